@@ -20,6 +20,8 @@
 
 #include "Module.h"
 
+class CompileCache;
+
 /// @brief 代码生成的一般类
 class CodeGenerator {
 
@@ -45,6 +47,15 @@ public:
         this->showLinearIR = show;
     }
 
+    ///
+    /// @brief 设置编译缓存，用于函数级的汇编代码复用
+    /// @param cache 编译缓存，为空或未开启时不使用缓存
+    ///
+    void setCompileCache(CompileCache * cache)
+    {
+        this->compileCache = cache;
+    }
+
 protected:
     /// @brief 代码产生器运行，结果保存到指定的文件中
     /// @param fp 输出内容所在文件的指针
@@ -63,4 +74,9 @@ protected:
     /// @brief 显示IR指令内容
     ///
     bool showLinearIR = false;
+
+    ///
+    /// @brief 编译缓存
+    ///
+    CompileCache * compileCache = nullptr;
 };
@@ -13,30 +13,140 @@
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// </table>
 ///
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include "CodeGenerator.h"
 #include "CodeGeneratorAsm.h"
 #include "Module.h"
 #include "Function.h"
+#include "GlobalVariable.h"
+#include "CompileCache.h"
+#include "Debug.h"
 
 /// @brief 构造函数
 CodeGeneratorAsm::CodeGeneratorAsm(Module * _module) : CodeGenerator(_module)
 {}
 
+/// @brief 函数汇编指令生成前的串行调整，默认不需要调整
+/// @param func 要处理的函数
+void CodeGeneratorAsm::adjustInsts(Function * func)
+{
+    (void) func;
+}
+
 /// @brief .text代码段，主要存放CPU指令，以函数为单位
 void CodeGeneratorAsm::genCodeSection()
 {
-    // 重新设置为0
-    labelIndex = 0;
-
-    // 遍历所有的函数，以函数为单位，产生指令
+    // 需要产生指令的函数，内置函数除外
+    std::vector<Function *> funcs;
     for (auto func: module->getFunctionList()) {
-
         if (!func->isBuiltin()) {
+            funcs.push_back(func);
+        }
+    }
+
+    // 每个函数的汇编代码单独存放，按源程序中函数的次序输出
+    std::vector<std::string> asmCodes(funcs.size());
+
+    // 函数级缓存的键以及需要产生指令的函数在funcs中的序号
+    std::vector<std::string> cacheKeys(funcs.size());
+    std::vector<size_t> pending;
+
+    if (compileCache && compileCache->isEnabled()) {
+
+        // 函数的汇编代码除了函数自身的IR外还依赖于全局变量的声明
+        std::string globals;
+        for (auto var: module->getGlobalVariables()) {
+            std::string str;
+            var->toDeclareString(str);
+            globals += str + "\n";
+        }
+
+        for (size_t k = 0; k < funcs.size(); ++k) {
+
+            // IR文本依赖于Value的名字，需要先命名
+            std::string irCode;
+            funcs[k]->renameIR();
+            funcs[k]->toString(irCode);
+
+            cacheKeys[k] = compileCache->makeKey("func", globals + irCode);
+
+            if (compileCache->load(cacheKeys[k], asmCodes[k])) {
+                minic_debug(DEBUG_CACHE, "function %s: hit\n", funcs[k]->getName().c_str());
+            } else {
+                minic_debug(DEBUG_CACHE, "function %s: miss\n", funcs[k]->getName().c_str());
+                pending.push_back(k);
+            }
+        }
+    } else {
+        for (size_t k = 0; k < funcs.size(); ++k) {
+            pending.push_back(k);
+        }
+    }
+
+    // 串行进行会影响其它函数的IR调整
+    for (auto k: pending) {
+        adjustInsts(funcs[k]);
+    }
+
+    // 前面的函数都已输出的函数立即按次序输出，并释放其汇编代码，不必等全部函数完成。
+    // 缓存命中的函数一开始即已完成
+    std::vector<bool> done(funcs.size(), true);
+    std::vector<bool> generated(funcs.size(), false);
+    for (auto k: pending) {
+        done[k] = false;
+    }
 
-            // 针对func产生汇编指令
-            genCodeSection(func);
+    std::mutex flushMutex;
+    size_t flushed = 0;
+    auto flush = [&]() {
+        while ((flushed < funcs.size()) && done[flushed]) {
+
+            // 新产生的函数汇编代码加入缓存
+            if (generated[flushed] && !cacheKeys[flushed].empty()) {
+                compileCache->save(cacheKeys[flushed], asmCodes[flushed]);
+            }
+
+            fwrite(asmCodes[flushed].data(), 1, asmCodes[flushed].size(), fp);
+            std::string().swap(asmCodes[flushed]);
+            flushed++;
+        }
+    };
+
+    // 工作线程每次领取一个未处理的函数，以函数为单位产生指令
+    std::atomic<size_t> nextFunc{0};
+    auto worker = [&]() {
+        for (size_t k = nextFunc++; k < pending.size(); k = nextFunc++) {
+            genCodeSection(funcs[pending[k]], asmCodes[pending[k]]);
+
+            std::lock_guard<std::mutex> lock(flushMutex);
+            done[pending[k]] = true;
+            generated[pending[k]] = true;
+            flush();
         }
+    };
+
+    // 线程数不超过CPU核数以及函数个数，当前线程也参与处理
+    size_t threadNum = std::max<size_t>(1, std::thread::hardware_concurrency());
+    threadNum = std::min(threadNum, pending.size());
+
+    std::vector<std::thread> threads;
+    for (size_t k = 1; k < threadNum; ++k) {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+
+    for (auto & thread: threads) {
+        thread.join();
     }
+
+    // 没有需要产生指令的函数时，缓存命中的函数在这里输出
+    flush();
 }
 
 /// @brief 产生汇编文件
@@ -55,3 +165,45 @@ bool CodeGeneratorAsm::run()
 
     return true;
 }
+
+/// @brief 产生全局变量的初值，非0元素用4字节的数据伪指令，连续的0合并为一条.zero伪指令
+/// @param var 全局变量
+/// @param size 变量的字节数
+/// @param wordDirective 4字节数据的伪指令，如.word、.long
+void CodeGeneratorAsm::genInitValues(GlobalVariable * var, int32_t size, const char * wordDirective)
+{
+    // 每行最多输出的元素个数
+    const int32_t valuesPerLine = 8;
+
+    auto & values = var->getInitValues();
+    int32_t count = (int32_t) values.size();
+    int32_t k = 0;
+
+    while (k < count) {
+
+        // 连续两个及以上的0合并，单个0与相邻的非0元素放在同一行
+        int32_t zeroEnd = k;
+        while ((zeroEnd < count) && (values[zeroEnd] == 0)) {
+            zeroEnd++;
+        }
+        if (zeroEnd - k >= 2) {
+            fprintf(fp, ".zero %d\n", (zeroEnd - k) * 4);
+            k = zeroEnd;
+            continue;
+        }
+
+        fprintf(fp, "%s ", wordDirective);
+        for (int32_t n = 0; (n < valuesPerLine) && (k < count); ++n, ++k) {
+            if ((n > 0) && (values[k] == 0) && (k + 1 < count) && (values[k + 1] == 0)) {
+                break;
+            }
+            fprintf(fp, n ? ", %d" : "%d", values[k]);
+        }
+        fprintf(fp, "\n");
+    }
+
+    // 末尾为0的元素没有记录，补足变量的大小
+    if (size > count * 4) {
+        fprintf(fp, ".zero %d\n", size - count * 4);
+    }
+}
@@ -13,8 +13,11 @@
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// </table>
 ///
+#pragma once
+
 #include <cstdio>
 #include <cstring>
+#include <string>
 
 #include "CodeGenerator.h"
 
@@ -38,9 +41,16 @@ public:
     /// @brief 全局变量Section，主要包含初始化的和未初始化过的
     virtual void genDataSection() = 0;
 
-    /// @brief 针对函数进行汇编指令生成，放到.text代码段中
+    /// @brief 函数汇编指令生成前的串行调整。凡是会修改跨函数共享Value（常量、全局变量、
+    /// 寄存器Value等）使用链的IR调整都放在这里，之后各函数的代码生成可以并行执行
+    /// @param func 要处理的函数
+    virtual void adjustInsts(Function * func);
+
+    /// @brief 针对函数进行汇编指令生成，结果追加到字符串中，最终按函数次序放到.text代码段中
+    /// 各函数在不同的线程中并行调用，只能访问函数自身的数据
     /// @param func 要处理的函数
-    virtual void genCodeSection(Function * func) = 0;
+    /// @param asmCode 函数的汇编代码
+    virtual void genCodeSection(Function * func, std::string & asmCode) = 0;
 
     /// @brief 寄存器分配
     /// @param func 要处理的函数
@@ -54,8 +64,9 @@ protected:
     /// @brief 汇编指令生成，放到.text代码段中
     void genCodeSection();
 
-    ///
-    /// @brief Label索引编号，要求文件级别的编号，而不是函数级别的编号
-    ///
-    int64_t labelIndex = 0;
+    /// @brief 产生全局变量的初值，非0元素用4字节的数据伪指令，连续的0合并为一条.zero伪指令
+    /// @param var 全局变量
+    /// @param size 变量的字节数
+    /// @param wordDirective 4字节数据的伪指令，如.word、.long
+    void genInitValues(GlobalVariable * var, int32_t size, const char * wordDirective);
 };
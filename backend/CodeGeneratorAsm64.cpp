@@ -0,0 +1,270 @@
+///
+/// @file CodeGeneratorAsm64.cpp
+/// @brief 64位平台（ARM64、RISC-V64、x86-64）汇编代码生成器的共同类的实现
+/// @version 1.0
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-17 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "CodeGeneratorAsm64.h"
+#include "Function.h"
+#include "Module.h"
+#include "LabelInstruction.h"
+#include "LocalVariable.h"
+#include "OutputStream.h"
+#include "TimeReport.h"
+#include "Debug.h"
+#include "StackSlotColoring.h"
+
+/// @brief 构造函数
+/// @param _module 符号表
+/// @param _target 平台信息
+CodeGeneratorAsm64::CodeGeneratorAsm64(Module * _module, const TargetInfo & _target)
+    : CodeGeneratorAsm(_module), target(_target)
+{}
+
+/// @brief 全局变量Section，主要包含初始化的和未初始化过的
+void CodeGeneratorAsm64::genDataSection()
+{
+    // 生成代码段
+    fprintf(fp, ".text\n");
+
+    // 只读的全局变量放在.rodata段，有非0初值的放在.data段，其余放在BSS段
+    for (auto var: module->getGlobalVariables()) {
+
+        if (var->isInBSSSection() && !var->isReadOnly()) {
+
+            // 在BSS段的全局变量，可以包含初值全是0的变量
+            fprintf(fp,
+                    ".comm %s, %d, %d\n",
+                    var->getName().c_str(),
+                    target.typeSize(var->getType()),
+                    var->getAlignment());
+        } else {
+
+            // 有初值或只读的全局变量，连续的0用.zero输出
+            fprintf(fp, "%s %s\n", target.globalDirective, var->getName().c_str());
+            fprintf(fp, "%s\n", var->isReadOnly() ? ".section .rodata" : ".data");
+            fprintf(fp, "%s %d\n", target.alignDirective, var->getAlignment());
+            fprintf(fp, ".type %s, %sobject\n", var->getName().c_str(), target.symbolTypePrefix);
+            fprintf(fp, ".size %s, %d\n", var->getName().c_str(), target.typeSize(var->getType()));
+            fprintf(fp, "%s:\n", var->getName().c_str());
+            genInitValues(var, target.typeSize(var->getType()), target.wordDirective);
+            fprintf(fp, ".text\n");
+        }
+    }
+}
+
+/// @brief 栈内变量地址的汇编写法，默认为16(sp)的形式
+/// @param baseRegId 基址寄存器编号
+/// @param offset 偏移
+/// @return 地址的字符串
+std::string CodeGeneratorAsm64::memoryOperandStr(int32_t baseRegId, int64_t offset)
+{
+    return std::to_string(offset) + "(" + target.regName[baseRegId] + ")";
+}
+
+///
+/// @brief 获取IR变量相关信息字符串
+/// @param val IR变量
+/// @param str 追加的字符串
+///
+void CodeGeneratorAsm64::getIRValueStr(Value * val, std::string & str)
+{
+    std::string name = val->getName();
+    std::string IRName = val->getIRName();
+    int32_t regId = val->getRegId();
+    int32_t baseRegId;
+    int64_t offset;
+    std::string showName;
+
+    if ((!name.empty()) && (!IRName.empty())) {
+        showName = name + ":" + IRName;
+    } else {
+        showName = IRName;
+    }
+
+    if (regId != -1) {
+        // 寄存器
+        str += std::string("\t") + target.commentPrefix + " " + showName + ":" + target.regName[regId];
+    } else if (val->getMemoryAddr(&baseRegId, &offset)) {
+        // 栈内寻址
+        str += std::string("\t") + target.commentPrefix + " " + showName + ":" + memoryOperandStr(baseRegId, offset);
+    }
+}
+
+/// @brief 针对函数进行汇编指令生成，放到.text代码段中
+/// @param func 要处理的函数
+/// @param asmCode 函数的汇编代码
+void CodeGeneratorAsm64::genCodeSection(Function * func, std::string & asmCode)
+{
+    // 寄存器分配以及栈内局部变量的站内地址重新分配
+    {
+        TimeScope scope("registerAllocation", func->getName());
+        registerAllocation(func);
+    }
+
+    // Label采用函数内编号并加函数名前缀的方式，各函数可独立编号，指令选择时才生成名字
+    int32_t labelIndex = 0;
+    for (auto inst: func->getInterCode().getInsts()) {
+        if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
+            static_cast<LabelInstruction *>(inst)->setAsmIndex(labelIndex++);
+        }
+    }
+
+    // 指令选择可能新建栈内变量，注释要在其后输出
+    std::string insts;
+    selectInsts(func, insts);
+
+    TimeScope scope("emit", func->getName());
+
+    // ILOC代码输出为汇编代码
+    OutputStream os(asmCode);
+
+    os << target.alignDirective << ' ' << std::max(target.minFuncAlign, func->getAlignment()) << '\n';
+    os << target.globalDirective << ' ' << func->getName() << '\n';
+    os << ".type " << func->getName() << ", " << target.symbolTypePrefix << "function\n";
+    os << func->getName() << ":\n";
+
+    // 开启时输出IR指令作为注释
+    if (this->showLinearIR) {
+
+        // 输出有关局部变量与临时变量的注释，便于查找问题
+        std::string str;
+        for (auto localVar: func->getVarValues()) {
+            str.clear();
+            getIRValueStr(localVar, str);
+            if (!str.empty()) {
+                os << str << '\n';
+            }
+        }
+
+        for (auto inst: func->getInterCode().getInsts()) {
+            if (inst->hasResultValue()) {
+                str.clear();
+                getIRValueStr(inst, str);
+                if (!str.empty()) {
+                    os << str << '\n';
+                }
+            }
+        }
+    }
+
+    os << insts;
+
+    os << ".size " << func->getName() << ", .-" << func->getName() << '\n';
+}
+
+/// @brief 寄存器分配前对形参指令调整，栈传递的形参通过FP寻址
+/// @param func 要处理的函数
+void CodeGeneratorAsm64::adjustFormalParamInsts(Function * func)
+{
+    auto & params = func->getParams();
+
+    // 寄存器传递的形参在入口保存到栈中，已在stackAlloc中分配
+    // 其余的形参由调用者从sp开始依次存放，每个8字节
+    int64_t fp_esp = stackParamOffset(func);
+    for (int k = target.maxArgRegNum; k < (int) params.size(); k++) {
+
+        params[k]->setMemoryAddr(target.fpRegNo, fp_esp);
+
+        fp_esp += 8;
+    }
+}
+
+/// @brief 栈空间分配
+/// @param func 要处理的函数
+void CodeGeneratorAsm64::stackAlloc(Function * func)
+{
+    // 栈帧空间（低地址在前，高地址在后）
+    // --------------------- sp
+    // 实参栈传递的空间（排除寄存器传递的实参空间）
+    // ---------------------
+    // 寄存器传递的形参的保存空间
+    // ---------------------
+    // 需要保存在栈中的局部变量或临时变量
+    // ---------------------
+    // 入口处保存的寄存器与返回地址，FP的位置由各平台决定
+    // ---------------------
+    // 栈传递的形参
+    // ---------------------
+
+    // 栈帧大小确定后统一改为SP+非负偏移寻址
+    StackSlotColoring coloring(func);
+
+    for (auto var: func->getVarValues()) {
+
+        if ((var->getRegId() == -1) && (!var->getMemoryAddr())) {
+
+            // 指针为8字节，其它按照4字节的大小整数倍分配
+            int32_t size = (target.typeSize(var->getType()) + 3) & ~3;
+
+            coloring.addObject(var, size, target.typeAlignment(var->getType()));
+        }
+    }
+
+    for (auto inst: func->getInterCode().getInsts()) {
+
+        if (inst->hasResultValue() && (inst->getRegId() == -1)) {
+
+            int32_t size = (target.typeSize(inst->getType()) + 3) & ~3;
+
+            coloring.addObject(inst, size, target.typeAlignment(inst->getType()));
+        }
+    }
+
+    int32_t fp_esp = coloring.run();
+
+    // 寄存器传递的形参在入口处就要保存，不参与栈槽共享，每个8字节
+    auto & params = func->getParams();
+    std::vector<int32_t> paramOffsets;
+    for (int k = 0; k < (int) params.size() && k < target.maxArgRegNum; k++) {
+        fp_esp = (fp_esp + 8 + 7) & ~7;
+        paramOffsets.push_back(fp_esp);
+    }
+
+    // 通过栈传递的实参，前maxArgRegNum个通过寄存器传递
+    int maxFuncCallArgCnt = func->getMaxFuncCallArgCnt();
+    if (maxFuncCallArgCnt > target.maxArgRegNum) {
+        fp_esp += (maxFuncCallArgCnt - target.maxArgRegNum) * 8;
+    }
+
+    // 栈帧大小按16字节对齐，保证SP以及函数调用时SP的16字节对齐
+    int32_t frameSize = (fp_esp + 15) & ~15;
+
+    for (auto & obj: coloring.getObjects()) {
+
+        if (auto var = dynamic_cast<LocalVariable *>(obj.val)) {
+            var->setMemoryAddr(target.spRegNo, frameSize - obj.offset);
+        } else if (auto inst = dynamic_cast<Instruction *>(obj.val)) {
+            inst->setMemoryAddr(target.spRegNo, frameSize - obj.offset);
+        }
+
+        // 记录活跃区间，栈内偏移检查时共享栈槽的变量不算冲突
+        func->setStackLiveRange(obj.val, obj.start, obj.end);
+    }
+
+    for (size_t k = 0; k < paramOffsets.size(); k++) {
+        params[k]->setMemoryAddr(target.spRegNo, frameSize - paramOffsets[k]);
+    }
+
+    minic_debug(DEBUG_STACK_LAYOUT,
+                "Function %s: frame size %d -> %d bytes (%d stack objects)\n",
+                func->getName().c_str(),
+                coloring.getUnsharedSize(),
+                frameSize,
+                (int) coloring.getObjects().size());
+
+    // 设置函数的最大栈帧深度，没有考虑入口处保存的寄存器与返回地址的空间
+    func->setMaxDep(frameSize);
+}
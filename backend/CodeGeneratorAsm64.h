@@ -0,0 +1,120 @@
+///
+/// @file CodeGeneratorAsm64.h
+/// @brief 64位平台（ARM64、RISC-V64、x86-64）汇编代码生成器的共同类
+/// @version 1.0
+/// @date 2026-10-17
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-17 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "CodeGeneratorAsm.h"
+
+class Type;
+
+/// @brief 64位平台的汇编代码生成器共同类。全局变量、栈帧分配以及函数的汇编输出由本类完成，
+/// 各平台只提供汇编伪指令、寄存器以及指令选择等与指令集相关的部分
+class CodeGeneratorAsm64 : public CodeGeneratorAsm {
+
+public:
+    /// @brief 平台相关的汇编伪指令、寄存器与类型信息
+    struct TargetInfo {
+
+        /// @brief 导出符号的伪指令，如.global、.globl
+        const char * globalDirective;
+
+        /// @brief 对齐伪指令，如.align、.balign
+        const char * alignDirective;
+
+        /// @brief .type伪指令中符号类型的前缀，如%、@
+        const char * symbolTypePrefix;
+
+        /// @brief 4字节数据的伪指令，如.word、.long
+        const char * wordDirective;
+
+        /// @brief 汇编注释的开始，如//、#
+        const char * commentPrefix;
+
+        /// @brief 函数入口对齐伪指令的最小值
+        int32_t minFuncAlign;
+
+        /// @brief 通过寄存器传递的参数个数
+        int32_t maxArgRegNum;
+
+        /// @brief 栈指针寄存器编号
+        int32_t spRegNo;
+
+        /// @brief 帧指针寄存器编号
+        int32_t fpRegNo;
+
+        /// @brief 寄存器的名字，按寄存器编号索引
+        const std::string * regName;
+
+        /// @brief 类型在栈内或数据段中占用的字节数
+        int32_t (*typeSize)(Type * type);
+
+        /// @brief 类型的对齐字节数
+        int32_t (*typeAlignment)(Type * type);
+    };
+
+    /// @brief 构造函数
+    /// @param module 符号表
+    /// @param target 平台信息
+    CodeGeneratorAsm64(Module * module, const TargetInfo & target);
+
+    /// @brief 析构函数
+    ~CodeGeneratorAsm64() override = default;
+
+protected:
+    /// @brief 全局变量Section，主要包含初始化的和未初始化过的
+    void genDataSection() override;
+
+    /// @brief 针对函数进行汇编指令生成，放到.text代码段中
+    /// @param func 要处理的函数
+    /// @param asmCode 函数的汇编代码
+    void genCodeSection(Function * func, std::string & asmCode) override;
+
+    /// @brief 对函数进行指令选择，产生函数体的汇编指令
+    /// @param func 要处理的函数，已完成寄存器分配
+    /// @param insts 函数体的汇编指令
+    virtual void selectInsts(Function * func, std::string & insts) = 0;
+
+    /// @brief 第一个栈传递的形参相对于FP的偏移，取决于入口处保存的寄存器以及返回地址的位置
+    /// @param func 要处理的函数
+    /// @return 偏移
+    virtual int64_t stackParamOffset(Function * func) = 0;
+
+    /// @brief 栈内变量地址的汇编写法，用于注释
+    /// @param baseRegId 基址寄存器编号
+    /// @param offset 偏移
+    /// @return 地址的字符串
+    virtual std::string memoryOperandStr(int32_t baseRegId, int64_t offset);
+
+    /// @brief 栈空间分配
+    /// @param func 要处理的函数
+    void stackAlloc(Function * func);
+
+    /// @brief 寄存器分配前对形参指令调整，栈传递的形参通过FP寻址
+    /// @param func 要处理的函数
+    void adjustFormalParamInsts(Function * func);
+
+    ///
+    /// @brief 获取IR变量相关信息字符串
+    /// @param val IR变量
+    /// @param str 追加的字符串
+    ///
+    void getIRValueStr(Value * val, std::string & str);
+
+protected:
+    /// @brief 平台信息
+    const TargetInfo & target;
+};
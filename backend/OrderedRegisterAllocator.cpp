@@ -0,0 +1,170 @@
+///
+/// @file OrderedRegisterAllocator.cpp
+/// @brief 按平台给定的分配次序查找空闲寄存器的简单或朴素的寄存器分配器，x86-64、ARM64与RISC-V64共用
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <algorithm>
+#include "OrderedRegisterAllocator.h"
+
+///
+/// @brief Construct a new Simple Register Allocator object
+/// @param order 可分配的寄存器编号，按分配时的查找次序排列，一般先临时寄存器后传参寄存器
+/// @param orderNum 可分配的寄存器个数
+///
+OrderedRegisterAllocator::OrderedRegisterAllocator(const int32_t * order, int32_t orderNum)
+    : allocOrder(order), allocOrderNum(orderNum)
+{}
+
+///
+/// @brief 分配一个寄存器。如果没有，则选取寄存器中最晚使用的寄存器，同时溢出寄存器到变量中
+/// @return int 寄存器编号
+/// @param no 指定的寄存器编号
+///
+int OrderedRegisterAllocator::Allocate(Value * var, int32_t no)
+{
+    if (var) {
+        auto pIter = findValue(var);
+        if (pIter != regValues.end()) {
+            // 该变量已经分配了Load寄存器了，不需要再次分配
+            return pIter->second;
+        }
+    }
+
+    int32_t regno = -1;
+
+    // 尝试指定的寄存器是否可用
+    if ((no != -1) && !regBitmap.test(no)) {
+
+        // 可用
+        regno = no;
+    } else {
+
+        // 按平台给定的次序查询空闲的寄存器，尽量不占用传参的寄存器
+        for (int k = 0; k < allocOrderNum; ++k) {
+
+            int32_t candidate = allocOrder[k];
+            if (!regBitmap.test(candidate)) {
+
+                // 找到空闲寄存器
+                regno = candidate;
+                break;
+            }
+        }
+    }
+
+    if (regno != -1) {
+
+        // 找到空闲的寄存器
+
+        // 占用
+        bitmapSet(regno);
+
+    } else {
+
+        // 没有可用的寄存器分配，需要溢出一个变量的寄存器
+
+        // 溢出的策略：选择最迟加入队列的变量，获取其Load寄存器编号
+        regno = regValues.front().second;
+
+        // 从队列中删除，该变量不再占用寄存器
+        regValues.erase(regValues.begin());
+    }
+
+    if (var) {
+        // 加入新的变量
+        regValues.emplace_back(var, regno);
+    }
+
+    return regno;
+}
+
+///
+/// @brief 强制占用一个指定的寄存器。如果寄存器被占用，则强制寄存器关联的变量溢出
+/// @param no 要分配的寄存器编号
+///
+void OrderedRegisterAllocator::Allocate(int32_t no)
+{
+    if (regBitmap.test(no)) {
+
+        // 指定的寄存器已经被占用
+
+        // 释放该寄存器
+        free(no);
+    }
+
+    // 占用该寄存器
+    bitmapSet(no);
+}
+
+///
+/// @brief 将变量对应的load寄存器标记为空闲状态
+/// @param var 变量
+///
+void OrderedRegisterAllocator::free(Value * var)
+{
+    if (!var) {
+        return;
+    }
+
+    auto pIter = findValue(var);
+    if (pIter != regValues.end()) {
+
+        // 清除该索引的寄存器，变得可使用
+        regBitmap.reset(pIter->second);
+        regValues.erase(pIter);
+    }
+}
+
+///
+/// @brief 将寄存器no标记为空闲状态
+/// @param no 寄存器编号
+///
+void OrderedRegisterAllocator::free(int32_t no)
+{
+    // 无效寄存器，什么都不做，直接返回
+    if (no == -1) {
+        return;
+    }
+
+    // 清除该索引的寄存器，变得可使用
+    regBitmap.reset(no);
+
+    // 查找寄存器编号
+    auto pIter = std::find_if(regValues.begin(), regValues.end(), [=](auto & item) {
+        return item.second == no; // 存器编号与 no 匹配
+    });
+
+    if (pIter != regValues.end()) {
+        // 查找到，则清除
+        regValues.erase(pIter);
+    }
+}
+
+///
+/// @brief 寄存器被置位，使用过的寄存器被置位
+/// @param no
+///
+void OrderedRegisterAllocator::bitmapSet(int32_t no)
+{
+    regBitmap.set(no);
+    usedBitmap.set(no);
+}
+
+///
+/// @brief 查找变量占用的Load寄存器记录
+/// @param var 变量
+/// @return 找到时为对应的迭代器，否则为regValues.end()
+///
+std::vector<std::pair<Value *, int32_t>>::iterator OrderedRegisterAllocator::findValue(Value * var)
+{
+    return std::find_if(regValues.begin(), regValues.end(), [=](auto & item) { return item.first == var; });
+}
@@ -0,0 +1,105 @@
+///
+/// @file OrderedRegisterAllocator.h
+/// @brief 按平台给定的分配次序查找空闲寄存器的简单或朴素的寄存器分配器，x86-64、ARM64与RISC-V64共用
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "BitMap.h"
+#include "Value.h"
+
+class OrderedRegisterAllocator {
+
+public:
+    /// @brief 支持的寄存器编号的个数
+    static const int maxRegNum = 32;
+
+    ///
+    /// @brief Construct a new Simple Register Allocator object
+    /// @param order 可分配的寄存器编号，按分配时的查找次序排列，一般先临时寄存器后传参寄存器
+    /// @param orderNum 可分配的寄存器个数
+    ///
+    OrderedRegisterAllocator(const int32_t * order, int32_t orderNum);
+
+    ///
+    /// @brief 尝试按指定的寄存器编号进行分配，若能分配，则直接分配，否则按分配次序分配一个寄存器。
+    /// 如果没有，则选取寄存器中最晚使用的寄存器，同时溢出寄存器到变量中
+    /// @param var 分配寄存器的变量
+    /// @param no 指定的寄存器编号
+    /// @return int 寄存器编号
+    ///
+    int Allocate(Value * var = nullptr, int32_t no = -1);
+
+    ///
+    /// @brief 强制占用一个指定的寄存器。如果寄存器被占用，则强制寄存器关联的变量溢出
+    /// @param no 要分配的寄存器编号
+    ///
+    void Allocate(int32_t no);
+
+    ///
+    /// @brief 将变量对应的load寄存器标记为空闲状态
+    /// @param var 变量
+    ///
+    void free(Value * var);
+
+    ///
+    /// @brief 将寄存器no标记为空闲状态
+    /// @param no 寄存器编号
+    ///
+    void free(int32_t);
+
+protected:
+    ///
+    /// @brief 寄存器被置位，使用过的寄存器被置位
+    /// @param no
+    ///
+    void bitmapSet(int32_t no);
+
+    ///
+    /// @brief 查找变量占用的Load寄存器记录
+    /// @param var 变量
+    /// @return 找到时为对应的迭代器，否则为regValues.end()
+    ///
+    std::vector<std::pair<Value *, int32_t>>::iterator findValue(Value * var);
+
+protected:
+    ///
+    /// @brief 可分配的寄存器编号，按分配时的查找次序排列
+    ///
+    const int32_t * allocOrder;
+
+    ///
+    /// @brief 可分配的寄存器个数
+    ///
+    int32_t allocOrderNum;
+
+    ///
+    /// @brief 寄存器位图：1已被占用，0未被使用
+    ///
+    BitMap<maxRegNum> regBitmap;
+
+    ///
+    /// @brief 寄存器被那个Value占用。按照时间次序加入
+    /// 寄存器编号记录在分配器内，而不是写回Value，
+    /// 这样常量、全局变量等跨函数共享的Value在多个函数并行指令选择时互不干扰
+    ///
+    std::vector<std::pair<Value *, int32_t>> regValues;
+
+    ///
+    /// @brief 使用过的所有寄存器编号
+    ///
+    BitMap<maxRegNum> usedBitmap;
+};
@@ -0,0 +1,277 @@
+///
+/// @file StackSlotColoring.cpp
+/// @brief 基于活跃区间的栈槽共享（栈槽着色）的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <map>
+#include <queue>
+#include <unordered_map>
+
+#include "StackSlotColoring.h"
+#include "GotoInstruction.h"
+#include "MoveInstruction.h"
+#include "PointerType.h"
+
+/// @brief 构造函数
+/// @param _func 要处理的函数
+StackSlotColoring::StackSlotColoring(Function * _func) : func(_func)
+{}
+
+/// @brief 加入需要栈内分配的对象
+/// @param val 变量或指令
+/// @param size 字节数
+/// @param align 对齐字节数
+/// @param liveAtEntry 是否在函数入口处写入，活跃区间从第一条指令开始
+void StackSlotColoring::addObject(Value * val, int32_t size, int32_t align, bool liveAtEntry)
+{
+    StackObject obj;
+    obj.val = val;
+    obj.size = size;
+    obj.align = align;
+    obj.liveAtEntry = liveAtEntry;
+
+    objects.push_back(obj);
+
+    // 原来的分配方式：逐个对象依次往低地址分配
+    unsharedSize = (unsharedSize + size + align - 1) / align * align;
+}
+
+/// @brief 计算类型在栈内的对齐要求
+/// @param type 类型
+/// @return 对齐字节数
+int32_t StackSlotColoring::getAlignment(Type * type)
+{
+    // 32位平台最小按4字节对齐，最大按8字节对齐
+    return std::min(8, std::max(4, type->getAlignment()));
+}
+
+/// @brief 计算活跃区间并分配栈槽
+/// @return 分配的栈空间大小
+int32_t StackSlotColoring::run()
+{
+    computeLiveRanges();
+
+    return assignSlots();
+}
+
+/// @brief 根据指令序列计算各对象的活跃区间
+void StackSlotColoring::computeLiveRanges()
+{
+    std::vector<Instruction *> & insts = func->getInterCode().getInsts();
+
+    std::unordered_map<Value *, size_t> objIndex;
+    for (size_t k = 0; k < objects.size(); ++k) {
+        objIndex[objects[k].val] = k;
+    }
+
+    // Label指令在指令序列中的位置
+    std::unordered_map<Instruction *, int32_t> labelPos;
+    for (int32_t pos = 0; pos < (int32_t) insts.size(); ++pos) {
+        if (insts[pos]->getOp() == IRInstOperator::IRINST_OP_LABEL) {
+            labelPos[insts[pos]] = pos;
+        }
+    }
+
+    // 数组经地址计算后得到的值，记录其来源的数组，使用这些值时数组也要活跃
+    std::unordered_map<Value *, std::vector<Value *>> arrayRoots;
+
+    auto occur = [&](Value * val, int32_t pos) {
+        auto pIter = objIndex.find(val);
+        if (pIter != objIndex.end()) {
+            StackObject & obj = objects[pIter->second];
+            if (obj.start == -1) {
+                obj.start = pos;
+            }
+            obj.end = pos;
+        }
+    };
+
+    auto use = [&](Value * val, int32_t pos) {
+        occur(val, pos);
+
+        auto pIter = arrayRoots.find(val);
+        if (pIter != arrayRoots.end()) {
+            for (auto root: pIter->second) {
+                occur(root, pos);
+            }
+        }
+    };
+
+    // 循环范围，也就是向后跳转的目标到跳转指令之间的范围
+    std::vector<std::pair<int32_t, int32_t>> loops;
+
+    for (int32_t pos = 0; pos < (int32_t) insts.size(); ++pos) {
+
+        Instruction * inst = insts[pos];
+
+        // 传递数组来源，指针读写指令的结果是数组元素的值，不再是地址
+        std::vector<Value *> roots;
+        bool isPointerAccess = false;
+        if (Instanceof(moveInst, MoveInstruction *, inst)) {
+            isPointerAccess = moveInst->getIsPointerLoad() || moveInst->getIsPointerStore();
+        }
+
+        if ((!isPointerAccess) && (inst->getOp() != IRInstOperator::IRINST_OP_FUNC_CALL)) {
+            int32_t first = (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) ? 1 : 0;
+            for (int32_t k = first; k < inst->getOperandsNum(); ++k) {
+                Value * operand = inst->getOperand(k);
+                if (operand->getType()->isArrayType()) {
+                    roots.push_back(operand);
+                }
+                auto pIter = arrayRoots.find(operand);
+                if (pIter != arrayRoots.end()) {
+                    roots.insert(roots.end(), pIter->second.begin(), pIter->second.end());
+                }
+            }
+        }
+
+        if (!roots.empty()) {
+            // 赋值指令的结果为第一个操作数，其它指令的结果为指令自身
+            Value * result = (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) ? inst->getOperand(0) : inst;
+            auto & resultRoots = arrayRoots[result];
+            for (auto root: roots) {
+                if (std::find(resultRoots.begin(), resultRoots.end(), root) == resultRoots.end()) {
+                    resultRoots.push_back(root);
+                }
+            }
+        }
+
+        for (int32_t k = 0; k < inst->getOperandsNum(); ++k) {
+            use(inst->getOperand(k), pos);
+        }
+
+        if (inst->hasResultValue()) {
+            use(inst, pos);
+        }
+
+        if (inst->getOp() == IRInstOperator::IRINST_OP_GOTO) {
+            Instanceof(gotoInst, GotoInstruction *, inst);
+
+            for (Instruction * target: {(Instruction *) gotoInst->getTarget(), (Instruction *) gotoInst->getFalseTarget()}) {
+                if (target) {
+                    auto pIter = labelPos.find(target);
+                    if ((pIter != labelPos.end()) && (pIter->second <= pos)) {
+                        loops.emplace_back(pIter->second, pos);
+                    }
+                }
+            }
+        }
+    }
+
+    // 没有被指令使用的对象仍然分配栈槽，活跃区间取第一条指令，便于与其它对象共享
+    for (auto & obj: objects) {
+        if (obj.start == -1) {
+            obj.start = 0;
+            obj.end = 0;
+        }
+
+        // 在函数入口处写入的对象，从入口到第一次使用之间也不能与其它对象共享
+        if (obj.liveAtEntry) {
+            obj.start = 0;
+        }
+    }
+
+    if (loops.empty()) {
+        return;
+    }
+
+    // 相交的循环范围合并。与合并后的范围相交的活跃区间需要覆盖整个范围，
+    // 因为值可能经过循环的回边从范围的后部流到前部
+    std::sort(loops.begin(), loops.end());
+
+    std::vector<std::pair<int32_t, int32_t>> regions;
+    for (auto & loop: loops) {
+        if ((!regions.empty()) && (loop.first <= regions.back().second)) {
+            regions.back().second = std::max(regions.back().second, loop.second);
+        } else {
+            regions.push_back(loop);
+        }
+    }
+
+    for (auto & obj: objects) {
+
+        // 合并后的范围互不相交且有序，扩展后可能与后面的范围相交，因此按次序检查一遍即可
+        for (auto & region: regions) {
+            if ((obj.start <= region.second) && (region.first <= obj.end)) {
+                obj.start = std::min(obj.start, region.first);
+                obj.end = std::max(obj.end, region.second);
+            }
+        }
+    }
+}
+
+/// @brief 按活跃区间分配栈槽
+/// @return 分配的栈空间大小
+int32_t StackSlotColoring::assignSlots()
+{
+    // 按活跃区间的开始位置依次分配，同时开始时大的对象先分配
+    std::vector<StackObject *> order;
+    for (auto & obj: objects) {
+        order.push_back(&obj);
+    }
+
+    std::sort(order.begin(), order.end(), [](StackObject * a, StackObject * b) {
+        if (a->start != b->start) {
+            return a->start < b->start;
+        }
+        return a->size > b->size;
+    });
+
+    // 空闲栈槽，按大小索引，值为栈槽偏移
+    std::multimap<int32_t, int32_t> freeSlots;
+
+    // 正在使用的栈槽，按活跃区间的结束位置排序
+    struct ActiveSlot {
+        int32_t end;
+        int32_t size;
+        int32_t offset;
+        bool operator>(const ActiveSlot & other) const
+        {
+            return end > other.end;
+        }
+    };
+    std::priority_queue<ActiveSlot, std::vector<ActiveSlot>, std::greater<ActiveSlot>> active;
+
+    int32_t frameSize = 0;
+
+    for (auto obj: order) {
+
+        // 活跃区间已结束的对象释放栈槽
+        while ((!active.empty()) && (active.top().end < obj->start)) {
+            freeSlots.emplace(active.top().size, active.top().offset);
+            active.pop();
+        }
+
+        // 选择满足大小与对齐要求的最小空闲栈槽
+        auto pIter = freeSlots.lower_bound(obj->size);
+        while ((pIter != freeSlots.end()) && (pIter->second % obj->align != 0)) {
+            ++pIter;
+        }
+
+        int32_t slotSize;
+        if (pIter != freeSlots.end()) {
+            slotSize = pIter->first;
+            obj->offset = pIter->second;
+            freeSlots.erase(pIter);
+        } else {
+            // 没有可用的栈槽，则在栈帧的低地址新建
+            slotSize = obj->size;
+            frameSize = (frameSize + obj->size + obj->align - 1) / obj->align * obj->align;
+            obj->offset = frameSize;
+        }
+
+        active.push({obj->end, slotSize, obj->offset});
+    }
+
+    return frameSize;
+}
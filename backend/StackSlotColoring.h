@@ -0,0 +1,126 @@
+///
+/// @file StackSlotColoring.h
+/// @brief 基于活跃区间的栈槽共享（栈槽着色），用于减小函数栈帧
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Function.h"
+
+///
+/// @brief 栈槽着色。对需要栈内空间的局部变量与临时变量计算线性指令序列上的活跃区间，
+/// 活跃区间不相交的对象共享同一个栈槽，栈槽按对齐要求分配。
+///
+/// 活跃区间为对象在指令序列中首次出现到最后一次出现的范围，遇到向后跳转（循环）时，
+/// 与循环范围相交的区间扩展到整个循环；数组经地址计算得到的指针被使用时，数组同样视为活跃。
+///
+class StackSlotColoring {
+
+public:
+    ///
+    /// @brief 栈内对象
+    ///
+    struct StackObject {
+
+        /// @brief 对应的变量或指令
+        Value * val;
+
+        /// @brief 占用的字节数
+        int32_t size;
+
+        /// @brief 对齐字节数
+        int32_t align;
+
+        /// @brief 活跃区间的开始指令序号，-1表示还没有计算
+        int32_t start = -1;
+
+        /// @brief 活跃区间的结束指令序号
+        int32_t end = -1;
+
+        /// @brief 分配的栈内偏移，对象的地址为fp - offset
+        int32_t offset = 0;
+
+        /// @brief 是否在函数入口处写入，如通过寄存器传递后保存到栈内的形参
+        bool liveAtEntry = false;
+    };
+
+    ///
+    /// @brief 构造函数
+    /// @param func 要处理的函数
+    ///
+    explicit StackSlotColoring(Function * func);
+
+    ///
+    /// @brief 加入需要栈内分配的对象
+    /// @param val 变量或指令
+    /// @param size 字节数
+    /// @param align 对齐字节数
+    /// @param liveAtEntry 是否在函数入口处写入，活跃区间从第一条指令开始
+    ///
+    void addObject(Value * val, int32_t size, int32_t align, bool liveAtEntry = false);
+
+    ///
+    /// @brief 计算活跃区间并分配栈槽
+    /// @return 分配的栈空间大小
+    ///
+    int32_t run();
+
+    ///
+    /// @brief 获取栈内对象，run之后offset有效
+    /// @return 栈内对象
+    ///
+    std::vector<StackObject> & getObjects()
+    {
+        return objects;
+    }
+
+    ///
+    /// @brief 不共享栈槽时需要的栈空间大小，用于对比
+    /// @return 栈空间大小
+    ///
+    int32_t getUnsharedSize() const
+    {
+        return unsharedSize;
+    }
+
+    ///
+    /// @brief 计算类型在栈内的对齐要求
+    /// @param type 类型
+    /// @return 对齐字节数
+    ///
+    static int32_t getAlignment(Type * type);
+
+protected:
+    ///
+    /// @brief 根据指令序列计算各对象的活跃区间
+    ///
+    void computeLiveRanges();
+
+    ///
+    /// @brief 按活跃区间分配栈槽
+    /// @return 分配的栈空间大小
+    ///
+    int32_t assignSlots();
+
+private:
+    /// @brief 要处理的函数
+    Function * func;
+
+    /// @brief 需要栈内分配的对象
+    std::vector<StackObject> objects;
+
+    /// @brief 不共享栈槽时需要的栈空间大小
+    int32_t unsharedSize = 0;
+};
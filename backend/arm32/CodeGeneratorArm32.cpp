@@ -13,6 +13,7 @@
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// </table>
 ///
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 #include <string>
@@ -29,7 +30,17 @@
 #include "RegVariable.h"
 #include "FuncCallInstruction.h"
 #include "ArgInstruction.h"
+#include "LabelInstruction.h"
 #include "MoveInstruction.h"
+#include "TimeReport.h"
+#include "Debug.h"
+#include "StackSlotColoring.h"
+#include "ElfObjectArm32.h"
+#include "Thumb2Arm32.h"
+#include "IfConversionArm32.h"
+#include "LoopVectorizerArm32.h"
+#include "IRConstant.h"
+#include "Common.h"
 
 /// @brief 构造函数
 /// @param tab 符号表
@@ -44,8 +55,66 @@ CodeGeneratorArm32::~CodeGeneratorArm32()
 void CodeGeneratorArm32::genHeader()
 {
     fprintf(fp, "%s\n", ".arch armv7ve");
-    fprintf(fp, "%s\n", ".arm");
-    fprintf(fp, "%s\n", ".fpu vfpv4");
+    if (thumb) {
+        // Thumb-2只能使用统一汇编语法，条件执行的指令需要IT指令
+        fprintf(fp, "%s\n", ".syntax unified");
+        fprintf(fp, "%s\n", ".thumb");
+    } else {
+        fprintf(fp, "%s\n", ".arm");
+    }
+    // 循环向量化使用NEON指令
+    fprintf(fp, "%s\n", ".fpu neon-vfpv4");
+}
+
+/// @brief 产生汇编文件或目标文件，目标文件不需要再经过汇编器处理
+/// @return true:成功，false:失败
+bool CodeGeneratorArm32::run()
+{
+    if (!emitObject) {
+
+        bool result = CodeGeneratorAsm::run();
+
+        if (thumb && (armCodeSize > 0)) {
+            minic_debug(DEBUG_CODE_SIZE,
+                        "total: A32 %d bytes -> Thumb-2 %d bytes (%.1f%% smaller)\n",
+                        (int) armCodeSize,
+                        (int) thumbCodeSize,
+                        100.0 * (armCodeSize - thumbCodeSize) / armCodeSize);
+        }
+
+        return result;
+    }
+
+    // 函数级缓存保存的是汇编代码，产生目标文件时不使用
+    compileCache = nullptr;
+
+    // 各函数并行产生机器码
+    CodeGeneratorAsm::genCodeSection();
+    if (encodeFailed) {
+        return false;
+    }
+
+    TimeScope scope("writeObject");
+
+    ElfObjectArm32 object;
+
+    for (auto var: module->getGlobalVariables()) {
+        object.addVariable(var->getName(),
+                           var->getType()->getSize(),
+                           var->getAlignment(),
+                           var->getInitValues(),
+                           var->isInBSSSection(),
+                           var->isReadOnly());
+    }
+
+    // 函数按源程序中的次序放置，.align n按2的n次方字节对齐
+    for (auto func: module->getFunctionList()) {
+        if (!func->isBuiltin()) {
+            object.addFunction(func->getName(), machineCodes[func], 1 << func->getAlignment());
+        }
+    }
+
+    return object.write(fp);
 }
 
 /// @brief 全局变量Section，主要包含初始化的和未初始化过的
@@ -56,24 +125,24 @@ void CodeGeneratorArm32::genDataSection()
 
     // 可直接操作文件指针fp进行写操作
 
-    // 目前不支持全局变量和静态变量，以及字符串常量
-    // 全局变量分两种情况：初始化的全局变量和未初始化的全局变量
-    // TODO 这里先处理未初始化的全局变量
+    // 全局变量分三种情况：只读的全局变量放在.rodata段，有非0初值的放在.data段，其余放在BSS段
     for (auto var: module->getGlobalVariables()) {
 
-        if (var->isInBSSSection()) {
+        if (var->isInBSSSection() && !var->isReadOnly()) {
 
             // 在BSS段的全局变量，可以包含初值全是0的变量
             fprintf(fp, ".comm %s, %d, %d\n", var->getName().c_str(), var->getType()->getSize(), var->getAlignment());
         } else {
 
-            // 有初值的全局变量
+            // 有初值或只读的全局变量，初值用.word输出，连续的0用.zero输出
             fprintf(fp, ".global %s\n", var->getName().c_str());
-            fprintf(fp, ".data\n");
+            fprintf(fp, "%s\n", var->isReadOnly() ? ".section .rodata" : ".data");
             fprintf(fp, ".align %d\n", var->getAlignment());
             fprintf(fp, ".type %s, %%object\n", var->getName().c_str());
-            fprintf(fp, "%s\n", var->getName().c_str());
-            // TODO 后面设置初始化的值，具体请参考ARM的汇编
+            fprintf(fp, ".size %s, %d\n", var->getName().c_str(), var->getType()->getSize());
+            fprintf(fp, "%s:\n", var->getName().c_str());
+            genInitValues(var, var->getType()->getSize(), ".word");
+            fprintf(fp, ".text\n");
         }
     }
 }
@@ -110,70 +179,184 @@ void CodeGeneratorArm32::getIRValueStr(Value * val, std::string & str)
     }
 }
 
+/// @brief 函数汇编指令生成前的串行调整，主要是函数调用指令的实参调整
+/// @param func 要处理的函数
+void CodeGeneratorArm32::adjustInsts(Function * func)
+{
+    // 调整函数调用指令，主要是前四个寄存器传值，后面用栈传递
+    // 为了更好的进行寄存器分配，可以进行对函数调用的指令进行预处理
+    // 当然也可以不做处理，不过性能更差。这个处理是可选的。
+    // 实参可能是常量或全局变量，寄存器Value也是各函数共享的，因此不能并行调整
+    TimeScope scope("adjustFuncCallInsts", func->getName());
+    adjustFuncCallInsts(func);
+}
+
 /// @brief 针对函数进行汇编指令生成，放到.text代码段中
 /// @param func 要处理的函数
-void CodeGeneratorArm32::genCodeSection(Function * func)
+/// @param asmCode 函数的汇编代码
+void CodeGeneratorArm32::genCodeSection(Function * func, std::string & asmCode)
 {
+    // ILOC代码序列
+    ILocArm32 iloc(module);
+    iloc.setThumb(thumb);
+
+    // 识别可向量化的循环，指令选择到循环头时插入向量循环。
+    // 向量循环可能使用r4-r9，需要在寄存器分配时确定保护的寄存器，因此先识别
+    LoopVectorizerArm32 loopVectorizer(func, iloc);
+    if (loopVectorize) {
+
+        TimeScope scope("LoopVectorizerArm32::run", func->getName());
+
+        int32_t vectorized = loopVectorizer.run();
+
+        minic_debug(DEBUG_ISEL, "Function %s: %d loops vectorized\n", func->getName().c_str(), vectorized);
+    }
+
     // 寄存器分配以及栈内局部变量的站内地址重新分配
-    registerAllocation(func);
+    {
+        TimeScope scope("registerAllocation", func->getName());
+        registerAllocation(func, loopVectorizer.getSavedRegs());
+    }
 
     // 获取函数的指令列表
     std::vector<Instruction *> & IrInsts = func->getInterCode().getInsts();
 
-    // 汇编指令输出前要确保Label的名字有效，必须是程序级别的唯一，而不是函数内的唯一。要全局编号。
+    // 汇编指令输出前要确保Label的名字有效，必须是程序级别的唯一，而不是函数内的唯一。
+    // 这里采用函数内编号并加函数名前缀的方式，各函数可独立编号，指令选择时才生成名字
+    // 同时记录各Label的profile执行次数，供if转换的代价模型使用
+    int32_t labelIndex = 0;
+    std::unordered_map<std::string, int64_t> labelCounts;
     for (auto inst: IrInsts) {
         if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
-            inst->setName(IR_LABEL_PREFIX + std::to_string(labelIndex++));
+            LabelInstruction * labelInst = static_cast<LabelInstruction *>(inst);
+            labelInst->setAsmIndex(labelIndex++);
+            if (labelInst->getProfileCount() >= 0) {
+                labelCounts[IR_LABEL_PREFIX + func->getName() + "_" + std::to_string(labelInst->getAsmIndex())] =
+                    labelInst->getProfileCount();
+            }
         }
     }
 
-    // ILOC代码序列
-    ILocArm32 iloc(module);
+    // 简单的朴素寄存器分配方法，每个函数单独一个
+    SimpleRegisterAllocator simpleRegisterAllocator;
 
     // 指令选择生成汇编指令
-    InstSelectorArm32 instSelector(IrInsts, iloc, func, simpleRegisterAllocator);
-    instSelector.setShowLinearIR(this->showLinearIR);
-    instSelector.run();
+    {
+        TimeScope scope("InstSelectorArm32::run", func->getName());
+        InstSelectorArm32 instSelector(IrInsts, iloc, func, simpleRegisterAllocator);
+        instSelector.setShowLinearIR(this->showLinearIR);
+        instSelector.setLoopVectorizer(loopVectorize ? &loopVectorizer : nullptr);
+        instSelector.run();
+    }
 
     // 删除无用的Label指令
-    iloc.deleteUnusedLabel();
+    {
+        TimeScope scope("deleteUnusedLabel", func->getName());
+        iloc.deleteUnusedLabel();
+    }
+
+    if (ifConversion) {
+
+        // 小的分支结构改为条件执行的指令
+        TimeScope scope("IfConversionArm32::run", func->getName());
+
+        IfConversionArm32 ifConversionPass(iloc.getCode(), labelCounts);
+        int32_t converted = ifConversionPass.run();
+
+        minic_debug(DEBUG_ISEL, "Function %s: %d branches if-converted\n", func->getName().c_str(), converted);
+    }
+
+    if (thumb) {
+
+        // 调整为Thumb-2指令序列，尽量使用16位编码
+        TimeScope scope("Thumb2Arm32::run", func->getName());
+
+        Thumb2Arm32 thumb2(iloc.getCode());
+        thumb2.run();
+
+        armCodeSize += thumb2.getArmSize();
+        thumbCodeSize += thumb2.getThumbSize();
+
+        minic_debug(DEBUG_CODE_SIZE,
+                    "Function %s: A32 %d bytes -> Thumb-2 %d bytes (%.1f%% smaller)\n",
+                    func->getName().c_str(),
+                    thumb2.getArmSize(),
+                    thumb2.getThumbSize(),
+                    thumb2.getArmSize() ? 100.0 * (thumb2.getArmSize() - thumb2.getThumbSize()) / thumb2.getArmSize()
+                                        : 0.0);
+    }
+
+    if (emitObject) {
+
+        // 直接编码为机器码，不产生汇编
+        TimeScope scope("encode", func->getName());
+
+        EncoderArm32 encoder;
+        ArmMachineCode machineCode;
+        if (!encoder.encode(iloc.getCode(), machineCode)) {
+            minic_log(LOG_ERROR, "函数%s：%s", func->getName().c_str(), encoder.getLastError().c_str());
+            encodeFailed = true;
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(machineCodeMutex);
+        machineCodes[func] = std::move(machineCode);
+        return;
+    }
+
+    TimeScope scope("emit", func->getName());
 
     // ILOC代码输出为汇编代码
-    fprintf(fp, ".align %d\n", func->getAlignment());
-    fprintf(fp, ".global %s\n", func->getName().c_str());
-    fprintf(fp, ".type %s, %%function\n", func->getName().c_str());
-    fprintf(fp, "%s:\n", func->getName().c_str());
+    OutputStream os(asmCode);
+
+    os << ".align " << func->getAlignment() << '\n';
+    os << ".global " << func->getName() << '\n';
+    os << ".type " << func->getName() << ", %function\n";
+    if (thumb) {
+        // 函数地址的最低位置1，由ARM代码调用或通过bx lr返回ARM代码时可正确切换状态
+        os << ".thumb_func\n";
+    }
+    os << func->getName() << ":\n";
 
     // 开启时输出IR指令作为注释
     if (this->showLinearIR) {
 
         // 输出有关局部变量的注释，便于查找问题
+        std::string str;
         for (auto localVar: func->getVarValues()) {
-            std::string str;
+            str.clear();
             getIRValueStr(localVar, str);
             if (!str.empty()) {
-                fprintf(fp, "%s\n", str.c_str());
+                os << str << '\n';
             }
         }
 
         // 输出指令关联的临时变量信息
         for (auto inst: func->getInterCode().getInsts()) {
             if (inst->hasResultValue()) {
-                std::string str;
+                str.clear();
                 getIRValueStr(inst, str);
                 if (!str.empty()) {
-                    fprintf(fp, "%s\n", str.c_str());
+                    os << str << '\n';
                 }
             }
         }
     }
 
-    iloc.outPut(fp);
+    iloc.outPut(os);
 }
 
 /// @brief 寄存器分配
 /// @param func 函数指针
 void CodeGeneratorArm32::registerAllocation(Function * func)
+{
+    registerAllocation(func, {});
+}
+
+/// @brief 寄存器分配
+/// @param func 函数指针
+/// @param savedRegs 循环向量化等额外使用的需要保护的寄存器
+void CodeGeneratorArm32::registerAllocation(Function * func, const std::vector<int32_t> & savedRegs)
 {
     // 内置函数不需要处理
     if (func->isBuiltin()) {
@@ -203,10 +386,11 @@ void CodeGeneratorArm32::registerAllocation(Function * func)
         protectedRegNo.push_back(ARM32_LX_REG_NO);
     }
 
-    // 调整函数调用指令，主要是前四个寄存器传值，后面用栈传递
-    // 为了更好的进行寄存器分配，可以进行对函数调用的指令进行预处理
-    // 当然也可以不做处理，不过性能更差。这个处理是可选的。
-    adjustFuncCallInsts(func);
+    // 额外使用的r4-r9，push/pop的寄存器列表按编号从小到大
+    protectedRegNo.insert(protectedRegNo.end(), savedRegs.begin(), savedRegs.end());
+    std::sort(protectedRegNo.begin(), protectedRegNo.end());
+
+    // 函数调用指令的调整已在adjustInsts中串行完成
 
     // 为局部变量和临时变量在栈内分配空间，指定偏移，进行栈空间的分配
     stackAlloc(func);
@@ -228,25 +412,25 @@ void CodeGeneratorArm32::registerAllocation(Function * func)
 /// @param func 要处理的函数
 void CodeGeneratorArm32::adjustFormalParamInsts(Function * func)
 {
-    // 函数形参的前四个实参值采用的是寄存器传值，后面栈传递
+    // 硬浮点调用约定，整数形参依次通过r0-r3传值，float形参依次通过s0-s15传值，其余栈传递
 
     auto & params = func->getParams();
 
-    // 形参的前四个通过寄存器来传值R0-R3
-    for (int k = 0; k < (int) params.size() && k <= 3; k++) {
-
-        // 前四个设置分配寄存器
-        params[k]->setRegId(k);
-    }
+    std::vector<ArmArgLocation> locations = PlatformArm32::paramLocations(func);
 
-    // 根据ARM版C语言的调用约定，除前4个外的实参进行值传递，逆序入栈
+    // 栈传递的形参在保护寄存器的空间之上，按参数次序依次存放
     int64_t fp_esp = func->getProtectedReg().size() * 4;
-    for (int k = 4; k < (int) params.size(); k++) {
 
-        params[k]->setMemoryAddr(ARM32_FP_REG_NO, fp_esp);
+    for (int k = 0; k < (int) params.size(); k++) {
+
+        if (locations[k].reg == -1) {
+            params[k]->setMemoryAddr(ARM32_FP_REG_NO, fp_esp + locations[k].stackOffset);
+        } else if (!locations[k].isFloat && !locations[k].saved) {
+            // 整数寄存器传递的设置分配寄存器
+            params[k]->setRegId(locations[k].reg);
+        }
 
-        // 增加4字节，目前只支持int类型
-        fp_esp += params[k]->getType()->getSize();
+        // s寄存器传递的形参以及需要保存的整数形参已在栈内分配空间，在函数入口处保存
     }
 }
 
@@ -270,9 +454,18 @@ void CodeGeneratorArm32::adjustFuncCallInsts(Function * func)
 
             int32_t argNum = callInst->getOperandsNum();
 
-            // 除前四个整数寄存器外，后面的参数采用栈传递
-            int esp = 0;
-            for (int32_t k = 4; k < argNum; k++) {
+            // 硬浮点调用约定，整数实参依次通过r0-r3传递，float实参依次通过s0-s15传递，其余栈传递
+            std::vector<Type *> argTypes;
+            for (int32_t k = 0; k < argNum; k++) {
+                argTypes.push_back(callInst->getOperand(k)->getType());
+            }
+            std::vector<ArmArgLocation> locations = PlatformArm32::argLocations(argTypes);
+
+            for (int32_t k = 0; k < argNum; k++) {
+
+                if (locations[k].reg != -1) {
+                    continue;
+                }
 
                 // 获取实参的值
                 auto arg = callInst->getOperand(k);
@@ -287,9 +480,10 @@ void CodeGeneratorArm32::adjustFuncCallInsts(Function * func)
                 // ---------------------
 
                 // 新建一个内存变量，把实参的值保存到栈中，以便栈传值，其寻址为SP + 非负偏移
-                MemVariable * newVal = func->newMemVariable(IntegerType::getTypeInt());
-                newVal->setMemoryAddr(ARM32_SP_REG_NO, esp);
-                esp += 4;
+                // float实参保持float类型，指令选择时据此重新计算传递位置
+                Type * slotType = arg->getType()->isFloatType() ? arg->getType() : IntegerType::getTypeInt();
+                MemVariable * newVal = func->newMemVariable(slotType);
+                newVal->setMemoryAddr(ARM32_SP_REG_NO, locations[k].stackOffset);
 
                 // 引入赋值指令，把实参的值保存到内存变量上
                 Instruction * assignInst = new MoveInstruction(func, newVal, arg);
@@ -303,16 +497,26 @@ void CodeGeneratorArm32::adjustFuncCallInsts(Function * func)
                 pIter++;
             }
 
-            // ARM32的函数调用约定，前四个参数通过寄存器传递
-            for (int k = 0; k < argNum && k < 4; k++) {
+            // 展开为stmia的memset清零只需地址放到r0，填充值与大小保持常量供指令选择使用
+            if (InstSelectorArm32::isInlineZeroFill(callInst)) {
+                argNum = 1;
+            }
+
+            // ARM32的函数调用约定，前四个整数参数通过寄存器传递，float参数由指令选择直接加载到s寄存器
+            for (int k = 0; k < argNum; k++) {
+
+                if ((locations[k].reg == -1) || locations[k].isFloat) {
+                    continue;
+                }
 
                 // 把实参的值通过move指令传递给寄存器
 
                 auto arg = callInst->getOperand(k);
+                int32_t regNo = locations[k].reg;
 
-                Instruction * assignInst = new MoveInstruction(func, PlatformArm32::intRegVal[k], arg);
+                Instruction * assignInst = new MoveInstruction(func, PlatformArm32::intRegVal[regNo], arg);
 
-                callInst->setOperand(k, PlatformArm32::intRegVal[k]);
+                callInst->setOperand(k, PlatformArm32::intRegVal[regNo]);
 
                 // 函数调用指令前插入后，pIter仍指向函数调用指令
                 pIter = insts.insert(pIter, assignInst);
@@ -333,8 +537,8 @@ void CodeGeneratorArm32::adjustFuncCallInsts(Function * func)
             // 有arg指令后可不用参数，展示不删除
             // args.clear();
 
-            // 赋值指令
-            if (callInst->hasResultValue()) {
+            // 赋值指令，float返回值在s0中，由指令选择保存到结果变量
+            if (callInst->hasResultValue() && !callInst->getType()->isFloatType()) {
 
                 if (callInst->getRegId() == 0) {
                     // 结果变量的寄存器和返回值寄存器一样，则什么都不需要做
@@ -374,8 +578,8 @@ void CodeGeneratorArm32::stackAlloc(Function * func)
     // ---------------------
 
     // 这里对临时变量和局部变量都在栈上进行分配，采用FP+偏移的寻址方式，偏移为负数
-
-    int32_t sp_esp = 0;
+    // 活跃区间不相交的变量通过栈槽着色共享同一个栈槽，以减小栈帧
+    StackSlotColoring coloring(func);
 
     // 遍历函数变量列表
     for (auto var: func->getVarValues()) {
@@ -388,23 +592,10 @@ void CodeGeneratorArm32::stackAlloc(Function * func)
         // baseRegNo不等于-1，则说明该变量肯定在栈上，属于内存变量，之前肯定已经分配过
         if ((var->getRegId() == -1) && (!var->getMemoryAddr())) {
 
-            // 该变量没有分配寄存器
-
-            int32_t size = var->getType()->getSize();
+            // 该变量没有分配寄存器，32位ARM平台按照4字节的大小整数倍分配局部变量
+            int32_t size = (var->getType()->getSize() + 3) & ~3;
 
-            // 32位ARM平台按照4字节的大小整数倍分配局部变量
-            size = (size + 3) & ~3;
-
-            // 累计当前作用域大小
-            sp_esp += size;
-
-            // 这里要注意检查变量栈的偏移范围。一般采用机制寄存器+立即数方式间接寻址
-            // 若立即数满足要求，可采用基址寄存器+立即数变量的方式访问变量
-            // 否则，需要先把偏移量放到寄存器中，然后机制寄存器+偏移寄存器来寻址
-            // 之后需要对所有使用到该Value的指令在寄存器分配前要变换。
-
-            // 局部变量偏移设置
-            var->setMemoryAddr(ARM32_FP_REG_NO, -sp_esp);
+            coloring.addObject(var, size, StackSlotColoring::getAlignment(var->getType()));
         }
     }
 
@@ -412,26 +603,52 @@ void CodeGeneratorArm32::stackAlloc(Function * func)
     for (auto inst: func->getInterCode().getInsts()) {
 
         if (inst->hasResultValue() && (inst->getRegId() == -1)) {
+
             // 有值，并且没有分配寄存器
+            int32_t size = (inst->getType()->getSize() + 3) & ~3;
+
+            coloring.addObject(inst, size, StackSlotColoring::getAlignment(inst->getType()));
+        }
+    }
 
-            int32_t size = inst->getType()->getSize();
+    // 通过s寄存器传递的float形参以及需要保存的整数寄存器形参，在函数入口处保存到栈内
+    auto & params = func->getParams();
+    std::vector<ArmArgLocation> locations = PlatformArm32::paramLocations(func);
+    for (size_t k = 0; k < params.size(); ++k) {
+        if ((locations[k].reg != -1) && (locations[k].isFloat || locations[k].saved)) {
+            coloring.addObject(params[k], 4, 4, true);
+        }
+    }
 
-            // 32位ARM平台按照4字节的大小整数倍分配局部变量
-            size = (size + 3) & ~3;
+    int32_t sp_esp = coloring.run();
 
-            // 累计当前作用域大小
-            sp_esp += size;
+    for (auto & obj: coloring.getObjects()) {
 
-            // 这里要注意检查变量栈的偏移范围。一般采用机制寄存器+立即数方式间接寻址
-            // 若立即数满足要求，可采用基址寄存器+立即数变量的方式访问变量
-            // 否则，需要先把偏移量放到寄存器中，然后机制寄存器+偏移寄存器来寻址
-            // 之后需要对所有使用到该Value的指令在寄存器分配前要变换。
+        // 这里要注意检查变量栈的偏移范围。一般采用机制寄存器+立即数方式间接寻址
+        // 若立即数满足要求，可采用基址寄存器+立即数变量的方式访问变量
+        // 否则，需要先把偏移量放到寄存器中，然后机制寄存器+偏移寄存器来寻址
+        // 之后需要对所有使用到该Value的指令在寄存器分配前要变换。
 
-            // 局部变量偏移设置
-            inst->setMemoryAddr(ARM32_FP_REG_NO, -sp_esp);
+        // 局部变量或临时变量偏移设置
+        if (Instanceof(var, LocalVariable *, obj.val)) {
+            var->setMemoryAddr(ARM32_FP_REG_NO, -obj.offset);
+        } else if (Instanceof(inst, Instruction *, obj.val)) {
+            inst->setMemoryAddr(ARM32_FP_REG_NO, -obj.offset);
+        } else if (Instanceof(param, FormalParam *, obj.val)) {
+            param->setMemoryAddr(ARM32_FP_REG_NO, -obj.offset);
         }
+
+        // 记录活跃区间，栈内偏移检查时共享栈槽的变量不算冲突
+        func->setStackLiveRange(obj.val, obj.start, obj.end);
     }
 
+    minic_debug(DEBUG_STACK_LAYOUT,
+                "Function %s: frame size %d -> %d bytes (%d stack objects)\n",
+                func->getName().c_str(),
+                coloring.getUnsharedSize(),
+                sp_esp,
+                (int) coloring.getObjects().size());
+
     // 通过栈传递的实参，ARM32的前四个通过寄存器传递
     int maxFuncCallArgCnt = func->getMaxFuncCallArgCnt();
     if (maxFuncCallArgCnt > 4) {
@@ -13,7 +13,12 @@
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// </table>
 ///
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
 #include "CodeGeneratorAsm.h"
+#include "EncoderArm32.h"
 #include "SimpleRegisterAllocator.h"
 
 class CodeGeneratorArm32 : public CodeGeneratorAsm {
@@ -26,21 +31,71 @@ public:
     /// @brief 析构函数
     ~CodeGeneratorArm32() override;
 
+    ///
+    /// @brief 设置是否直接产生ELF目标文件，不产生汇编
+    /// @param emit true：产生目标文件，false：产生汇编
+    ///
+    void setEmitObject(bool emit)
+    {
+        this->emitObject = emit;
+    }
+
+    ///
+    /// @brief 设置是否产生Thumb-2指令，默认产生A32指令
+    /// @param _thumb true：Thumb-2，false：A32
+    ///
+    void setThumb(bool _thumb)
+    {
+        this->thumb = _thumb;
+    }
+
+    ///
+    /// @brief 设置是否进行if转换，把小的分支结构改为条件执行的指令
+    /// @param enable true：进行，false：不进行
+    ///
+    void setIfConversion(bool enable)
+    {
+        this->ifConversion = enable;
+    }
+
+    ///
+    /// @brief 设置是否进行循环向量化，把int数组的简单循环改为NEON指令
+    /// @param enable true：进行，false：不进行
+    ///
+    void setLoopVectorize(bool enable)
+    {
+        this->loopVectorize = enable;
+    }
+
 protected:
+    /// @brief 产生汇编文件或目标文件
+    /// @return true:成功，false:失败
+    bool run() override;
+
     /// @brief 产生汇编头部分
     void genHeader() override;
 
     /// @brief 全局变量Section，主要包含初始化的和未初始化过的
     void genDataSection() override;
 
+    /// @brief 函数汇编指令生成前的串行调整，主要是函数调用指令的实参调整
+    /// @param func 要处理的函数
+    void adjustInsts(Function * func) override;
+
     /// @brief 针对函数进行汇编指令生成，放到.text代码段中
     /// @param func 要处理的函数
-    void genCodeSection(Function * func) override;
+    /// @param asmCode 函数的汇编代码
+    void genCodeSection(Function * func, std::string & asmCode) override;
 
     /// @brief 寄存器分配
     /// @param func 要处理的函数
     void registerAllocation(Function * func) override;
 
+    /// @brief 寄存器分配
+    /// @param func 要处理的函数
+    /// @param savedRegs 循环向量化等额外使用的需要保护的寄存器
+    void registerAllocation(Function * func, const std::vector<int32_t> & savedRegs);
+
     /// @brief 栈空间分配
     /// @param func 要处理的函数
     void stackAlloc(Function * func);
@@ -59,9 +114,30 @@ protected:
     ///
     void getIRValueStr(Value * val, std::string & str);
 
-private:
-    ///
-    /// @brief 简单的朴素寄存器分配方法
-    ///
-    SimpleRegisterAllocator simpleRegisterAllocator;
+    /// @brief 是否直接产生ELF目标文件
+    bool emitObject = false;
+
+    /// @brief 产生目标文件时各函数的机器码，各函数并行产生，需要互斥访问
+    std::unordered_map<Function *, ArmMachineCode> machineCodes;
+
+    /// @brief 机器码的互斥锁
+    std::mutex machineCodeMutex;
+
+    /// @brief 是否有函数编码失败
+    std::atomic<bool> encodeFailed{false};
+
+    /// @brief 是否产生Thumb-2指令
+    bool thumb = false;
+
+    /// @brief 是否进行if转换
+    bool ifConversion = false;
+
+    /// @brief 是否进行循环向量化
+    bool loopVectorize = false;
+
+    /// @brief Thumb-2模式下所有函数按A32计算的代码大小
+    std::atomic<int32_t> armCodeSize{0};
+
+    /// @brief Thumb-2模式下所有函数估算的代码大小
+    std::atomic<int32_t> thumbCodeSize{0};
 };
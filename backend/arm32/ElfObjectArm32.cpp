@@ -0,0 +1,360 @@
+///
+/// @file ElfObjectArm32.cpp
+/// @brief ARM32 ELF可重定位目标文件(.o)的产生
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#include "ElfObjectArm32.h"
+
+// 节的编号，与输出的节头表次序一致
+#define SHN_TEXT 1
+#define SHN_REL_TEXT 2
+#define SHN_DATA 3
+#define SHN_RODATA 4
+#define SHN_BSS 5
+#define SHN_ATTRIBUTES 6
+#define SHN_SYMTAB 7
+#define SHN_STRTAB 8
+#define SHN_SHSTRTAB 9
+#define SHN_COUNT 10
+
+// 节的类型
+#define SHT_PROGBITS 1
+#define SHT_SYMTAB 2
+#define SHT_STRTAB 3
+#define SHT_NOBITS 8
+#define SHT_REL 9
+#define SHT_ARM_ATTRIBUTES 0x70000003
+
+// 节的标志
+#define SHF_WRITE 0x1
+#define SHF_ALLOC 0x2
+#define SHF_EXECINSTR 0x4
+#define SHF_INFO_LINK 0x40
+
+// 符号的绑定与类型
+#define STB_LOCAL 0
+#define STB_GLOBAL 1
+#define STT_NOTYPE 0
+#define STT_OBJECT 1
+#define STT_FUNC 2
+#define ELF32_ST_INFO(bind, type) ((uint8_t) (((bind) << 4) | (type)))
+
+// EABI版本5，硬浮点调用约定，与arm-linux-gnueabihf工具链一致
+#define EF_ARM_EABI_VER5 0x05000000
+#define EF_ARM_ABI_FLOAT_HARD 0x00000400
+
+/// @brief 小端字节序的输出缓冲
+class ElfBuffer {
+
+public:
+    std::string bytes;
+
+    void put8(uint32_t value)
+    {
+        bytes.push_back((char) (value & 0xFF));
+    }
+
+    void put16(uint32_t value)
+    {
+        put8(value);
+        put8(value >> 8);
+    }
+
+    void put32(uint32_t value)
+    {
+        put16(value);
+        put16(value >> 16);
+    }
+
+    void put(const void * src, size_t size)
+    {
+        if (size == 0) {
+            return;
+        }
+        bytes.append((const char *) src, size);
+    }
+
+    /// @brief 填充0到指定的对齐
+    void align(uint32_t alignment)
+    {
+        while (bytes.size() % alignment) {
+            put8(0);
+        }
+    }
+
+    uint32_t size() const
+    {
+        return (uint32_t) bytes.size();
+    }
+};
+
+/// @brief 添加函数，函数的机器码追加到.text节中
+/// @param name 函数名
+/// @param code 函数的机器码
+/// @param alignment 对齐字节数
+void ElfObjectArm32::addFunction(const std::string & name, const ArmMachineCode & code, int32_t alignment)
+{
+    uint32_t align = std::max<uint32_t>(4, (uint32_t) alignment);
+    textAlign = std::max(textAlign, align);
+
+    // 对齐的填充采用nop指令
+    while (text.size() % align) {
+        for (int k = 0; k < 4; ++k) {
+            text.push_back((uint8_t) (0xE320F000u >> (8 * k)));
+        }
+    }
+
+    uint32_t start = (uint32_t) text.size();
+
+    for (uint32_t word: code.words) {
+        for (int k = 0; k < 4; ++k) {
+            text.push_back((uint8_t) (word >> (8 * k)));
+        }
+    }
+
+    for (auto & reloc: code.relocs) {
+        textRelocs.push_back({start + reloc.offset, reloc.symbol, reloc.type});
+    }
+
+    globals.push_back({name,
+                       start,
+                       (uint32_t) code.words.size() * 4,
+                       ELF32_ST_INFO(STB_GLOBAL, STT_FUNC),
+                       SHN_TEXT});
+}
+
+/// @brief 添加全局变量
+/// @param name 变量名
+/// @param size 字节数
+/// @param alignment 对齐字节数
+/// @param values 各4字节元素的初值，末尾为0的元素可省略
+/// @param bss true：初值都为0，可放在.bss节中，false：放在.data节中
+/// @param readOnly true：只读，放在.rodata节中
+void ElfObjectArm32::addVariable(const std::string & name,
+                                 int32_t size,
+                                 int32_t alignment,
+                                 const std::vector<int32_t> & values,
+                                 bool bss,
+                                 bool readOnly)
+{
+    uint32_t align = std::max<uint32_t>(1, (uint32_t) alignment);
+    uint32_t offset;
+    uint16_t shndx;
+
+    if (bss && !readOnly) {
+        bssAlign = std::max(bssAlign, align);
+        offset = (bssSize + align - 1) / align * align;
+        bssSize = offset + (uint32_t) size;
+        shndx = SHN_BSS;
+    } else {
+        std::vector<uint8_t> & section = readOnly ? rodata : data;
+        uint32_t & sectionAlign = readOnly ? rodataAlign : dataAlign;
+
+        sectionAlign = std::max(sectionAlign, align);
+        offset = (uint32_t) (section.size() + align - 1) / align * align;
+        section.resize(offset + (uint32_t) size, 0);
+
+        // 初值按小端字节序存放
+        for (size_t k = 0; (k < values.size()) && ((k + 1) * 4 <= (size_t) size); ++k) {
+            for (int b = 0; b < 4; ++b) {
+                section[offset + k * 4 + b] = (uint8_t) ((uint32_t) values[k] >> (8 * b));
+            }
+        }
+
+        shndx = readOnly ? SHN_RODATA : SHN_DATA;
+    }
+
+    globals.push_back({name, offset, (uint32_t) size, ELF32_ST_INFO(STB_GLOBAL, STT_OBJECT), shndx});
+}
+
+/// @brief 输出目标文件
+/// @param fp 输出文件
+/// @return true：成功，false：失败
+bool ElfObjectArm32::write(FILE * fp)
+{
+    // 符号表：局部符号在前，全局符号在后。$a与$d为映射符号，标识ARM代码与数据的开始
+    std::vector<Symbol> symbols;
+    symbols.push_back({"", 0, 0, 0, 0});
+    if (!text.empty()) {
+        symbols.push_back({"$a", 0, 0, ELF32_ST_INFO(STB_LOCAL, STT_NOTYPE), SHN_TEXT});
+    }
+    if (!data.empty()) {
+        symbols.push_back({"$d", 0, 0, ELF32_ST_INFO(STB_LOCAL, STT_NOTYPE), SHN_DATA});
+    }
+    if (!rodata.empty()) {
+        symbols.push_back({"$d", 0, 0, ELF32_ST_INFO(STB_LOCAL, STT_NOTYPE), SHN_RODATA});
+    }
+
+    uint32_t firstGlobal = (uint32_t) symbols.size();
+
+    std::unordered_map<std::string, uint32_t> symbolIndex;
+    for (auto & symbol: globals) {
+        symbolIndex[symbol.name] = (uint32_t) symbols.size();
+        symbols.push_back(symbol);
+    }
+
+    // 引用的外部符号，如库函数
+    for (auto & reloc: textRelocs) {
+        if (symbolIndex.find(reloc.symbol) == symbolIndex.end()) {
+            symbolIndex[reloc.symbol] = (uint32_t) symbols.size();
+            symbols.push_back({reloc.symbol, 0, 0, ELF32_ST_INFO(STB_GLOBAL, STT_NOTYPE), 0});
+        }
+    }
+
+    // 符号名字符串表
+    ElfBuffer strtab;
+    strtab.put8(0);
+    std::vector<uint32_t> nameOffsets;
+    for (auto & symbol: symbols) {
+        if (symbol.name.empty()) {
+            nameOffsets.push_back(0);
+        } else {
+            nameOffsets.push_back(strtab.size());
+            strtab.put(symbol.name.c_str(), symbol.name.size() + 1);
+        }
+    }
+
+    ElfBuffer symtab;
+    for (size_t k = 0; k < symbols.size(); ++k) {
+        symtab.put32(nameOffsets[k]);
+        symtab.put32(symbols[k].value);
+        symtab.put32(symbols[k].size);
+        symtab.put8(symbols[k].info);
+        symtab.put8(0);
+        symtab.put16(symbols[k].shndx);
+    }
+
+    ElfBuffer relText;
+    for (auto & reloc: textRelocs) {
+        relText.put32(reloc.offset);
+        relText.put32((symbolIndex[reloc.symbol] << 8) | reloc.type);
+    }
+
+    // 属性节：v7-A架构，ARM与Thumb-2指令集，VFPv4，NEON，VFP寄存器传参，允许使用sdiv/udiv
+    ElfBuffer attrs;
+    const uint8_t fileAttrs[] = {6, 10, 7, 'A', 8, 1, 9, 2, 10, 5, 12, 2, 28, 1, 44, 2};
+    const char vendor[] = "aeabi";
+    uint32_t fileSize = 1 + 4 + sizeof(fileAttrs);
+    attrs.put8('A');
+    attrs.put32(4 + sizeof(vendor) + fileSize);
+    attrs.put(vendor, sizeof(vendor));
+    attrs.put8(1);
+    attrs.put32(fileSize);
+    attrs.put(fileAttrs, sizeof(fileAttrs));
+
+    // 节名字符串表
+    const char * sectionNames[SHN_COUNT] =
+        {"", ".text", ".rel.text", ".data", ".rodata", ".bss", ".ARM.attributes", ".symtab", ".strtab", ".shstrtab"};
+    ElfBuffer shstrtab;
+    shstrtab.put8(0);
+    uint32_t sectionNameOffsets[SHN_COUNT] = {0};
+    for (int k = 1; k < SHN_COUNT; ++k) {
+        sectionNameOffsets[k] = shstrtab.size();
+        shstrtab.put(sectionNames[k], strlen(sectionNames[k]) + 1);
+    }
+
+    // 依次放置ELF头、各节的内容以及节头表
+    ElfBuffer out;
+
+    const uint8_t ident[16] = {0x7F, 'E', 'L', 'F', 1 /* 32位 */, 1 /* 小端 */, 1 /* 版本 */};
+    out.put(ident, sizeof(ident));
+    out.put16(1);  // ET_REL
+    out.put16(40); // EM_ARM
+    out.put32(1);  // EV_CURRENT
+    out.put32(0);  // e_entry
+    out.put32(0);  // e_phoff
+    size_t shoffPos = out.bytes.size();
+    out.put32(0); // e_shoff，最后回填
+    out.put32(EF_ARM_EABI_VER5 | EF_ARM_ABI_FLOAT_HARD);
+    out.put16(52); // e_ehsize
+    out.put16(0);  // e_phentsize
+    out.put16(0);  // e_phnum
+    out.put16(40); // e_shentsize
+    out.put16(SHN_COUNT);
+    out.put16(SHN_SHSTRTAB);
+
+    struct SectionLayout {
+        uint32_t type, flags, offset, size, link, info, align, entsize;
+    };
+    SectionLayout layout[SHN_COUNT] = {};
+
+    auto place = [&](int no, const void * content, uint32_t size, uint32_t align) {
+        out.align(align);
+        layout[no].offset = out.size();
+        layout[no].size = size;
+        layout[no].align = align;
+        out.put(content, size);
+    };
+
+    place(SHN_TEXT, text.data(), (uint32_t) text.size(), textAlign);
+    layout[SHN_TEXT].type = SHT_PROGBITS;
+    layout[SHN_TEXT].flags = SHF_ALLOC | SHF_EXECINSTR;
+
+    place(SHN_REL_TEXT, relText.bytes.data(), relText.size(), 4);
+    layout[SHN_REL_TEXT].type = SHT_REL;
+    layout[SHN_REL_TEXT].flags = SHF_INFO_LINK;
+    layout[SHN_REL_TEXT].link = SHN_SYMTAB;
+    layout[SHN_REL_TEXT].info = SHN_TEXT;
+    layout[SHN_REL_TEXT].entsize = 8;
+
+    place(SHN_DATA, data.data(), (uint32_t) data.size(), dataAlign);
+    layout[SHN_DATA].type = SHT_PROGBITS;
+    layout[SHN_DATA].flags = SHF_ALLOC | SHF_WRITE;
+
+    place(SHN_RODATA, rodata.data(), (uint32_t) rodata.size(), rodataAlign);
+    layout[SHN_RODATA].type = SHT_PROGBITS;
+    layout[SHN_RODATA].flags = SHF_ALLOC;
+
+    // .bss在文件中不占空间
+    layout[SHN_BSS] = {SHT_NOBITS, SHF_ALLOC | SHF_WRITE, out.size(), bssSize, 0, 0, bssAlign, 0};
+
+    place(SHN_ATTRIBUTES, attrs.bytes.data(), attrs.size(), 1);
+    layout[SHN_ATTRIBUTES].type = SHT_ARM_ATTRIBUTES;
+
+    place(SHN_SYMTAB, symtab.bytes.data(), symtab.size(), 4);
+    layout[SHN_SYMTAB].type = SHT_SYMTAB;
+    layout[SHN_SYMTAB].link = SHN_STRTAB;
+    layout[SHN_SYMTAB].info = firstGlobal;
+    layout[SHN_SYMTAB].entsize = 16;
+
+    place(SHN_STRTAB, strtab.bytes.data(), strtab.size(), 1);
+    layout[SHN_STRTAB].type = SHT_STRTAB;
+
+    place(SHN_SHSTRTAB, shstrtab.bytes.data(), shstrtab.size(), 1);
+    layout[SHN_SHSTRTAB].type = SHT_STRTAB;
+
+    // 节头表
+    out.align(4);
+    uint32_t shoff = out.size();
+    for (int k = 0; k < 4; ++k) {
+        out.bytes[shoffPos + k] = (char) (shoff >> (8 * k));
+    }
+
+    for (int k = 0; k < SHN_COUNT; ++k) {
+        out.put32(sectionNameOffsets[k]);
+        out.put32(layout[k].type);
+        out.put32(layout[k].flags);
+        out.put32(0); // sh_addr
+        out.put32(layout[k].offset);
+        out.put32(layout[k].size);
+        out.put32(layout[k].link);
+        out.put32(layout[k].info);
+        out.put32(layout[k].align);
+        out.put32(layout[k].entsize);
+    }
+
+    return fwrite(out.bytes.data(), 1, out.bytes.size(), fp) == out.bytes.size();
+}
@@ -0,0 +1,102 @@
+///
+/// @file ElfObjectArm32.h
+/// @brief ARM32 ELF可重定位目标文件(.o)的产生
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "EncoderArm32.h"
+
+/// @brief ARM32 ELF可重定位目标文件，含.text、.data、.rodata、.bss节以及符号表与.text的重定位表
+class ElfObjectArm32 {
+
+public:
+    /// @brief 添加函数，函数的机器码追加到.text节中
+    /// @param name 函数名
+    /// @param code 函数的机器码
+    /// @param alignment 对齐字节数
+    void addFunction(const std::string & name, const ArmMachineCode & code, int32_t alignment);
+
+    /// @brief 添加全局变量
+    /// @param name 变量名
+    /// @param size 字节数
+    /// @param alignment 对齐字节数
+    /// @param values 各4字节元素的初值，末尾为0的元素可省略
+    /// @param bss true：初值都为0，可放在.bss节中，false：放在.data节中
+    /// @param readOnly true：只读，放在.rodata节中
+    void addVariable(const std::string & name,
+                     int32_t size,
+                     int32_t alignment,
+                     const std::vector<int32_t> & values,
+                     bool bss,
+                     bool readOnly);
+
+    /// @brief 输出目标文件
+    /// @param fp 输出文件
+    /// @return true：成功，false：失败
+    bool write(FILE * fp);
+
+private:
+    /// @brief 符号
+    struct Symbol {
+
+        /// @brief 符号名
+        std::string name;
+
+        /// @brief 所在节内的偏移
+        uint32_t value;
+
+        /// @brief 大小
+        uint32_t size;
+
+        /// @brief 绑定与类型，即st_info
+        uint8_t info;
+
+        /// @brief 所在节的编号，0为未定义
+        uint16_t shndx;
+    };
+
+    /// @brief .text节的内容
+    std::vector<uint8_t> text;
+
+    /// @brief .data节的内容
+    std::vector<uint8_t> data;
+
+    /// @brief .rodata节的内容
+    std::vector<uint8_t> rodata;
+
+    /// @brief .bss节的大小
+    uint32_t bssSize = 0;
+
+    /// @brief .text节的对齐字节数
+    uint32_t textAlign = 4;
+
+    /// @brief .data节的对齐字节数
+    uint32_t dataAlign = 1;
+
+    /// @brief .rodata节的对齐字节数
+    uint32_t rodataAlign = 1;
+
+    /// @brief .bss节的对齐字节数
+    uint32_t bssAlign = 1;
+
+    /// @brief 定义的全局符号，按添加的次序
+    std::vector<Symbol> globals;
+
+    /// @brief .text节的重定位项，偏移相对于.text节的开头
+    std::vector<ArmReloc> textRelocs;
+};
@@ -0,0 +1,914 @@
+///
+/// @file EncoderArm32.cpp
+/// @brief ARM32(A32)指令编码的实现，把ILOC指令序列直接编码为机器码
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <cstdlib>
+#include <unordered_map>
+
+#include "EncoderArm32.h"
+#include "IRConstant.h"
+#include "PlatformArm32.h"
+
+/// @brief 指令的编码格式
+enum class ArmFormat {
+    DataProc,       ///< 数据处理，add rd,rn,op2
+    Move,           ///< 传送，mov rd,op2
+    Compare,        ///< 比较，cmp rn,op2
+    Shift,          ///< 移位，lsl rd,rm,#n或lsl rd,rm,rs
+    Multiply,       ///< 乘法，mul rd,rm,rs以及mla/mls rd,rm,rs,ra
+    Divide,         ///< 除法，sdiv rd,rn,rm
+    MoveWide,       ///< 16位立即数传送，movw/movt rd,#imm16
+    LoadStore,      ///< 访存，ldr rd,[rn,#imm]
+    Branch,         ///< 跳转，b/bl label
+    BranchExchange, ///< 寄存器跳转，bx rm
+    BlockTransfer,  ///< 多寄存器访存，push/pop {reglist}以及stmia rn!,{reglist}
+    Nop,            ///< 空操作
+    VfpArith,       ///< VFP三操作数运算，vadd.f32 sd,sn,sm
+    VfpUnary,       ///< VFP两操作数运算，vneg.f32 sd,sm以及vcmp、vcvt
+    VfpMove,        ///< 通用寄存器与s寄存器之间的传送，vmov sn,rt或vmov rt,sn
+    VfpStatus,      ///< FPSCR的标志位传送到APSR，vmrs APSR_nzcv,fpscr
+    VfpLoadStore,   ///< VFP访存，vldr sd,[rn,#imm]
+    NeonArith,      ///< NEON三操作数运算，vadd.i32 qd,qn,qm
+    NeonUnary,      ///< NEON两操作数运算，vneg.s32 qd,qm
+    NeonShift,      ///< NEON立即数移位，vshr.u32 qd,qm,#n
+    NeonDup,        ///< 通用寄存器复制到q寄存器的各元素，vdup.32 qd,rt
+    NeonLoadStore,  ///< NEON访存，vld1.32 {dd,dd+1},[rn]以及写回基址的[rn]!
+};
+
+/// @brief 编码表的表项，bits为格式内区分指令的编码位，数据处理类为4位的操作码
+struct ArmEncoding {
+    ArmFormat format;
+    uint32_t bits;
+};
+
+// 数据处理指令的4位操作码
+#define ARM_DP_AND 0x0
+#define ARM_DP_EOR 0x1
+#define ARM_DP_SUB 0x2
+#define ARM_DP_RSB 0x3
+#define ARM_DP_ADD 0x4
+#define ARM_DP_ADC 0x5
+#define ARM_DP_SBC 0x6
+#define ARM_DP_TST 0x8
+#define ARM_DP_TEQ 0x9
+#define ARM_DP_CMP 0xA
+#define ARM_DP_CMN 0xB
+#define ARM_DP_ORR 0xC
+#define ARM_DP_MOV 0xD
+#define ARM_DP_BIC 0xE
+#define ARM_DP_MVN 0xF
+
+/// @brief 指令编码表，按助记符（不含条件后缀）查找
+static const std::unordered_map<std::string, ArmEncoding> encodingTable = {
+    {"and", {ArmFormat::DataProc, ARM_DP_AND}},
+    {"eor", {ArmFormat::DataProc, ARM_DP_EOR}},
+    {"sub", {ArmFormat::DataProc, ARM_DP_SUB}},
+    {"rsb", {ArmFormat::DataProc, ARM_DP_RSB}},
+    {"add", {ArmFormat::DataProc, ARM_DP_ADD}},
+    {"subs", {ArmFormat::DataProc, ARM_DP_SUB}},
+    {"adds", {ArmFormat::DataProc, ARM_DP_ADD}},
+    {"adc", {ArmFormat::DataProc, ARM_DP_ADC}},
+    {"sbc", {ArmFormat::DataProc, ARM_DP_SBC}},
+    {"orr", {ArmFormat::DataProc, ARM_DP_ORR}},
+    {"bic", {ArmFormat::DataProc, ARM_DP_BIC}},
+    {"mov", {ArmFormat::Move, ARM_DP_MOV}},
+    {"mvn", {ArmFormat::Move, ARM_DP_MVN}},
+    {"tst", {ArmFormat::Compare, ARM_DP_TST}},
+    {"teq", {ArmFormat::Compare, ARM_DP_TEQ}},
+    {"cmp", {ArmFormat::Compare, ARM_DP_CMP}},
+    {"cmn", {ArmFormat::Compare, ARM_DP_CMN}},
+    {"lsl", {ArmFormat::Shift, 0x0}},
+    {"lsr", {ArmFormat::Shift, 0x1}},
+    {"asr", {ArmFormat::Shift, 0x2}},
+    {"mul", {ArmFormat::Multiply, 0x00000090}},
+    {"mla", {ArmFormat::Multiply, 0x00200090}},
+    {"mls", {ArmFormat::Multiply, 0x00600090}},
+    {"sdiv", {ArmFormat::Divide, 0x0710F010}},
+    {"udiv", {ArmFormat::Divide, 0x0730F010}},
+    {"movw", {ArmFormat::MoveWide, 0x03000000}},
+    {"movt", {ArmFormat::MoveWide, 0x03400000}},
+    {"ldr", {ArmFormat::LoadStore, 0x00100000}},
+    {"str", {ArmFormat::LoadStore, 0x00000000}},
+    {"ldrb", {ArmFormat::LoadStore, 0x00500000}},
+    {"strb", {ArmFormat::LoadStore, 0x00400000}},
+    {"b", {ArmFormat::Branch, 0x0A000000}},
+    {"bl", {ArmFormat::Branch, 0x0B000000}},
+    {"bx", {ArmFormat::BranchExchange, 0x012FFF10}},
+    {"blx", {ArmFormat::BranchExchange, 0x012FFF30}},
+    {"push", {ArmFormat::BlockTransfer, 0x092D0000}},
+    {"pop", {ArmFormat::BlockTransfer, 0x08BD0000}},
+    {"stmia", {ArmFormat::BlockTransfer, 0x08800000}},
+    {"nop", {ArmFormat::Nop, 0x0320F000}},
+    {"vadd.f32", {ArmFormat::VfpArith, 0x0E300A00}},
+    {"vsub.f32", {ArmFormat::VfpArith, 0x0E300A40}},
+    {"vmul.f32", {ArmFormat::VfpArith, 0x0E200A00}},
+    {"vdiv.f32", {ArmFormat::VfpArith, 0x0E800A00}},
+    {"vneg.f32", {ArmFormat::VfpUnary, 0x0EB10A40}},
+    {"vcmp.f32", {ArmFormat::VfpUnary, 0x0EB40A40}},
+    {"vcvt.f32.s32", {ArmFormat::VfpUnary, 0x0EB80AC0}},
+    {"vcvt.s32.f32", {ArmFormat::VfpUnary, 0x0EBD0AC0}},
+    {"vmov", {ArmFormat::VfpMove, 0x0E000A10}},
+    {"vmrs", {ArmFormat::VfpStatus, 0x0EF1FA10}},
+    {"vldr", {ArmFormat::VfpLoadStore, 0x0D100A00}},
+    {"vstr", {ArmFormat::VfpLoadStore, 0x0D000A00}},
+    {"vadd.i32", {ArmFormat::NeonArith, 0xF2200840}},
+    {"vsub.i32", {ArmFormat::NeonArith, 0xF3200840}},
+    {"vmul.i32", {ArmFormat::NeonArith, 0xF2200950}},
+    {"vcgt.s32", {ArmFormat::NeonArith, 0xF2200340}},
+    {"vcge.s32", {ArmFormat::NeonArith, 0xF2200350}},
+    {"vceq.i32", {ArmFormat::NeonArith, 0xF3200850}},
+    {"vtst.32", {ArmFormat::NeonArith, 0xF2200850}},
+    {"vorr", {ArmFormat::NeonArith, 0xF2200150}},
+    {"vbsl", {ArmFormat::NeonArith, 0xF3100150}},
+    {"vmvn", {ArmFormat::NeonUnary, 0xF3B005C0}},
+    {"vneg.s32", {ArmFormat::NeonUnary, 0xF3B903C0}},
+    {"vshr.u32", {ArmFormat::NeonShift, 0xF3800050}},
+    {"vdup.32", {ArmFormat::NeonDup, 0x0EA00B10}},
+    {"vld1.32", {ArmFormat::NeonLoadStore, 0xF4200A80}},
+    {"vst1.32", {ArmFormat::NeonLoadStore, 0xF4000A80}},
+};
+
+/// @brief 条件后缀对应的4位条件码
+static const std::unordered_map<std::string, uint32_t> condTable = {
+    {"eq", 0x0},
+    {"ne", 0x1},
+    {"cs", 0x2},
+    {"hs", 0x2},
+    {"cc", 0x3},
+    {"lo", 0x3},
+    {"mi", 0x4},
+    {"pl", 0x5},
+    {"vs", 0x6},
+    {"vc", 0x7},
+    {"hi", 0x8},
+    {"ls", 0x9},
+    {"ge", 0xA},
+    {"lt", 0xB},
+    {"gt", 0xC},
+    {"le", 0xD},
+    {"al", 0xE},
+};
+
+/// @brief 无条件执行的条件码
+#define ARM_COND_AL 0xE
+
+/// @brief 解析寄存器名，如r0、fp、sp
+/// @param str 寄存器名
+/// @param reg 寄存器编号
+/// @return true：成功，false：不是寄存器
+static bool parseReg(const std::string & str, uint32_t & reg)
+{
+    for (int k = 0; k < PlatformArm32::maxRegNum; ++k) {
+        if (str == PlatformArm32::regName[k]) {
+            reg = k;
+            return true;
+        }
+    }
+
+    // r11-r15等别名
+    if ((str.size() >= 2) && (str[0] == 'r')) {
+        char * end;
+        long no = std::strtol(str.c_str() + 1, &end, 10);
+        if ((*end == '\0') && (no >= 0) && (no < PlatformArm32::maxRegNum)) {
+            reg = (uint32_t) no;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// @brief 解析s寄存器名，如s0、s31
+/// @param str 寄存器名
+/// @param reg 寄存器编号
+/// @return true：成功，false：不是s寄存器
+static bool parseSReg(const std::string & str, uint32_t & reg)
+{
+    for (int k = 0; k < PlatformArm32::maxFloatRegNum; ++k) {
+        if (str == PlatformArm32::floatRegName[k]) {
+            reg = k;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// @brief s寄存器编号编码到指令中，高4位在field开始的4位，最低位在bit位
+/// @param reg s寄存器编号
+/// @param field 高4位的开始位置
+/// @param bit 最低位的位置
+/// @return 编码位
+static uint32_t sRegBits(uint32_t reg, uint32_t field, uint32_t bit)
+{
+    return ((reg >> 1) << field) | ((reg & 1) << bit);
+}
+
+/// @brief 解析q寄存器名，如q0、q15
+/// @param str 寄存器名
+/// @param reg 对应的第一个d寄存器的编号，即q寄存器编号的2倍
+/// @return true：成功，false：不是q寄存器
+static bool parseQReg(const std::string & str, uint32_t & reg)
+{
+    if ((str.size() < 2) || (str[0] != 'q')) {
+        return false;
+    }
+
+    char * end;
+    long no = std::strtol(str.c_str() + 1, &end, 10);
+    if ((*end != '\0') || (no < 0) || (no > 15)) {
+        return false;
+    }
+
+    reg = (uint32_t) no * 2;
+
+    return true;
+}
+
+/// @brief d寄存器编号编码到指令中，低4位在field开始的4位，最高位在bit位
+/// @param reg d寄存器编号
+/// @param field 低4位的开始位置
+/// @param bit 最高位的位置
+/// @return 编码位
+static uint32_t dRegBits(uint32_t reg, uint32_t field, uint32_t bit)
+{
+    return ((reg & 0xF) << field) | ((reg >> 4) << bit);
+}
+
+/// @brief 解析整数，可带符号，支持十进制与0x开头的十六进制
+/// @param str 字符串
+/// @param value 整数值
+/// @return true：成功，false：不是整数
+static bool parseInt(const std::string & str, int64_t & value)
+{
+    if (str.empty()) {
+        return false;
+    }
+
+    char * end;
+    value = std::strtoll(str.c_str(), &end, 0);
+
+    return *end == '\0';
+}
+
+/// @brief 解析立即数，如#100、#-16
+/// @param str 字符串
+/// @param value 立即数
+/// @return true：成功，false：不是立即数
+static bool parseImm(const std::string & str, int64_t & value)
+{
+    return (!str.empty()) && (str[0] == '#') && parseInt(str.substr(1), value);
+}
+
+/// @brief 按逗号拆分字符串，并去掉各项两侧的空格
+/// @param str 字符串
+/// @return 拆分后的各项
+static std::vector<std::string> splitOperands(const std::string & str)
+{
+    std::vector<std::string> items;
+
+    size_t start = 0;
+    while (start <= str.size()) {
+        size_t end = str.find(',', start);
+        if (end == std::string::npos) {
+            end = str.size();
+        }
+
+        std::string item = str.substr(start, end - start);
+        size_t first = item.find_first_not_of(' ');
+        size_t last = item.find_last_not_of(' ');
+        items.push_back(first == std::string::npos ? "" : item.substr(first, last - first + 1));
+
+        start = end + 1;
+    }
+
+    return items;
+}
+
+/// @brief 立即数不能编码时改用对应的指令，如add rd,rn,#-16改为sub rd,rn,#16
+/// @param opcode 数据处理指令的操作码，可能被替换
+/// @param value 立即数
+/// @param imm12 编码后的12位
+/// @return true：可以编码，false：不可以
+static bool encodeOperandImm(uint32_t & opcode, int64_t value, uint32_t & imm12)
+{
+    if (EncoderArm32::encodeImm((uint32_t) value, imm12)) {
+        return true;
+    }
+
+    uint32_t altOpcode;
+    int64_t altValue;
+
+    switch (opcode) {
+        case ARM_DP_ADD:
+            altOpcode = ARM_DP_SUB;
+            altValue = -value;
+            break;
+        case ARM_DP_SUB:
+            altOpcode = ARM_DP_ADD;
+            altValue = -value;
+            break;
+        case ARM_DP_CMP:
+            altOpcode = ARM_DP_CMN;
+            altValue = -value;
+            break;
+        case ARM_DP_CMN:
+            altOpcode = ARM_DP_CMP;
+            altValue = -value;
+            break;
+        case ARM_DP_ADC:
+            altOpcode = ARM_DP_SBC;
+            altValue = ~value;
+            break;
+        case ARM_DP_SBC:
+            altOpcode = ARM_DP_ADC;
+            altValue = ~value;
+            break;
+        case ARM_DP_AND:
+            altOpcode = ARM_DP_BIC;
+            altValue = ~value;
+            break;
+        case ARM_DP_BIC:
+            altOpcode = ARM_DP_AND;
+            altValue = ~value;
+            break;
+        case ARM_DP_MOV:
+            altOpcode = ARM_DP_MVN;
+            altValue = ~value;
+            break;
+        case ARM_DP_MVN:
+            altOpcode = ARM_DP_MOV;
+            altValue = ~value;
+            break;
+        default:
+            return false;
+    }
+
+    if (!EncoderArm32::encodeImm((uint32_t) altValue, imm12)) {
+        return false;
+    }
+
+    opcode = altOpcode;
+
+    return true;
+}
+
+/// @brief 编码A32数据处理指令的立即数，8位数字循环右移偶数位
+/// @param value 立即数
+/// @param imm12 编码后的12位
+/// @return true：可以编码，false：不可以
+bool EncoderArm32::encodeImm(uint32_t value, uint32_t & imm12)
+{
+    for (uint32_t rot = 0; rot < 16; ++rot) {
+
+        // 循环左移2*rot位后不超过8位，则value即为其循环右移2*rot位的结果
+        uint32_t imm8 = rot ? ((value << (2 * rot)) | (value >> (32 - 2 * rot))) : value;
+        if (imm8 <= 0xFF) {
+            imm12 = (rot << 8) | imm8;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// @brief 设置出错信息
+/// @param inst 出错的指令
+/// @param msg 出错原因
+/// @return 总是false
+bool EncoderArm32::setLastError(ArmInst * inst, const std::string & msg)
+{
+    lastError = "指令(" + inst->outPut() + ")不能编码：" + msg;
+
+    return false;
+}
+
+/// @brief 编码一个函数的指令序列
+/// @param code ILOC指令序列
+/// @param machineCode 编码得到的机器码
+/// @return true：成功，false：存在不能编码的指令
+bool EncoderArm32::encode(std::list<ArmInst *> & code, ArmMachineCode & machineCode)
+{
+    labels.clear();
+    branchFixups.clear();
+
+    for (ArmInst * inst: code) {
+
+        // 无用指令、占位指令以及注释不产生机器码
+        if (inst->dead || inst->opcode.empty() || (inst->opcode == "@")) {
+            continue;
+        }
+
+        if (inst->result == ":") {
+            // Label指令，记录其偏移
+            labels[inst->opcode] = (uint32_t) machineCode.words.size() * 4;
+            continue;
+        }
+
+        if (!encodeInst(inst, machineCode)) {
+            return false;
+        }
+    }
+
+    // 跳转目标为函数内的Label时直接修正偏移，否则为外部符号，由链接器修正
+    for (auto & fixup: branchFixups) {
+
+        uint32_t & word = machineCode.words[fixup.first];
+        uint32_t offset = (uint32_t) fixup.first * 4;
+
+        auto pIter = labels.find(fixup.second);
+        if (pIter != labels.end()) {
+            // 偏移相对于当前指令地址加8，以字为单位
+            int32_t disp = ((int32_t) pIter->second - (int32_t) (offset + 8)) >> 2;
+            word |= (uint32_t) disp & 0x00FFFFFF;
+        } else if (fixup.second.compare(0, std::string(IR_LABEL_PREFIX).size(), IR_LABEL_PREFIX) == 0) {
+            lastError = "跳转的目标Label(" + fixup.second + ")不存在";
+            return false;
+        } else {
+            // 无条件的bl为函数调用，其它为跳转；加数-8编码在指令中
+            bool isCall = ((word & 0xFF000000) == 0xEB000000);
+            word |= 0x00FFFFFE;
+            machineCode.relocs.push_back({offset, fixup.second, isCall ? (uint32_t) R_ARM_CALL : R_ARM_JUMP24});
+        }
+    }
+
+    return true;
+}
+
+/// @brief 编码一条指令
+/// @param inst 指令
+/// @param machineCode 机器码
+/// @return true：成功，false：失败
+bool EncoderArm32::encodeInst(ArmInst * inst, ArmMachineCode & machineCode)
+{
+    // 先按完整的助记符查找，找不到时去掉两个字符的条件后缀再查找，如movlt、bne
+    uint32_t cond = ARM_COND_AL;
+    auto pIter = encodingTable.find(inst->opcode);
+    if ((pIter == encodingTable.end()) && (inst->opcode.size() > 2)) {
+        auto condIter = condTable.find(inst->opcode.substr(inst->opcode.size() - 2));
+        if (condIter != condTable.end()) {
+            pIter = encodingTable.find(inst->opcode.substr(0, inst->opcode.size() - 2));
+            cond = condIter->second;
+        }
+    }
+
+    if (pIter == encodingTable.end()) {
+        return setLastError(inst, "不支持的指令");
+    }
+
+    if (!inst->cond.empty()) {
+        auto condIter = condTable.find(inst->cond);
+        if (condIter == condTable.end()) {
+            return setLastError(inst, "不支持的条件");
+        }
+        cond = condIter->second;
+    }
+
+    const ArmEncoding & encoding = pIter->second;
+    uint32_t word = 0;
+    uint32_t rd, rn, rm, rs, ra;
+    int64_t value;
+
+    // 第二个源操作数，寄存器或立即数，opcode在立即数不能编码时可能被替换
+    auto operand2 = [&](uint32_t & opcode, const std::string & str, uint32_t & op2) {
+        uint32_t imm12;
+        if (parseReg(str, op2)) {
+            return true;
+        }
+        if (parseImm(str, value) && encodeOperandImm(opcode, value, imm12)) {
+            op2 = (1u << 25) | imm12;
+            return true;
+        }
+        return false;
+    };
+
+    switch (encoding.format) {
+
+        case ArmFormat::DataProc: {
+            // add rd,rn,op2，只有两个操作数时rd兼作第一个源操作数
+            std::string src1 = inst->arg2.empty() ? inst->result : inst->arg1;
+            std::string src2 = inst->arg2.empty() ? inst->arg1 : inst->arg2;
+
+            uint32_t opcode = encoding.bits;
+            uint32_t op2;
+            if (!parseReg(inst->result, rd) || !parseReg(src1, rn) || !operand2(opcode, src2, op2)) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            // adds/subs设置标志位，改用对应的指令时进位标志不同，不能替换
+            uint32_t setFlags = inst->setsFlags() ? 1 : 0;
+            if (setFlags && (opcode != encoding.bits)) {
+                return setLastError(inst, "立即数不能编码");
+            }
+
+            word = (opcode << 21) | (setFlags << 20) | (rn << 16) | (rd << 12) | op2;
+            break;
+        }
+
+        case ArmFormat::Move: {
+            // mov rd,op2，立即数不能编码时16位以内的改用movw
+            uint32_t opcode = encoding.bits;
+            uint32_t op2;
+            if (!parseReg(inst->result, rd)) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            if (operand2(opcode, inst->arg1, op2)) {
+                word = (opcode << 21) | (rd << 12) | op2;
+            } else if ((encoding.bits == ARM_DP_MOV) && parseImm(inst->arg1, value) && (value >= 0) &&
+                       (value <= 0xFFFF)) {
+                word = 0x03000000 | (((uint32_t) value & 0xF000) << 4) | (rd << 12) | ((uint32_t) value & 0x0FFF);
+            } else {
+                return setLastError(inst, "操作数错误");
+            }
+            break;
+        }
+
+        case ArmFormat::Compare: {
+            // cmp rn,op2，设置标志位
+            uint32_t opcode = encoding.bits;
+            uint32_t op2;
+            if (!parseReg(inst->result, rn) || !operand2(opcode, inst->arg1, op2)) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            word = (opcode << 21) | (1u << 20) | (rn << 16) | op2;
+            break;
+        }
+
+        case ArmFormat::Shift: {
+            // lsl rd,rm,#n 或 lsl rd,rm,rs，即mov rd,rm,lsl #n
+            if (!parseReg(inst->result, rd) || !parseReg(inst->arg1, rm)) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            if (parseReg(inst->arg2, rs)) {
+                word = 0x01A00010 | (rd << 12) | (rs << 8) | (encoding.bits << 5) | rm;
+            } else if (parseImm(inst->arg2, value) && (value >= 0) && (value <= 32) &&
+                       ((value < 32) || (encoding.bits != 0))) {
+                // lsr与asr移位32位时编码为0
+                word = 0x01A00000 | (rd << 12) | (((uint32_t) value & 0x1F) << 7) | (encoding.bits << 5) | rm;
+            } else {
+                return setLastError(inst, "操作数错误");
+            }
+            break;
+        }
+
+        case ArmFormat::Multiply: {
+            // mul rd,rm,rs 或 mla/mls rd,rm,rs,ra
+            ra = 0;
+            bool accumulate = (encoding.bits != 0x00000090);
+            if (!parseReg(inst->result, rd) || !parseReg(inst->arg1, rm) || !parseReg(inst->arg2, rs) ||
+                (accumulate && !parseReg(inst->addition, ra))) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            word = encoding.bits | (rd << 16) | (ra << 12) | (rs << 8) | rm;
+            break;
+        }
+
+        case ArmFormat::Divide: {
+            // sdiv rd,rn,rm
+            if (!parseReg(inst->result, rd) || !parseReg(inst->arg1, rn) || !parseReg(inst->arg2, rm)) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            word = encoding.bits | (rd << 16) | (rm << 8) | rn;
+            break;
+        }
+
+        case ArmFormat::MoveWide: {
+            // movw rd,#:lower16:100 或 movt rd,#:upper16:g，符号地址由链接器填写
+            if (!parseReg(inst->result, rd) || (inst->arg1.size() < 2) || (inst->arg1[0] != '#')) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            bool isMovt = (encoding.bits == 0x03400000);
+            std::string operand = inst->arg1.substr(1);
+            bool lower = operand.compare(0, 9, ":lower16:") == 0;
+            bool upper = operand.compare(0, 9, ":upper16:") == 0;
+            if (lower || upper) {
+                operand = operand.substr(9);
+            }
+
+            uint32_t imm16;
+            if (parseInt(operand, value)) {
+                if (upper) {
+                    imm16 = ((uint32_t) value >> 16) & 0xFFFF;
+                } else if (lower || ((value >= 0) && (value <= 0xFFFF))) {
+                    imm16 = (uint32_t) value & 0xFFFF;
+                } else {
+                    return setLastError(inst, "立即数超过16位");
+                }
+            } else if ((lower && !isMovt) || (upper && isMovt)) {
+                // 符号地址的低16位或高16位，加数0编码在指令中
+                imm16 = 0;
+                machineCode.relocs.push_back({(uint32_t) machineCode.words.size() * 4,
+                                              operand,
+                                              isMovt ? (uint32_t) R_ARM_MOVT_ABS : R_ARM_MOVW_ABS_NC});
+            } else {
+                return setLastError(inst, "操作数错误");
+            }
+
+            word = encoding.bits | ((imm16 & 0xF000) << 4) | (rd << 12) | (imm16 & 0x0FFF);
+            break;
+        }
+
+        case ArmFormat::LoadStore: {
+            // ldr rd,[rn] | [rn,#imm] | [rn,rm] | [rn,#imm]! | [rn],#imm
+            std::string addr = inst->arg1;
+            bool writeBack = (!addr.empty()) && (addr.back() == '!');
+            if (writeBack) {
+                addr.pop_back();
+            }
+
+            if (!parseReg(inst->result, rd) || (addr.size() < 3) || (addr.front() != '[') || (addr.back() != ']')) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            std::vector<std::string> items = splitOperands(addr.substr(1, addr.size() - 2));
+
+            // 后变址时偏移在方括号外
+            bool postIndex = !inst->arg2.empty();
+            if ((items.size() > 2) || (postIndex && ((items.size() != 1) || writeBack)) || !parseReg(items[0], rn)) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            std::string offset = postIndex ? inst->arg2 : ((items.size() == 2) ? items[1] : "#0");
+
+            uint32_t up = 1;
+            uint32_t offsetBits;
+            if (parseImm(offset, value)) {
+                if ((value <= -4096) || (value >= 4096)) {
+                    return setLastError(inst, "偏移超过12位");
+                }
+                if (value < 0) {
+                    up = 0;
+                    value = -value;
+                }
+                offsetBits = (uint32_t) value;
+            } else {
+                if (offset[0] == '-') {
+                    up = 0;
+                    offset = offset.substr(1);
+                }
+                if (!parseReg(offset, rm)) {
+                    return setLastError(inst, "操作数错误");
+                }
+                offsetBits = (1u << 25) | rm;
+            }
+
+            // P=1为先变址，W=1为写回基址
+            uint32_t pre = postIndex ? 0 : 1;
+            word = 0x04000000 | (pre << 24) | (up << 23) | ((writeBack ? 1u : 0u) << 21) | encoding.bits | (rn << 16) |
+                   (rd << 12) | offsetBits;
+            break;
+        }
+
+        case ArmFormat::Branch: {
+            // b label，偏移在函数内的所有Label确定后修正
+            if (inst->result.empty()) {
+                return setLastError(inst, "缺少跳转目标");
+            }
+
+            branchFixups.emplace_back(machineCode.words.size(), inst->result);
+            word = encoding.bits;
+            break;
+        }
+
+        case ArmFormat::BranchExchange: {
+            // bx lr
+            if (!parseReg(inst->result, rm)) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            word = encoding.bits | rm;
+            break;
+        }
+
+        case ArmFormat::BlockTransfer: {
+            // push {r4,fp,lr}，寄存器列表也可以是r4-r7的范围形式；stmia r0!,{r1,r2}的基址寄存器在前
+            std::string list = inst->result;
+            bool baseForm = (encoding.bits == 0x08800000);
+            uint32_t baseBits = 0;
+            if (baseForm) {
+                std::string base = inst->result;
+                bool writeBack = !base.empty() && (base.back() == '!');
+                if (writeBack) {
+                    base.pop_back();
+                }
+                if (!parseReg(base, rn)) {
+                    return setLastError(inst, "操作数错误");
+                }
+                list = inst->arg1;
+                baseBits = (rn << 16) | ((writeBack ? 1u : 0u) << 21);
+            }
+
+            if ((list.size() < 3) || (list.front() != '{') || (list.back() != '}')) {
+                return setLastError(inst, "寄存器列表错误");
+            }
+
+            uint32_t mask = 0;
+            for (auto & item: splitOperands(list.substr(1, list.size() - 2))) {
+                size_t dash = item.find('-');
+                uint32_t first, last;
+                if (dash == std::string::npos) {
+                    if (!parseReg(item, first)) {
+                        return setLastError(inst, "寄存器列表错误");
+                    }
+                    last = first;
+                } else if (!parseReg(item.substr(0, dash), first) || !parseReg(item.substr(dash + 1), last) ||
+                           (first > last)) {
+                    return setLastError(inst, "寄存器列表错误");
+                }
+
+                for (uint32_t reg = first; reg <= last; ++reg) {
+                    mask |= 1u << reg;
+                }
+            }
+
+            if (mask == 0) {
+                return setLastError(inst, "寄存器列表错误");
+            }
+
+            if (!baseForm && ((mask & (mask - 1)) == 0)) {
+                // 只有一个寄存器时与汇编器一样采用str rd,[sp,#-4]!与ldr rd,[sp],#4
+                rd = 0;
+                while (!(mask & (1u << rd))) {
+                    rd++;
+                }
+                word = ((encoding.bits == 0x092D0000) ? 0x052D0004 : 0x049D0004) | (rd << 12);
+            } else {
+                word = encoding.bits | baseBits | mask;
+            }
+            break;
+        }
+
+        case ArmFormat::Nop:
+            word = encoding.bits;
+            break;
+
+        case ArmFormat::VfpArith: {
+            // vadd.f32 sd,sn,sm，Sd为Vd:D，Sn为Vn:N，Sm为Vm:M
+            if (!parseSReg(inst->result, rd) || !parseSReg(inst->arg1, rn) || !parseSReg(inst->arg2, rm)) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            word = encoding.bits | sRegBits(rd, 12, 22) | sRegBits(rn, 16, 7) | sRegBits(rm, 0, 5);
+            break;
+        }
+
+        case ArmFormat::VfpUnary: {
+            // vneg.f32 sd,sm 以及 vcmp.f32 sd,sm、vcvt.f32.s32 sd,sm
+            if (!parseSReg(inst->result, rd) || !parseSReg(inst->arg1, rm)) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            word = encoding.bits | sRegBits(rd, 12, 22) | sRegBits(rm, 0, 5);
+            break;
+        }
+
+        case ArmFormat::VfpMove: {
+            // vmov sn,rt 或 vmov rt,sn，bit20为1时传送到通用寄存器
+            if (parseSReg(inst->result, rn) && parseReg(inst->arg1, rd)) {
+                word = encoding.bits | sRegBits(rn, 16, 7) | (rd << 12);
+            } else if (parseReg(inst->result, rd) && parseSReg(inst->arg1, rn)) {
+                word = encoding.bits | (1u << 20) | sRegBits(rn, 16, 7) | (rd << 12);
+            } else {
+                return setLastError(inst, "操作数错误");
+            }
+            break;
+        }
+
+        case ArmFormat::VfpStatus:
+            // 只支持vmrs APSR_nzcv,fpscr
+            if ((inst->result != "APSR_nzcv") || (inst->arg1 != "fpscr")) {
+                return setLastError(inst, "操作数错误");
+            }
+            word = encoding.bits;
+            break;
+
+        case ArmFormat::VfpLoadStore: {
+            // vldr sd,[rn] | [rn,#imm]，偏移为4的倍数，编码为8位的字偏移
+            std::string addr = inst->arg1;
+            if (!parseSReg(inst->result, rd) || (addr.size() < 3) || (addr.front() != '[') || (addr.back() != ']')) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            std::vector<std::string> items = splitOperands(addr.substr(1, addr.size() - 2));
+            if ((items.size() > 2) || !parseReg(items[0], rn)) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            value = 0;
+            if ((items.size() == 2) && !parseImm(items[1], value)) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            uint32_t up = 1;
+            if (value < 0) {
+                up = 0;
+                value = -value;
+            }
+            if ((value % 4 != 0) || (value > 1020)) {
+                return setLastError(inst, "偏移超出范围");
+            }
+
+            word = encoding.bits | (up << 23) | sRegBits(rd, 12, 22) | (rn << 16) | ((uint32_t) value / 4);
+            break;
+        }
+
+        case ArmFormat::NeonArith: {
+            // vadd.i32 qd,qn,qm，Dd为D:Vd，Dn为N:Vn，Dm为M:Vm
+            if (!parseQReg(inst->result, rd) || !parseQReg(inst->arg1, rn) || !parseQReg(inst->arg2, rm)) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            word = encoding.bits | dRegBits(rd, 12, 22) | dRegBits(rn, 16, 7) | dRegBits(rm, 0, 5);
+            break;
+        }
+
+        case ArmFormat::NeonUnary: {
+            // vneg.s32 qd,qm
+            if (!parseQReg(inst->result, rd) || !parseQReg(inst->arg1, rm)) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            word = encoding.bits | dRegBits(rd, 12, 22) | dRegBits(rm, 0, 5);
+            break;
+        }
+
+        case ArmFormat::NeonShift: {
+            // vshr.u32 qd,qm,#n，32位元素的imm6为64-n
+            if (!parseQReg(inst->result, rd) || !parseQReg(inst->arg1, rm) || !parseImm(inst->arg2, value) ||
+                (value < 1) || (value > 32)) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            word = encoding.bits | ((uint32_t) (64 - value) << 16) | dRegBits(rd, 12, 22) | dRegBits(rm, 0, 5);
+            break;
+        }
+
+        case ArmFormat::NeonDup: {
+            // vdup.32 qd,rt，可条件执行
+            if (!parseQReg(inst->result, rd) || !parseReg(inst->arg1, rm)) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            word = encoding.bits | dRegBits(rd, 16, 7) | (rm << 12);
+            break;
+        }
+
+        case ArmFormat::NeonLoadStore: {
+            // vld1.32 {dd,dd+1},[rn]，Rm为0xF时不写回，为0xD时基址加访问的字节数
+            std::string list = inst->result;
+            std::string addr = inst->arg1;
+            bool writeBack = !addr.empty() && (addr.back() == '!');
+            if (writeBack) {
+                addr.pop_back();
+            }
+
+            if ((list.size() < 3) || (list.front() != '{') || (list.back() != '}') || (addr.size() < 3) ||
+                (addr.front() != '[') || (addr.back() != ']') || !parseReg(addr.substr(1, addr.size() - 2), rn)) {
+                return setLastError(inst, "操作数错误");
+            }
+
+            std::vector<std::string> items = splitOperands(list.substr(1, list.size() - 2));
+            uint32_t first;
+            if ((items.size() != 2) || (items[0].size() < 2) || (items[1].size() < 2) || (items[0][0] != 'd') ||
+                (items[1][0] != 'd') || !parseInt(items[0].substr(1), value) || (value < 0) || (value > 30)) {
+                return setLastError(inst, "寄存器列表错误");
+            }
+            first = (uint32_t) value;
+            if (!parseInt(items[1].substr(1), value) || ((uint32_t) value != first + 1)) {
+                return setLastError(inst, "寄存器列表错误");
+            }
+
+            word = encoding.bits | dRegBits(first, 12, 22) | (rn << 16) | (writeBack ? 0xDu : 0xFu);
+            break;
+        }
+    }
+
+    // NEON的数据处理与访存指令不能条件执行，高4位为0xF，已包含在编码中
+    if ((word >> 28) == 0xF) {
+        if (cond != ARM_COND_AL) {
+            return setLastError(inst, "不能条件执行");
+        }
+        machineCode.words.push_back(word);
+        return true;
+    }
+
+    machineCode.words.push_back((cond << 28) | word);
+
+    return true;
+}
@@ -0,0 +1,99 @@
+///
+/// @file EncoderArm32.h
+/// @brief ARM32(A32)指令编码的头文件，把ILOC指令序列直接编码为机器码
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ILocArm32.h"
+
+// ARM32 ELF的重定位类型
+#define R_ARM_ABS32 2
+#define R_ARM_CALL 28
+#define R_ARM_JUMP24 29
+#define R_ARM_MOVW_ABS_NC 43
+#define R_ARM_MOVT_ABS 44
+
+/// @brief 机器码中对符号的引用，由链接器根据符号地址修正
+struct ArmReloc {
+
+    /// @brief 被修正的指令相对于所在代码块开头的偏移
+    uint32_t offset;
+
+    /// @brief 引用的符号名
+    std::string symbol;
+
+    /// @brief 重定位类型，如R_ARM_CALL
+    uint32_t type;
+};
+
+/// @brief 一个函数的机器码，函数内的Label已经解析，对外部符号的引用记录为重定位
+struct ArmMachineCode {
+
+    /// @brief 指令序列，每条指令4字节
+    std::vector<uint32_t> words;
+
+    /// @brief 重定位项
+    std::vector<ArmReloc> relocs;
+};
+
+/// @brief ARM32指令编码器，按编码表把ArmInst编码为A32指令
+class EncoderArm32 {
+
+public:
+    /// @brief 编码一个函数的指令序列
+    /// @param code ILOC指令序列
+    /// @param machineCode 编码得到的机器码
+    /// @return true：成功，false：存在不能编码的指令
+    bool encode(std::list<ArmInst *> & code, ArmMachineCode & machineCode);
+
+    /// @brief 获取出错信息
+    /// @return 出错信息
+    const std::string & getLastError() const
+    {
+        return lastError;
+    }
+
+    /// @brief 编码A32数据处理指令的立即数，8位数字循环右移偶数位
+    /// @param value 立即数
+    /// @param imm12 编码后的12位
+    /// @return true：可以编码，false：不可以
+    static bool encodeImm(uint32_t value, uint32_t & imm12);
+
+private:
+    /// @brief 编码一条指令
+    /// @param inst 指令
+    /// @param machineCode 机器码
+    /// @return true：成功，false：失败
+    bool encodeInst(ArmInst * inst, ArmMachineCode & machineCode);
+
+    /// @brief 设置出错信息
+    /// @param inst 出错的指令
+    /// @param msg 出错原因
+    /// @return 总是false
+    bool setLastError(ArmInst * inst, const std::string & msg);
+
+    /// @brief 函数内的Label及其偏移
+    std::unordered_map<std::string, uint32_t> labels;
+
+    /// @brief 跳转到函数内Label的指令，待Label的偏移确定后修正
+    std::vector<std::pair<size_t, std::string>> branchFixups;
+
+    /// @brief 出错信息
+    std::string lastError;
+};
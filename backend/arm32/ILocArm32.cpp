@@ -15,9 +15,12 @@
 ///
 #include <cstdio>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "ILocArm32.h"
 #include "Common.h"
+#include "ConstFloat.h"
 #include "Function.h"
 #include "PlatformArm32.h"
 #include "Module.h"
@@ -64,52 +67,165 @@ void ArmInst::setDead()
     dead = true;
 }
 
+/// @brief 不带条件后缀的助记符，用于从movlt、bne等助记符中分离出条件
+static const std::unordered_set<std::string> baseOpcodes = {
+    "b",   "bl",  "bx",  "mov", "movw", "movt", "mvn", "add",  "sub", "rsb", "mul", "sdiv", "and",
+    "orr", "eor", "lsl", "lsr", "asr",  "cmp",  "cmn", "tst",  "ldr", "str", "push", "pop",
+};
+
+/// @brief 条件及其相反的条件
+static const std::unordered_map<std::string, std::string> inverseConds = {
+    {"eq", "ne"},
+    {"ne", "eq"},
+    {"cs", "cc"},
+    {"cc", "cs"},
+    {"hs", "lo"},
+    {"lo", "hs"},
+    {"mi", "pl"},
+    {"pl", "mi"},
+    {"vs", "vc"},
+    {"vc", "vs"},
+    {"hi", "ls"},
+    {"ls", "hi"},
+    {"ge", "lt"},
+    {"lt", "ge"},
+    {"gt", "le"},
+    {"le", "gt"},
+};
+
+/// @brief 设置标志位的指令
+static const std::unordered_set<std::string> flagSettingOpcodes = {
+    "cmp",
+    "cmn",
+    "tst",
+    "teq",
+    "adds",
+    "subs",
+    "movs",
+    "lsls",
+    "muls",
+    "rsbs",
+    "ands",
+    "orrs",
+    "eors",
+    "vmrs",
+};
+
+/*
+    是否是Label
+*/
+bool ArmInst::isLabel() const
+{
+    return (!dead) && (result == ":");
+}
+
+/*
+    是否是会产生机器码的指令
+*/
+bool ArmInst::isInst() const
+{
+    return (!dead) && (!opcode.empty()) && (opcode != "@") && (result != ":");
+}
+
+/*
+    获取指令的执行条件，并分离出不带条件的助记符
+*/
+std::string ArmInst::getCond(std::string & base) const
+{
+    base = opcode;
+
+    if (!cond.empty()) {
+        return cond;
+    }
+
+    if ((baseOpcodes.count(opcode) == 0) && (opcode.size() > 2)) {
+        std::string suffix = opcode.substr(opcode.size() - 2);
+        std::string prefix = opcode.substr(0, opcode.size() - 2);
+        if (inverseConds.count(suffix) && baseOpcodes.count(prefix)) {
+            base = prefix;
+            return suffix;
+        }
+    }
+
+    return "";
+}
+
+/*
+    是否设置标志位
+*/
+bool ArmInst::setsFlags() const
+{
+    return flagSettingOpcodes.count(opcode) != 0;
+}
+
+/*
+    获取相反的条件
+*/
+std::string ArmInst::invertCond(const std::string & _cond)
+{
+    auto pIter = inverseConds.find(_cond);
+    return (pIter == inverseConds.end()) ? "" : pIter->second;
+}
+
 /*
     输出函数
 */
 std::string ArmInst::outPut()
+{
+    std::string ret;
+
+    OutputStream os(ret);
+    outPut(os);
+
+    return ret;
+}
+
+/*
+    输出函数，直接写入输出流
+*/
+bool ArmInst::outPut(OutputStream & os)
 {
     // 无用代码，什么都不输出
     if (dead) {
-        return "";
+        return false;
     }
 
     // 占位指令,可能需要输出一个空操作，看是否支持 FIXME
     if (opcode.empty()) {
-        return "";
+        return false;
     }
 
-    std::string ret = opcode;
+    os << opcode;
 
     if (!cond.empty()) {
-        ret += cond;
+        os << cond;
     }
 
     // 结果输出
     if (!result.empty()) {
         if (result == ":") {
-            ret += result;
+            os << result;
         } else {
-            ret += " " + result;
+            os << ' ' << result;
         }
     }
 
     // 第一元参数输出
     if (!arg1.empty()) {
-        ret += "," + arg1;
+        os << ',' << arg1;
     }
 
     // 第二元参数输出
     if (!arg2.empty()) {
-        ret += "," + arg2;
+        os << ',' << arg2;
     }
 
     // 其他附加信息输出
     if (!addition.empty()) {
-        ret += "," + addition;
+        os << ',' << addition;
     }
 
-    return ret;
+    return true;
 }
 
 #define emit(...) code.push_back(new ArmInst(__VA_ARGS__))
@@ -131,32 +247,42 @@ ILocArm32::~ILocArm32()
     }
 }
 
+/// @brief add/sub指令是否可直接使用该立即数
+/// @param num 立即数
+/// @return true：可以，false：需要先加载到寄存器
+bool ILocArm32::isImm(int num)
+{
+    return thumb ? PlatformArm32::thumbConstExpr(num) : PlatformArm32::constExpr(num);
+}
+
+/// @brief ldr/str指令是否可直接使用该偏移
+/// @param num 偏移
+/// @return true：可以，false：需要先加载到寄存器
+bool ILocArm32::isDisp(int num)
+{
+    return thumb ? PlatformArm32::isThumbDisp(num) : PlatformArm32::isDisp(num);
+}
+
 /// @brief 删除无用的Label指令
 void ILocArm32::deleteUnusedLabel()
 {
-    std::list<ArmInst *> labelInsts;
+    // 先收集所有转移语句的目标Label，避免对每个Label都遍历一次指令序列
+    std::unordered_set<std::string> usedLabels;
     for (ArmInst * arm: code) {
-        if ((!arm->dead) && (arm->opcode[0] == '.') && (arm->result == ":")) {
-            labelInsts.push_back(arm);
+        // TODO 转移语句的指令标识符根据定义修改判断
+        if ((!arm->dead) && (arm->opcode[0] == 'b')) {
+            usedLabels.insert(arm->result);
         }
     }
 
     // 检测Label指令是否在被使用，也就是是否有跳转到该Label的指令
     // 如果没有使用，则设置为dead
-    for (ArmInst * labelArm: labelInsts) {
-        bool labelUsed = false;
-
-        for (ArmInst * arm: code) {
-            // TODO 转移语句的指令标识符根据定义修改判断
-            if ((!arm->dead) && (arm->opcode[0] == 'b') && (arm->result == labelArm->opcode)) {
-                labelUsed = true;
-                break;
+    for (ArmInst * arm: code) {
+        if ((!arm->dead) && (arm->opcode[0] == '.') && (arm->result == ":")) {
+            if (usedLabels.find(arm->opcode) == usedLabels.end()) {
+                arm->setDead();
             }
         }
-
-        if (!labelUsed) {
-            labelArm->setDead();
-        }
     }
 }
 
@@ -165,20 +291,40 @@ void ILocArm32::deleteUnusedLabel()
 /// @param outputEmpty 是否输出空语句
 void ILocArm32::outPut(FILE * file, bool outputEmpty)
 {
-    for (auto arm: code) {
+    OutputStream os(file);
+    outPut(os, outputEmpty);
+}
 
-        std::string s = arm->outPut();
+/// @brief 输出汇编到字符串中，便于各函数独立生成后再按次序合并输出
+/// @param str 追加输出的字符串
+/// @param outputEmpty 是否输出空语句
+void ILocArm32::outPut(std::string & str, bool outputEmpty)
+{
+    OutputStream os(str);
+    outPut(os, outputEmpty);
+}
+
+/// @brief 输出汇编到输出流
+/// @param os 输出流
+/// @param outputEmpty 是否输出空语句
+void ILocArm32::outPut(OutputStream & os, bool outputEmpty)
+{
+    for (auto arm: code) {
 
         if (arm->result == ":") {
             // Label指令，不需要Tab输出
-            fprintf(file, "%s\n", s.c_str());
+            arm->outPut(os);
+            os << '\n';
             continue;
         }
 
-        if (!s.empty()) {
-            fprintf(file, "\t%s\n", s.c_str());
-        } else if ((outputEmpty)) {
-            fprintf(file, "\n");
+        // 除Label指令外的指令前加Tab，空语句时不加
+        if ((!arm->dead) && (!arm->opcode.empty())) {
+            os << '\t';
+            arm->outPut(os);
+            os << '\n';
+        } else if (outputEmpty) {
+            os << '\n';
         }
     }
 }
@@ -287,7 +433,7 @@ void ILocArm32::load_base(int rs_reg_no, int base_reg_no, int offset)
     std::string rsReg = PlatformArm32::regName[rs_reg_no];
     std::string base = PlatformArm32::regName[base_reg_no];
 
-    if (PlatformArm32::isDisp(offset)) {
+    if (isDisp(offset)) {
         // 有效的偏移常量
         if (offset) {
             // [fp,#-16] [fp]
@@ -319,7 +465,7 @@ void ILocArm32::store_base(int src_reg_no, int base_reg_no, int disp, int tmp_re
 {
     std::string base = PlatformArm32::regName[base_reg_no];
 
-    if (PlatformArm32::isDisp(disp)) {
+    if (isDisp(disp)) {
         // 有效的偏移常量
 
         // 若disp为0，则直接采用基址，否则采用基址+偏移
@@ -361,6 +507,9 @@ void ILocArm32::load_var(int rs_reg_no, Value * src_var)
     if (Instanceof(constVal, ConstInt *, src_var)) {
         // 整型常量
         load_imm(rs_reg_no, constVal->getVal());
+    } else if (Instanceof(floatVal, ConstFloat *, src_var)) {
+        // 浮点常量按位模式加载
+        load_imm(rs_reg_no, floatVal->getBits());
     } else if (src_var->getRegId() != -1) {
         // 源操作数为寄存器变量
         int32_t src_regId = src_var->getRegId();
@@ -395,7 +544,7 @@ void ILocArm32::load_var(int rs_reg_no, Value * src_var)
             std::string rsReg = PlatformArm32::regName[rs_reg_no];
             std::string baseReg = PlatformArm32::regName[var_baseRegId];
 
-            if (PlatformArm32::constExpr(var_offset)) {
+            if (isImm(var_offset)) {
                 // add r8, fp, #-16  (计算数组首地址)
                 emit("add", rsReg, baseReg, toStr(var_offset));
             } else {
@@ -509,6 +658,69 @@ void ILocArm32::store_var(int src_reg_no, Value * dest_var, int tmp_reg_no)
     }
 }
 
+/// @brief 获取可用vldr/vstr直接访问的栈内变量的地址，偏移为4的倍数且在±1020以内
+/// @param var 变量
+/// @return 地址，如[fp,#-16]，不能直接访问时为空
+std::string ILocArm32::vfpAddr(Value * var)
+{
+    int32_t baseRegId = -1;
+    int64_t offset = -1;
+
+    if ((var->getRegId() != -1) || var->getType()->isArrayType() || !var->getMemoryAddr(&baseRegId, &offset)) {
+        return "";
+    }
+
+    if ((offset % 4 != 0) || (offset <= -1024) || (offset >= 1024)) {
+        return "";
+    }
+
+    std::string base = PlatformArm32::regName[baseRegId];
+    if (offset) {
+        base += "," + toStr((int) offset);
+    }
+
+    return "[" + base + "]";
+}
+
+/// @brief 加载变量到浮点寄存器，栈内变量用vldr直接加载，其它的先加载到通用寄存器再用vmov传送
+/// @param s_reg_no 浮点寄存器号
+/// @param var 变量
+/// @param tmp_reg_no 临时通用寄存器号
+void ILocArm32::load_float(int s_reg_no, Value * var, int tmp_reg_no)
+{
+    std::string addr = vfpAddr(var);
+
+    if (!addr.empty()) {
+        // vldr s0,[fp,#-16]
+        emit("vldr", PlatformArm32::floatRegName[s_reg_no], addr);
+    } else {
+        // 常量、全局变量、寄存器变量或偏移过大的栈内变量
+        load_var(tmp_reg_no, var);
+
+        // vmov s0,r4
+        emit("vmov", PlatformArm32::floatRegName[s_reg_no], PlatformArm32::regName[tmp_reg_no]);
+    }
+}
+
+/// @brief 保存浮点寄存器到变量，栈内变量用vstr直接保存，其它的先用vmov传送到通用寄存器再保存
+/// @param s_reg_no 浮点寄存器号
+/// @param var 变量
+/// @param tmp_reg_no 临时通用寄存器号，不能是ARM32_TMP_REG_NO，保存全局变量时要用它作为地址寄存器
+void ILocArm32::store_float(int s_reg_no, Value * var, int tmp_reg_no)
+{
+    std::string addr = vfpAddr(var);
+
+    if (!addr.empty()) {
+        // vstr s0,[fp,#-16]
+        emit("vstr", PlatformArm32::floatRegName[s_reg_no], addr);
+    } else {
+        // vmov r4,s0
+        emit("vmov", PlatformArm32::regName[tmp_reg_no], PlatformArm32::floatRegName[s_reg_no]);
+
+        store_var(tmp_reg_no, var, ARM32_TMP_REG_NO);
+    }
+}
+
 /// @brief 加载栈内变量地址
 /// @param rsReg 结果寄存器号
 /// @param base_reg_no 基址寄存器
@@ -518,7 +730,7 @@ void ILocArm32::leaStack(int rs_reg_no, int base_reg_no, int off)
     std::string rs_reg_name = PlatformArm32::regName[rs_reg_no];
     std::string base_reg_name = PlatformArm32::regName[base_reg_no];
 
-    if (PlatformArm32::constExpr(off))
+    if (isImm(off))
         // add r8,fp,#-16
         emit("add", rs_reg_name, base_reg_name, toStr(off));
     else {
@@ -546,7 +758,7 @@ void ILocArm32::allocStack(Function * func, int tmp_reg_no)
     // 保存SP寄存器到FP寄存器中
     mov_reg(ARM32_FP_REG_NO, ARM32_SP_REG_NO);
 
-    if (PlatformArm32::constExpr(off)) {
+    if (isImm(off)) {
         // sub sp,sp,#16
         emit("sub", "sp", "sp", toStr(off));
     } else {
@@ -19,6 +19,7 @@
 #include <string>
 
 #include "Module.h"
+#include "OutputStream.h"
 
 #define Instanceof(res, type, var) auto res = dynamic_cast<type>(var)
 
@@ -75,9 +76,36 @@ struct ArmInst {
     /// @brief 设置死指令
     void setDead();
 
+    /// @brief 是否是Label
+    /// @return true：是，false：不是或者是无效的Label
+    bool isLabel() const;
+
+    /// @brief 是否是会产生机器码的指令，Label、注释、无效指令除外
+    /// @return true：是，false：不是
+    bool isInst() const;
+
+    /// @brief 获取指令的执行条件，条件可能在cond中，也可能是助记符的后缀，如movlt、bne
+    /// @param base 不带条件的助记符
+    /// @return 条件，无条件执行时为空
+    std::string getCond(std::string & base) const;
+
+    /// @brief 是否设置标志位
+    /// @return true：是，false：不是
+    bool setsFlags() const;
+
+    /// @brief 获取相反的条件，如lt的相反条件为ge
+    /// @param cond 条件
+    /// @return 相反的条件，不认识的条件返回空
+    static std::string invertCond(const std::string & cond);
+
     /// @brief 指令字符串输出函数
     /// @return
     std::string outPut();
+
+    /// @brief 指令直接输出到输出流，不产生临时字符串
+    /// @param os 输出流
+    /// @return true：有输出，false：无用指令或占位指令，没有输出
+    bool outPut(OutputStream & os);
 };
 
 /// @brief 底层汇编序列-ARM32
@@ -89,6 +117,24 @@ class ILocArm32 {
     /// @brief 符号表
     Module * module;
 
+    /// @brief 是否产生Thumb-2指令，立即数与偏移的范围与A32不同
+    bool thumb = false;
+
+    /// @brief add/sub指令是否可直接使用该立即数
+    /// @param num 立即数
+    /// @return true：可以，false：需要先加载到寄存器
+    bool isImm(int num);
+
+    /// @brief ldr/str指令是否可直接使用该偏移
+    /// @param num 偏移
+    /// @return true：可以，false：需要先加载到寄存器
+    bool isDisp(int num);
+
+    /// @brief 获取可用vldr/vstr直接访问的栈内变量的地址，偏移为4的倍数且在±1020以内
+    /// @param var 变量
+    /// @return 地址，如[fp,#-16]，不能直接访问时为空
+    std::string vfpAddr(Value * var);
+
     /// @brief 加载立即数 ldr r0,=#100
     /// @param rs_reg_no 结果寄存器号
     /// @param num 立即数
@@ -113,6 +159,15 @@ public:
     /// @brief 析构函数
     ~ILocArm32();
 
+    ///
+    /// @brief 设置是否产生Thumb-2指令
+    /// @param _thumb true：Thumb-2，false：A32
+    ///
+    void setThumb(bool _thumb)
+    {
+        thumb = _thumb;
+    }
+
     ///
     /// @brief 注释指令，不包含分号
     /// @param str 注释内容
@@ -180,6 +235,18 @@ public:
     /// @param addr_reg_no 地址寄存器号
     void store_var(int src_reg_no, Value * var, int addr_reg_no);
 
+    /// @brief 加载变量到浮点寄存器，栈内变量用vldr直接加载，其它的先加载到通用寄存器再用vmov传送
+    /// @param s_reg_no 浮点寄存器号
+    /// @param var 变量
+    /// @param tmp_reg_no 临时通用寄存器号
+    void load_float(int s_reg_no, Value * var, int tmp_reg_no);
+
+    /// @brief 保存浮点寄存器到变量，栈内变量用vstr直接保存，其它的先用vmov传送到通用寄存器再保存
+    /// @param s_reg_no 浮点寄存器号
+    /// @param var 变量
+    /// @param tmp_reg_no 临时通用寄存器号，不能是ARM32_TMP_REG_NO，保存全局变量时要用它作为地址寄存器
+    void store_float(int s_reg_no, Value * var, int tmp_reg_no);
+
     /// @brief 寄存器Mov操作
     /// @param rs_reg_no 结果寄存器
     /// @param src_reg_no 源寄存器
@@ -217,6 +284,16 @@ public:
     /// @param outputEmpty 是否输出空语句
     void outPut(FILE * file, bool outputEmpty = false);
 
+    /// @brief 输出汇编到字符串中，便于各函数独立生成后再按次序合并输出
+    /// @param str 追加输出的字符串
+    /// @param outputEmpty 是否输出空语句
+    void outPut(std::string & str, bool outputEmpty = false);
+
+    /// @brief 输出汇编到输出流
+    /// @param os 输出流
+    /// @param outputEmpty 是否输出空语句
+    void outPut(OutputStream & os, bool outputEmpty = false);
+
     /// @brief 删除无用的Label指令
     void deleteUnusedLabel();
 };
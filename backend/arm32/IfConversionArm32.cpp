@@ -0,0 +1,259 @@
+///
+/// @file IfConversionArm32.cpp
+/// @brief ARM32的if转换，把小的分支结构变换为条件执行的指令的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <algorithm>
+
+#include "IfConversionArm32.h"
+
+/// @brief 是否是可以条件执行的指令，跳转、函数调用、设置标志位、修改sp/pc的指令以及VFP指令除外
+/// @param inst 指令
+/// @return true：可以，false：不可以
+static bool isPredicable(ArmInst * inst)
+{
+    std::string base;
+    if (!inst->getCond(base).empty()) {
+        // 已经是条件执行的指令
+        return false;
+    }
+
+    if ((base == "b") || (base == "bl") || (base == "bx") || (base == "push") || (base == "pop") ||
+        (base == "cbz") || (base == "cbnz")) {
+        return false;
+    }
+
+    // VFP指令的条件后缀在数据类型之前，如vaddlt.f32，简单起见不做条件执行
+    if (base[0] == 'v') {
+        return false;
+    }
+
+    return !inst->setsFlags() && (inst->result != "sp") && (inst->result != "pc");
+}
+
+/// @brief 构造函数
+/// @param _code 一个函数的ILOC指令序列，已删除无用的Label
+/// @param _labelCounts Label的执行次数，没有profile时为空
+IfConversionArm32::IfConversionArm32(std::list<ArmInst *> & _code,
+                                     const std::unordered_map<std::string, int64_t> & _labelCounts)
+    : code(_code), labelCounts(_labelCounts)
+{}
+
+/// @brief 进行if转换
+/// @return 变换的分支结构个数
+int32_t IfConversionArm32::run()
+{
+    insts.assign(code.begin(), code.end());
+
+    // 各Label被跳转指令引用的次数，为0时Label可删除
+    std::unordered_map<std::string, int32_t> labelRefs;
+    for (auto inst: insts) {
+        std::string base;
+        if (inst->isInst()) {
+            inst->getCond(base);
+            if (base == "b") {
+                labelRefs[inst->result]++;
+            }
+        }
+    }
+
+    int32_t converted = 0;
+
+    for (size_t k = 0; k < insts.size(); ++k) {
+
+        ArmInst * branch = insts[k];
+        if (!branch->isInst()) {
+            continue;
+        }
+
+        std::string base;
+        std::string cond = branch->getCond(base);
+        std::string inverseCond = ArmInst::invertCond(cond);
+        if ((base != "b") || inverseCond.empty()) {
+            continue;
+        }
+
+        // then分支，条件不满足时顺序执行
+        std::vector<ArmInst *> thenArm;
+        int64_t thenCount = -1;
+        int64_t thenEnd = collectArm(k + 1, thenArm, thenCount);
+        if (thenEnd < 0) {
+            continue;
+        }
+
+        std::vector<ArmInst *> elseArm;
+        int64_t elseCount = -1;
+        ArmInst * elseLabel = nullptr;
+        ArmInst * endLabel;
+        ArmInst * thenJump = nullptr;
+
+        ArmInst * stop = insts[thenEnd];
+        if (stop->isLabel() && (stop->opcode == branch->result)) {
+
+            // 三角形：bcc .Lend; then分支; .Lend:
+            endLabel = stop;
+
+            int64_t endCount = labelCount(endLabel);
+            if ((thenCount >= 0) && (endCount >= thenCount)) {
+                elseCount = endCount - thenCount;
+            }
+        } else if (stop->isInst() && (stop->opcode == "b") && stop->cond.empty()) {
+
+            // 菱形：bcc .Lelse; then分支; b .Lend; .Lelse: else分支; .Lend:
+            thenJump = stop;
+
+            int64_t elseStart = nextValid(thenEnd + 1);
+            if ((elseStart < 0) || !insts[elseStart]->isLabel() || (insts[elseStart]->opcode != branch->result) ||
+                (labelRefs[branch->result] != 1)) {
+                continue;
+            }
+            elseLabel = insts[elseStart];
+            elseCount = labelCount(elseLabel);
+
+            int64_t elseEnd = collectArm(elseStart + 1, elseArm, elseCount);
+            if ((elseEnd < 0) || !insts[elseEnd]->isLabel() || (insts[elseEnd]->opcode != thenJump->result)) {
+                continue;
+            }
+            endLabel = insts[elseEnd];
+        } else {
+            continue;
+        }
+
+        if (thenArm.empty() && elseArm.empty()) {
+            continue;
+        }
+
+        if (!isProfitable(thenArm.size(), elseArm.size(), thenCount, elseCount, thenJump != nullptr)) {
+            continue;
+        }
+
+        // then分支在跳转条件不满足时执行，else分支在跳转条件满足时执行
+        for (auto inst: thenArm) {
+            inst->cond = inverseCond;
+        }
+        for (auto inst: elseArm) {
+            inst->cond = cond;
+        }
+
+        branch->setDead();
+        labelRefs[branch->result]--;
+
+        if (thenJump) {
+            thenJump->setDead();
+            labelRefs[thenJump->result]--;
+            elseLabel->setDead();
+        }
+
+        if (labelRefs[endLabel->opcode] == 0) {
+            endLabel->setDead();
+        }
+
+        converted++;
+    }
+
+    return converted;
+}
+
+/// @brief 下一个有效的指令或Label的位置
+/// @param start 开始查找的位置
+/// @return 位置，没有时返回-1
+int64_t IfConversionArm32::nextValid(size_t start)
+{
+    for (size_t k = start; k < insts.size(); ++k) {
+        if (insts[k]->isInst() || insts[k]->isLabel()) {
+            return (int64_t) k;
+        }
+    }
+
+    return -1;
+}
+
+/// @brief 收集一个分支内的指令
+/// @param start 分支开始的位置
+/// @param arm 分支内的指令
+/// @param count 分支开头Label的执行次数，没有时不修改
+/// @return 分支结束的位置，即第一条不能条件执行的指令或有效的Label；分支过大时返回-1
+int64_t IfConversionArm32::collectArm(size_t start, std::vector<ArmInst *> & arm, int64_t & count)
+{
+    for (size_t k = start; k < insts.size(); ++k) {
+
+        ArmInst * inst = insts[k];
+
+        if (inst->isLabel()) {
+            return (int64_t) k;
+        }
+
+        // 没有跳转引用而被删除的Label，顺序执行进入分支，可提供分支的执行次数
+        if (inst->dead && (inst->result == ":")) {
+            if ((count < 0) && arm.empty()) {
+                count = labelCount(inst);
+            }
+            continue;
+        }
+
+        if (!inst->isInst()) {
+            continue;
+        }
+
+        if (!isPredicable(inst)) {
+            return (int64_t) k;
+        }
+
+        if (arm.size() >= IFCVT_MAX_ARM_INSTS) {
+            return -1;
+        }
+
+        arm.push_back(inst);
+    }
+
+    return -1;
+}
+
+/// @brief 按代价模型判断变换是否有利
+/// @param thenInsts then分支的指令数
+/// @param elseInsts else分支的指令数
+/// @param thenCount then分支的执行次数，未知时为-1
+/// @param elseCount else分支的执行次数，未知时为-1
+/// @param diamond 是否是菱形结构，then分支末尾有无条件跳转
+/// @return true：有利，false：不利
+bool IfConversionArm32::isProfitable(size_t thenInsts,
+                                     size_t elseInsts,
+                                     int64_t thenCount,
+                                     int64_t elseCount,
+                                     bool diamond)
+{
+    // 没有profile时按两个分支各执行一半估算
+    double thenProb = 0.5;
+    if ((thenCount >= 0) && (elseCount >= 0) && (thenCount + elseCount > 0)) {
+        thenProb = (double) thenCount / (double) (thenCount + elseCount);
+    }
+    double elseProb = 1.0 - thenProb;
+
+    // 分支代码：条件跳转、执行的分支、菱形结构then分支末尾的跳转，以及按较少执行的分支估算的预测失败
+    double branchCost = 1.0 + thenProb * (double) (thenInsts + (diamond ? 1 : 0)) + elseProb * (double) elseInsts +
+                        std::min(thenProb, elseProb) * IFCVT_MISPREDICT_COST;
+
+    // 条件执行：两个分支的指令都要执行
+    double predicatedCost = (double) (thenInsts + elseInsts);
+
+    return predicatedCost <= branchCost;
+}
+
+/// @brief Label的执行次数
+/// @param label Label指令
+/// @return 执行次数，未知时为-1
+int64_t IfConversionArm32::labelCount(ArmInst * label)
+{
+    auto pIter = labelCounts.find(label->opcode);
+
+    return (pIter == labelCounts.end()) ? -1 : pIter->second;
+}
@@ -0,0 +1,86 @@
+///
+/// @file IfConversionArm32.h
+/// @brief ARM32的if转换，把小的分支结构变换为条件执行的指令的头文件
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ILocArm32.h"
+
+/// @brief 条件执行的分支最多包含的指令数
+#define IFCVT_MAX_ARM_INSTS 4
+
+/// @brief 分支预测失败的代价，单位为指令数
+#define IFCVT_MISPREDICT_COST 10
+
+///
+/// @brief if转换。指令选择后在ILOC指令序列上识别以下两种结构，
+/// 分支内不含Label、跳转、函数调用、设置标志位的指令以及VFP指令时，把分支内的指令改为条件执行并删除跳转：
+/// (1) 菱形：bcc .Lelse; then分支; b .Lend; .Lelse: else分支; .Lend:
+/// (2) 三角形：bcc .Lend; then分支; .Lend:
+/// 条件执行的指令不论条件是否满足都要占用执行时间，因此按代价模型决定是否变换：
+/// 有profile时按各分支的执行次数估算分支预测失败的概率，没有时按各一半估算
+///
+class IfConversionArm32 {
+
+public:
+    /// @brief 构造函数
+    /// @param _code 一个函数的ILOC指令序列，已删除无用的Label
+    /// @param _labelCounts Label的执行次数，没有profile时为空
+    IfConversionArm32(std::list<ArmInst *> & _code, const std::unordered_map<std::string, int64_t> & _labelCounts);
+
+    /// @brief 进行if转换
+    /// @return 变换的分支结构个数
+    int32_t run();
+
+private:
+    /// @brief 收集一个分支内的指令
+    /// @param start 分支开始的位置
+    /// @param arm 分支内的指令
+    /// @param count 分支开头Label的执行次数，没有时不修改
+    /// @return 分支结束的位置，即第一条不能条件执行的指令或有效的Label；分支过大时返回-1
+    int64_t collectArm(size_t start, std::vector<ArmInst *> & arm, int64_t & count);
+
+    /// @brief 下一个有效的指令或Label的位置
+    /// @param start 开始查找的位置
+    /// @return 位置，没有时返回-1
+    int64_t nextValid(size_t start);
+
+    /// @brief 按代价模型判断变换是否有利
+    /// @param thenInsts then分支的指令数
+    /// @param elseInsts else分支的指令数
+    /// @param thenCount then分支的执行次数，未知时为-1
+    /// @param elseCount else分支的执行次数，未知时为-1
+    /// @param diamond 是否是菱形结构，then分支末尾有无条件跳转
+    /// @return true：有利，false：不利
+    bool isProfitable(size_t thenInsts, size_t elseInsts, int64_t thenCount, int64_t elseCount, bool diamond);
+
+    /// @brief Label的执行次数
+    /// @param label Label指令
+    /// @return 执行次数，未知时为-1
+    int64_t labelCount(ArmInst * label);
+
+    /// @brief ILOC指令序列
+    std::list<ArmInst *> & code;
+
+    /// @brief 指令序列的拷贝，便于按位置访问
+    std::vector<ArmInst *> insts;
+
+    /// @brief Label的执行次数
+    const std::unordered_map<std::string, int64_t> & labelCounts;
+};
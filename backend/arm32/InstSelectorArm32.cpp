@@ -13,11 +13,14 @@
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// </table>
 ///
+#include <algorithm>
 #include <cstdio>
 
 #include "Common.h"
+#include "Debug.h"
 #include "ILocArm32.h"
 #include "InstSelectorArm32.h"
+#include "LoopVectorizerArm32.h"
 #include "PlatformArm32.h"
 #include "ConstInt.h"
 
@@ -65,6 +68,21 @@ InstSelectorArm32::InstSelectorArm32(vector<Instruction *> & _irCode,
     translator_handlers[IRInstOperator::IRINST_OP_EQ_I] = &InstSelectorArm32::translate_eq_int32;
     translator_handlers[IRInstOperator::IRINST_OP_NE_I] = &InstSelectorArm32::translate_ne_int32;
 
+    // 浮点运算与类型转换，在VFP的s寄存器中进行
+    translator_handlers[IRInstOperator::IRINST_OP_ADD_F] = &InstSelectorArm32::translate_add_float;
+    translator_handlers[IRInstOperator::IRINST_OP_SUB_F] = &InstSelectorArm32::translate_sub_float;
+    translator_handlers[IRInstOperator::IRINST_OP_MUL_F] = &InstSelectorArm32::translate_mul_float;
+    translator_handlers[IRInstOperator::IRINST_OP_DIV_F] = &InstSelectorArm32::translate_div_float;
+    translator_handlers[IRInstOperator::IRINST_OP_NEG_F] = &InstSelectorArm32::translate_neg_float;
+    translator_handlers[IRInstOperator::IRINST_OP_LT_F] = &InstSelectorArm32::translate_lt_float;
+    translator_handlers[IRInstOperator::IRINST_OP_GT_F] = &InstSelectorArm32::translate_gt_float;
+    translator_handlers[IRInstOperator::IRINST_OP_LE_F] = &InstSelectorArm32::translate_le_float;
+    translator_handlers[IRInstOperator::IRINST_OP_GE_F] = &InstSelectorArm32::translate_ge_float;
+    translator_handlers[IRInstOperator::IRINST_OP_EQ_F] = &InstSelectorArm32::translate_eq_float;
+    translator_handlers[IRInstOperator::IRINST_OP_NE_F] = &InstSelectorArm32::translate_ne_float;
+    translator_handlers[IRInstOperator::IRINST_OP_ITOF] = &InstSelectorArm32::translate_itof;
+    translator_handlers[IRInstOperator::IRINST_OP_FTOI] = &InstSelectorArm32::translate_ftoi;
+
     // 添加数组相关指令的处理-lxg
     translator_handlers[IRInstOperator::IRINST_OP_STORE_PTR] = &InstSelectorArm32::translate_store_ptr;
     translator_handlers[IRInstOperator::IRINST_OP_LOAD_PTR] = &InstSelectorArm32::translate_load_ptr;
@@ -75,27 +93,23 @@ InstSelectorArm32::InstSelectorArm32(vector<Instruction *> & _irCode,
     translator_handlers[IRInstOperator::IRINST_OP_ARG] = &InstSelectorArm32::translate_arg;
 
     if (_func) {
-        printf("\n=== Memory Allocation Analysis for Function %s ===\n", _func->getName().c_str());
-
-        // 1. 检查当前内存分配状态
-        printf("--- Checking Current Memory Allocation ---\n");
+        // 1. 检查当前内存分配状态，布局信息只在--debug=stack-layout时输出
         _func->printMemoryLayout();
 
         bool hasConflicts = !_func->validateMemoryAllocation();
 
         if (hasConflicts) {
-            printf("--- DETECTED CONFLICTS: Applying Memory Fix ---\n");
+            minic_debug(DEBUG_STACK_LAYOUT,
+                        "Function %s: conflicts detected, applying memory fix\n",
+                        _func->getName().c_str());
             _func->reallocateMemory();
 
             // 2. 验证修复结果
-            printf("--- Post-Fix Validation ---\n");
-            _func->printMemoryLayout();
-            _func->validateMemoryAllocation();
-        } else {
-            printf("✓ No memory conflicts detected.\n");
+            if (debugEnabled(DEBUG_STACK_LAYOUT)) {
+                _func->printMemoryLayout();
+                _func->validateMemoryAllocation();
+            }
         }
-
-        printf("=== Memory Allocation Analysis Complete ===\n\n");
     }
 }
 
@@ -108,12 +122,24 @@ InstSelectorArm32::~InstSelectorArm32()
 /// @brief 指令选择执行
 void InstSelectorArm32::run()
 {
-    for (auto inst: ir) {
+    for (size_t k = 0; k < ir.size(); ++k) {
 
-        // 逐个指令进行翻译
-        if (!inst->isDead()) {
-            translate(inst);
+        Instruction * inst = ir[k];
+        if (inst->isDead()) {
+            continue;
+        }
+
+        // 记录下一条有效指令，用于去掉跳转到下一条Label的跳转指令
+        nextInst = nullptr;
+        for (size_t next = k + 1; next < ir.size(); ++next) {
+            if (!ir[next]->isDead()) {
+                nextInst = ir[next];
+                break;
+            }
         }
+
+        // 逐个指令进行翻译
+        translate(inst);
     }
 }
 
@@ -124,19 +150,20 @@ void InstSelectorArm32::translate(Instruction * inst)
     // 操作符
     IRInstOperator op = inst->getOp();
 
-    std::string irStr;
-    inst->toString(irStr);
-    // printf("Translating IR operator: %d\n", (int) op);
-    //  特别检查指针相关的指令
-    if (irStr.find("*") != std::string::npos) {
-        printf("  -> Found pointer operation: %s\n", irStr.c_str());
+    //  特别检查指针相关的指令，只在--debug=isel时输出
+    if (debugEnabled(DEBUG_ISEL)) {
+        std::string irStr;
+        inst->toString(irStr);
+        if (irStr.find("*") != std::string::npos) {
+            minic_debug(DEBUG_ISEL, "  -> Found pointer operation: %s\n", irStr.c_str());
+        }
     }
 
     map<IRInstOperator, translate_handler>::const_iterator pIter;
     pIter = translator_handlers.find(op);
     if (pIter == translator_handlers.end()) {
         // 没有找到，则说明当前不支持
-        printf("Translate: Operator(%d) not support", (int) op);
+        minic_log(LOG_ERROR, "Translate: Operator(%d) not support", (int) op);
         return;
     }
 
@@ -174,7 +201,20 @@ void InstSelectorArm32::translate_label(Instruction * inst)
 {
     Instanceof(labelInst, LabelInstruction *, inst);
 
-    iloc.label(labelInst->getName());
+    // 可向量化的循环，向量循环放在循环头之前，原来的循环处理剩余的元素
+    if (loopVectorizer) {
+        loopVectorizer->emitVectorLoop(labelInst, labelName(labelInst));
+    }
+
+    iloc.label(labelName(labelInst));
+}
+
+/// @brief 获取Label在汇编中的名字
+/// @param label Label指令
+/// @return 函数名与Label编号组成的名字
+std::string InstSelectorArm32::labelName(LabelInstruction * label)
+{
+    return IR_LABEL_PREFIX + func->getName() + "_" + std::to_string(label->getAsmIndex());
 }
 
 /// @brief goto指令指令翻译成ARM32汇编
@@ -191,8 +231,8 @@ void InstSelectorArm32::translate_goto(Instruction * inst)
     if (gotoInst->getOperandsNum() > 0) {
         // 这是条件跳转
         Value * condition = gotoInst->getOperand(0);
-        std::string trueLabel = gotoInst->getTarget()->getName();
-        std::string falseLabel = gotoInst->getFalseTarget()->getName();
+        std::string trueLabel = labelName(gotoInst->getTarget());
+        std::string falseLabel = labelName(gotoInst->getFalseTarget());
 
         // 加载条件到寄存器中
         int condRegNo = simpleRegisterAllocator.Allocate(condition);
@@ -201,17 +241,25 @@ void InstSelectorArm32::translate_goto(Instruction * inst)
         // 比较与0
         iloc.inst("cmp", PlatformArm32::regName[condRegNo], "#0");
 
-        // 如果不等于0，跳转到trueLabel
-        iloc.inst("bne", trueLabel);
+        if (nextInst == gotoInst->getFalseTarget()) {
+            // 假出口紧随其后，不等于0时跳转到trueLabel即可
+            iloc.inst("bne", trueLabel);
+        } else if (nextInst == gotoInst->getTarget()) {
+            // 真出口紧随其后，等于0时跳转到falseLabel即可
+            iloc.inst("beq", falseLabel);
+        } else {
+            // 如果不等于0，跳转到trueLabel
+            iloc.inst("bne", trueLabel);
 
-        // 否则跳转到falseLabel
-        iloc.inst("b", falseLabel);
+            // 否则跳转到falseLabel
+            iloc.inst("b", falseLabel);
+        }
 
         // 释放条件寄存器
         simpleRegisterAllocator.free(condition);
-    } else {
-        // 无条件跳转
-        iloc.jump(gotoInst->getTarget()->getName());
+    } else if (nextInst != gotoInst->getTarget()) {
+        // 无条件跳转，目标紧随其后时顺序执行即可
+        iloc.jump(labelName(gotoInst->getTarget()));
     }
 }
 
@@ -239,6 +287,21 @@ void InstSelectorArm32::translate_entry(Instruction * inst)
 
     // 为fun分配栈帧，含局部变量、函数调用值传递的空间等
     iloc.allocStack(func, ARM32_TMP_REG_NO);
+
+    // 通过s寄存器传递的float形参以及需要保存的整数形参保存到栈内，之后与其它栈内变量一样访问。
+    // r0-r3可能是整数形参，借助不参与分配的ip
+    auto & params = func->getParams();
+    std::vector<ArmArgLocation> locations = PlatformArm32::paramLocations(func);
+    for (size_t k = 0; k < params.size(); ++k) {
+        if (locations[k].reg == -1) {
+            continue;
+        }
+        if (locations[k].isFloat) {
+            iloc.store_float(locations[k].reg, params[k], ARM32_IP_REG_NO);
+        } else if (locations[k].saved) {
+            iloc.store_var(locations[k].reg, params[k], ARM32_IP_REG_NO);
+        }
+    }
 }
 
 /// @brief 函数出口指令翻译成ARM32汇编
@@ -249,8 +312,15 @@ void InstSelectorArm32::translate_exit(Instruction * inst)
         // 存在返回值
         Value * retVal = inst->getOperand(0);
 
-        // 赋值给寄存器R0
-        iloc.load_var(0, retVal);
+        if (retVal->getType()->isFloatType()) {
+            // 硬浮点调用约定，float返回值通过s0传递
+            int32_t tmp_reg_no = simpleRegisterAllocator.Allocate();
+            iloc.load_float(0, retVal, tmp_reg_no);
+            simpleRegisterAllocator.free(tmp_reg_no);
+        } else {
+            // 赋值给寄存器R0
+            iloc.load_var(0, retVal);
+        }
     }
 
     // 恢复栈空间
@@ -272,51 +342,50 @@ void InstSelectorArm32::translate_assign(Instruction * inst)
     Value * result = inst->getOperand(0);
     Value * arg1 = inst->getOperand(1);
 
-    // 简化的赋值逻辑，移除复杂的指针解引用处理
-    // 指针解引用应该通过专门的 LOAD_PTR 指令处理
-    // 获取指令的字符串表示进行调试
-    std::string irStr;
-    inst->toString(irStr);
-    printf("ASSIGN: %s\n", irStr.c_str());
-    // 检查是否是指针解引用：%l10 = *%l9
-    if (irStr.find(" = *") != std::string::npos) {
-        printf("  -> Detected pointer dereference, calling translate_load_ptr\n");
+    // 只在--debug=isel时生成IR文本
+    if (debugEnabled(DEBUG_ISEL)) {
+        std::string irStr;
+        inst->toString(irStr);
+        minic_debug(DEBUG_ISEL, "ASSIGN: %s\n", irStr.c_str());
+    }
+
+    Instanceof(moveInst, MoveInstruction *, inst);
+
+    // 指针解引用：%l10 = *%l9
+    if (moveInst && moveInst->getIsPointerLoad()) {
+        minic_debug(DEBUG_ISEL, "  -> Detected pointer dereference, calling translate_load_ptr\n");
         translate_load_ptr(inst);
         return;
     }
 
-    // 检查是否是指针存储：*%l9 = 1
-    if (irStr.find("*") == 0 && irStr.find(" = ") != std::string::npos) {
-        printf("  -> Detected pointer store, calling translate_store_ptr\n");
+    // 指针存储：*%l9 = 1
+    if (moveInst && moveInst->getIsPointerStore()) {
+        minic_debug(DEBUG_ISEL, "  -> Detected pointer store, calling translate_store_ptr\n");
         translate_store_ptr(inst);
         return;
     }
 
+    translate_move(result, arg1);
+}
+
+/// @brief 把arg1的值传送到result中，供赋值指令及函数调用的传参、取返回值使用
+/// @param result 目的操作数
+/// @param arg1 源操作数
+void InstSelectorArm32::translate_move(Value * result, Value * arg1)
+{
     int32_t arg1_regId = arg1->getRegId();
     int32_t result_regId = result->getRegId();
 
     if (arg1_regId != -1) {
         iloc.store_var(arg1_regId, result, ARM32_TMP_REG_NO);
     } else if (result_regId != -1) {
-        // 检查arg1是否是常量
-        ConstInt * constArg1 = dynamic_cast<ConstInt *>(arg1);
-        if (constArg1 != nullptr) {
-            // 是常量，直接加载立即数
-            iloc.inst("movw", PlatformArm32::regName[result_regId], "#:lower16:" + std::to_string(constArg1->getVal()));
-        } else {
-            iloc.load_var(result_regId, arg1);
-        }
+        // 常量按立即数加载，高16位不为0时load_var会补上movt
+        iloc.load_var(result_regId, arg1);
     } else {
         int32_t temp_regno = simpleRegisterAllocator.Allocate();
 
-        // 检查arg1是否是常量
-        ConstInt * constArg1 = dynamic_cast<ConstInt *>(arg1);
-        if (constArg1 != nullptr) {
-            // 是常量，直接加载立即数
-            iloc.inst("movw", PlatformArm32::regName[temp_regno], "#:lower16:" + std::to_string(constArg1->getVal()));
-        } else {
-            iloc.load_var(temp_regno, arg1);
-        }
+        // 常量按立即数加载，高16位不为0时load_var会补上movt
+        iloc.load_var(temp_regno, arg1);
 
         iloc.store_var(temp_regno, result, ARM32_TMP_REG_NO);
         simpleRegisterAllocator.free(temp_regno);
@@ -496,6 +565,11 @@ void InstSelectorArm32::translate_call(Instruction * inst)
 {
     FuncCallInstruction * callInst = dynamic_cast<FuncCallInstruction *>(inst);
 
+    if (isInlineZeroFill(callInst)) {
+        translate_zero_fill(callInst);
+        return;
+    }
+
     int32_t operandNum = callInst->getOperandsNum();
 
     if (operandNum != realArgCount) {
@@ -507,6 +581,13 @@ void InstSelectorArm32::translate_call(Instruction * inst)
         }
     }
 
+    // 硬浮点调用约定，整数实参依次通过r0-r3传递，float实参依次通过s0-s15传递，其余栈传递
+    std::vector<Type *> argTypes;
+    for (int32_t k = 0; k < operandNum; k++) {
+        argTypes.push_back(callInst->getOperand(k)->getType());
+    }
+    std::vector<ArmArgLocation> locations = PlatformArm32::argLocations(argTypes);
+
     if (operandNum) {
 
         // 强制占用这几个寄存器参数传递的寄存器
@@ -515,26 +596,36 @@ void InstSelectorArm32::translate_call(Instruction * inst)
         simpleRegisterAllocator.Allocate(2);
         simpleRegisterAllocator.Allocate(3);
 
-        // 前四个的后面参数采用栈传递
-        int esp = 0;
-        for (int32_t k = 4; k < operandNum; k++) {
+        // 寄存器之外的参数采用栈传递
+        for (int32_t k = 0; k < operandNum; k++) {
+
+            if (locations[k].reg != -1) {
+                continue;
+            }
 
             auto arg = callInst->getOperand(k);
 
+            // 已由adjustFuncCallInsts保存到栈传递位置的实参不需要再传送
+            int32_t arg_base_reg_no = -1;
+            int64_t arg_offset = -1;
+            if (arg->getMemoryAddr(&arg_base_reg_no, &arg_offset) && (arg_base_reg_no == ARM32_SP_REG_NO) &&
+                (arg_offset == locations[k].stackOffset)) {
+                continue;
+            }
+
             // 新建一个内存变量，用于栈传值到形参变量中
             MemVariable * newVal = func->newMemVariable((Type *) PointerType::get(arg->getType()));
-            newVal->setMemoryAddr(ARM32_SP_REG_NO, esp);
-            esp += 4;
-
-            Instruction * assignInst = new MoveInstruction(func, newVal, arg);
+            newVal->setMemoryAddr(ARM32_SP_REG_NO, locations[k].stackOffset);
 
-            // 翻译赋值指令
-            translate_assign(assignInst);
-
-            delete assignInst;
+            // 不借助临时的赋值指令，避免修改共享Value的使用链
+            translate_move(newVal, arg);
         }
 
-        for (int32_t k = 0; k < operandNum && k < 4; k++) {
+        for (int32_t k = 0; k < operandNum; k++) {
+
+            if ((locations[k].reg == -1) || locations[k].isFloat) {
+                continue;
+            }
 
             auto arg = callInst->getOperand(k);
 
@@ -542,12 +633,18 @@ void InstSelectorArm32::translate_call(Instruction * inst)
             // 如果是临时变量，该变量可更改为寄存器变量即可，或者设置寄存器号
             // 如果不是，则必须开辟一个寄存器变量，然后赋值即可
 
-            Instruction * assignInst = new MoveInstruction(func, PlatformArm32::intRegVal[k], arg);
+            translate_move(PlatformArm32::intRegVal[locations[k].reg], arg);
+        }
+
+        // float实参加载到s寄存器，r0-r3已传递整数实参，借助预留的r10
+        for (int32_t k = 0; k < operandNum; k++) {
 
-            // 翻译赋值指令
-            translate_assign(assignInst);
+            if ((locations[k].reg == -1) || !locations[k].isFloat) {
+                continue;
+            }
 
-            delete assignInst;
+            simpleRegisterAllocator.AllocateFloat(locations[k].reg);
+            iloc.load_float(locations[k].reg, callInst->getOperand(k), ARM32_TMP_REG_NO);
         }
     }
 
@@ -558,21 +655,90 @@ void InstSelectorArm32::translate_call(Instruction * inst)
         simpleRegisterAllocator.free(1);
         simpleRegisterAllocator.free(2);
         simpleRegisterAllocator.free(3);
+
+        for (auto & loc: locations) {
+            if (loc.isFloat) {
+                simpleRegisterAllocator.freeFloat(loc.reg);
+            }
+        }
     }
 
     // 赋值指令
     if (callInst->hasResultValue()) {
 
-        // 新建一个赋值操作
-        Instruction * assignInst = new MoveInstruction(func, callInst, PlatformArm32::intRegVal[0]);
+        if (callInst->getType()->isFloatType()) {
+            // float返回值在s0中
+            int32_t tmp_reg_no = simpleRegisterAllocator.Allocate();
+            iloc.store_float(0, callInst, tmp_reg_no);
+            simpleRegisterAllocator.free(tmp_reg_no);
+        } else {
+            // 返回值R0传送到结果变量
+            translate_move(callInst, PlatformArm32::intRegVal[0]);
+        }
+    }
+
+    // 函数调用后清零，使得下次可正常统计
+    realArgCount = 0;
+}
 
-        // 翻译赋值指令
-        translate_assign(assignInst);
+/// @brief 函数调用是否是可展开的memset清零：填充值为0，大小为4的倍数的常量且不超过ARM32_INLINE_ZERO_MAX
+/// @param callInst 函数调用指令
+/// @return true：展开，不调用库函数；false：正常调用
+bool InstSelectorArm32::isInlineZeroFill(FuncCallInstruction * callInst)
+{
+    if ((callInst->getCalledName() != "memset") || (callInst->getOperandsNum() != 3)) {
+        return false;
+    }
 
-        delete assignInst;
+    auto fill = dynamic_cast<ConstInt *>(callInst->getOperand(1));
+    auto size = dynamic_cast<ConstInt *>(callInst->getOperand(2));
+    if (!fill || !size || (fill->getVal() != 0)) {
+        return false;
     }
 
-    // 函数调用后清零，使得下次可正常统计
+    int32_t bytes = size->getVal();
+    return (bytes > 0) && (bytes % 4 == 0) && (bytes <= ARM32_INLINE_ZERO_MAX);
+}
+
+/// @brief 小的常量大小的memset清零展开为stmia，每条指令写入12字节
+/// @param callInst 函数调用指令，实参已由isInlineZeroFill检查
+void InstSelectorArm32::translate_zero_fill(FuncCallInstruction * callInst)
+{
+    int32_t words = static_cast<ConstInt *>(callInst->getOperand(2))->getVal() / 4;
+
+    // 与函数调用一样占用r0~r3，r0为写入地址，r1~r3为0
+    simpleRegisterAllocator.Allocate(0);
+    simpleRegisterAllocator.Allocate(1);
+    simpleRegisterAllocator.Allocate(2);
+    simpleRegisterAllocator.Allocate(3);
+
+    translate_move(PlatformArm32::intRegVal[0], callInst->getOperand(0));
+
+    int32_t zeroRegs = std::min(words, 3);
+    for (int32_t k = 1; k <= zeroRegs; ++k) {
+        iloc.inst("mov", PlatformArm32::regName[k], "#0");
+    }
+
+    const std::string addr = PlatformArm32::regName[0] + "!";
+    while (words > 0) {
+        int32_t count = std::min(words, 3);
+        if (count == 1) {
+            iloc.inst("str", PlatformArm32::regName[1], "[" + PlatformArm32::regName[0] + "]");
+        } else {
+            std::string list = "{" + PlatformArm32::regName[1];
+            for (int32_t k = 2; k <= count; ++k) {
+                list += "," + PlatformArm32::regName[k];
+            }
+            iloc.inst("stmia", addr, list + "}");
+        }
+        words -= count;
+    }
+
+    simpleRegisterAllocator.free(0);
+    simpleRegisterAllocator.free(1);
+    simpleRegisterAllocator.free(2);
+    simpleRegisterAllocator.free(3);
+
     realArgCount = 0;
 }
 
@@ -654,101 +820,140 @@ void InstSelectorArm32::translate_arg(Instruction * inst)
     realArgCount++;
 }
 
-void InstSelectorArm32::translate_store_ptr(Instruction * inst)
+/// @brief 浮点二元运算指令翻译成ARM32汇编，操作数加载到s寄存器后用VFP指令运算
+/// @param inst IR指令
+/// @param operator_name VFP操作码，如vadd.f32
+void InstSelectorArm32::translate_float_two_operator(Instruction * inst, const string & operator_name)
+{
+    int32_t tmp_reg_no = simpleRegisterAllocator.Allocate();
+    int32_t arg1_s_no = simpleRegisterAllocator.AllocateFloat();
+    int32_t arg2_s_no = simpleRegisterAllocator.AllocateFloat();
+
+    iloc.load_float(arg1_s_no, inst->getOperand(0), tmp_reg_no);
+    iloc.load_float(arg2_s_no, inst->getOperand(1), tmp_reg_no);
+
+    // 结果复用第一个操作数的寄存器，如vadd.f32 s0,s0,s1
+    iloc.inst(operator_name,
+              PlatformArm32::floatRegName[arg1_s_no],
+              PlatformArm32::floatRegName[arg1_s_no],
+              PlatformArm32::floatRegName[arg2_s_no]);
+
+    iloc.store_float(arg1_s_no, inst, tmp_reg_no);
+
+    simpleRegisterAllocator.freeFloat(arg1_s_no);
+    simpleRegisterAllocator.freeFloat(arg2_s_no);
+    simpleRegisterAllocator.free(tmp_reg_no);
+}
+
+/// @brief 浮点一元运算以及整数与浮点之间的转换指令翻译成ARM32汇编，在同一个s寄存器内运算
+/// @param inst IR指令
+/// @param operator_name VFP操作码，如vneg.f32、vcvt.f32.s32
+void InstSelectorArm32::translate_float_one_operator(Instruction * inst, const string & operator_name)
+{
+    int32_t tmp_reg_no = simpleRegisterAllocator.Allocate();
+    int32_t s_no = simpleRegisterAllocator.AllocateFloat();
+
+    // 整数按位模式传送到s寄存器后转换，转换得到的整数同样按位模式保存
+    iloc.load_float(s_no, inst->getOperand(0), tmp_reg_no);
+
+    iloc.inst(operator_name, PlatformArm32::floatRegName[s_no], PlatformArm32::floatRegName[s_no]);
+
+    iloc.store_float(s_no, inst, tmp_reg_no);
+
+    simpleRegisterAllocator.freeFloat(s_no);
+    simpleRegisterAllocator.free(tmp_reg_no);
+}
+
+/// @brief 浮点关系运算指令翻译成ARM32汇编，vcmp比较后把FPSCR的标志位传送到APSR再按条件设置结果
+/// @param inst IR指令
+/// @param condition ARM的条件码，有无序操作数(NaN)时除ne外都不满足
+void InstSelectorArm32::translate_cmp_float(Instruction * inst, const string & condition)
 {
-    printf("=== Executing translate_store_ptr ===\n");
+    int32_t result_reg_no = simpleRegisterAllocator.Allocate();
+    int32_t arg1_s_no = simpleRegisterAllocator.AllocateFloat();
+    int32_t arg2_s_no = simpleRegisterAllocator.AllocateFloat();
+
+    iloc.load_float(arg1_s_no, inst->getOperand(0), result_reg_no);
+    iloc.load_float(arg2_s_no, inst->getOperand(1), result_reg_no);
+
+    iloc.inst("vcmp.f32", PlatformArm32::floatRegName[arg1_s_no], PlatformArm32::floatRegName[arg2_s_no]);
+    iloc.inst("vmrs", "APSR_nzcv", "fpscr");
 
+    // 小于用mi、小于等于用ls，无序时N与Z都为0，C与V都为1，条件不满足
+    iloc.inst("mov", PlatformArm32::regName[result_reg_no], "#0");
+    iloc.inst("mov" + condition, PlatformArm32::regName[result_reg_no], "#1");
+
+    iloc.store_var(result_reg_no, inst, ARM32_TMP_REG_NO);
+
+    simpleRegisterAllocator.freeFloat(arg1_s_no);
+    simpleRegisterAllocator.freeFloat(arg2_s_no);
+    simpleRegisterAllocator.free(result_reg_no);
+}
+
+void InstSelectorArm32::translate_store_ptr(Instruction * inst)
+{
     Value * ptrVar = inst->getOperand(0); // 指针变量（目标地址）
     Value * value = inst->getOperand(1);  // 要存储的值
-                                          // 获取IR字符串用于调试
-    std::string irStr;
-    inst->toString(irStr);
-    printf("  -> IR instruction: '%s'\n", irStr.c_str());
-
-    // 详细调试信息
-    printf("  -> ptrVar name: '%s'\n", ptrVar->getName().c_str());
-    printf("  -> value name: '%s'\n", value->getName().c_str());
-    // 更详细的变量信息
-    printf("  -> ptrVar name: '%s', type: %s\n",
-           ptrVar->getName().c_str(),
-           ptrVar->getType()->isPointerType() ? "POINTER" : "NON-POINTER");
-    printf("  -> value name: '%s', type: %s\n",
-           value->getName().c_str(),
-           value->getType()->isPointerType() ? "POINTER" : "NON-POINTER");
 
     // 检查内存地址
-    int32_t ptrBaseReg, valueBaseReg;
-    int64_t ptrOffset, valueOffset;
+    int32_t ptrBaseReg = -1, valueBaseReg = -1;
+    int64_t ptrOffset = 0, valueOffset = 0;
     bool ptrHasAddr = ptrVar->getMemoryAddr(&ptrBaseReg, &ptrOffset);
     bool valueHasAddr = value->getMemoryAddr(&valueBaseReg, &valueOffset);
 
-    printf("  -> ptrVar: hasAddr=%s, baseReg=%d, offset=%ld\n", ptrHasAddr ? "true" : "false", ptrBaseReg, ptrOffset);
-    printf("  -> value: hasAddr=%s, baseReg=%d, offset=%ld\n",
-           valueHasAddr ? "true" : "false",
-           valueBaseReg,
-           valueOffset);
+    if (debugEnabled(DEBUG_ISEL)) {
+        std::string irStr;
+        inst->toString(irStr);
+        minic_debug(DEBUG_ISEL,
+                    "STORE_PTR: %s (ptr %s: %s, addr=%s fp%+ld; value %s: %s, addr=%s fp%+ld)\n",
+                    irStr.c_str(),
+                    ptrVar->getName().c_str(),
+                    ptrVar->getType()->isPointerType() ? "pointer" : "non-pointer",
+                    ptrHasAddr ? "yes" : "no",
+                    (long) ptrOffset,
+                    value->getName().c_str(),
+                    value->getType()->isPointerType() ? "pointer" : "non-pointer",
+                    valueHasAddr ? "yes" : "no",
+                    (long) valueOffset);
+    }
 
-    // 地址冲突检测和处理
+    // 地址冲突检测和处理：指针与存储的值在同一位置时解释为自赋值，直接跳过
     if (ptrHasAddr && valueHasAddr && ptrBaseReg == valueBaseReg && ptrOffset == valueOffset) {
-
-        printf("  -> CRITICAL BUG: Same memory address for different IR variables!\n");
-        printf("  -> This indicates a serious memory allocation bug in the compiler backend.\n");
-        printf("  -> Variables with same address should never exist in well-formed IR.\n");
-
-        // 分析IR指令来确定正确的语义
-        if (irStr.find("*") == 0) {
-            printf("  -> IR shows pointer store operation: %s\n", irStr.c_str());
-            printf("  -> Working around address conflict...\n");
-
-            // 工作方案：由于地址冲突，我们解释为自赋值，直接跳过
-            printf("  -> Treating as no-op due to address conflict\n");
-            printf("=== End translate_store_ptr (NOP due to address conflict) ===\n");
-            return;
-        }
+        minic_debug(DEBUG_ISEL, "  -> Same memory address for different IR variables, treated as no-op\n");
+        return;
     }
 
     int32_t ptr_reg = simpleRegisterAllocator.Allocate();
     int32_t value_reg = simpleRegisterAllocator.Allocate();
 
-    printf("  -> Allocated ptr_reg=r%d, value_reg=r%d\n", ptr_reg, value_reg);
-
     // 加载指针地址
-    printf("  -> Loading pointer address\n");
     iloc.load_var(ptr_reg, ptrVar);
 
-    // 加载要存储的值
-    printf("  -> Loading value to store\n");
-    // 检查value是否是常量
+    // 加载要存储的值，检查value是否是常量
     ConstInt * constValue = dynamic_cast<ConstInt *>(value);
     if (constValue != nullptr) {
         // 是常量，直接加载立即数
-        printf("  -> Value is constant: %d\n", constValue->getVal());
         iloc.inst("movw", PlatformArm32::regName[value_reg], "#:lower16:" + std::to_string(constValue->getVal()));
     } else {
         // 是变量，使用load_var
-        printf("  -> Value is variable\n");
         iloc.load_var(value_reg, value);
     }
 
     // 存储到指针指向的地址
-    printf("  -> Storing value to address\n");
     iloc.inst("str", PlatformArm32::regName[value_reg], "[" + PlatformArm32::regName[ptr_reg] + "]");
 
     simpleRegisterAllocator.free(ptr_reg);
     simpleRegisterAllocator.free(value_reg);
-    printf("=== End translate_store_ptr ===\n");
 }
 
 /// @brief 加载指针指向的值到寄存器
 void InstSelectorArm32::translate_load_ptr(Instruction * inst)
 {
-    printf("Executing translate_load_ptr\n");
-
     // 对于 result = *ptr 这种ASSIGN指令
     Value * result = inst->getOperand(0); // 结果变量
     Value * ptrVar = inst->getOperand(1); // 指针变量
 
-    printf("  -> Loading value from pointer address\n");
+    minic_debug(DEBUG_ISEL, "LOAD_PTR: %s = *%s\n", result->getName().c_str(), ptrVar->getName().c_str());
 
     int32_t ptr_reg = simpleRegisterAllocator.Allocate();
     int32_t result_reg = simpleRegisterAllocator.Allocate();
@@ -25,6 +25,13 @@
 #include "SimpleRegisterAllocator.h"
 #include "RegVariable.h"
 
+class LabelInstruction;
+class FuncCallInstruction;
+class LoopVectorizerArm32;
+
+/// @brief 常量大小的memset清零不超过该字节数时用stmia展开，不调用库函数
+#define ARM32_INLINE_ZERO_MAX 128
+
 using namespace std;
 
 /// @brief 指令选择器-ARM32
@@ -60,10 +67,20 @@ protected:
     /// @param inst IR指令
     void translate_assign(Instruction * inst);
 
+    /// @brief 把arg1的值传送到result中，供赋值指令及函数调用的传参、取返回值使用
+    /// @param result 目的操作数
+    /// @param arg1 源操作数
+    void translate_move(Value * result, Value * arg1);
+
     /// @brief Label指令指令翻译成ARM32汇编
     /// @param inst IR指令
     void translate_label(Instruction * inst);
 
+    /// @brief 获取Label在汇编中的名字
+    /// @param label Label指令
+    /// @return 函数名与Label编号组成的名字
+    std::string labelName(LabelInstruction * label);
+
     /// @brief goto指令指令翻译成ARM32汇编
     /// @param inst IR指令
     void translate_goto(Instruction * inst);
@@ -301,6 +318,112 @@ protected:
         translate_cmp_int32(inst, "ne");
     }
 
+    /// @brief 浮点二元运算指令翻译成ARM32汇编，操作数加载到s寄存器后用VFP指令运算
+    /// @param inst IR指令
+    /// @param operator_name VFP操作码，如vadd.f32
+    void translate_float_two_operator(Instruction * inst, const string & operator_name);
+
+    /// @brief 浮点一元运算以及整数与浮点之间的转换指令翻译成ARM32汇编，在同一个s寄存器内运算
+    /// @param inst IR指令
+    /// @param operator_name VFP操作码，如vneg.f32、vcvt.f32.s32
+    void translate_float_one_operator(Instruction * inst, const string & operator_name);
+
+    /// @brief 浮点关系运算指令翻译成ARM32汇编，vcmp比较后把FPSCR的标志位传送到APSR再按条件设置结果
+    /// @param inst IR指令
+    /// @param condition ARM的条件码，有无序操作数(NaN)时除ne外都不满足
+    void translate_cmp_float(Instruction * inst, const string & condition);
+
+    /// @brief 浮点加法指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_add_float(Instruction * inst)
+    {
+        translate_float_two_operator(inst, "vadd.f32");
+    }
+
+    /// @brief 浮点减法指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_sub_float(Instruction * inst)
+    {
+        translate_float_two_operator(inst, "vsub.f32");
+    }
+
+    /// @brief 浮点乘法指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_mul_float(Instruction * inst)
+    {
+        translate_float_two_operator(inst, "vmul.f32");
+    }
+
+    /// @brief 浮点除法指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_div_float(Instruction * inst)
+    {
+        translate_float_two_operator(inst, "vdiv.f32");
+    }
+
+    /// @brief 浮点负号指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_neg_float(Instruction * inst)
+    {
+        translate_float_one_operator(inst, "vneg.f32");
+    }
+
+    /// @brief 整数转换为浮点指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_itof(Instruction * inst)
+    {
+        translate_float_one_operator(inst, "vcvt.f32.s32");
+    }
+
+    /// @brief 浮点转换为整数指令翻译成ARM32汇编，向零舍入
+    /// @param inst IR指令
+    void translate_ftoi(Instruction * inst)
+    {
+        translate_float_one_operator(inst, "vcvt.s32.f32");
+    }
+
+    /// @brief 浮点小于指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_lt_float(Instruction * inst)
+    {
+        translate_cmp_float(inst, "mi");
+    }
+
+    /// @brief 浮点大于指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_gt_float(Instruction * inst)
+    {
+        translate_cmp_float(inst, "gt");
+    }
+
+    /// @brief 浮点小于等于指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_le_float(Instruction * inst)
+    {
+        translate_cmp_float(inst, "ls");
+    }
+
+    /// @brief 浮点大于等于指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_ge_float(Instruction * inst)
+    {
+        translate_cmp_float(inst, "ge");
+    }
+
+    /// @brief 浮点等于指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_eq_float(Instruction * inst)
+    {
+        translate_cmp_float(inst, "eq");
+    }
+
+    /// @brief 浮点不等于指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_ne_float(Instruction * inst)
+    {
+        translate_cmp_float(inst, "ne");
+    }
+
     /// @brief 指针解引用指令翻译成ARM32汇编
     /// @param inst IR指令
     void translate_load_ptr(Instruction * inst);
@@ -331,6 +454,10 @@ protected:
     /// @param inst IR指令
     void translate_call(Instruction * inst);
 
+    /// @brief 小的常量大小的memset清零展开为stmia，每条指令写入12字节
+    /// @param callInst 函数调用指令，实参已由isInlineZeroFill检查
+    void translate_zero_fill(FuncCallInstruction * callInst);
+
     ///
     /// @brief 实参指令翻译成ARM32汇编
     /// @param inst
@@ -361,6 +488,16 @@ protected:
     /// @brief 累计的实参个数
     int32_t realArgCount = 0;
 
+    ///
+    /// @brief 当前翻译指令之后的下一条有效指令，跳转到紧随其后的Label时不需要跳转指令
+    ///
+    Instruction * nextInst = nullptr;
+
+    ///
+    /// @brief 循环向量化，为空时不进行
+    ///
+    LoopVectorizerArm32 * loopVectorizer = nullptr;
+
     ///
     /// @brief 显示IR指令内容
     ///
@@ -390,6 +527,20 @@ public:
         showLinearIR = show;
     }
 
+    ///
+    /// @brief 设置循环向量化，翻译循环头的Label时插入向量循环
+    /// @param vectorizer 已识别可向量化循环的循环向量化，为空时不进行
+    ///
+    void setLoopVectorizer(LoopVectorizerArm32 * vectorizer)
+    {
+        loopVectorizer = vectorizer;
+    }
+
     /// @brief 指令选择
     void run();
+
+    /// @brief 函数调用是否是可展开的memset清零：填充值为0，大小为4的倍数的常量且不超过ARM32_INLINE_ZERO_MAX
+    /// @param callInst 函数调用指令
+    /// @return true：展开，不调用库函数；false：正常调用
+    static bool isInlineZeroFill(FuncCallInstruction * callInst);
 };
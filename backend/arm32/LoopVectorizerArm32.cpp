@@ -0,0 +1,1100 @@
+///
+/// @file LoopVectorizerArm32.cpp
+/// @brief ARM32的循环向量化，把int数组的简单循环用NEON指令每次处理4个元素的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <cstdlib>
+
+#include "LoopVectorizerArm32.h"
+#include "ConstInt.h"
+#include "FormalParam.h"
+#include "GlobalVariable.h"
+#include "GotoInstruction.h"
+#include "LabelInstruction.h"
+#include "LocalVariable.h"
+#include "MoveInstruction.h"
+#include "PlatformArm32.h"
+#include "PointerType.h"
+
+/// @brief 可分配的q寄存器，q4-q7即d8-d15由被调用者保护，不使用
+static const int32_t vectorRegs[] = {0, 1, 2, 3, 8, 9, 10, 11, 12, 13, 14, 15};
+
+/// @brief 构造函数
+/// @param _func 函数，在寄存器分配之前识别循环
+/// @param _iloc 函数的ILOC指令序列
+LoopVectorizerArm32::LoopVectorizerArm32(Function * _func, ILocArm32 & _iloc) : func(_func), iloc(_iloc)
+{}
+
+/// @brief 识别函数内可向量化的循环
+/// @return 可向量化的循环个数
+int32_t LoopVectorizerArm32::run()
+{
+    for (auto inst: func->getInterCode().getInsts()) {
+        if (!inst->isDead()) {
+            insts.push_back(inst);
+        }
+    }
+
+    for (auto inst: insts) {
+        if (inst->getOp() == IRInstOperator::IRINST_OP_GOTO) {
+            Instanceof(gotoInst, GotoInstruction *, inst);
+            labelRefs[gotoInst->getTarget()]++;
+            if (gotoInst->getFalseTarget()) {
+                labelRefs[gotoInst->getFalseTarget()]++;
+            }
+        }
+    }
+
+    for (size_t k = 0; k < insts.size(); ++k) {
+        if (insts[k]->getOp() == IRInstOperator::IRINST_OP_LABEL) {
+            VectorLoop loop;
+            if (analyzeLoop(k, loop)) {
+                loops[static_cast<LabelInstruction *>(insts[k])] = std::move(loop);
+            }
+        }
+    }
+
+    return (int32_t) loops.size();
+}
+
+/// @brief 分析以header开始的循环是否可以向量化
+/// @param pos 循环头在指令序列中的位置
+/// @param loop 可以向量化时的循环信息
+/// @return true：可以，false：不可以
+bool LoopVectorizerArm32::analyzeLoop(size_t pos, VectorLoop & loop)
+{
+    // 循环头：.Lh: %c = icmp lt i,n; bc %c, label .Lb, label .Lx; .Lb:
+    if (pos + 3 >= insts.size()) {
+        return false;
+    }
+
+    LabelInstruction * header = static_cast<LabelInstruction *>(insts[pos]);
+    Instruction * cmp = insts[pos + 1];
+    Instanceof(branch, GotoInstruction *, insts[pos + 2]);
+    if ((branch == nullptr) || (branch->getOperandsNum() != 1) || (branch->getOperand(0) != cmp) ||
+        (insts[pos + 3] != branch->getTarget())) {
+        return false;
+    }
+
+    if (cmp->getOp() == IRInstOperator::IRINST_OP_LT_I) {
+        loop.index = cmp->getOperand(0);
+        loop.bound = cmp->getOperand(1);
+    } else if (cmp->getOp() == IRInstOperator::IRINST_OP_GT_I) {
+        loop.index = cmp->getOperand(1);
+        loop.bound = cmp->getOperand(0);
+    } else {
+        return false;
+    }
+
+    // 循环变量是int型的局部变量或形参
+    if (!loop.index->getType()->isInt32Type() || !loop.bound->getType()->isInt32Type() ||
+        ((dynamic_cast<LocalVariable *>(loop.index) == nullptr) &&
+         (dynamic_cast<FormalParam *>(loop.index) == nullptr))) {
+        return false;
+    }
+
+    // 循环体以跳转到循环头的无条件跳转结束，其后紧跟循环出口
+    size_t end = pos + 4;
+    while ((end < insts.size()) && !((insts[end]->getOp() == IRInstOperator::IRINST_OP_GOTO) &&
+                                     (insts[end]->getOperandsNum() == 0) &&
+                                     (static_cast<GotoInstruction *>(insts[end])->getTarget() == header))) {
+        end++;
+    }
+    if ((end + 1 >= insts.size()) || (insts[end + 1] != branch->getFalseTarget())) {
+        return false;
+    }
+
+    // 循环头只能顺序执行或经回边进入，循环体只能从循环头进入
+    if ((labelRefs[header] != 1) || (labelRefs[branch->getTarget()] != 1)) {
+        return false;
+    }
+
+    // 循环内定值的Value，除循环变量外不能在循环之外使用，向量循环不更新它们
+    loopDefs.clear();
+    for (size_t k = pos; k < end; ++k) {
+        Instanceof(moveInst, MoveInstruction *, insts[k]);
+        if (moveInst) {
+            if (!moveInst->getIsPointerStore()) {
+                loopDefs.insert(moveInst->getOperand(0));
+            }
+        } else if (insts[k]->hasResultValue()) {
+            loopDefs.insert(insts[k]);
+        }
+    }
+
+    if (loopDefs.count(loop.bound) || !loopDefs.count(loop.index)) {
+        return false;
+    }
+
+    for (size_t k = 0; k < insts.size(); ++k) {
+        if ((k >= pos) && (k <= end)) {
+            continue;
+        }
+        for (int32_t m = 0; m < insts[k]->getOperandsNum(); ++m) {
+            Value * operand = insts[k]->getOperand(m);
+            if ((operand != loop.index) && loopDefs.count(operand)) {
+                return false;
+            }
+        }
+    }
+
+    current = &loop;
+    splatOps.clear();
+    boolOps.clear();
+
+    BodyState state;
+    state.nodes[loop.index] = Node{NodeKind::Index, 0, nullptr, -1};
+    if (!analyzeBlock(pos + 4, end, state)) {
+        return false;
+    }
+
+    // 循环变量在循环体内加1
+    const Node & next = state.nodes[loop.index];
+    if ((next.kind != NodeKind::Index) || (next.offset != 1)) {
+        return false;
+    }
+
+    bool hasStore = false;
+    for (auto & op: loop.ops) {
+        hasStore = hasStore || (op.kind == VecOpKind::Store);
+    }
+
+    if (!hasStore || !checkDependences() || !allocateRegs()) {
+        return false;
+    }
+
+    // 通用寄存器先使用不需要保护的r0-r3、ip以及已保护的lr，不够时使用r4-r9，由函数入口保护。
+    // 入口之后还使用的形参已保存到栈内，循环内r0-r3可用
+    std::vector<int32_t> candidates = {0, 1, 2, 3, ARM32_IP_REG_NO};
+    if (func->getExistFuncCall()) {
+        candidates.push_back(ARM32_LX_REG_NO);
+    }
+    for (int32_t reg = 4; reg <= 9; ++reg) {
+        candidates.push_back(reg);
+    }
+
+    // 计数器以及各数组的地址，最后一个数组复用循环变量的寄存器
+    size_t needed = loop.streams.size() + 1;
+    for (auto reg: candidates) {
+        if (loop.regs.size() < needed) {
+            loop.regs.push_back(reg);
+        }
+    }
+
+    if (loop.regs.size() < needed) {
+        return false;
+    }
+
+    for (auto reg: loop.regs) {
+        if ((reg >= 4) && (reg <= 9)) {
+            savedRegs.insert(reg);
+        }
+    }
+
+    return true;
+}
+
+/// @brief 分析一段顺序执行的指令
+/// @param start 开始位置
+/// @param end 结束位置，不包含
+/// @param state 分析状态
+/// @return true：可以向量化，false：不可以
+bool LoopVectorizerArm32::analyzeBlock(size_t start, size_t end, BodyState & state)
+{
+    for (size_t k = start; k < end; ++k) {
+
+        Instruction * inst = insts[k];
+
+        if (inst->getOp() == IRInstOperator::IRINST_OP_GOTO) {
+
+            // 条件跳转开始的if或if-else结构，分支内不能再嵌套
+            if ((inst->getOperandsNum() == 0) || state.inArm || !analyzeSelect(k, end, state)) {
+                return false;
+            }
+
+            // 结构之后的位置，抵消循环的++k
+            k--;
+            continue;
+        }
+
+        if (!analyzeInst(inst, state)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// @brief 分析一条指令
+/// @param inst 指令
+/// @param state 分析状态
+/// @return true：可以向量化，false：不可以
+bool LoopVectorizerArm32::analyzeInst(Instruction * inst, BodyState & state)
+{
+    Node a, b;
+
+    switch (inst->getOp()) {
+
+        case IRInstOperator::IRINST_OP_ASSIGN: {
+
+            Instanceof(moveInst, MoveInstruction *, inst);
+            Value * dst = inst->getOperand(0);
+            Value * src = inst->getOperand(1);
+
+            if (moveInst->getIsPointerStore()) {
+
+                // *%p = v，地址必须是base+(i+c)*4
+                if (!getNode(dst, state, a) || !getNode(src, state, b) || (a.kind != NodeKind::Address)) {
+                    return false;
+                }
+
+                int32_t value = vectorOf(b);
+                int32_t stream = streamOf(a);
+                if ((value < 0) || (stream < 0)) {
+                    return false;
+                }
+
+                if (state.inArm) {
+                    // 分支内的写入在合并时按条件选择写入的值
+                    state.pendingStores[stream] = value;
+                    return true;
+                }
+
+                int32_t op = addOp(VecOpKind::Store, value);
+                current->ops[op].stream = stream;
+
+                Stream & s = current->streams[stream];
+                if (s.firstStore < 0) {
+                    s.firstStore = op;
+                }
+
+                // 其它数组可能与写入的数组重叠，读取的值不再可用
+                state.loaded.clear();
+                state.loaded[stream] = value;
+                state.safeStreams.insert(stream);
+                return true;
+            }
+
+            if (moveInst->getIsPointerLoad()) {
+
+                // %v = *%p，地址必须是base+(i+c)*4
+                if (!getNode(src, state, a) || (a.kind != NodeKind::Address) || !dst->getType()->isInt32Type()) {
+                    return false;
+                }
+
+                int32_t stream = streamOf(a);
+                if (stream < 0) {
+                    return false;
+                }
+
+                int32_t value;
+                if (state.inArm && !state.pendingStores.empty()) {
+                    // 分支内写入之后只能读取刚写入的数组
+                    auto pIter = state.pendingStores.find(stream);
+                    if (pIter == state.pendingStores.end()) {
+                        return false;
+                    }
+                    value = pIter->second;
+                } else if (state.loaded.count(stream)) {
+                    value = state.loaded[stream];
+                } else {
+                    // 分支内的读取会无条件执行，只能读取分支之前已访问过的数组，不会越界
+                    if (state.inArm && !state.safeStreams.count(stream)) {
+                        return false;
+                    }
+
+                    value = addOp(VecOpKind::Load);
+                    current->ops[value].stream = stream;
+                    current->streams[stream].lastLoad = value;
+                    state.loaded[stream] = value;
+                    if (!state.inArm) {
+                        state.safeStreams.insert(stream);
+                    }
+                }
+
+                state.nodes[dst] = Node{NodeKind::Vector, 0, nullptr, value};
+                return true;
+            }
+
+            // 普通赋值，全局变量在循环之后可能使用，不能只在标量循环中更新
+            if (dynamic_cast<GlobalVariable *>(dst) || !getNode(src, state, a)) {
+                return false;
+            }
+
+            if (dst == current->index) {
+                // 循环变量只能在分支之外加1一次
+                const Node & old = state.nodes[dst];
+                if (state.inArm || (old.kind != NodeKind::Index) || (old.offset != 0) ||
+                    (a.kind != NodeKind::Index) || (a.offset != 1)) {
+                    return false;
+                }
+            }
+
+            state.nodes[dst] = a;
+            return true;
+        }
+
+        case IRInstOperator::IRINST_OP_ADD_I:
+        case IRInstOperator::IRINST_OP_SUB_I:
+        case IRInstOperator::IRINST_OP_MUL_I: {
+
+            if (!getNode(inst->getOperand(0), state, a) || !getNode(inst->getOperand(1), state, b)) {
+                return false;
+            }
+
+            IRInstOperator op = inst->getOp();
+            ConstInt * constA = (a.kind == NodeKind::Invariant) ? dynamic_cast<ConstInt *>(a.value) : nullptr;
+            ConstInt * constB = (b.kind == NodeKind::Invariant) ? dynamic_cast<ConstInt *>(b.value) : nullptr;
+
+            // 下标：i+c、c+i、i-c
+            if ((a.kind == NodeKind::Index) && constB && (op != IRInstOperator::IRINST_OP_MUL_I)) {
+                int32_t c = (op == IRInstOperator::IRINST_OP_ADD_I) ? constB->getVal() : -constB->getVal();
+                state.nodes[inst] = Node{NodeKind::Index, a.offset + c, nullptr, -1};
+                return true;
+            }
+            if ((b.kind == NodeKind::Index) && constA && (op == IRInstOperator::IRINST_OP_ADD_I)) {
+                state.nodes[inst] = Node{NodeKind::Index, b.offset + constA->getVal(), nullptr, -1};
+                return true;
+            }
+
+            // 字节偏移：(i+c)*4
+            if (op == IRInstOperator::IRINST_OP_MUL_I) {
+                if ((a.kind == NodeKind::Index) && constB && (constB->getVal() == 4)) {
+                    state.nodes[inst] = Node{NodeKind::Offset, a.offset, nullptr, -1};
+                    return true;
+                }
+                if ((b.kind == NodeKind::Index) && constA && (constA->getVal() == 4)) {
+                    state.nodes[inst] = Node{NodeKind::Offset, b.offset, nullptr, -1};
+                    return true;
+                }
+            }
+
+            // 元素地址：base+(i+c)*4
+            if (op == IRInstOperator::IRINST_OP_ADD_I) {
+                if ((a.kind == NodeKind::Invariant) && (b.kind == NodeKind::Offset) && isIntArrayBase(a.value)) {
+                    state.nodes[inst] = Node{NodeKind::Address, b.offset, a.value, -1};
+                    return true;
+                }
+                if ((b.kind == NodeKind::Invariant) && (a.kind == NodeKind::Offset) && isIntArrayBase(b.value)) {
+                    state.nodes[inst] = Node{NodeKind::Address, a.offset, b.value, -1};
+                    return true;
+                }
+            }
+
+            // 元素的运算，至少有一个操作数是元素的值
+            if ((a.kind != NodeKind::Vector) && (a.kind != NodeKind::Mask) && (b.kind != NodeKind::Vector) &&
+                (b.kind != NodeKind::Mask)) {
+                return false;
+            }
+
+            int32_t va = vectorOf(a);
+            int32_t vb = vectorOf(b);
+            if ((va < 0) || (vb < 0)) {
+                return false;
+            }
+
+            VecOpKind kind = (op == IRInstOperator::IRINST_OP_ADD_I)   ? VecOpKind::Add
+                             : (op == IRInstOperator::IRINST_OP_SUB_I) ? VecOpKind::Sub
+                                                                       : VecOpKind::Mul;
+            state.nodes[inst] = Node{NodeKind::Vector, 0, nullptr, addOp(kind, va, vb)};
+            return true;
+        }
+
+        case IRInstOperator::IRINST_OP_NEG_I: {
+
+            if (!getNode(inst->getOperand(0), state, a) ||
+                ((a.kind != NodeKind::Vector) && (a.kind != NodeKind::Mask))) {
+                return false;
+            }
+
+            state.nodes[inst] = Node{NodeKind::Vector, 0, nullptr, addOp(VecOpKind::Neg, vectorOf(a))};
+            return true;
+        }
+
+        case IRInstOperator::IRINST_OP_LT_I:
+        case IRInstOperator::IRINST_OP_GT_I:
+        case IRInstOperator::IRINST_OP_LE_I:
+        case IRInstOperator::IRINST_OP_GE_I:
+        case IRInstOperator::IRINST_OP_EQ_I:
+        case IRInstOperator::IRINST_OP_NE_I: {
+
+            if (!getNode(inst->getOperand(0), state, a) || !getNode(inst->getOperand(1), state, b)) {
+                return false;
+            }
+
+            if ((a.kind != NodeKind::Vector) && (a.kind != NodeKind::Mask) && (b.kind != NodeKind::Vector) &&
+                (b.kind != NodeKind::Mask)) {
+                return false;
+            }
+
+            int32_t va = vectorOf(a);
+            int32_t vb = vectorOf(b);
+            if ((va < 0) || (vb < 0)) {
+                return false;
+            }
+
+            // NEON只有大于、大于等于与相等的比较，小于与小于等于交换操作数，不等取反
+            int32_t mask;
+            switch (inst->getOp()) {
+                case IRInstOperator::IRINST_OP_LT_I:
+                    mask = addOp(VecOpKind::CmpGt, vb, va);
+                    break;
+                case IRInstOperator::IRINST_OP_GT_I:
+                    mask = addOp(VecOpKind::CmpGt, va, vb);
+                    break;
+                case IRInstOperator::IRINST_OP_LE_I:
+                    mask = addOp(VecOpKind::CmpGe, vb, va);
+                    break;
+                case IRInstOperator::IRINST_OP_GE_I:
+                    mask = addOp(VecOpKind::CmpGe, va, vb);
+                    break;
+                case IRInstOperator::IRINST_OP_EQ_I:
+                    mask = addOp(VecOpKind::CmpEq, va, vb);
+                    break;
+                default:
+                    mask = addOp(VecOpKind::Not, addOp(VecOpKind::CmpEq, va, vb));
+                    break;
+            }
+
+            state.nodes[inst] = Node{NodeKind::Mask, 0, nullptr, mask};
+            return true;
+        }
+
+        default:
+            // 除法、函数调用等不能向量化
+            return false;
+    }
+}
+
+/// @brief 分析if或if-else结构，合并两个分支的定值与写入
+/// @param pos 条件跳转的位置，返回时为结构之后的位置
+/// @param end 循环体的结束位置
+/// @param state 分析状态
+/// @return true：可以向量化，false：不可以
+bool LoopVectorizerArm32::analyzeSelect(size_t & pos, size_t end, BodyState & state)
+{
+    GotoInstruction * branch = static_cast<GotoInstruction *>(insts[pos]);
+    LabelInstruction * thenLabel = branch->getTarget();
+    LabelInstruction * elseLabel = branch->getFalseTarget();
+
+    Node cond;
+    if (!getNode(branch->getOperand(0), state, cond)) {
+        return false;
+    }
+
+    int32_t mask = maskOf(cond);
+    if ((mask < 0) || (pos + 2 >= end) || (insts[pos + 1] != thenLabel) || (labelRefs[thenLabel] != 1) ||
+        (labelRefs[elseLabel] != 1)) {
+        return false;
+    }
+
+    auto isBranch = [&](size_t k) {
+        return (insts[k]->getOp() == IRInstOperator::IRINST_OP_LABEL) ||
+               (insts[k]->getOp() == IRInstOperator::IRINST_OP_GOTO);
+    };
+
+    auto isJumpTo = [&](size_t k, LabelInstruction * label) {
+        return (insts[k]->getOp() == IRInstOperator::IRINST_OP_GOTO) && (insts[k]->getOperandsNum() == 0) &&
+               (static_cast<GotoInstruction *>(insts[k])->getTarget() == label);
+    };
+
+    size_t thenStart = pos + 2;
+    size_t thenEnd = thenStart;
+    while ((thenEnd < end) && !isBranch(thenEnd)) {
+        thenEnd++;
+    }
+    if (thenEnd >= end) {
+        return false;
+    }
+
+    size_t elseStart, elseEnd, next;
+    if (insts[thenEnd] == elseLabel) {
+
+        // if：bc %c, label .Lthen, label .Lend; .Lthen: then分支; .Lend:
+        elseStart = elseEnd = thenEnd;
+        next = thenEnd + 1;
+    } else {
+
+        // if-else：bc %c, label .Lthen, label .Lelse; .Lthen: then分支; br label .Lend;
+        // .Lelse: else分支; br label .Lend; .Lend:，else分支末尾的跳转可以没有
+        if ((insts[thenEnd]->getOp() != IRInstOperator::IRINST_OP_GOTO) || (insts[thenEnd]->getOperandsNum() != 0) ||
+            (thenEnd + 1 >= end) || (insts[thenEnd + 1] != elseLabel)) {
+            return false;
+        }
+
+        LabelInstruction * endLabel = static_cast<GotoInstruction *>(insts[thenEnd])->getTarget();
+
+        elseStart = thenEnd + 2;
+        elseEnd = elseStart;
+        while ((elseEnd < end) && !isBranch(elseEnd)) {
+            elseEnd++;
+        }
+
+        int32_t jumps = 1;
+        next = elseEnd;
+        if ((next < end) && isJumpTo(next, endLabel)) {
+            jumps++;
+            next++;
+        }
+
+        if ((next >= end) || (insts[next] != endLabel) || (labelRefs[endLabel] != jumps)) {
+            return false;
+        }
+        next++;
+    }
+
+    // 两个分支都在分支之前的状态上分析
+    BodyState thenState = state;
+    thenState.inArm = true;
+    BodyState elseState = state;
+    elseState.inArm = true;
+
+    if (!analyzeBlock(thenStart, thenEnd, thenState) || !analyzeBlock(elseStart, elseEnd, elseState)) {
+        return false;
+    }
+
+    // 按指令次序收集分支内定值的Value，两个分支都有值时按条件选择
+    std::vector<Value *> defs;
+    std::unordered_set<Value *> seen;
+    for (size_t k = thenStart; k < elseEnd; ++k) {
+        Instanceof(moveInst, MoveInstruction *, insts[k]);
+        Value * def = nullptr;
+        if (moveInst) {
+            def = moveInst->getIsPointerStore() ? nullptr : moveInst->getOperand(0);
+        } else if (insts[k]->hasResultValue()) {
+            def = insts[k];
+        }
+        if (def && seen.insert(def).second) {
+            defs.push_back(def);
+        }
+    }
+
+    for (auto def: defs) {
+
+        auto thenIter = thenState.nodes.find(def);
+        auto elseIter = elseState.nodes.find(def);
+
+        if ((thenIter == thenState.nodes.end()) || (elseIter == elseState.nodes.end())) {
+            // 只在一个分支内有值，之后使用时不能向量化
+            state.nodes.erase(def);
+            continue;
+        }
+
+        if (isSameNode(thenIter->second, elseIter->second)) {
+            state.nodes[def] = thenIter->second;
+            continue;
+        }
+
+        int32_t thenValue = vectorOf(thenIter->second);
+        int32_t elseValue = vectorOf(elseIter->second);
+        if ((thenValue < 0) || (elseValue < 0)) {
+            return false;
+        }
+
+        state.nodes[def] = Node{NodeKind::Vector, 0, nullptr, addOp(VecOpKind::Select, mask, thenValue, elseValue)};
+    }
+
+    // 两个分支都要写入相同的数组，按条件选择写入的值
+    if (thenState.pendingStores.size() != elseState.pendingStores.size()) {
+        return false;
+    }
+
+    std::vector<int32_t> stores;
+    for (auto & item: thenState.pendingStores) {
+        if (!elseState.pendingStores.count(item.first)) {
+            return false;
+        }
+        stores.push_back(item.first);
+    }
+    std::sort(stores.begin(), stores.end());
+
+    for (auto stream: stores) {
+
+        int32_t thenValue = thenState.pendingStores[stream];
+        int32_t elseValue = elseState.pendingStores[stream];
+        int32_t value =
+            (thenValue == elseValue) ? thenValue : addOp(VecOpKind::Select, mask, thenValue, elseValue);
+
+        int32_t op = addOp(VecOpKind::Store, value);
+        current->ops[op].stream = stream;
+
+        Stream & s = current->streams[stream];
+        if (s.firstStore < 0) {
+            s.firstStore = op;
+        }
+
+        state.loaded.clear();
+        state.loaded[stream] = value;
+        state.safeStreams.insert(stream);
+    }
+
+    pos = next;
+
+    return true;
+}
+
+/// @brief 获取Value的符号形式
+/// @param val Value
+/// @param state 分析状态
+/// @param node 符号形式
+/// @return true：成功，false：循环内定值的Value在定值之前使用，不能向量化
+bool LoopVectorizerArm32::getNode(Value * val, BodyState & state, Node & node)
+{
+    auto pIter = state.nodes.find(val);
+    if (pIter != state.nodes.end()) {
+        node = pIter->second;
+        return true;
+    }
+
+    // 循环内定值的Value在定值之前使用的是上一次迭代的值
+    if (loopDefs.count(val)) {
+        return false;
+    }
+
+    node = Node{NodeKind::Invariant, 0, val, -1};
+
+    return true;
+}
+
+/// @brief 获取作为向量运算操作数的向量，循环不变量复制到各元素，比较结果转为1或0
+/// @param node 符号形式
+/// @return 向量运算，不能作为操作数时为-1
+int32_t LoopVectorizerArm32::vectorOf(const Node & node)
+{
+    switch (node.kind) {
+
+        case NodeKind::Vector:
+            return node.op;
+
+        case NodeKind::Mask: {
+            auto pIter = boolOps.find(node.op);
+            if (pIter != boolOps.end()) {
+                return pIter->second;
+            }
+
+            int32_t op = addOp(VecOpKind::ToBool, node.op);
+            boolOps[node.op] = op;
+            return op;
+        }
+
+        case NodeKind::Invariant: {
+            if (!node.value->getType()->isInt32Type()) {
+                return -1;
+            }
+
+            auto pIter = splatOps.find(node.value);
+            if (pIter != splatOps.end()) {
+                return pIter->second;
+            }
+
+            int32_t op = addOp(VecOpKind::Splat);
+            current->ops[op].value = node.value;
+            splatOps[node.value] = op;
+            return op;
+        }
+
+        default:
+            // 下标与地址不作为元素的值
+            return -1;
+    }
+}
+
+/// @brief 获取作为选择条件的比较结果，向量的非0元素转为全1
+/// @param node 符号形式
+/// @return 向量运算，不能作为条件时为-1
+int32_t LoopVectorizerArm32::maskOf(const Node & node)
+{
+    if (node.kind == NodeKind::Mask) {
+        return node.op;
+    }
+
+    if (node.kind == NodeKind::Vector) {
+        return addOp(VecOpKind::Test, node.op, node.op);
+    }
+
+    return -1;
+}
+
+/// @brief 增加一个向量运算
+/// @param kind 种类
+/// @param src0 源操作数
+/// @param src1 源操作数
+/// @param src2 源操作数
+/// @return 向量运算的编号
+int32_t LoopVectorizerArm32::addOp(VecOpKind kind, int32_t src0, int32_t src1, int32_t src2)
+{
+    VecOp op;
+    op.kind = kind;
+    op.src[0] = src0;
+    op.src[1] = src1;
+    op.src[2] = src2;
+
+    current->ops.push_back(op);
+
+    return (int32_t) current->ops.size() - 1;
+}
+
+/// @brief 获取地址对应的数组，没有时新增
+/// @param addr 地址的符号形式
+/// @return 数组的编号，下标的常量偏移过大时为-1
+int32_t LoopVectorizerArm32::streamOf(const Node & addr)
+{
+    if (std::abs(addr.offset) > VECTORIZE_MAX_OFFSET) {
+        return -1;
+    }
+
+    for (size_t k = 0; k < current->streams.size(); ++k) {
+        if ((current->streams[k].base == addr.value) && (current->streams[k].offset == addr.offset)) {
+            return (int32_t) k;
+        }
+    }
+
+    current->streams.push_back(Stream{addr.value, addr.offset});
+
+    return (int32_t) current->streams.size() - 1;
+}
+
+/// @brief 检查数组之间的依赖，确定运行时需要检查重叠的数组对
+/// @return true：可以向量化，false：存在改变结果的依赖
+bool LoopVectorizerArm32::checkDependences()
+{
+    auto & streams = current->streams;
+
+    for (size_t s = 0; s < streams.size(); ++s) {
+
+        if (streams[s].firstStore < 0) {
+            continue;
+        }
+
+        for (size_t x = 0; x < streams.size(); ++x) {
+
+            // 两个都写入的数组只检查一次
+            if ((x == s) || ((streams[x].firstStore >= 0) && (x < s))) {
+                continue;
+            }
+
+            if (streams[s].base == streams[x].base) {
+
+                // 同一数组的元素距离不小于4时，一次迭代的4个元素之间没有依赖
+                int32_t distance = streams[s].offset - streams[x].offset;
+                if (std::abs(distance) >= VECTORIZE_LANES) {
+                    continue;
+                }
+
+                // 读取的元素在写入的元素之后且都在写入之前读取，向量循环读到的仍是原来的值
+                if ((distance < 0) && (streams[x].firstStore < 0) && (streams[x].lastLoad < streams[s].firstStore)) {
+                    continue;
+                }
+
+                return false;
+            }
+
+            // 不同的数组变量不会重叠，指针则可能指向任意数组，在运行时检查
+            if (streams[s].base->getType()->isArrayType() && streams[x].base->getType()->isArrayType()) {
+                continue;
+            }
+
+            current->checks.emplace_back((int32_t) s, (int32_t) x);
+        }
+    }
+
+    return true;
+}
+
+/// @brief 为向量运算分配q寄存器，确定写回基址的访存
+/// @return true：成功，false：寄存器不足
+bool LoopVectorizerArm32::allocateRegs()
+{
+    auto & ops = current->ops;
+
+    // 各向量运算的结果最后一次被使用的位置
+    std::vector<int32_t> lastUse(ops.size(), -1);
+    std::vector<int32_t> lastAccess(current->streams.size(), -1);
+    for (size_t k = 0; k < ops.size(); ++k) {
+        for (auto src: ops[k].src) {
+            if (src >= 0) {
+                lastUse[src] = (int32_t) k;
+            }
+        }
+        if (ops[k].stream >= 0) {
+            lastAccess[ops[k].stream] = (int32_t) k;
+        }
+    }
+
+    // 每个数组的最后一次访问写回基址，指向下一次迭代的元素
+    for (auto k: lastAccess) {
+        ops[k].writeBack = true;
+    }
+
+    bool busy[16] = {false};
+
+    auto allocate = [&](int32_t prefer) {
+        if ((prefer >= 0) && !busy[prefer]) {
+            busy[prefer] = true;
+            return prefer;
+        }
+        for (auto reg: vectorRegs) {
+            if (!busy[reg]) {
+                busy[reg] = true;
+                return reg;
+            }
+        }
+        return -1;
+    };
+
+    auto release = [&](int32_t src, int32_t k) {
+        if ((src >= 0) && (lastUse[src] == k) && (ops[src].kind != VecOpKind::Splat)) {
+            busy[ops[src].reg] = false;
+        }
+    };
+
+    // 循环不变量在向量循环之前复制，整个循环内占用寄存器
+    for (auto & op: ops) {
+        if (op.kind == VecOpKind::Splat) {
+            op.reg = allocate(-1);
+            if (op.reg < 0) {
+                return false;
+            }
+        }
+    }
+
+    for (size_t k = 0; k < ops.size(); ++k) {
+
+        VecOp & op = ops[k];
+        int32_t pos = (int32_t) k;
+
+        if (op.kind == VecOpKind::Splat) {
+            continue;
+        }
+
+        if (op.kind == VecOpKind::Store) {
+            release(op.src[0], pos);
+            continue;
+        }
+
+        if (op.kind == VecOpKind::Select) {
+            // vbsl的目的寄存器即条件，条件之后不再使用时直接使用其寄存器，
+            // 否则先复制条件，这时目的寄存器不能是两个值的寄存器
+            release(op.src[0], pos);
+            op.reg = allocate(ops[op.src[0]].reg);
+            release(op.src[1], pos);
+            if (op.src[2] != op.src[1]) {
+                release(op.src[2], pos);
+            }
+        } else {
+            release(op.src[0], pos);
+            if (op.src[1] != op.src[0]) {
+                release(op.src[1], pos);
+            }
+            op.reg = allocate(-1);
+        }
+
+        if (op.reg < 0) {
+            return false;
+        }
+
+        // 结果没有使用时立即释放
+        if (lastUse[k] < 0) {
+            busy[op.reg] = false;
+        }
+    }
+
+    return true;
+}
+
+/// @brief Label是可向量化循环的循环头时，产生其之前的向量循环
+/// @param header Label指令
+/// @param headerName 循环头在汇编中的名字，也是不满足向量化条件时的跳转目标
+void LoopVectorizerArm32::emitVectorLoop(LabelInstruction * header, const std::string & headerName)
+{
+    auto pIter = loops.find(header);
+    if (pIter == loops.end()) {
+        return;
+    }
+
+    VectorLoop & loop = pIter->second;
+    const std::string * regName = PlatformArm32::regName;
+    std::string tmpReg = regName[ARM32_TMP_REG_NO];
+    std::string vecLabel = headerName + "_vec";
+
+    int32_t indexReg = loop.regs[0];
+    int32_t countReg = loop.regs[1];
+
+    // 各数组的地址寄存器，最后一个数组复用循环变量的寄存器
+    std::vector<int32_t> streamRegs;
+    for (size_t k = 0; k < loop.streams.size(); ++k) {
+        streamRegs.push_back((k + 1 < loop.streams.size()) ? loop.regs[k + 2] : indexReg);
+    }
+
+    // 剩余的元素不足4个时直接执行标量循环
+    iloc.load_var(indexReg, loop.index);
+    iloc.load_var(countReg, loop.bound);
+    iloc.inst("cmp", regName[indexReg], regName[countReg]);
+    iloc.inst("bge", headerName);
+    iloc.inst("sub", regName[countReg], regName[countReg], regName[indexReg]);
+    iloc.inst("cmp", regName[countReg], "#" + std::to_string(VECTORIZE_LANES));
+    iloc.inst("blo", headerName);
+
+    // 各数组的元素地址base+(i+c)*4
+    iloc.inst("lsl", regName[indexReg], regName[indexReg], "#2");
+    for (size_t k = 0; k < loop.streams.size(); ++k) {
+
+        const Stream & stream = loop.streams[k];
+        std::string reg = regName[streamRegs[k]];
+
+        iloc.load_var(ARM32_TMP_REG_NO, stream.base);
+        iloc.inst("add", reg, tmpReg, regName[indexReg]);
+        if (stream.offset > 0) {
+            iloc.inst("add", reg, reg, "#" + std::to_string(stream.offset * 4));
+        } else if (stream.offset < 0) {
+            iloc.inst("sub", reg, reg, "#" + std::to_string(-stream.offset * 4));
+        }
+    }
+
+    // 可能重叠的数组：同一次迭代的元素地址相同或相距不小于一个向量时结果不变，否则执行标量循环
+    for (auto & check: loop.checks) {
+        iloc.inst("subs", tmpReg, regName[streamRegs[check.first]], regName[streamRegs[check.second]]);
+        iloc.inst("addne", tmpReg, tmpReg, "#" + std::to_string(VECTORIZE_LANES * 4 - 1));
+        iloc.inst("cmpne", tmpReg, "#" + std::to_string(VECTORIZE_LANES * 8 - 1));
+        iloc.inst("blo", headerName);
+    }
+
+    // 循环不变量复制到q寄存器的各元素
+    for (auto & op: loop.ops) {
+        if (op.kind == VecOpKind::Splat) {
+            iloc.load_var(ARM32_TMP_REG_NO, op.value);
+            iloc.inst("vdup.32", qRegName(op.reg), tmpReg);
+        }
+    }
+
+    // 计数器为剩余的元素个数减4，减到负数时结束
+    iloc.inst("sub", regName[countReg], regName[countReg], "#" + std::to_string(VECTORIZE_LANES));
+    iloc.label(vecLabel);
+
+    for (auto & op: loop.ops) {
+
+        std::string rd = qRegName(op.reg);
+        std::string rn = (op.src[0] >= 0) ? qRegName(loop.ops[op.src[0]].reg) : "";
+        std::string rm = (op.src[1] >= 0) ? qRegName(loop.ops[op.src[1]].reg) : "";
+
+        switch (op.kind) {
+            case VecOpKind::Splat:
+                break;
+            case VecOpKind::Load:
+            case VecOpKind::Store: {
+                std::string addr = "[" + regName[streamRegs[op.stream]] + "]" + (op.writeBack ? "!" : "");
+                if (op.kind == VecOpKind::Load) {
+                    iloc.inst("vld1.32", dRegList(op.reg), addr);
+                } else {
+                    iloc.inst("vst1.32", dRegList(loop.ops[op.src[0]].reg), addr);
+                }
+                break;
+            }
+            case VecOpKind::Add:
+                iloc.inst("vadd.i32", rd, rn, rm);
+                break;
+            case VecOpKind::Sub:
+                iloc.inst("vsub.i32", rd, rn, rm);
+                break;
+            case VecOpKind::Mul:
+                iloc.inst("vmul.i32", rd, rn, rm);
+                break;
+            case VecOpKind::Neg:
+                iloc.inst("vneg.s32", rd, rn);
+                break;
+            case VecOpKind::CmpGt:
+                iloc.inst("vcgt.s32", rd, rn, rm);
+                break;
+            case VecOpKind::CmpGe:
+                iloc.inst("vcge.s32", rd, rn, rm);
+                break;
+            case VecOpKind::CmpEq:
+                iloc.inst("vceq.i32", rd, rn, rm);
+                break;
+            case VecOpKind::Not:
+                iloc.inst("vmvn", rd, rn);
+                break;
+            case VecOpKind::ToBool:
+                iloc.inst("vshr.u32", rd, rn, "#31");
+                break;
+            case VecOpKind::Test:
+                iloc.inst("vtst.32", rd, rn, rn);
+                break;
+            case VecOpKind::Select:
+                if (rd != rn) {
+                    iloc.inst("vorr", rd, rn, rn);
+                }
+                iloc.inst("vbsl", rd, rm, qRegName(loop.ops[op.src[2]].reg));
+                break;
+        }
+    }
+
+    iloc.inst("subs", regName[countReg], regName[countReg], "#" + std::to_string(VECTORIZE_LANES));
+    iloc.inst("bhs", vecLabel);
+
+    // 循环变量前进到剩余元素的开始，即上界减去剩余的元素个数
+    iloc.load_var(ARM32_TMP_REG_NO, loop.bound);
+    iloc.inst("sub", tmpReg, tmpReg, regName[countReg]);
+    iloc.inst("sub", tmpReg, tmpReg, "#" + std::to_string(VECTORIZE_LANES));
+    iloc.store_var(ARM32_TMP_REG_NO, loop.index, countReg);
+}
+
+/// @brief 两个符号形式是否相同
+/// @param a 符号形式
+/// @param b 符号形式
+/// @return true：相同，false：不同
+bool LoopVectorizerArm32::isSameNode(const Node & a, const Node & b)
+{
+    return (a.kind == b.kind) && (a.offset == b.offset) && (a.value == b.value) && (a.op == b.op);
+}
+
+/// @brief 向量循环使用的需要保护的寄存器，寄存器分配时加入函数的保护寄存器
+/// @return 寄存器编号，从小到大
+std::vector<int32_t> LoopVectorizerArm32::getSavedRegs() const
+{
+    return std::vector<int32_t>(savedRegs.begin(), savedRegs.end());
+}
+
+/// @brief 是否是int数组或指向int的指针，可以作为元素地址的基址
+/// @param val Value
+/// @return true：是，false：不是
+bool LoopVectorizerArm32::isIntArrayBase(Value * val)
+{
+    Type * type = val->getType();
+
+    if (type->isArrayType()) {
+        return static_cast<ArrayType *>(type)->getElementType()->isInt32Type();
+    }
+
+    if (type->isPointerType()) {
+        return static_cast<PointerType *>(type)->getPointeeType()->isInt32Type();
+    }
+
+    return false;
+}
+
+/// @brief q寄存器名
+/// @param reg q寄存器编号
+/// @return 寄存器名，如q8
+std::string LoopVectorizerArm32::qRegName(int32_t reg)
+{
+    return "q" + std::to_string(reg);
+}
+
+/// @brief q寄存器对应的d寄存器列表，作为vld1/vst1的操作数
+/// @param reg q寄存器编号
+/// @return 寄存器列表，如{d16,d17}
+std::string LoopVectorizerArm32::dRegList(int32_t reg)
+{
+    return "{d" + std::to_string(2 * reg) + ",d" + std::to_string(2 * reg + 1) + "}";
+}
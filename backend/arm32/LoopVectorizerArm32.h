@@ -0,0 +1,298 @@
+///
+/// @file LoopVectorizerArm32.h
+/// @brief ARM32的循环向量化，把int数组的简单循环用NEON指令每次处理4个元素的头文件
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Function.h"
+#include "ILocArm32.h"
+
+class LabelInstruction;
+
+/// @brief 每个q寄存器容纳的int元素个数，即向量循环每次迭代处理的元素个数
+#define VECTORIZE_LANES 4
+
+/// @brief 数组下标相对循环变量的常量偏移的最大绝对值，保证字节偏移可作为add/sub的立即数
+#define VECTORIZE_MAX_OFFSET 255
+
+///
+/// @brief 循环向量化。指令选择前在函数的线性IR上识别IRGenerator为while语句产生的以下结构：
+///   .Lh: %c = icmp lt i,n; bc %c, label .Lb, label .Lx
+///   .Lb: 循环体; i = i + 1; br label .Lh
+///   .Lx:
+/// 循环体内只能包含int数组元素的单位步长访问，即地址为base+(i+c)*4的指针读取与写入，
+/// 元素之间以及与循环不变量的add/sub/mul/neg与比较运算，以及由比较控制的if/if-else选择。
+/// 指令选择到循环头时在其之前插入NEON的向量循环，每次迭代用vld1.32/vst1.32处理4个元素，
+/// 选择用vbsl实现；之后原来的标量循环处理剩余的元素。可能重叠的数组（指针形参等）
+/// 在运行时检查地址，重叠会改变结果时直接执行标量循环
+///
+class LoopVectorizerArm32 {
+
+public:
+    /// @brief 构造函数
+    /// @param _func 函数，在寄存器分配之前识别循环
+    /// @param _iloc 函数的ILOC指令序列
+    LoopVectorizerArm32(Function * _func, ILocArm32 & _iloc);
+
+    /// @brief 识别函数内可向量化的循环
+    /// @return 可向量化的循环个数
+    int32_t run();
+
+    /// @brief Label是可向量化循环的循环头时，产生其之前的向量循环
+    /// @param header Label指令
+    /// @param headerName 循环头在汇编中的名字，也是不满足向量化条件时的跳转目标
+    void emitVectorLoop(LabelInstruction * header, const std::string & headerName);
+
+    /// @brief 向量循环使用的需要保护的寄存器，寄存器分配时加入函数的保护寄存器
+    /// @return 寄存器编号，从小到大
+    std::vector<int32_t> getSavedRegs() const;
+
+private:
+    /// @brief 循环体内Value的符号形式
+    enum class NodeKind {
+        Index,     ///< 循环变量加常量，i+c
+        Offset,    ///< 元素的字节偏移，(i+c)*4
+        Address,   ///< 元素的地址，base+(i+c)*4
+        Invariant, ///< 循环不变量，常量或循环内没有定值的变量
+        Vector,    ///< 连续4个元素的值
+        Mask,      ///< 比较结果，各元素全1或全0
+    };
+
+    /// @brief 符号形式的Value
+    struct Node {
+        NodeKind kind = NodeKind::Invariant;
+
+        /// @brief Index、Offset、Address的常量c
+        int32_t offset = 0;
+
+        /// @brief Address的基址或Invariant的值
+        Value * value = nullptr;
+
+        /// @brief Vector、Mask对应的向量运算
+        int32_t op = -1;
+    };
+
+    /// @brief 向量运算的种类
+    enum class VecOpKind {
+        Splat,  ///< 循环不变量复制到各元素，vdup.32，在向量循环之前执行
+        Load,   ///< vld1.32
+        Store,  ///< vst1.32
+        Add,    ///< vadd.i32
+        Sub,    ///< vsub.i32
+        Mul,    ///< vmul.i32
+        Neg,    ///< vneg.s32
+        CmpGt,  ///< vcgt.s32
+        CmpGe,  ///< vcge.s32
+        CmpEq,  ///< vceq.i32
+        Not,    ///< vmvn
+        ToBool, ///< 全1或全0的比较结果转为1或0，vshr.u32 #31
+        Test,   ///< 非0的元素转为全1，vtst.32
+        Select, ///< 按比较结果选择，vbsl
+    };
+
+    /// @brief 向量运算
+    struct VecOp {
+        VecOpKind kind;
+
+        /// @brief 源操作数对应的向量运算，Select依次为条件、条件成立与不成立时的值
+        int32_t src[3] = {-1, -1, -1};
+
+        /// @brief Load、Store访问的数组
+        int32_t stream = -1;
+
+        /// @brief Splat的循环不变量
+        Value * value = nullptr;
+
+        /// @brief 结果分配的q寄存器
+        int32_t reg = -1;
+
+        /// @brief 访存后是否写回基址，每个数组在循环内的最后一次访问写回
+        bool writeBack = false;
+    };
+
+    /// @brief 循环内以单位步长访问的数组，基址与下标的常量偏移都相同的访问视为同一个
+    struct Stream {
+        /// @brief 基址，数组变量或指针
+        Value * base;
+
+        /// @brief 下标相对循环变量的常量偏移
+        int32_t offset;
+
+        /// @brief 最后一次读取的向量运算，没有时为-1
+        int32_t lastLoad = -1;
+
+        /// @brief 第一次写入的向量运算，没有时为-1
+        int32_t firstStore = -1;
+    };
+
+    /// @brief 可向量化的循环
+    struct VectorLoop {
+        /// @brief 循环变量
+        Value * index = nullptr;
+
+        /// @brief 循环变量的上界
+        Value * bound = nullptr;
+
+        /// @brief 访问的数组
+        std::vector<Stream> streams;
+
+        /// @brief 向量运算，按执行次序
+        std::vector<VecOp> ops;
+
+        /// @brief 需要运行时检查地址是否重叠的数组对
+        std::vector<std::pair<int32_t, int32_t>> checks;
+
+        /// @brief 可用的通用寄存器
+        std::vector<int32_t> regs;
+    };
+
+    /// @brief 分析循环体时的状态
+    struct BodyState {
+        /// @brief 循环体内已定值的Value的符号形式
+        std::unordered_map<Value *, Node> nodes;
+
+        /// @brief 各数组最近一次读取或写入的值，写入后其它数组的缓存失效
+        std::unordered_map<int32_t, int32_t> loaded;
+
+        /// @brief if分支内待合并的写入，数组及写入的值
+        std::unordered_map<int32_t, int32_t> pendingStores;
+
+        /// @brief 是否在if分支内
+        bool inArm = false;
+
+        /// @brief 分支之前的无条件访问过的数组，分支内只能读取这些数组
+        std::unordered_set<int32_t> safeStreams;
+    };
+
+    /// @brief 分析以header开始的循环是否可以向量化
+    /// @param pos 循环头在指令序列中的位置
+    /// @param loop 可以向量化时的循环信息
+    /// @return true：可以，false：不可以
+    bool analyzeLoop(size_t pos, VectorLoop & loop);
+
+    /// @brief 分析一段顺序执行的指令
+    /// @param start 开始位置
+    /// @param end 结束位置，不包含
+    /// @param state 分析状态
+    /// @return true：可以向量化，false：不可以
+    bool analyzeBlock(size_t start, size_t end, BodyState & state);
+
+    /// @brief 分析一条指令
+    /// @param inst 指令
+    /// @param state 分析状态
+    /// @return true：可以向量化，false：不可以
+    bool analyzeInst(Instruction * inst, BodyState & state);
+
+    /// @brief 分析if或if-else结构，合并两个分支的定值与写入
+    /// @param pos 条件跳转的位置，返回时为结构之后的位置
+    /// @param end 循环体的结束位置
+    /// @param state 分析状态
+    /// @return true：可以向量化，false：不可以
+    bool analyzeSelect(size_t & pos, size_t end, BodyState & state);
+
+    /// @brief 获取Value的符号形式
+    /// @param val Value
+    /// @param state 分析状态
+    /// @param node 符号形式
+    /// @return true：成功，false：循环内定值的Value在定值之前使用，不能向量化
+    bool getNode(Value * val, BodyState & state, Node & node);
+
+    /// @brief 获取作为向量运算操作数的向量，循环不变量复制到各元素，比较结果转为1或0
+    /// @param node 符号形式
+    /// @return 向量运算，不能作为操作数时为-1
+    int32_t vectorOf(const Node & node);
+
+    /// @brief 获取作为选择条件的比较结果，向量的非0元素转为全1
+    /// @param node 符号形式
+    /// @return 向量运算，不能作为条件时为-1
+    int32_t maskOf(const Node & node);
+
+    /// @brief 增加一个向量运算
+    /// @param kind 种类
+    /// @param src0 源操作数
+    /// @param src1 源操作数
+    /// @param src2 源操作数
+    /// @return 向量运算的编号
+    int32_t addOp(VecOpKind kind, int32_t src0 = -1, int32_t src1 = -1, int32_t src2 = -1);
+
+    /// @brief 获取地址对应的数组，没有时新增
+    /// @param addr 地址的符号形式
+    /// @return 数组的编号
+    int32_t streamOf(const Node & addr);
+
+    /// @brief 检查数组之间的依赖，确定运行时需要检查重叠的数组对
+    /// @return true：可以向量化，false：存在改变结果的依赖
+    bool checkDependences();
+
+    /// @brief 为向量运算分配q寄存器，确定写回基址的访存
+    /// @return true：成功，false：寄存器不足
+    bool allocateRegs();
+
+    /// @brief 两个符号形式是否相同
+    /// @param a 符号形式
+    /// @param b 符号形式
+    /// @return true：相同，false：不同
+    static bool isSameNode(const Node & a, const Node & b);
+
+    /// @brief 是否是int数组或指向int的指针，可以作为元素地址的基址
+    /// @param val Value
+    /// @return true：是，false：不是
+    static bool isIntArrayBase(Value * val);
+
+    /// @brief q寄存器名
+    /// @param reg q寄存器编号
+    /// @return 寄存器名，如q8
+    static std::string qRegName(int32_t reg);
+
+    /// @brief q寄存器对应的d寄存器列表，作为vld1/vst1的操作数
+    /// @param reg q寄存器编号
+    /// @return 寄存器列表，如{d16,d17}
+    static std::string dRegList(int32_t reg);
+
+    /// @brief 要处理的函数
+    Function * func;
+
+    /// @brief ILOC指令序列
+    ILocArm32 & iloc;
+
+    /// @brief 函数内有效的IR指令
+    std::vector<Instruction *> insts;
+
+    /// @brief 各Label被跳转指令引用的次数
+    std::unordered_map<LabelInstruction *, int32_t> labelRefs;
+
+    /// @brief 正在分析的循环
+    VectorLoop * current = nullptr;
+
+    /// @brief 正在分析的循环内定值的Value
+    std::unordered_set<Value *> loopDefs;
+
+    /// @brief 正在分析的循环内各循环不变量复制到各元素的向量运算
+    std::unordered_map<Value *, int32_t> splatOps;
+
+    /// @brief 正在分析的循环内各比较结果转为1或0的向量运算
+    std::unordered_map<int32_t, int32_t> boolOps;
+
+    /// @brief 向量循环使用的r4-r9
+    std::set<int32_t> savedRegs;
+
+    /// @brief 可向量化的循环，按循环头查找
+    std::unordered_map<LabelInstruction *, VectorLoop> loops;
+};
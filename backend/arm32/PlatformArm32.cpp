@@ -15,7 +15,10 @@
 ///
 #include "PlatformArm32.h"
 
+#include "Function.h"
 #include "IntegerType.h"
+#include "LocalVariable.h"
+#include "MoveInstruction.h"
 
 const std::string PlatformArm32::regName[PlatformArm32::maxRegNum] = {
     "r0",  // 用于传参或返回值等，不需要栈保护
@@ -56,6 +59,80 @@ RegVariable * PlatformArm32::intRegVal[PlatformArm32::maxRegNum] = {
     new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[15], 15),
 };
 
+const std::string PlatformArm32::floatRegName[PlatformArm32::maxFloatRegNum] = {
+    "s0",  "s1",  "s2",  "s3",  "s4",  "s5",  "s6",  "s7",  "s8",  "s9",  "s10",
+    "s11", "s12", "s13", "s14", "s15", "s16", "s17", "s18", "s19", "s20", "s21",
+    "s22", "s23", "s24", "s25", "s26", "s27", "s28", "s29", "s30", "s31",
+};
+
+/// @brief 按硬浮点调用约定计算参数的传递位置：整数依次使用r0-r3，float依次使用s0-s15，
+/// 其余参数按参数次序通过栈传递，每个占4字节
+/// @param types 各参数的类型
+/// @return 各参数的传递位置
+std::vector<ArmArgLocation> PlatformArm32::argLocations(const std::vector<Type *> & types)
+{
+    std::vector<ArmArgLocation> locations(types.size());
+
+    int32_t intRegs = 0;
+    int32_t floatRegs = 0;
+    int32_t stackOffset = 0;
+
+    for (size_t k = 0; k < types.size(); ++k) {
+
+        ArmArgLocation & loc = locations[k];
+        loc.isFloat = types[k]->isFloatType();
+
+        if (loc.isFloat && (floatRegs < maxUsableFloatRegNum)) {
+            loc.reg = floatRegs++;
+        } else if ((!loc.isFloat) && (intRegs < 4)) {
+            loc.reg = intRegs++;
+        } else {
+            loc.stackOffset = stackOffset;
+            stackOffset += 4;
+        }
+    }
+
+    return locations;
+}
+
+/// @brief 按硬浮点调用约定计算函数形参的传递位置，并标记需要保存到栈内的整数寄存器形参
+/// @param func 函数
+/// @return 各形参的传递位置
+std::vector<ArmArgLocation> PlatformArm32::paramLocations(Function * func)
+{
+    auto & params = func->getParams();
+
+    std::vector<Type *> types;
+    for (auto param: params) {
+        types.push_back(param->getType());
+    }
+
+    std::vector<ArmArgLocation> locations = argLocations(types);
+
+    // 标量形参在入口处复制到局部变量，之后r0-r3可被分配使用。
+    // 数组形参等直接使用的形参若留在寄存器中会被覆盖，需保存到栈内
+    bool entry = true;
+    for (auto inst: func->getInterCode().getInsts()) {
+
+        if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
+            entry = false;
+        }
+
+        bool entryCopy = entry && (dynamic_cast<MoveInstruction *>(inst) != nullptr) &&
+                         (dynamic_cast<LocalVariable *>(inst->getOperand(0)) != nullptr);
+
+        for (int32_t m = entryCopy ? 1 : 0; m < inst->getOperandsNum(); ++m) {
+            for (size_t k = 0; k < params.size(); ++k) {
+                if ((inst->getOperand(m) == params[k]) && (locations[k].reg != -1) && !locations[k].isFloat) {
+                    locations[k].saved = true;
+                }
+            }
+        }
+    }
+
+    return locations;
+}
+
 /// @brief 循环左移两位
 /// @param num
 void PlatformArm32::roundLeftShiftTwoBit(unsigned int & num)
@@ -104,6 +181,64 @@ bool PlatformArm32::isDisp(int num)
     return num < 4096 && num > -4096;
 }
 
+/// @brief 判断num是否是Thumb-2的修改立即数，8位数字循环右移或按字节重复得到
+/// @param num
+/// @return
+bool PlatformArm32::__thumbConstExpr(int num)
+{
+    unsigned int new_num = (unsigned int) num;
+
+    if (new_num <= 0xff) {
+        return true;
+    }
+
+    // 0x00XY00XY、0xXY00XY00、0xXYXYXYXY三种按字节重复的形式
+    unsigned int byte = new_num & 0xff;
+    if (((new_num & 0xff00ff00) == 0) && ((new_num >> 16) == byte)) {
+        return true;
+    }
+    if (((new_num & 0x00ff00ff) == 0) && ((new_num >> 16) == (new_num & 0xffff))) {
+        return true;
+    }
+    if (new_num == byte * 0x01010101u) {
+        return true;
+    }
+
+    // 最高位为1的8位数字循环右移8到31位
+    for (int rot = 8; rot < 32; rot++) {
+        unsigned int imm8 = (new_num << rot) | (new_num >> (32 - rot));
+        if ((imm8 >= 0x80) && (imm8 <= 0xff)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// @brief Thumb-2下add/sub是否可直接使用该立即数，含addw/subw的12位立即数
+/// @param num
+/// @return
+bool PlatformArm32::thumbConstExpr(int num)
+{
+    return (num < 4096 && num > -4096) || __thumbConstExpr(num) || __thumbConstExpr(-num);
+}
+
+/// @brief Thumb-2下判定是否是合法的ldr/str偏移，负偏移只有8位
+/// @param num
+/// @return
+bool PlatformArm32::isThumbDisp(int num)
+{
+    return num < 4096 && num > -256;
+}
+
+/// @brief 判断是否是r0-r7的低寄存器，Thumb的16位指令大多只能使用低寄存器
+/// @param name 寄存器名字
+/// @return 是否是
+bool PlatformArm32::isLowReg(const std::string & name)
+{
+    return name.size() == 2 && name[0] == 'r' && name[1] >= '0' && name[1] <= '7';
+}
+
 /// @brief 判断是否是合法的寄存器名
 /// @param s 寄存器名字
 /// @return 是否是
@@ -15,13 +15,20 @@
 ///
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "RegVariable.h"
 
+class Function;
+
 // 在操作过程中临时借助的寄存器为ARM32_TMP_REG_NO
 #define ARM32_TMP_REG_NO 10
 
+// 过程内调用暂存寄存器IP，不需要保护，也不参与分配
+#define ARM32_IP_REG_NO 12
+
 // 栈寄存器SP和FP
 #define ARM32_SP_REG_NO 13
 #define ARM32_FP_REG_NO 11
@@ -29,6 +36,22 @@
 // 函数跳转寄存器LX
 #define ARM32_LX_REG_NO 14
 
+/// @brief 硬浮点调用约定下参数的传递位置
+struct ArmArgLocation {
+
+    /// @brief 传递参数的寄存器编号，float为s寄存器的编号，-1表示栈传递
+    int32_t reg = -1;
+
+    /// @brief 是否通过s寄存器传递
+    bool isFloat = false;
+
+    /// @brief 栈传递时相对于调用时sp的偏移
+    int32_t stackOffset = -1;
+
+    /// @brief r0-r3传递的整数形参在入口复制之外还被使用，需在函数入口处保存到栈内
+    bool saved = false;
+};
+
 /// @brief ARM32平台信息
 class PlatformArm32 {
 
@@ -41,6 +64,11 @@ class PlatformArm32 {
     /// @return
     static bool __constExpr(int num);
 
+    /// @brief 判断num是否是Thumb-2的修改立即数，8位数字循环右移或按字节重复得到
+    /// @param num
+    /// @return
+    static bool __thumbConstExpr(int num);
+
 public:
     /// @brief 同时处理正数和负数
     /// @param num
@@ -52,6 +80,21 @@ public:
     /// @return
     static bool isDisp(int num);
 
+    /// @brief Thumb-2下add/sub是否可直接使用该立即数，含addw/subw的12位立即数
+    /// @param num
+    /// @return
+    static bool thumbConstExpr(int num);
+
+    /// @brief Thumb-2下判定是否是合法的ldr/str偏移，负偏移只有8位
+    /// @param num
+    /// @return
+    static bool isThumbDisp(int num);
+
+    /// @brief 判断是否是r0-r7的低寄存器，Thumb的16位指令大多只能使用低寄存器
+    /// @param name 寄存器名字
+    /// @return 是否是
+    static bool isLowReg(const std::string & name);
+
     /// @brief 判断是否是合法的寄存器名
     /// @param name 寄存器名字
     /// @return 是否是
@@ -68,4 +111,24 @@ public:
 
     /// @brief 对寄存器R0分配Value，记录位置
     static RegVariable * intRegVal[PlatformArm32::maxRegNum];
+
+    /// @brief 最大浮点寄存器数目
+    static const int maxFloatRegNum = 32;
+
+    /// @brief 可使用的浮点寄存器的个数s0-s15，调用者保存，使用时不需要栈保护
+    static const int maxUsableFloatRegNum = 16;
+
+    /// @brief 浮点寄存器的名字，s0-s31
+    static const std::string floatRegName[maxFloatRegNum];
+
+    /// @brief 按硬浮点调用约定计算参数的传递位置：整数依次使用r0-r3，float依次使用s0-s15，
+    /// 其余参数按参数次序通过栈传递，每个占4字节
+    /// @param types 各参数的类型
+    /// @return 各参数的传递位置
+    static std::vector<ArmArgLocation> argLocations(const std::vector<Type *> & types);
+
+    /// @brief 按硬浮点调用约定计算函数形参的传递位置，并标记需要保存到栈内的整数寄存器形参
+    /// @param func 函数
+    /// @return 各形参的传递位置
+    static std::vector<ArmArgLocation> paramLocations(Function * func);
 };
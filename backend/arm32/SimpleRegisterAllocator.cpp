@@ -29,9 +29,12 @@ SimpleRegisterAllocator::SimpleRegisterAllocator()
 ///
 int SimpleRegisterAllocator::Allocate(Value * var, int32_t no)
 {
-    if (var && (var->getLoadRegId() != -1)) {
-        // 该变量已经分配了Load寄存器了，不需要再次分配
-        return var->getLoadRegId();
+    if (var) {
+        auto pIter = findValue(var);
+        if (pIter != regValues.end()) {
+            // 该变量已经分配了Load寄存器了，不需要再次分配
+            return pIter->second;
+        }
     }
 
     int32_t regno = -1;
@@ -66,23 +69,16 @@ int SimpleRegisterAllocator::Allocate(Value * var, int32_t no)
 
         // 没有可用的寄存器分配，需要溢出一个变量的寄存器
 
-        // 溢出的策略：选择最迟加入队列的变量
-        Value * oldestVar = regValues.front();
-
-        // 获取Load寄存器编号，设置该变量不再占用Load寄存器
-        regno = oldestVar->getLoadRegId();
+        // 溢出的策略：选择最迟加入队列的变量，获取其Load寄存器编号
+        regno = regValues.front().second;
 
-        // 设置该变量不再占用寄存器
-        oldestVar->setLoadRegId(-1);
-
-        // 从队列中删除
+        // 从队列中删除，该变量不再占用寄存器
         regValues.erase(regValues.begin());
     }
 
     if (var) {
         // 加入新的变量
-        var->setLoadRegId(regno);
-        regValues.push_back(var);
+        regValues.emplace_back(var, regno);
     }
 
     return regno;
@@ -112,12 +108,16 @@ void SimpleRegisterAllocator::Allocate(int32_t no)
 ///
 void SimpleRegisterAllocator::free(Value * var)
 {
-    if (var && (var->getLoadRegId() != -1)) {
+    if (!var) {
+        return;
+    }
+
+    auto pIter = findValue(var);
+    if (pIter != regValues.end()) {
 
         // 清除该索引的寄存器，变得可使用
-        regBitmap.reset(var->getLoadRegId());
-        regValues.erase(std::find(regValues.begin(), regValues.end(), var));
-        var->setLoadRegId(-1);
+        regBitmap.reset(pIter->second);
+        regValues.erase(pIter);
     }
 }
 
@@ -136,17 +136,50 @@ void SimpleRegisterAllocator::free(int32_t no)
     regBitmap.reset(no);
 
     // 查找寄存器编号
-    auto pIter = std::find_if(regValues.begin(), regValues.end(), [=](auto val) {
-        return val->getLoadRegId() == no; // 存器编号与 no 匹配
+    auto pIter = std::find_if(regValues.begin(), regValues.end(), [=](auto & item) {
+        return item.second == no; // 存器编号与 no 匹配
     });
 
     if (pIter != regValues.end()) {
-        // 查找到，则清除，并设置为-1
-        (*pIter)->setLoadRegId(-1);
+        // 查找到，则清除
         regValues.erase(pIter);
     }
 }
 
+///
+/// @brief 分配一个浮点寄存器s0-s15，只在一条IR指令的翻译内临时使用。
+/// 指定了寄存器编号时强制占用该寄存器，如函数调用时传递float参数的寄存器
+/// @param no 指定的寄存器编号
+/// @return int 浮点寄存器编号，没有空闲寄存器时为-1
+///
+int SimpleRegisterAllocator::AllocateFloat(int32_t no)
+{
+    if (no != -1) {
+        floatRegBitmap.set(no);
+        return no;
+    }
+
+    for (int k = 0; k < PlatformArm32::maxUsableFloatRegNum; ++k) {
+        if (!floatRegBitmap.test(k)) {
+            floatRegBitmap.set(k);
+            return k;
+        }
+    }
+
+    return -1;
+}
+
+///
+/// @brief 将浮点寄存器no标记为空闲状态
+/// @param no 浮点寄存器编号
+///
+void SimpleRegisterAllocator::freeFloat(int32_t no)
+{
+    if (no != -1) {
+        floatRegBitmap.reset(no);
+    }
+}
+
 ///
 /// @brief 寄存器被置位，使用过的寄存器被置位
 /// @param no
@@ -155,4 +188,14 @@ void SimpleRegisterAllocator::bitmapSet(int32_t no)
 {
     regBitmap.set(no);
     usedBitmap.set(no);
-}
\ No newline at end of file
+}
+
+///
+/// @brief 查找变量占用的Load寄存器记录
+/// @param var 变量
+/// @return 找到时为对应的迭代器，否则为regValues.end()
+///
+std::vector<std::pair<Value *, int32_t>>::iterator SimpleRegisterAllocator::findValue(Value * var)
+{
+    return std::find_if(regValues.begin(), regValues.end(), [=](auto & item) { return item.first == var; });
+}
@@ -15,6 +15,7 @@
 ///
 #pragma once
 
+#include <utility>
 #include <vector>
 
 #include "BitMap.h"
@@ -56,6 +57,20 @@ public:
     ///
     void free(int32_t);
 
+    ///
+    /// @brief 分配一个浮点寄存器s0-s15，只在一条IR指令的翻译内临时使用。
+    /// 指定了寄存器编号时强制占用该寄存器，如函数调用时传递float参数的寄存器
+    /// @param no 指定的寄存器编号
+    /// @return int 浮点寄存器编号，没有空闲寄存器时为-1
+    ///
+    int AllocateFloat(int32_t no = -1);
+
+    ///
+    /// @brief 将浮点寄存器no标记为空闲状态
+    /// @param no 浮点寄存器编号
+    ///
+    void freeFloat(int32_t no);
+
 protected:
     ///
     /// @brief 寄存器被置位，使用过的寄存器被置位
@@ -63,6 +78,13 @@ protected:
     ///
     void bitmapSet(int32_t no);
 
+    ///
+    /// @brief 查找变量占用的Load寄存器记录
+    /// @param var 变量
+    /// @return 找到时为对应的迭代器，否则为regValues.end()
+    ///
+    std::vector<std::pair<Value *, int32_t>>::iterator findValue(Value * var);
+
 protected:
     ///
     /// @brief 寄存器位图：1已被占用，0未被使用
@@ -71,11 +93,18 @@ protected:
 
     ///
     /// @brief 寄存器被那个Value占用。按照时间次序加入
+    /// 寄存器编号记录在分配器内，而不是写回Value，
+    /// 这样常量、全局变量等跨函数共享的Value在多个函数并行指令选择时互不干扰
     ///
-    std::vector<Value *> regValues;
+    std::vector<std::pair<Value *, int32_t>> regValues;
 
     ///
     /// @brief 使用过的所有寄存器编号
     ///
     BitMap<PlatformArm32::maxUsableRegNum> usedBitmap;
+
+    ///
+    /// @brief 浮点寄存器位图：1已被占用，0未被使用。只使用调用者保存的s0-s15，因此不需要栈保护
+    ///
+    BitMap<PlatformArm32::maxUsableFloatRegNum> floatRegBitmap;
 };
@@ -0,0 +1,493 @@
+///
+/// @file Thumb2Arm32.cpp
+/// @brief 把ARM32指令选择产生的A32指令序列调整为Thumb-2指令序列的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <cstdlib>
+#include <vector>
+
+#include "Thumb2Arm32.h"
+#include "PlatformArm32.h"
+
+/// @brief 解析立即数操作数，如#16
+/// @param str 操作数
+/// @param value 立即数的值
+/// @return true：是立即数，false：不是
+static bool parseImm(const std::string & str, int64_t & value)
+{
+    if ((str.size() < 2) || (str[0] != '#')) {
+        return false;
+    }
+
+    char * end;
+    value = strtoll(str.c_str() + 1, &end, 10);
+
+    return *end == '\0';
+}
+
+/// @brief 解析内存操作数，如[fp,#-16]、[r0]、[fp,r8]
+/// @param str 操作数
+/// @param base 基址寄存器
+/// @param index 变址寄存器或者立即数偏移，没有时为空
+/// @return true：成功，false：不是内存操作数
+static bool parseAddr(const std::string & str, std::string & base, std::string & index)
+{
+    if ((str.size() < 3) || (str.front() != '[') || (str.back() != ']')) {
+        return false;
+    }
+
+    std::string inner = str.substr(1, str.size() - 2);
+    size_t comma = inner.find(',');
+    if (comma == std::string::npos) {
+        base = inner;
+        index.clear();
+    } else {
+        base = inner.substr(0, comma);
+        index = inner.substr(comma + 1);
+    }
+
+    return true;
+}
+
+/// @brief push/pop的寄存器列表是否可用16位编码，只含低寄存器以及push的lr或pop的pc
+/// @param list 寄存器列表，如{r4,fp,lr}
+/// @param extra 额外允许的寄存器
+/// @return true：可以，false：不可以
+static bool isNarrowRegList(const std::string & list, const std::string & extra)
+{
+    size_t start = 1;
+    while (start < list.size()) {
+        size_t end = list.find_first_of(",}", start);
+        if (end == std::string::npos) {
+            break;
+        }
+
+        std::string reg = list.substr(start, end - start);
+        if (!PlatformArm32::isLowReg(reg) && (reg != extra)) {
+            return false;
+        }
+
+        start = end + 1;
+    }
+
+    return true;
+}
+
+/// @brief 按汇编器选择编码的规则估算一条指令的大小，跳转指令按32位计算
+/// @param inst 指令
+/// @param base 不带条件的助记符
+/// @param cond 条件，非空时指令在IT块中
+/// @return 字节数
+static int32_t instSize(ArmInst * inst, const std::string & base, const std::string & cond)
+{
+    const std::string & op = inst->opcode;
+    const std::string & rd = inst->result;
+    int64_t imm;
+
+    // IT块中的16位数据处理指令不设置标志位，与IT块外带s的形式编码相同
+    bool narrowForm = (!cond.empty()) || inst->setsFlags();
+
+    if ((op.compare(0, 2, "it") == 0) || (op == "cbz") || (op == "cbnz") || (base == "bx")) {
+        return 2;
+    }
+
+    if (base == "push") {
+        return isNarrowRegList(rd, "lr") ? 2 : 4;
+    }
+
+    if (base == "pop") {
+        return isNarrowRegList(rd, "pc") ? 2 : 4;
+    }
+
+    if ((base == "mov") || (op == "movs")) {
+        if (!parseImm(inst->arg1, imm)) {
+            // 寄存器之间的mov可使用任意寄存器
+            return 2;
+        }
+        return (narrowForm && PlatformArm32::isLowReg(rd) && (imm >= 0) && (imm <= 255)) ? 2 : 4;
+    }
+
+    if ((base == "add") || (base == "sub") || (op == "adds") || (op == "subs")) {
+
+        const std::string & rn = inst->arg1;
+
+        if (parseImm(inst->arg2, imm)) {
+            if ((rd == "sp") && (rn == "sp")) {
+                return ((imm >= 0) && (imm <= 508) && ((imm & 3) == 0)) ? 2 : 4;
+            }
+            if (narrowForm && PlatformArm32::isLowReg(rd) && PlatformArm32::isLowReg(rn) && (imm >= 0)) {
+                return ((imm <= 7) || ((rd == rn) && (imm <= 255))) ? 2 : 4;
+            }
+            return 4;
+        }
+
+        if (narrowForm && PlatformArm32::isLowReg(rd) && PlatformArm32::isLowReg(rn) &&
+            PlatformArm32::isLowReg(inst->arg2)) {
+            return 2;
+        }
+
+        // 不设置标志位的add rd,rd,rm可使用任意寄存器
+        return ((base == "add") && (rd == rn)) ? 2 : 4;
+    }
+
+    if ((op == "lsls") || (op == "rsbs") || (op == "muls") || (op == "ands") || (op == "orrs") || (op == "eors")) {
+        // 只有满足16位编码条件时才会改为带s的形式
+        return 2;
+    }
+
+    if (base == "cmp") {
+        if (parseImm(inst->arg1, imm)) {
+            return (PlatformArm32::isLowReg(rd) && (imm >= 0) && (imm <= 255)) ? 2 : 4;
+        }
+        return 2;
+    }
+
+    if ((base == "ldr") || (base == "str")) {
+
+        std::string rn, index;
+        if (!PlatformArm32::isLowReg(rd) || !parseAddr(inst->arg1, rn, index)) {
+            return 4;
+        }
+
+        if (index.empty()) {
+            imm = 0;
+        } else if (!parseImm(index, imm)) {
+            // 寄存器变址
+            return (PlatformArm32::isLowReg(rn) && PlatformArm32::isLowReg(index)) ? 2 : 4;
+        }
+
+        if ((imm < 0) || ((imm & 3) != 0)) {
+            return 4;
+        }
+        if (rn == "sp") {
+            return (imm <= 1020) ? 2 : 4;
+        }
+        return (PlatformArm32::isLowReg(rn) && (imm <= 124)) ? 2 : 4;
+    }
+
+    return 4;
+}
+
+/// @brief 构造函数
+/// @param _code 一个函数的ILOC指令序列，已删除无用的Label
+Thumb2Arm32::Thumb2Arm32(std::list<ArmInst *> & _code) : code(_code)
+{}
+
+/// @brief 调整为Thumb-2指令序列
+void Thumb2Arm32::run()
+{
+    // A32每条指令4字节
+    armSize = 0;
+    for (auto inst: code) {
+        if (inst->isInst()) {
+            armSize += 4;
+        }
+    }
+
+    // cbz/cbnz去掉了cmp指令，先进行，使得之前的指令有更多机会使用16位编码
+    useCompareBranchZero();
+
+    useNarrowEncoding();
+
+    insertITBlocks();
+
+    thumbSize = estimateSize();
+}
+
+/// @brief 计算每条指令之后标志位是否仍被使用
+/// @return 各指令之后标志位是否活跃，Label为Label处是否活跃
+std::unordered_map<ArmInst *, bool> Thumb2Arm32::computeFlagsLive()
+{
+    std::unordered_map<ArmInst *, bool> liveAfter;
+
+    // Label处标志位是否活跃，跳转到Label的指令之前同样活跃。循环跳转需要迭代到不再变化
+    std::unordered_map<std::string, bool> labelLive;
+
+    bool changed = true;
+    while (changed) {
+
+        changed = false;
+
+        // 函数出口处标志位不活跃
+        bool live = false;
+
+        for (auto pIter = code.rbegin(); pIter != code.rend(); ++pIter) {
+
+            ArmInst * inst = *pIter;
+
+            if (inst->isLabel()) {
+                bool & labelFlag = labelLive[inst->opcode];
+                if (live && !labelFlag) {
+                    labelFlag = true;
+                    changed = true;
+                }
+                liveAfter[inst] = live;
+                continue;
+            }
+
+            if (!inst->isInst()) {
+                continue;
+            }
+
+            liveAfter[inst] = live;
+
+            std::string base;
+            std::string cond = inst->getCond(base);
+
+            if ((base == "b") && cond.empty()) {
+                // 无条件跳转，与目标Label处相同
+                auto labelIter = labelLive.find(inst->result);
+                live = (labelIter != labelLive.end()) && labelIter->second;
+            } else if ((inst->opcode == "cbz") || (inst->opcode == "cbnz")) {
+                // 不读也不写标志位，顺序执行与跳转目标处之一活跃即活跃
+                auto labelIter = labelLive.find(inst->arg1);
+                live = live || ((labelIter != labelLive.end()) && labelIter->second);
+            } else if ((base == "bl") || (base == "bx") ||
+                       ((base == "pop") && (inst->result.find("pc") != std::string::npos))) {
+                // 函数调用不保持标志位，函数返回后标志位不再使用
+                live = false;
+            } else {
+                if (inst->setsFlags()) {
+                    live = false;
+                }
+                if (!cond.empty()) {
+                    live = true;
+                }
+            }
+        }
+    }
+
+    return liveAfter;
+}
+
+/// @brief 与0比较后的条件跳转改为cbz/cbnz
+void Thumb2Arm32::useCompareBranchZero()
+{
+    std::unordered_map<ArmInst *, bool> liveAfter = computeFlagsLive();
+
+    for (auto pIter = code.begin(); pIter != code.end(); ++pIter) {
+
+        ArmInst * cmpInst = *pIter;
+        if (!cmpInst->isInst() || (cmpInst->opcode != "cmp") || (cmpInst->arg1 != "#0") ||
+            !PlatformArm32::isLowReg(cmpInst->result)) {
+            continue;
+        }
+
+        // 紧随其后的指令必须是beq或bne
+        auto brIter = std::next(pIter);
+        while ((brIter != code.end()) && !(*brIter)->isInst() && !(*brIter)->isLabel()) {
+            ++brIter;
+        }
+        if ((brIter == code.end()) || !(*brIter)->isInst()) {
+            continue;
+        }
+
+        ArmInst * brInst = *brIter;
+        if (((brInst->opcode != "beq") && (brInst->opcode != "bne")) || !brInst->cond.empty() || liveAfter[brInst]) {
+            continue;
+        }
+
+        // 只能向前跳转，偏移0到126字节。这里按调整前的指令估算上限，条件执行的指令可能还需要IT指令
+        int32_t bytes = 0;
+        bool found = false;
+        for (auto iter = std::next(brIter); iter != code.end() && bytes <= 128; ++iter) {
+            if ((*iter)->isLabel() && ((*iter)->opcode == brInst->result)) {
+                // 跳转目标处也不能使用cmp设置的标志位
+                found = !liveAfter[*iter];
+                break;
+            }
+            if ((*iter)->isInst()) {
+                std::string base;
+                bytes += ((*iter)->getCond(base).empty() || (base == "b")) ? 4 : 6;
+            }
+        }
+
+        if (!found || (bytes < 2) || (bytes > 128)) {
+            continue;
+        }
+
+        // cmp r0,#0; bne .L1 => cbnz r0,.L1
+        brInst->replace(brInst->opcode == "beq" ? "cbz" : "cbnz", cmpInst->result, brInst->result);
+        cmpInst->setDead();
+    }
+}
+
+/// @brief 标志位不再使用的低寄存器指令改为带s的形式，以便选用16位编码
+void Thumb2Arm32::useNarrowEncoding()
+{
+    std::unordered_map<ArmInst *, bool> liveAfter = computeFlagsLive();
+
+    for (auto inst: code) {
+
+        if (!inst->isInst() || liveAfter[inst]) {
+            continue;
+        }
+
+        std::string base;
+        if (!inst->getCond(base).empty()) {
+            continue;
+        }
+
+        const std::string & rd = inst->result;
+        const std::string & op = inst->opcode;
+        int64_t imm;
+
+        if (!PlatformArm32::isLowReg(rd)) {
+            continue;
+        }
+
+        if (op == "movw") {
+            // movw r0,#:lower16:100 => movs r0,#100
+            const std::string prefix = "#:lower16:";
+            if (inst->arg1.compare(0, prefix.size(), prefix) == 0 &&
+                parseImm("#" + inst->arg1.substr(prefix.size()), imm) && (imm >= 0) && (imm <= 255)) {
+                inst->replace("movs", rd, "#" + std::to_string(imm));
+            }
+        } else if (op == "mov") {
+            if (parseImm(inst->arg1, imm) && (imm >= 0) && (imm <= 255)) {
+                inst->opcode = "movs";
+            }
+        } else if ((op == "add") || (op == "sub")) {
+            if (!PlatformArm32::isLowReg(inst->arg1)) {
+                continue;
+            }
+            if (parseImm(inst->arg2, imm)) {
+                if ((imm >= 0) && ((imm <= 7) || ((rd == inst->arg1) && (imm <= 255)))) {
+                    inst->opcode = op + "s";
+                }
+            } else if (PlatformArm32::isLowReg(inst->arg2)) {
+                inst->opcode = op + "s";
+            }
+        } else if (op == "lsl") {
+            if (PlatformArm32::isLowReg(inst->arg1) && parseImm(inst->arg2, imm)) {
+                inst->opcode = "lsls";
+            }
+        } else if (op == "rsb") {
+            // 求负数，即negs
+            if (PlatformArm32::isLowReg(inst->arg1) && (inst->arg2 == "#0")) {
+                inst->opcode = "rsbs";
+            }
+        } else if ((op == "mul") || (op == "and") || (op == "orr") || (op == "eor")) {
+            // 16位编码的结果寄存器必须与一个源寄存器相同
+            if (PlatformArm32::isLowReg(inst->arg1) && PlatformArm32::isLowReg(inst->arg2) &&
+                ((rd == inst->arg1) || ((op == "mul") && (rd == inst->arg2)))) {
+                inst->opcode = op + "s";
+            }
+        }
+    }
+}
+
+/// @brief 条件执行的非跳转指令放到IT块中
+void Thumb2Arm32::insertITBlocks()
+{
+    for (auto pIter = code.begin(); pIter != code.end(); ++pIter) {
+
+        ArmInst * first = *pIter;
+        if (!first->isInst()) {
+            continue;
+        }
+
+        std::string base;
+        std::string cond = first->getCond(base);
+        if (cond.empty() || (base == "b")) {
+            continue;
+        }
+
+        // 后续条件相同或相反的指令放到同一个IT块中，最多4条，如itte lt
+        std::string mask;
+        auto last = pIter;
+        for (auto iter = std::next(pIter); iter != code.end() && mask.size() < 3; ++iter) {
+
+            ArmInst * inst = *iter;
+            if (inst->isLabel()) {
+                break;
+            }
+            if (!inst->isInst()) {
+                continue;
+            }
+
+            std::string nextBase;
+            std::string nextCond = inst->getCond(nextBase);
+            if (nextBase == "b") {
+                break;
+            }
+
+            if (nextCond == cond) {
+                mask += 't';
+            } else if (nextCond == ArmInst::invertCond(cond)) {
+                mask += 'e';
+            } else {
+                break;
+            }
+
+            last = iter;
+        }
+
+        code.insert(pIter, new ArmInst("it" + mask, cond));
+        pIter = last;
+    }
+}
+
+/// @brief 估算Thumb-2指令序列的大小
+/// @return 字节数
+int32_t Thumb2Arm32::estimateSize()
+{
+    // 先按32位计算跳转指令得到各指令的位置上限，再根据跳转距离确定跳转指令的大小
+    std::vector<ArmInst *> insts;
+    std::vector<int32_t> sizes;
+    std::vector<int32_t> positions;
+    std::unordered_map<std::string, int32_t> labelPositions;
+
+    int32_t pos = 0;
+    for (auto inst: code) {
+
+        if (inst->isLabel()) {
+            labelPositions[inst->opcode] = pos;
+            continue;
+        }
+
+        if (!inst->isInst()) {
+            continue;
+        }
+
+        std::string base;
+        std::string cond = inst->getCond(base);
+
+        insts.push_back(inst);
+        positions.push_back(pos);
+        sizes.push_back((base == "b") ? 4 : instSize(inst, base, cond));
+
+        pos += sizes.back();
+    }
+
+    int32_t total = 0;
+    for (size_t k = 0; k < insts.size(); ++k) {
+
+        std::string base;
+        std::string cond = insts[k]->getCond(base);
+
+        if (base == "b") {
+            auto labelIter = labelPositions.find(insts[k]->result);
+            if (labelIter != labelPositions.end()) {
+                // 条件跳转的16位编码范围为-256到254，无条件跳转为-2048到2046
+                int32_t dist = std::abs(labelIter->second - (positions[k] + 4));
+                if (dist <= (cond.empty() ? 2040 : 250)) {
+                    sizes[k] = 2;
+                }
+            }
+        }
+
+        total += sizes[k];
+    }
+
+    return total;
+}
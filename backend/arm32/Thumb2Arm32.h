@@ -0,0 +1,81 @@
+///
+/// @file Thumb2Arm32.h
+/// @brief 把ARM32指令选择产生的A32指令序列调整为Thumb-2指令序列的头文件
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <list>
+#include <string>
+#include <unordered_map>
+
+#include "ILocArm32.h"
+
+///
+/// @brief Thumb-2指令序列调整。A32与Thumb-2在统一汇编语法下助记符基本相同，差别在于：
+/// (1) 条件执行的非跳转指令必须放在IT块中；
+/// (2) 16位编码的数据处理指令大多只能使用r0-r7，并且在IT块外总是设置标志位，
+///     因此只有标志位不再被使用时才能改为带s的形式以选用16位编码；
+/// (3) 与0比较后跳转可用cbz/cbnz代替，但只能向前跳转126字节以内。
+/// 各指令的大小按汇编器选择编码的规则估算，用于统计代码大小的变化
+///
+class Thumb2Arm32 {
+
+public:
+    /// @brief 构造函数
+    /// @param _code 一个函数的ILOC指令序列，已删除无用的Label
+    Thumb2Arm32(std::list<ArmInst *> & _code);
+
+    /// @brief 调整为Thumb-2指令序列
+    void run();
+
+    /// @brief 获取调整前A32指令序列的大小
+    /// @return 字节数
+    int32_t getArmSize() const
+    {
+        return armSize;
+    }
+
+    /// @brief 获取调整后Thumb-2指令序列的估算大小
+    /// @return 字节数
+    int32_t getThumbSize() const
+    {
+        return thumbSize;
+    }
+
+private:
+    /// @brief 与0比较后的条件跳转改为cbz/cbnz
+    void useCompareBranchZero();
+
+    /// @brief 标志位不再使用的低寄存器指令改为带s的形式，以便选用16位编码
+    void useNarrowEncoding();
+
+    /// @brief 条件执行的非跳转指令放到IT块中
+    void insertITBlocks();
+
+    /// @brief 计算每条指令之后标志位是否仍被使用
+    /// @return 各指令之后标志位是否活跃，Label为Label处是否活跃
+    std::unordered_map<ArmInst *, bool> computeFlagsLive();
+
+    /// @brief 估算Thumb-2指令序列的大小
+    /// @return 字节数
+    int32_t estimateSize();
+
+    /// @brief ILOC指令序列
+    std::list<ArmInst *> & code;
+
+    /// @brief 调整前A32指令序列的大小
+    int32_t armSize = 0;
+
+    /// @brief 调整后Thumb-2指令序列的估算大小
+    int32_t thumbSize = 0;
+};
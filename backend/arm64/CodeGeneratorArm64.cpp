@@ -0,0 +1,132 @@
+///
+/// @file CodeGeneratorArm64.cpp
+/// @brief ARM64(AArch64)的后端处理实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Function.h"
+#include "Module.h"
+#include "PlatformArm64.h"
+#include "CodeGeneratorArm64.h"
+#include "InstSelectorArm64.h"
+#include "OrderedRegisterAllocator.h"
+#include "ILocArm64.h"
+#include "TimeReport.h"
+
+/// @brief ARM64的汇编伪指令与寄存器
+static const CodeGeneratorAsm64::TargetInfo arm64Target = {
+    ".global",
+    ".align",
+    "%",
+    ".word",
+    "//",
+    2, // 指令为4字节，函数至少4字节对齐，.align按2的幂次
+    PlatformArm64::maxArgRegNum,
+    ARM64_SP_REG_NO,
+    ARM64_FP_REG_NO,
+    PlatformArm64::regName,
+    PlatformArm64::typeSize,
+    PlatformArm64::typeAlignment,
+};
+
+/// @brief 构造函数
+/// @param _module 符号表
+CodeGeneratorArm64::CodeGeneratorArm64(Module * _module) : CodeGeneratorAsm64(_module, arm64Target)
+{}
+
+/// @brief 产生汇编头部分
+void CodeGeneratorArm64::genHeader()
+{
+    fprintf(fp, "%s\n", ".arch armv8-a");
+}
+
+/// @brief 栈内变量地址的汇编写法，[sp,#16]
+/// @param baseRegId 基址寄存器编号
+/// @param offset 偏移
+/// @return 地址的字符串
+std::string CodeGeneratorArm64::memoryOperandStr(int32_t baseRegId, int64_t offset)
+{
+    return "[" + PlatformArm64::regName[baseRegId] + ",#" + std::to_string(offset) + "]";
+}
+
+/// @brief 对函数进行指令选择，产生函数体的汇编指令
+/// @param func 要处理的函数，已完成寄存器分配
+/// @param insts 函数体的汇编指令
+void CodeGeneratorArm64::selectInsts(Function * func, std::string & insts)
+{
+    // ILOC代码序列
+    ILocArm64 iloc(module);
+
+    // 简单的朴素寄存器分配方法，每个函数单独一个
+    OrderedRegisterAllocator simpleRegisterAllocator(PlatformArm64::usableRegNo, PlatformArm64::maxUsableRegNum);
+
+    // 指令选择生成汇编指令
+    {
+        TimeScope scope("InstSelectorArm64::run", func->getName());
+        InstSelectorArm64 instSelector(func->getInterCode().getInsts(), iloc, func, simpleRegisterAllocator);
+        instSelector.setShowLinearIR(this->showLinearIR);
+        instSelector.run();
+    }
+
+    // 删除无用的Label指令
+    {
+        TimeScope scope("deleteUnusedLabel", func->getName());
+        iloc.deleteUnusedLabel();
+    }
+
+    TimeScope scope("emit", func->getName());
+
+    // ILOC代码输出为汇编代码
+    OutputStream os(insts);
+    iloc.outPut(os);
+}
+
+/// @brief 寄存器分配
+/// @param func 函数指针
+void CodeGeneratorArm64::registerAllocation(Function * func)
+{
+    // 内置函数不需要处理
+    if (func->isBuiltin()) {
+        return;
+    }
+
+    // 与ARM32相同采用朴素的寄存器分配：局部变量、形参与临时变量都保存在栈中，
+    // 指令选择时临时加载到调用者保存的x0-x15中，因此不需要保护x19-x28
+
+    // AAPCS64的函数调用约定：
+    // x0-x7用于传参，x0用于返回值，x8-x15为临时寄存器，都不需要保护
+    // x16、x17为过程内临时寄存器，这里x16用于立即数过大时借助寻址
+    // x19-x28需要保护，x29为FP，x30为LR，FP与LR在入口成对保存
+    std::vector<int32_t> & protectedRegNo = func->getProtectedReg();
+    protectedRegNo.clear();
+    protectedRegNo.push_back(ARM64_FP_REG_NO);
+    protectedRegNo.push_back(ARM64_LR_REG_NO);
+
+    // 为局部变量、临时变量以及寄存器传递的形参在栈内分配空间，FP指向保存的FP与LR。
+    // 采用SP+非负偏移寻址，可使用按访问字节数缩放的无符号立即数偏移，32位访问时偏移可达16380，64位时可达32760
+    stackAlloc(func);
+
+    // 栈传递的形参通过FP寻址
+    adjustFormalParamInsts(func);
+}
+
+/// @brief 第一个栈传递的形参相对于FP的偏移，位于入口处保存的FP与LR之上
+/// @param func 要处理的函数
+/// @return 偏移
+int64_t CodeGeneratorArm64::stackParamOffset(Function * func)
+{
+    return func->getProtectedReg().size() * 8;
+}
@@ -0,0 +1,538 @@
+///
+/// @file ILocArm64.cpp
+/// @brief ARM64指令序列管理的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <string>
+#include <unordered_set>
+
+#include "ILocArm64.h"
+#include "Common.h"
+#include "Function.h"
+#include "PlatformArm64.h"
+#include "Module.h"
+
+Arm64Inst::Arm64Inst(std::string _opcode,
+                     std::string _result,
+                     std::string _arg1,
+                     std::string _arg2,
+                     std::string _cond,
+                     std::string _addition)
+    : opcode(_opcode), cond(_cond), result(_result), arg1(_arg1), arg2(_arg2), addition(_addition), dead(false)
+{}
+
+/*
+    设置为无效指令
+*/
+void Arm64Inst::setDead()
+{
+    dead = true;
+}
+
+/*
+    输出函数，直接写入输出流
+*/
+bool Arm64Inst::outPut(OutputStream & os)
+{
+    // 无用代码或占位指令，什么都不输出
+    if (dead || opcode.empty()) {
+        return false;
+    }
+
+    os << opcode;
+
+    // 条件跳转的条件，如b.ne
+    if (!cond.empty()) {
+        os << '.' << cond;
+    }
+
+    // 结果输出
+    if (!result.empty()) {
+        if (result == ":") {
+            os << result;
+        } else {
+            os << ' ' << result;
+        }
+    }
+
+    // 第一元参数输出
+    if (!arg1.empty()) {
+        os << ',' << arg1;
+    }
+
+    // 第二元参数输出
+    if (!arg2.empty()) {
+        os << ',' << arg2;
+    }
+
+    // 其他附加信息输出
+    if (!addition.empty()) {
+        os << ',' << addition;
+    }
+
+    return true;
+}
+
+#define emit(...) code.push_back(new Arm64Inst(__VA_ARGS__))
+
+/// @brief 构造函数
+/// @param _module 符号表
+ILocArm64::ILocArm64(Module * _module)
+{
+    this->module = _module;
+}
+
+/// @brief 析构函数
+ILocArm64::~ILocArm64()
+{
+    for (auto inst: code) {
+        delete inst;
+    }
+}
+
+/// @brief 获取寄存器的名字
+/// @param reg_no 寄存器编号
+/// @param wide true：64位名字，false：32位名字
+/// @return 寄存器名字
+std::string ILocArm64::reg(int reg_no, bool wide)
+{
+    return wide ? PlatformArm64::regName[reg_no] : PlatformArm64::wregName[reg_no];
+}
+
+/// @brief 删除无用的Label指令
+void ILocArm64::deleteUnusedLabel()
+{
+    // 先收集所有转移语句的目标Label，b与b.cond的目标为结果，cbz与cbnz的目标为第一元参数
+    std::unordered_set<std::string> usedLabels;
+    for (Arm64Inst * arm: code) {
+        if (arm->dead) {
+            continue;
+        }
+
+        if ((arm->opcode == "cbz") || (arm->opcode == "cbnz")) {
+            usedLabels.insert(arm->arg1);
+        } else if (arm->opcode[0] == 'b') {
+            usedLabels.insert(arm->result);
+        }
+    }
+
+    // 没有跳转到该Label的指令，则设置为dead
+    for (Arm64Inst * arm: code) {
+        if ((!arm->dead) && (arm->opcode[0] == '.') && (arm->result == ":")) {
+            if (usedLabels.find(arm->opcode) == usedLabels.end()) {
+                arm->setDead();
+            }
+        }
+    }
+}
+
+/// @brief 输出汇编到输出流
+/// @param os 输出流
+/// @param outputEmpty 是否输出空语句
+void ILocArm64::outPut(OutputStream & os, bool outputEmpty)
+{
+    for (auto arm: code) {
+
+        if (arm->result == ":") {
+            // Label指令，不需要Tab输出
+            if (arm->outPut(os)) {
+                os << '\n';
+            }
+            continue;
+        }
+
+        // 除Label指令外的指令前加Tab，空语句时不加
+        if ((!arm->dead) && (!arm->opcode.empty())) {
+            os << '\t';
+            arm->outPut(os);
+            os << '\n';
+        } else if (outputEmpty) {
+            os << '\n';
+        }
+    }
+}
+
+/// @brief 获取当前的代码序列
+/// @return 代码序列
+std::list<Arm64Inst *> & ILocArm64::getCode()
+{
+    return code;
+}
+
+/**
+ * 数字变字符串，若flag为真，则变为立即数寻址（加#）
+ */
+std::string ILocArm64::toStr(int64_t num, bool flag)
+{
+    std::string ret;
+
+    if (flag) {
+        ret = "#";
+    }
+
+    ret += std::to_string(num);
+
+    return ret;
+}
+
+/*
+    产生标签
+*/
+void ILocArm64::label(std::string name)
+{
+    // .L1:
+    emit(name, ":");
+}
+
+/// @brief 0个源操作数指令
+/// @param op 操作码
+/// @param rs 操作数
+void ILocArm64::inst(std::string op, std::string rs)
+{
+    emit(op, rs);
+}
+
+/// @brief 一个源操作数指令
+/// @param op 操作码
+/// @param rs 操作数
+/// @param arg1 源操作数
+void ILocArm64::inst(std::string op, std::string rs, std::string arg1)
+{
+    emit(op, rs, arg1);
+}
+
+/// @brief 两个源操作数指令
+/// @param op 操作码
+/// @param rs 操作数
+/// @param arg1 源操作数
+/// @param arg2 源操作数
+void ILocArm64::inst(std::string op, std::string rs, std::string arg1, std::string arg2)
+{
+    emit(op, rs, arg1, arg2);
+}
+
+/// @brief 两个源操作数并带有移位或扩展的指令
+/// @param op 操作码
+/// @param rs 操作数
+/// @param arg1 源操作数
+/// @param arg2 源操作数
+/// @param extra 移位或扩展
+void ILocArm64::inst(std::string op, std::string rs, std::string arg1, std::string arg2, std::string extra)
+{
+    emit(op, rs, arg1, arg2, "", extra);
+}
+
+///
+/// @brief 注释指令，GNU汇编中ARM64的行注释为//
+///
+void ILocArm64::comment(std::string str)
+{
+    emit("//", str);
+}
+
+/*
+    加载立即数 mov w0,#100
+*/
+void ILocArm64::load_imm(int rs_reg_no, int64_t constant, bool wide)
+{
+    std::string rsReg = reg(rs_reg_no, wide);
+
+    // 64位时movn左移16位后低16位为全1，只有非负数可以一条指令加载低16位为0的数
+    bool single = PlatformArm64::isMovImm(constant);
+    if (wide && (constant < -0x10000)) {
+        single = false;
+    }
+
+    if (single) {
+        // 汇编器根据立即数选用movz或movn
+        emit("mov", rsReg, toStr(constant));
+        return;
+    }
+
+    // movz加载低16位并清零其它位，movk加载高16位并保留其它位
+    uint32_t bits = (uint32_t) constant;
+    std::string wReg = reg(rs_reg_no, false);
+    emit("movz", wReg, toStr(bits & 0xffff));
+    emit("movk", wReg, toStr((bits >> 16) & 0xffff), "", "", "lsl #16");
+
+    // 64位的负数需要符号扩展
+    if (wide && (constant < 0)) {
+        emit("sxtw", rsReg, wReg);
+    }
+}
+
+/// @brief 加载符号地址 adrp x0,g; add x0,x0,:lo12:g
+/// @param rs_reg_no 结果寄存器编号
+/// @param name 符号名
+void ILocArm64::load_symbol(int rs_reg_no, std::string name)
+{
+    std::string rsReg = PlatformArm64::regName[rs_reg_no];
+
+    // adrp得到符号所在4KB页的地址，再加上页内偏移
+    emit("adrp", rsReg, name);
+    emit("add", rsReg, rsReg, ":lo12:" + name);
+}
+
+/// @brief 基址寻址的访存指令，偏移可编码时用缩放或未缩放的立即数偏移，否则借助寄存器
+/// @param op 访存指令，ldr或str
+/// @param reg 被加载或保存的寄存器名
+/// @param base_reg_no 基址寄存器
+/// @param disp 偏移
+/// @param size 访问的字节数
+/// @param off_reg_no 偏移不能编码时存放偏移的寄存器
+void ILocArm64::access_base(std::string op, std::string rsReg, int base_reg_no, int64_t disp, int32_t size, int off_reg_no)
+{
+    std::string base = PlatformArm64::regName[base_reg_no];
+
+    if (PlatformArm64::isScaledOffset(disp, size)) {
+        // 无符号偏移，按访问的字节数缩放后编码到指令中
+        // [sp,#16] [sp]
+        if (disp) {
+            base += "," + toStr(disp);
+        }
+        emit(op, rsReg, "[" + base + "]");
+    } else if (PlatformArm64::isUnscaledOffset(disp)) {
+        // 9位有符号偏移，不缩放，ldur/stur
+        emit(op.substr(0, 2) + "ur", rsReg, "[" + base + "," + toStr(disp) + "]");
+    } else {
+        // 偏移放到寄存器中，基址+寄存器寻址
+        // mov x16,#40000
+        load_imm(off_reg_no, disp, true);
+
+        // ldr w0,[sp,x16]
+        emit(op, rsReg, "[" + base + "," + PlatformArm64::regName[off_reg_no] + "]");
+    }
+}
+
+/// @brief 基址寻址 ldr w0,[sp,#16]
+/// @param rs_reg_no 结果寄存器
+/// @param base_reg_no 基址寄存器
+/// @param offset 偏移
+/// @param wide true：64位加载，false：32位加载
+void ILocArm64::load_base(int rs_reg_no, int base_reg_no, int64_t offset, bool wide)
+{
+    // 偏移不能编码时借助结果寄存器存放偏移
+    access_base("ldr", reg(rs_reg_no, wide), base_reg_no, offset, wide ? 8 : 4, rs_reg_no);
+}
+
+/// @brief 基址寻址 str w0,[sp,#16]
+/// @param src_reg_no 源寄存器
+/// @param base_reg_no 基址寄存器
+/// @param disp 偏移
+/// @param tmp_reg_no 可能需要临时寄存器编号
+/// @param wide true：64位保存，false：32位保存
+void ILocArm64::store_base(int src_reg_no, int base_reg_no, int64_t disp, int tmp_reg_no, bool wide)
+{
+    access_base("str", reg(src_reg_no, wide), base_reg_no, disp, wide ? 8 : 4, tmp_reg_no);
+}
+
+/// @brief 寄存器Mov操作，按64位传送
+/// @param rs_reg_no 结果寄存器
+/// @param src_reg_no 源寄存器
+void ILocArm64::mov_reg(int rs_reg_no, int src_reg_no)
+{
+    emit("mov", PlatformArm64::regName[rs_reg_no], PlatformArm64::regName[src_reg_no]);
+}
+
+/// @brief 加载变量到寄存器，保证将变量放到reg中
+/// @param rs_reg_no 结果寄存器
+/// @param src_var 源操作数
+void ILocArm64::load_var(int rs_reg_no, Value * src_var)
+{
+    if (Instanceof(constVal, ConstInt *, src_var)) {
+        // 整型常量
+        load_imm(rs_reg_no, constVal->getVal());
+    } else if (src_var->getRegId() != -1) {
+        // 源操作数为寄存器变量，寄存器之间按64位传送
+        int32_t src_regId = src_var->getRegId();
+        if (src_regId != rs_reg_no) {
+            mov_reg(rs_reg_no, src_regId);
+        }
+    } else if (Instanceof(globalVar, GlobalVariable *, src_var)) {
+        // 全局变量
+        if (src_var->getType()->isArrayType()) {
+            // 全局数组：只需要地址
+            load_symbol(rs_reg_no, globalVar->getName());
+        } else {
+            // 全局标量变量：页内偏移直接放到访存指令中
+            // adrp x0,g
+            // ldr w0,[x0,:lo12:g]
+            std::string rsReg = PlatformArm64::regName[rs_reg_no];
+            emit("adrp", rsReg, globalVar->getName());
+            emit("ldr",
+                 reg(rs_reg_no, PlatformArm64::isWide(src_var)),
+                 "[" + rsReg + ",:lo12:" + globalVar->getName() + "]");
+        }
+    } else {
+        // 栈+偏移的寻址方式
+        int32_t var_baseRegId = -1;
+        int64_t var_offset = -1;
+
+        bool result = src_var->getMemoryAddr(&var_baseRegId, &var_offset);
+        if (!result) {
+            minic_log(LOG_ERROR, "BUG");
+        }
+
+        if (src_var->getType()->isArrayType()) {
+            // 局部数组：返回数组首地址（栈基址+偏移）
+            leaStack(rs_reg_no, var_baseRegId, var_offset);
+        } else {
+            // 普通局部变量或指针变量：从栈中加载值，指针为64位
+            load_base(rs_reg_no, var_baseRegId, var_offset, PlatformArm64::isWide(src_var));
+        }
+    }
+}
+
+/// @brief 加载变量地址到寄存器（专门用于数组）
+/// @param rs_reg_no 结果寄存器
+/// @param src_var 源操作数
+void ILocArm64::load_var_addr(int rs_reg_no, Value * src_var)
+{
+    if (Instanceof(globalVar, GlobalVariable *, src_var)) {
+        // 全局变量地址
+        load_symbol(rs_reg_no, globalVar->getName());
+    } else {
+        lea_var(rs_reg_no, src_var);
+    }
+}
+
+/// @brief 加载变量地址到寄存器
+/// @param rs_reg_no 结果寄存器
+/// @param var 变量
+void ILocArm64::lea_var(int rs_reg_no, Value * var)
+{
+    // 栈帧偏移
+    int32_t var_baseRegId = -1;
+    int64_t var_offset = -1;
+
+    bool result = var->getMemoryAddr(&var_baseRegId, &var_offset);
+    if (!result) {
+        minic_log(LOG_ERROR, "BUG");
+    }
+
+    // add x0,sp,#16
+    leaStack(rs_reg_no, var_baseRegId, var_offset);
+}
+
+/// @brief 保存寄存器到变量，按变量的类型确定保存的宽度
+/// @param src_reg_no 源寄存器
+/// @param dest_var 变量
+/// @param tmp_reg_no 第三方寄存器
+void ILocArm64::store_var(int src_reg_no, Value * dest_var, int tmp_reg_no)
+{
+    // 被保存目标变量肯定不是常量
+
+    if (dest_var->getRegId() != -1) {
+
+        // 寄存器变量，寄存器不一样才需要mov操作
+        int dest_reg_id = dest_var->getRegId();
+        if (src_reg_no != dest_reg_id) {
+            mov_reg(dest_reg_id, src_reg_no);
+        }
+
+    } else if (Instanceof(globalVar, GlobalVariable *, dest_var)) {
+        // 全局变量
+        // adrp x16,g
+        // str w0,[x16,:lo12:g]
+        std::string tmpReg = PlatformArm64::regName[tmp_reg_no];
+        emit("adrp", tmpReg, globalVar->getName());
+        emit("str",
+             reg(src_reg_no, PlatformArm64::isWide(dest_var)),
+             "[" + tmpReg + ",:lo12:" + globalVar->getName() + "]");
+
+    } else {
+
+        // 对于局部变量，则直接从栈基址+偏移寻址
+        int32_t dest_baseRegId = -1;
+        int64_t dest_offset = -1;
+
+        bool result = dest_var->getMemoryAddr(&dest_baseRegId, &dest_offset);
+        if (!result) {
+            minic_log(LOG_ERROR, "BUG");
+        }
+
+        // str w0,[sp,#16]
+        store_base(src_reg_no, dest_baseRegId, dest_offset, tmp_reg_no, PlatformArm64::isWide(dest_var));
+    }
+}
+
+/// @brief 加载栈内变量地址
+/// @param rs_reg_no 结果寄存器号
+/// @param base_reg_no 基址寄存器
+/// @param off 偏移
+void ILocArm64::leaStack(int rs_reg_no, int base_reg_no, int64_t off)
+{
+    std::string rs_reg_name = PlatformArm64::regName[rs_reg_no];
+    std::string base_reg_name = PlatformArm64::regName[base_reg_no];
+
+    if (PlatformArm64::isAddSubImm(off)) {
+        // add x0,sp,#16
+        emit("add", rs_reg_name, base_reg_name, toStr(off));
+    } else if (PlatformArm64::isAddSubImm(-off)) {
+        // sub x0,x29,#16
+        emit("sub", rs_reg_name, base_reg_name, toStr(-off));
+    } else {
+        // mov x0,#40000
+        load_imm(rs_reg_no, off, true);
+
+        // add x0,sp,x0
+        emit("add", rs_reg_name, base_reg_name, rs_reg_name);
+    }
+}
+
+/// @brief 函数内栈内空间分配（局部变量、形参变量、函数参数传值，或不能寄存器分配的临时变量等）
+/// @param func 函数
+/// @param tmp_reg_no 栈帧过大时借助的寄存器
+void ILocArm64::allocStack(Function * func, int tmp_reg_no)
+{
+    // 计算栈帧大小，已按16字节对齐
+    int64_t off = func->getMaxDep();
+
+    // 不需要在栈内额外分配空间，则什么都不做
+    if (0 == off) {
+        return;
+    }
+
+    if (PlatformArm64::isAddSubImm(off)) {
+        // sub sp,sp,#16
+        emit("sub", "sp", "sp", toStr(off));
+    } else {
+        // mov x16,#40000
+        load_imm(tmp_reg_no, off, true);
+
+        // sub sp,sp,x16
+        emit("sub", "sp", "sp", PlatformArm64::regName[tmp_reg_no]);
+    }
+}
+
+/// @brief 调用函数
+/// @param name 函数名
+void ILocArm64::call_fun(std::string name)
+{
+    // 函数返回值在w0,不需要保护
+    emit("bl", name);
+}
+
+/// @brief NOP操作
+void ILocArm64::nop()
+{
+    emit("");
+}
+
+///
+/// @brief 无条件跳转指令
+/// @param label 目标Label名称
+///
+void ILocArm64::jump(std::string label)
+{
+    emit("b", label);
+}
@@ -0,0 +1,234 @@
+///
+/// @file ILocArm64.h
+/// @brief ARM64指令序列管理的头文件
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <string>
+
+#include "Module.h"
+#include "OutputStream.h"
+
+#define Instanceof(res, type, var) auto res = dynamic_cast<type>(var)
+
+/// @brief 底层汇编指令：ARM64
+struct Arm64Inst {
+
+    /// @brief 操作码
+    std::string opcode;
+
+    /// @brief 条件
+    std::string cond;
+
+    /// @brief 结果
+    std::string result;
+
+    /// @brief 源操作数1
+    std::string arg1;
+
+    /// @brief 源操作数2
+    std::string arg2;
+
+    /// @brief 附加信息，如移位或扩展
+    std::string addition;
+
+    /// @brief 标识指令是否无效
+    bool dead;
+
+    /// @brief 构造函数
+    /// @param op 操作码
+    /// @param rs 结果
+    /// @param s1 源操作数1
+    /// @param s2 源操作数2
+    /// @param cond 条件
+    /// @param extra 附加信息
+    Arm64Inst(std::string op,
+              std::string rs = "",
+              std::string s1 = "",
+              std::string s2 = "",
+              std::string cond = "",
+              std::string extra = "");
+
+    /// @brief 设置死指令
+    void setDead();
+
+    /// @brief 指令直接输出到输出流，不产生临时字符串
+    /// @param os 输出流
+    /// @return true：有输出，false：无用指令或占位指令，没有输出
+    bool outPut(OutputStream & os);
+};
+
+/// @brief 底层汇编序列-ARM64
+class ILocArm64 {
+
+    /// @brief ARM64汇编序列
+    std::list<Arm64Inst *> code;
+
+    /// @brief 符号表
+    Module * module;
+
+    /// @brief 加载立即数 mov w0,#100
+    /// @param rs_reg_no 结果寄存器号
+    /// @param num 立即数
+    /// @param wide true：加载到64位寄存器，false：加载到32位寄存器
+    void load_imm(int rs_reg_no, int64_t num, bool wide = false);
+
+    /// @brief 加载符号地址 adrp x0,g; add x0,x0,:lo12:g
+    /// @param rs_reg_no 结果寄存器号
+    /// @param name 符号名
+    void load_symbol(int rs_reg_no, std::string name);
+
+    /// @brief 加载栈内变量地址
+    /// @param rs_reg_no 结果寄存器号
+    /// @param base_reg_no 基址寄存器
+    /// @param off 偏移
+    void leaStack(int rs_reg_no, int base_reg_no, int64_t off);
+
+    /// @brief 基址寻址的访存指令，偏移可编码时用缩放或未缩放的立即数偏移，否则借助寄存器
+    /// @param op 访存指令，ldr或str
+    /// @param reg 被加载或保存的寄存器名
+    /// @param base_reg_no 基址寄存器
+    /// @param disp 偏移
+    /// @param size 访问的字节数
+    /// @param off_reg_no 偏移不能编码时存放偏移的寄存器
+    void access_base(std::string op, std::string reg, int base_reg_no, int64_t disp, int32_t size, int off_reg_no);
+
+public:
+    /// @brief 构造函数
+    /// @param _module 符号表-模块
+    ILocArm64(Module * _module);
+
+    /// @brief 析构函数
+    ~ILocArm64();
+
+    /// @brief 获取寄存器的名字
+    /// @param reg_no 寄存器编号
+    /// @param wide true：64位名字，false：32位名字
+    /// @return 寄存器名字
+    static std::string reg(int reg_no, bool wide);
+
+    ///
+    /// @brief 注释指令
+    /// @param str 注释内容
+    ///
+    void comment(std::string str);
+
+    /// @brief 数字变字符串，若flag为真，则变为立即数寻址（加#）
+    /// @param num 立即数
+    /// @param flag 是否加#
+    /// @return 字符串
+    std::string toStr(int64_t num, bool flag = true);
+
+    /// @brief 获取当前的代码序列
+    /// @return 代码序列
+    std::list<Arm64Inst *> & getCode();
+
+    /// @brief Load指令，基址寻址 ldr w0,[sp,#16]
+    /// @param rs_reg_no 结果寄存器
+    /// @param base_reg_no 基址寄存器
+    /// @param disp 偏移
+    /// @param wide true：64位加载，false：32位加载
+    void load_base(int rs_reg_no, int base_reg_no, int64_t disp, bool wide);
+
+    /// @brief Store指令，基址寻址 str w0,[sp,#16]
+    /// @param src_reg_no 源寄存器
+    /// @param base_reg_no 基址寄存器
+    /// @param disp 偏移
+    /// @param tmp_reg_no 可能需要临时寄存器编号
+    /// @param wide true：64位保存，false：32位保存
+    void store_base(int src_reg_no, int base_reg_no, int64_t disp, int tmp_reg_no, bool wide);
+
+    /// @brief 标签指令
+    /// @param name 标签名
+    void label(std::string name);
+
+    /// @brief 一个操作数指令
+    /// @param op 操作码
+    /// @param rs 操作数
+    void inst(std::string op, std::string rs);
+
+    /// @brief 一个源操作数指令
+    /// @param op 操作码
+    /// @param rs 操作数
+    /// @param arg1 源操作数
+    void inst(std::string op, std::string rs, std::string arg1);
+
+    /// @brief 两个源操作数指令
+    /// @param op 操作码
+    /// @param rs 操作数
+    /// @param arg1 源操作数
+    /// @param arg2 源操作数
+    void inst(std::string op, std::string rs, std::string arg1, std::string arg2);
+
+    /// @brief 两个源操作数并带有移位或扩展的指令
+    /// @param op 操作码
+    /// @param rs 操作数
+    /// @param arg1 源操作数
+    /// @param arg2 源操作数
+    /// @param extra 移位或扩展，如lsl #16、sxtw #2
+    void inst(std::string op, std::string rs, std::string arg1, std::string arg2, std::string extra);
+
+    /// @brief 加载变量到寄存器，指针与数组地址加载到64位寄存器
+    /// @param rs_reg_no 结果寄存器
+    /// @param var 变量
+    void load_var(int rs_reg_no, Value * var);
+
+    /// @brief 加载变量地址到寄存器
+    /// @param rs_reg_no 结果寄存器
+    /// @param var 变量
+    void lea_var(int rs_reg_no, Value * var);
+
+    /// @brief 保存寄存器到变量，按变量的类型确定保存的宽度
+    /// @param src_reg_no 源寄存器号
+    /// @param var 变量
+    /// @param tmp_reg_no 可能需要临时寄存器编号
+    void store_var(int src_reg_no, Value * var, int tmp_reg_no);
+
+    /// @brief 寄存器Mov操作，按64位传送
+    /// @param rs_reg_no 结果寄存器
+    /// @param src_reg_no 源寄存器
+    void mov_reg(int rs_reg_no, int src_reg_no);
+
+    /// @brief 加载变量地址到寄存器（专门用于数组）
+    /// @param rs_reg_no 结果寄存器
+    /// @param src_var 源操作数
+    void load_var_addr(int rs_reg_no, Value * src_var);
+
+    /// @brief 调用函数
+    /// @param name 函数名
+    void call_fun(std::string name);
+
+    /// @brief 分配栈帧
+    /// @param func 函数
+    /// @param tmp_reg_no 栈帧过大时借助的寄存器
+    void allocStack(Function * func, int tmp_reg_no);
+
+    /// @brief NOP操作
+    void nop();
+
+    ///
+    /// @brief 无条件跳转指令
+    /// @param label 目标Label名称
+    ///
+    void jump(std::string label);
+
+    /// @brief 输出汇编到输出流
+    /// @param os 输出流
+    /// @param outputEmpty 是否输出空语句
+    void outPut(OutputStream & os, bool outputEmpty = false);
+
+    /// @brief 删除无用的Label指令
+    void deleteUnusedLabel();
+};
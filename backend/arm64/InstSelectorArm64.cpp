@@ -0,0 +1,715 @@
+///
+/// @file InstSelectorArm64.cpp
+/// @brief 指令选择器-ARM64的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <utility>
+
+#include "Common.h"
+#include "Debug.h"
+#include "ILocArm64.h"
+#include "InstSelectorArm64.h"
+#include "PlatformArm64.h"
+#include "ConstInt.h"
+#include "Function.h"
+
+#include "LabelInstruction.h"
+#include "GotoInstruction.h"
+#include "FuncCallInstruction.h"
+#include "MoveInstruction.h"
+
+/// @brief 构造函数
+/// @param _irCode 指令
+/// @param _iloc ILoc
+/// @param _func 函数
+/// @param allocator 寄存器分配器
+InstSelectorArm64::InstSelectorArm64(std::vector<Instruction *> & _irCode,
+                                     ILocArm64 & _iloc,
+                                     Function * _func,
+                                     OrderedRegisterAllocator & allocator)
+    : ir(_irCode), iloc(_iloc), func(_func), simpleRegisterAllocator(allocator)
+{
+    translator_handlers[IRInstOperator::IRINST_OP_ENTRY] = &InstSelectorArm64::translate_entry;
+    translator_handlers[IRInstOperator::IRINST_OP_EXIT] = &InstSelectorArm64::translate_exit;
+
+    translator_handlers[IRInstOperator::IRINST_OP_LABEL] = &InstSelectorArm64::translate_label;
+    translator_handlers[IRInstOperator::IRINST_OP_GOTO] = &InstSelectorArm64::translate_goto;
+
+    translator_handlers[IRInstOperator::IRINST_OP_ASSIGN] = &InstSelectorArm64::translate_assign;
+
+    translator_handlers[IRInstOperator::IRINST_OP_ADD_I] = &InstSelectorArm64::translate_add_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_SUB_I] = &InstSelectorArm64::translate_sub_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_MUL_I] = &InstSelectorArm64::translate_mul_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_DIV_I] = &InstSelectorArm64::translate_div_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_MOD_I] = &InstSelectorArm64::translate_mod_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_NEG_I] = &InstSelectorArm64::translate_neg_int32;
+
+    translator_handlers[IRInstOperator::IRINST_OP_LT_I] = &InstSelectorArm64::translate_lt_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_GT_I] = &InstSelectorArm64::translate_gt_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_LE_I] = &InstSelectorArm64::translate_le_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_GE_I] = &InstSelectorArm64::translate_ge_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_EQ_I] = &InstSelectorArm64::translate_eq_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_NE_I] = &InstSelectorArm64::translate_ne_int32;
+
+    translator_handlers[IRInstOperator::IRINST_OP_STORE_PTR] = &InstSelectorArm64::translate_store_ptr;
+    translator_handlers[IRInstOperator::IRINST_OP_LOAD_PTR] = &InstSelectorArm64::translate_load_ptr;
+    translator_handlers[IRInstOperator::IRINST_OP_ADD_PTR] = &InstSelectorArm64::translate_add_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_ARRAY_ADDR] = &InstSelectorArm64::translate_array_addr;
+
+    translator_handlers[IRInstOperator::IRINST_OP_FUNC_CALL] = &InstSelectorArm64::translate_call;
+    translator_handlers[IRInstOperator::IRINST_OP_ARG] = &InstSelectorArm64::translate_arg;
+
+    // 栈内布局由栈槽着色给出，这里只在--debug=stack-layout时输出
+    if (_func) {
+        _func->printMemoryLayout();
+    }
+}
+
+/// @brief 指令选择执行
+void InstSelectorArm64::run()
+{
+    prevInst = nullptr;
+
+    for (size_t k = 0; k < ir.size(); ++k) {
+
+        Instruction * inst = ir[k];
+        if (inst->isDead()) {
+            continue;
+        }
+
+        // 记录下一条有效指令，用于去掉跳转到下一条Label的跳转指令以及相邻指令的合并
+        nextInst = nullptr;
+        for (size_t next = k + 1; next < ir.size(); ++next) {
+            if (!ir[next]->isDead()) {
+                nextInst = ir[next];
+                break;
+            }
+        }
+
+        // 逐个指令进行翻译
+        translate(inst);
+
+        prevInst = inst;
+    }
+}
+
+/// @brief 指令翻译成ARM64汇编
+/// @param inst IR指令
+void InstSelectorArm64::translate(Instruction * inst)
+{
+    // 操作符
+    IRInstOperator op = inst->getOp();
+
+    auto pIter = translator_handlers.find(op);
+    if (pIter == translator_handlers.end()) {
+        // 没有找到，则说明当前不支持
+        minic_log(LOG_ERROR, "Translate: Operator(%d) not support", (int) op);
+        return;
+    }
+
+    // 开启时输出IR指令作为注释
+    if (showLinearIR) {
+        outputIRInstruction(inst);
+    }
+
+    (this->*(pIter->second))(inst);
+}
+
+///
+/// @brief 输出IR指令
+///
+void InstSelectorArm64::outputIRInstruction(Instruction * inst)
+{
+    std::string irStr;
+    inst->toString(irStr);
+    if (!irStr.empty()) {
+        iloc.comment(irStr);
+    }
+}
+
+///
+/// @brief 加载操作数到寄存器，已经是寄存器时直接使用
+/// @param val 操作数
+/// @return 寄存器编号
+///
+int32_t InstSelectorArm64::loadOperand(Value * val)
+{
+    int32_t reg_no = val->getRegId();
+    if (reg_no == -1) {
+        reg_no = simpleRegisterAllocator.Allocate(val);
+        iloc.load_var(reg_no, val);
+    }
+
+    return reg_no;
+}
+
+///
+/// @brief 获取保存结果的寄存器，结果不是寄存器时分配一个
+/// @param result 结果
+/// @return 寄存器编号
+///
+int32_t InstSelectorArm64::resultReg(Value * result)
+{
+    int32_t reg_no = result->getRegId();
+    if (reg_no == -1) {
+        reg_no = simpleRegisterAllocator.Allocate(result);
+    }
+
+    return reg_no;
+}
+
+///
+/// @brief 结果不是寄存器时保存到结果变量中
+/// @param result 结果
+/// @param reg_no 结果所在的寄存器
+///
+void InstSelectorArm64::storeResult(Value * result, int32_t reg_no)
+{
+    if (result->getRegId() == -1) {
+        iloc.store_var(reg_no, result, ARM64_TMP_REG_NO);
+    }
+}
+
+/// @brief Label指令指令翻译成ARM64汇编
+/// @param inst IR指令
+void InstSelectorArm64::translate_label(Instruction * inst)
+{
+    Instanceof(labelInst, LabelInstruction *, inst);
+
+    iloc.label(labelName(labelInst));
+}
+
+/// @brief 获取Label在汇编中的名字
+/// @param label Label指令
+/// @return 函数名与Label编号组成的名字
+std::string InstSelectorArm64::labelName(LabelInstruction * label)
+{
+    return IR_LABEL_PREFIX + func->getName() + "_" + std::to_string(label->getAsmIndex());
+}
+
+/// @brief goto指令指令翻译成ARM64汇编，条件跳转用cbz/cbnz
+/// @param inst IR指令
+void InstSelectorArm64::translate_goto(Instruction * inst)
+{
+    Instanceof(gotoInst, GotoInstruction *, inst);
+
+    if (gotoInst->getOperandsNum() > 0) {
+
+        // 条件跳转，条件值与0比较并跳转合并为一条指令
+        Value * condition = gotoInst->getOperand(0);
+        std::string trueLabel = labelName(gotoInst->getTarget());
+        std::string falseLabel = labelName(gotoInst->getFalseTarget());
+
+        std::string condReg = ILocArm64::reg(loadOperand(condition), false);
+
+        if (nextInst == gotoInst->getFalseTarget()) {
+            // 假出口紧随其后，不等于0时跳转到trueLabel即可
+            iloc.inst("cbnz", condReg, trueLabel);
+        } else if (nextInst == gotoInst->getTarget()) {
+            // 真出口紧随其后，等于0时跳转到falseLabel即可
+            iloc.inst("cbz", condReg, falseLabel);
+        } else {
+            iloc.inst("cbnz", condReg, trueLabel);
+            iloc.jump(falseLabel);
+        }
+
+        simpleRegisterAllocator.free(condition);
+    } else if (nextInst != gotoInst->getTarget()) {
+        // 无条件跳转，目标紧随其后时顺序执行即可
+        iloc.jump(labelName(gotoInst->getTarget()));
+    }
+}
+
+/// @brief 函数入口指令翻译成ARM64汇编
+/// @param inst IR指令
+void InstSelectorArm64::translate_entry(Instruction * inst)
+{
+    (void) inst;
+
+    // FP与LR成对保存，sp始终保持16字节对齐
+    iloc.inst("stp", "x29", "x30", "[sp,#-16]!");
+    iloc.inst("mov", "x29", "sp");
+
+    // 为fun分配栈帧，含局部变量、形参、函数调用值传递的空间等
+    iloc.allocStack(func, ARM64_TMP_REG_NO);
+
+    // 寄存器传递的形参保存到栈中，函数调用时x0-x7会被改写
+    auto & params = func->getParams();
+    for (int k = 0; k < (int) params.size() && k < PlatformArm64::maxArgRegNum; k++) {
+        iloc.store_var(k, params[k], ARM64_TMP_REG_NO);
+    }
+}
+
+/// @brief 函数出口指令翻译成ARM64汇编
+/// @param inst IR指令
+void InstSelectorArm64::translate_exit(Instruction * inst)
+{
+    if (inst->getOperandsNum()) {
+        // 存在返回值，赋值给寄存器w0
+        iloc.load_var(0, inst->getOperand(0));
+    }
+
+    // 恢复栈空间以及FP与LR
+    iloc.inst("mov", "sp", "x29");
+    iloc.inst("ldp", "x29", "x30", "[sp]", "#16");
+
+    iloc.inst("ret", "");
+}
+
+/// @brief 赋值指令翻译成ARM64汇编，含指针读写
+/// @param inst IR指令
+void InstSelectorArm64::translate_assign(Instruction * inst)
+{
+    Instanceof(moveInst, MoveInstruction *, inst);
+
+    if (moveInst && moveInst->getIsPointerLoad()) {
+        // %l10 = *%l9
+        translate_load_ptr(inst);
+    } else if (moveInst && moveInst->getIsPointerStore()) {
+        // *%l9 = 1
+        translate_store_ptr(inst);
+    } else {
+        translate_move(inst->getOperand(0), inst->getOperand(1));
+    }
+}
+
+/// @brief 把arg1的值传送到result中，供赋值指令及函数调用的传参、取返回值使用
+/// @param result 目的操作数
+/// @param arg1 源操作数
+void InstSelectorArm64::translate_move(Value * result, Value * arg1)
+{
+    int32_t arg1_regId = arg1->getRegId();
+    int32_t result_regId = result->getRegId();
+
+    if (arg1_regId != -1) {
+        iloc.store_var(arg1_regId, result, ARM64_TMP_REG_NO);
+    } else if (result_regId != -1) {
+        iloc.load_var(result_regId, arg1);
+    } else {
+        int32_t temp_regno = simpleRegisterAllocator.Allocate();
+
+        iloc.load_var(temp_regno, arg1);
+        iloc.store_var(temp_regno, result, ARM64_TMP_REG_NO);
+
+        simpleRegisterAllocator.free(temp_regno);
+    }
+}
+
+///
+/// @brief 判断地址计算的偏移是否是乘以2的幂次的结果，是则可合并到扩展寄存器寻址add x0,x1,w2,sxtw #2中
+/// @param addInst 地址计算指令
+/// @param mulInst 乘法指令，是addInst的偏移操作数
+/// @param index 乘法的另一个操作数，即下标
+/// @param shift 左移位数
+/// @return true：可以合并，false：不可以
+///
+bool InstSelectorArm64::foldScaledIndex(Instruction * addInst, Instruction * mulInst, Value *& index, int32_t & shift)
+{
+    if (mulInst->getOp() != IRInstOperator::IRINST_OP_MUL_I) {
+        return false;
+    }
+
+    Value * other = mulInst->getOperand(0);
+    Instanceof(scale, ConstInt *, mulInst->getOperand(1));
+    if (!scale) {
+        other = mulInst->getOperand(1);
+        scale = dynamic_cast<ConstInt *>(mulInst->getOperand(0));
+    }
+
+    // 下标为常量时整个偏移是常量，不需要合并
+    if ((!scale) || dynamic_cast<ConstInt *>(other)) {
+        return false;
+    }
+
+    // 扩展寄存器寻址的左移位数为0到4
+    int32_t value = scale->getVal();
+    if ((value <= 0) || (value & (value - 1))) {
+        return false;
+    }
+
+    shift = 0;
+    while ((1 << shift) < value) {
+        shift++;
+    }
+
+    if (shift > 4) {
+        return false;
+    }
+
+    // 下标在乘法与地址计算之间不能被改写。临时变量只定义一次，其它变量要求两条指令相邻，
+    // 翻译乘法指令时看下一条指令，翻译地址计算指令时看上一条指令
+    bool adjacent = (prevInst == mulInst) || (nextInst == addInst);
+    if ((!dynamic_cast<Instruction *>(other)) && (!adjacent)) {
+        return false;
+    }
+
+    index = other;
+
+    return true;
+}
+
+/// @brief 整数或指针的加减法指令翻译成ARM64汇编，立即数可编码时不加载到寄存器
+/// @param inst IR指令
+/// @param isAdd true：加法，false：减法
+void InstSelectorArm64::translate_add_sub(Instruction * inst, bool isAdd)
+{
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    // 结果为指针时是地址计算，用64位寄存器
+    bool wide = PlatformArm64::isWide(result);
+
+    // 加法的指针在后时交换，使基址在前
+    if (isAdd && PlatformArm64::isWide(arg2) && (!PlatformArm64::isWide(arg1))) {
+        std::swap(arg1, arg2);
+    }
+
+    std::string opcode = isAdd ? "add" : "sub";
+
+    int32_t arg1_reg_no = loadOperand(arg1);
+    int32_t result_reg_no = resultReg(result);
+
+    std::string rsReg = ILocArm64::reg(result_reg_no, wide);
+    std::string arg1Reg = ILocArm64::reg(arg1_reg_no, wide);
+
+    Instanceof(constArg2, ConstInt *, arg2);
+    Instanceof(mulInst, Instruction *, arg2);
+
+    Value * index = arg2;
+    int32_t shift = 0;
+
+    if (constArg2 && PlatformArm64::isAddSubImm(constArg2->getVal())) {
+        // add w0,w1,#4
+        iloc.inst(opcode, rsReg, arg1Reg, iloc.toStr(constArg2->getVal()));
+    } else if (constArg2 && PlatformArm64::isAddSubImm(-(int64_t) constArg2->getVal())) {
+        // 负数立即数改用相反的运算
+        iloc.inst(isAdd ? "sub" : "add", rsReg, arg1Reg, iloc.toStr(-(int64_t) constArg2->getVal()));
+    } else if (wide && (!PlatformArm64::isWide(arg2))) {
+
+        // 偏移为32位整数，符号扩展后参与地址计算，乘以2的幂次的偏移合并为扩展时的移位
+        std::string extend = "sxtw";
+        if (isAdd && mulInst && foldScaledIndex(inst, mulInst, index, shift)) {
+            extend += " #" + std::to_string(shift);
+        }
+
+        int32_t index_reg_no = loadOperand(index);
+
+        // add x0,x1,w2,sxtw #2
+        iloc.inst(opcode, rsReg, arg1Reg, ILocArm64::reg(index_reg_no, false), extend);
+    } else {
+        int32_t arg2_reg_no = loadOperand(arg2);
+
+        // add w0,w1,w2
+        iloc.inst(opcode, rsReg, arg1Reg, ILocArm64::reg(arg2_reg_no, wide));
+    }
+
+    storeResult(result, result_reg_no);
+
+    // 释放寄存器
+    simpleRegisterAllocator.free(arg1);
+    simpleRegisterAllocator.free(arg2);
+    simpleRegisterAllocator.free(index);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 整数加法指令翻译成ARM64汇编，结果为指针时是地址计算
+/// @param inst IR指令
+void InstSelectorArm64::translate_add_int32(Instruction * inst)
+{
+    translate_add_sub(inst, true);
+}
+
+/// @brief 整数减法指令翻译成ARM64汇编
+/// @param inst IR指令
+void InstSelectorArm64::translate_sub_int32(Instruction * inst)
+{
+    translate_add_sub(inst, false);
+}
+
+/// @brief 数组元素地址计算指令翻译成ARM64汇编
+/// @param inst IR指令
+void InstSelectorArm64::translate_array_addr(Instruction * inst)
+{
+    translate_add_sub(inst, true);
+}
+
+/// @brief 二元操作指令翻译成ARM64汇编，操作数都加载到寄存器中
+/// @param inst IR指令
+/// @param operator_name 操作码
+void InstSelectorArm64::translate_two_operator(Instruction * inst, std::string operator_name)
+{
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    int32_t arg1_reg_no = loadOperand(arg1);
+    int32_t arg2_reg_no = loadOperand(arg2);
+    int32_t result_reg_no = resultReg(result);
+
+    // mul w0,w1,w2
+    iloc.inst(operator_name,
+              ILocArm64::reg(result_reg_no, false),
+              ILocArm64::reg(arg1_reg_no, false),
+              ILocArm64::reg(arg2_reg_no, false));
+
+    storeResult(result, result_reg_no);
+
+    // 释放寄存器
+    simpleRegisterAllocator.free(arg1);
+    simpleRegisterAllocator.free(arg2);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 整数乘法指令翻译成ARM64汇编
+/// @param inst IR指令
+void InstSelectorArm64::translate_mul_int32(Instruction * inst)
+{
+    // 结果只被紧随其后或下标不变的地址计算使用时，合并到地址计算的扩展寄存器寻址中，不需要单独计算
+    Use * use = inst->getFirstUse();
+    if (use && (!use->getNextUse())) {
+        Instanceof(user, Instruction *, use->getUser());
+        if (user && (!user->isDead()) && (user->getOp() == IRInstOperator::IRINST_OP_ADD_I) &&
+            PlatformArm64::isWide(user) && (user->getOperand(1) == inst) && PlatformArm64::isWide(user->getOperand(0))) {
+            Value * index;
+            int32_t shift;
+            if (foldScaledIndex(user, inst, index, shift)) {
+                return;
+            }
+        }
+    }
+
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    // 乘以2的幂次用移位实现
+    Instanceof(constArg, ConstInt *, arg2);
+    Value * var = arg1;
+    if (!constArg) {
+        constArg = dynamic_cast<ConstInt *>(arg1);
+        var = arg2;
+    }
+
+    int32_t value = constArg ? constArg->getVal() : 0;
+    if ((value <= 0) || (value & (value - 1)) || dynamic_cast<ConstInt *>(var)) {
+        translate_two_operator(inst, "mul");
+        return;
+    }
+
+    int32_t shift = 0;
+    while ((1 << shift) < value) {
+        shift++;
+    }
+
+    int32_t var_reg_no = loadOperand(var);
+    int32_t result_reg_no = resultReg(result);
+
+    if (shift == 0) {
+        iloc.inst("mov", ILocArm64::reg(result_reg_no, false), ILocArm64::reg(var_reg_no, false));
+    } else {
+        // lsl w0,w1,#2
+        iloc.inst("lsl",
+                  ILocArm64::reg(result_reg_no, false),
+                  ILocArm64::reg(var_reg_no, false),
+                  iloc.toStr(shift));
+    }
+
+    storeResult(result, result_reg_no);
+
+    simpleRegisterAllocator.free(var);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 整数除法指令翻译成ARM64汇编
+/// @param inst IR指令
+void InstSelectorArm64::translate_div_int32(Instruction * inst)
+{
+    translate_two_operator(inst, "sdiv");
+}
+
+/// @brief 整数求余指令翻译成ARM64汇编
+/// @param inst IR指令
+void InstSelectorArm64::translate_mod_int32(Instruction * inst)
+{
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    int32_t arg1_reg_no = loadOperand(arg1);
+    int32_t arg2_reg_no = loadOperand(arg2);
+    int32_t result_reg_no = resultReg(result);
+
+    std::string rsReg = ILocArm64::reg(result_reg_no, false);
+    std::string arg1Reg = ILocArm64::reg(arg1_reg_no, false);
+    std::string arg2Reg = ILocArm64::reg(arg2_reg_no, false);
+
+    // 余数 = 被除数 - 商 * 除数，乘减用一条msub完成
+    iloc.inst("sdiv", rsReg, arg1Reg, arg2Reg);
+    iloc.inst("msub", rsReg, rsReg, arg2Reg, arg1Reg);
+
+    storeResult(result, result_reg_no);
+
+    simpleRegisterAllocator.free(arg1);
+    simpleRegisterAllocator.free(arg2);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 整数负号指令翻译成ARM64汇编
+/// @param inst IR指令
+void InstSelectorArm64::translate_neg_int32(Instruction * inst)
+{
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+
+    int32_t arg1_reg_no = loadOperand(arg1);
+    int32_t result_reg_no = resultReg(result);
+
+    // neg w0,w1
+    iloc.inst("neg", ILocArm64::reg(result_reg_no, false), ILocArm64::reg(arg1_reg_no, false));
+
+    storeResult(result, result_reg_no);
+
+    simpleRegisterAllocator.free(arg1);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 整数关系运算指令翻译成ARM64汇编(统一处理函数)
+/// @param inst IR指令
+/// @param condition ARM64的条件码(eq,ne,lt,gt,le,ge)
+void InstSelectorArm64::translate_cmp_int32(Instruction * inst, const std::string & condition)
+{
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    bool wide = PlatformArm64::isWide(arg1) || PlatformArm64::isWide(arg2);
+
+    int32_t arg1_reg_no = loadOperand(arg1);
+    std::string arg1Reg = ILocArm64::reg(arg1_reg_no, wide);
+
+    // 立即数可编码时直接与立即数比较，负数用cmn
+    Instanceof(constArg2, ConstInt *, arg2);
+    if (constArg2 && PlatformArm64::isAddSubImm(constArg2->getVal())) {
+        iloc.inst("cmp", arg1Reg, iloc.toStr(constArg2->getVal()));
+    } else if (constArg2 && PlatformArm64::isAddSubImm(-(int64_t) constArg2->getVal())) {
+        iloc.inst("cmn", arg1Reg, iloc.toStr(-(int64_t) constArg2->getVal()));
+    } else {
+        int32_t arg2_reg_no = loadOperand(arg2);
+        iloc.inst("cmp", arg1Reg, ILocArm64::reg(arg2_reg_no, wide));
+    }
+
+    // 条件满足时为1，否则为0
+    int32_t result_reg_no = resultReg(result);
+    iloc.inst("cset", ILocArm64::reg(result_reg_no, false), condition);
+
+    storeResult(result, result_reg_no);
+
+    simpleRegisterAllocator.free(arg1);
+    simpleRegisterAllocator.free(arg2);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 函数调用指令翻译成ARM64汇编
+/// @param inst IR指令
+void InstSelectorArm64::translate_call(Instruction * inst)
+{
+    FuncCallInstruction * callInst = dynamic_cast<FuncCallInstruction *>(inst);
+
+    int32_t operandNum = callInst->getOperandsNum();
+
+    // 强制占用参数传递的寄存器，加载栈传递的实参时不会使用
+    for (int32_t k = 0; k < operandNum && k < PlatformArm64::maxArgRegNum; k++) {
+        simpleRegisterAllocator.Allocate(k);
+    }
+
+    // AAPCS64：前八个参数通过x0-x7传递，后面的参数每个占8字节，从sp开始依次存放
+    for (int32_t k = PlatformArm64::maxArgRegNum; k < operandNum; k++) {
+
+        auto arg = callInst->getOperand(k);
+
+        // 新建一个内存变量，用于栈传值到形参变量中
+        MemVariable * newVal = func->newMemVariable(arg->getType());
+        newVal->setMemoryAddr(ARM64_SP_REG_NO, (k - PlatformArm64::maxArgRegNum) * 8);
+
+        translate_move(newVal, arg);
+    }
+
+    for (int32_t k = 0; k < operandNum && k < PlatformArm64::maxArgRegNum; k++) {
+        translate_move(PlatformArm64::intRegVal[k], callInst->getOperand(k));
+    }
+
+    iloc.call_fun(callInst->getName());
+
+    for (int32_t k = 0; k < operandNum && k < PlatformArm64::maxArgRegNum; k++) {
+        simpleRegisterAllocator.free(k);
+    }
+
+    // 返回值w0传送到结果变量
+    if (callInst->hasResultValue()) {
+        translate_move(callInst, PlatformArm64::intRegVal[0]);
+    }
+}
+
+///
+/// @brief 实参指令翻译成ARM64汇编，实参在函数调用指令中统一处理
+/// @param inst IR指令
+///
+void InstSelectorArm64::translate_arg(Instruction * inst)
+{
+    (void) inst;
+}
+
+/// @brief 指针存储指令翻译成ARM64汇编
+/// @param inst IR指令
+void InstSelectorArm64::translate_store_ptr(Instruction * inst)
+{
+    Value * ptrVar = inst->getOperand(0);
+    Value * value = inst->getOperand(1);
+
+    std::string addr = "[" + PlatformArm64::regName[loadOperand(ptrVar)] + "]";
+
+    // 常量0直接保存零寄存器
+    Instanceof(constValue, ConstInt *, value);
+    if (constValue && (constValue->getVal() == 0)) {
+        iloc.inst("str", "wzr", addr);
+    } else {
+        int32_t value_reg_no = loadOperand(value);
+
+        // str w0,[x1]
+        iloc.inst("str", ILocArm64::reg(value_reg_no, PlatformArm64::isWide(value)), addr);
+    }
+
+    simpleRegisterAllocator.free(ptrVar);
+    simpleRegisterAllocator.free(value);
+}
+
+/// @brief 指针解引用指令翻译成ARM64汇编
+/// @param inst IR指令
+void InstSelectorArm64::translate_load_ptr(Instruction * inst)
+{
+    Value * result = inst->getOperand(0);
+    Value * ptrVar = inst->getOperand(1);
+
+    int32_t ptr_reg_no = loadOperand(ptrVar);
+    int32_t result_reg_no = resultReg(result);
+
+    // ldr w0,[x1]
+    iloc.inst("ldr",
+              ILocArm64::reg(result_reg_no, PlatformArm64::isWide(result)),
+              "[" + PlatformArm64::regName[ptr_reg_no] + "]");
+
+    storeResult(result, result_reg_no);
+
+    simpleRegisterAllocator.free(ptrVar);
+    simpleRegisterAllocator.free(result);
+}
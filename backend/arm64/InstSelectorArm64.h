@@ -0,0 +1,268 @@
+///
+/// @file InstSelectorArm64.h
+/// @brief 指令选择器-ARM64
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Function.h"
+#include "ILocArm64.h"
+#include "Instruction.h"
+#include "PlatformArm64.h"
+#include "OrderedRegisterAllocator.h"
+
+class LabelInstruction;
+
+/// @brief 指令选择器-ARM64
+class InstSelectorArm64 {
+
+    /// @brief 所有的IR指令
+    std::vector<Instruction *> & ir;
+
+    /// @brief 指令变换
+    ILocArm64 & iloc;
+
+    /// @brief 要处理的函数
+    Function * func;
+
+protected:
+    /// @brief 指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate(Instruction * inst);
+
+    /// @brief 函数入口指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_entry(Instruction * inst);
+
+    /// @brief 函数出口指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_exit(Instruction * inst);
+
+    /// @brief 赋值指令翻译成ARM64汇编，含指针读写
+    /// @param inst IR指令
+    void translate_assign(Instruction * inst);
+
+    /// @brief 把arg1的值传送到result中，供赋值指令及函数调用的传参、取返回值使用
+    /// @param result 目的操作数
+    /// @param arg1 源操作数
+    void translate_move(Value * result, Value * arg1);
+
+    /// @brief Label指令指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_label(Instruction * inst);
+
+    /// @brief 获取Label在汇编中的名字
+    /// @param label Label指令
+    /// @return 函数名与Label编号组成的名字
+    std::string labelName(LabelInstruction * label);
+
+    /// @brief goto指令指令翻译成ARM64汇编，条件跳转用cbz/cbnz
+    /// @param inst IR指令
+    void translate_goto(Instruction * inst);
+
+    /// @brief 整数或指针的加减法指令翻译成ARM64汇编，立即数可编码时不加载到寄存器
+    /// @param inst IR指令
+    /// @param isAdd true：加法，false：减法
+    void translate_add_sub(Instruction * inst, bool isAdd);
+
+    /// @brief 整数加法指令翻译成ARM64汇编，结果为指针时是地址计算
+    /// @param inst IR指令
+    void translate_add_int32(Instruction * inst);
+
+    /// @brief 整数减法指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_sub_int32(Instruction * inst);
+
+    /// @brief 整数乘法指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_mul_int32(Instruction * inst);
+
+    /// @brief 整数除法指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_div_int32(Instruction * inst);
+
+    /// @brief 整数求余指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_mod_int32(Instruction * inst);
+
+    /// @brief 整数负号指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_neg_int32(Instruction * inst);
+
+    /// @brief 整数关系运算指令翻译成ARM64汇编(统一处理函数)
+    /// @param inst IR指令
+    /// @param condition ARM64的条件码(eq,ne,lt,gt,le,ge)
+    void translate_cmp_int32(Instruction * inst, const std::string & condition);
+
+    /// @brief 整数小于指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_lt_int32(Instruction * inst)
+    {
+        translate_cmp_int32(inst, "lt");
+    }
+
+    /// @brief 整数大于指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_gt_int32(Instruction * inst)
+    {
+        translate_cmp_int32(inst, "gt");
+    }
+
+    /// @brief 整数小于等于指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_le_int32(Instruction * inst)
+    {
+        translate_cmp_int32(inst, "le");
+    }
+
+    /// @brief 整数大于等于指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_ge_int32(Instruction * inst)
+    {
+        translate_cmp_int32(inst, "ge");
+    }
+
+    /// @brief 整数等于指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_eq_int32(Instruction * inst)
+    {
+        translate_cmp_int32(inst, "eq");
+    }
+
+    /// @brief 整数不等于指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_ne_int32(Instruction * inst)
+    {
+        translate_cmp_int32(inst, "ne");
+    }
+
+    /// @brief 指针解引用指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_load_ptr(Instruction * inst);
+
+    /// @brief 指针存储指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_store_ptr(Instruction * inst);
+
+    /// @brief 数组元素地址计算指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_array_addr(Instruction * inst);
+
+    /// @brief 二元操作指令翻译成ARM64汇编，操作数都加载到寄存器中
+    /// @param inst IR指令
+    /// @param operator_name 操作码
+    void translate_two_operator(Instruction * inst, std::string operator_name);
+
+    /// @brief 函数调用指令翻译成ARM64汇编
+    /// @param inst IR指令
+    void translate_call(Instruction * inst);
+
+    ///
+    /// @brief 实参指令翻译成ARM64汇编，实参在函数调用指令中统一处理
+    /// @param inst IR指令
+    ///
+    void translate_arg(Instruction * inst);
+
+    ///
+    /// @brief 判断地址计算的偏移是否是乘以2的幂次的结果，是则可合并到扩展寄存器寻址add x0,x1,w2,sxtw #2中
+    /// @param addInst 地址计算指令
+    /// @param mulInst 乘法指令，是addInst的偏移操作数
+    /// @param index 乘法的另一个操作数，即下标
+    /// @param shift 左移位数
+    /// @return true：可以合并，false：不可以
+    ///
+    bool foldScaledIndex(Instruction * addInst, Instruction * mulInst, Value *& index, int32_t & shift);
+
+    ///
+    /// @brief 加载操作数到寄存器，已经是寄存器时直接使用
+    /// @param val 操作数
+    /// @return 寄存器编号
+    ///
+    int32_t loadOperand(Value * val);
+
+    ///
+    /// @brief 获取保存结果的寄存器，结果不是寄存器时分配一个
+    /// @param result 结果
+    /// @return 寄存器编号
+    ///
+    int32_t resultReg(Value * result);
+
+    ///
+    /// @brief 结果不是寄存器时保存到结果变量中，并释放占用的寄存器
+    /// @param result 结果
+    /// @param reg_no 结果所在的寄存器
+    ///
+    void storeResult(Value * result, int32_t reg_no);
+
+    ///
+    /// @brief 输出IR指令
+    ///
+    void outputIRInstruction(Instruction * inst);
+
+    /// @brief IR翻译动作函数原型
+    typedef void (InstSelectorArm64::*translate_handler)(Instruction *);
+
+    /// @brief IR动作处理函数清单
+    std::map<IRInstOperator, translate_handler> translator_handlers;
+
+    ///
+    /// @brief 简单的朴素寄存器分配方法
+    ///
+    OrderedRegisterAllocator & simpleRegisterAllocator;
+
+    ///
+    /// @brief 当前翻译指令之前的上一条有效指令
+    ///
+    Instruction * prevInst = nullptr;
+
+    ///
+    /// @brief 当前翻译指令之后的下一条有效指令，跳转到紧随其后的Label时不需要跳转指令
+    ///
+    Instruction * nextInst = nullptr;
+
+    ///
+    /// @brief 显示IR指令内容
+    ///
+    bool showLinearIR = false;
+
+public:
+    /// @brief 构造函数
+    /// @param _irCode IR指令
+    /// @param _iloc 后端指令
+    /// @param _func 函数
+    /// @param allocator 寄存器分配器
+    InstSelectorArm64(std::vector<Instruction *> & _irCode,
+                      ILocArm64 & _iloc,
+                      Function * _func,
+                      OrderedRegisterAllocator & allocator);
+
+    ///
+    /// @brief 析构函数
+    ///
+    ~InstSelectorArm64() = default;
+
+    ///
+    /// @brief 设置是否输出线性IR的内容
+    /// @param show true显示，false显示
+    ///
+    void setShowLinearIR(bool show)
+    {
+        showLinearIR = show;
+    }
+
+    /// @brief 指令选择
+    void run();
+};
@@ -0,0 +1,191 @@
+///
+/// @file PlatformArm64.cpp
+/// @brief ARM64(AArch64)平台相关实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include "PlatformArm64.h"
+
+#include "IntegerType.h"
+
+// AAPCS64调用约定下寄存器的用途
+const std::string PlatformArm64::regName[PlatformArm64::maxRegNum] = {
+    "x0",  // 用于传参或返回值，不需要栈保护
+    "x1",  // 用于传参，不需要栈保护
+    "x2",  // 用于传参，不需要栈保护
+    "x3",  // 用于传参，不需要栈保护
+    "x4",  // 用于传参，不需要栈保护
+    "x5",  // 用于传参，不需要栈保护
+    "x6",  // 用于传参，不需要栈保护
+    "x7",  // 用于传参，不需要栈保护
+    "x8",  // 间接返回结果的地址，不需要栈保护
+    "x9",  // 临时寄存器，不需要栈保护
+    "x10", // 临时寄存器，不需要栈保护
+    "x11", // 临时寄存器，不需要栈保护
+    "x12", // 临时寄存器，不需要栈保护
+    "x13", // 临时寄存器，不需要栈保护
+    "x14", // 临时寄存器，不需要栈保护
+    "x15", // 临时寄存器，不需要栈保护
+    "x16", // IP0，过程内临时寄存器，立即数过大时借助寻址
+    "x17", // IP1，过程内临时寄存器
+    "x18", // 平台寄存器，不使用
+    "x19", // 需要栈保护
+    "x20", // 需要栈保护
+    "x21", // 需要栈保护
+    "x22", // 需要栈保护
+    "x23", // 需要栈保护
+    "x24", // 需要栈保护
+    "x25", // 需要栈保护
+    "x26", // 需要栈保护
+    "x27", // 需要栈保护
+    "x28", // 需要栈保护
+    "x29", // FP，栈帧寄存器
+    "x30", // LR，链接寄存器，bl指令把返回地址保存到LR中
+    "sp",  // 堆栈指针寄存器，与零寄存器共用31号编码
+};
+
+const std::string PlatformArm64::wregName[PlatformArm64::maxRegNum] = {
+    "w0",  "w1",  "w2",  "w3",  "w4",  "w5",  "w6",  "w7",  "w8",  "w9",  "w10",
+    "w11", "w12", "w13", "w14", "w15", "w16", "w17", "w18", "w19", "w20", "w21",
+    "w22", "w23", "w24", "w25", "w26", "w27", "w28", "w29", "w30", "wsp",
+};
+
+// 先使用x8-x15，再使用x0-x7，尽量不占用传参的寄存器
+const int32_t PlatformArm64::usableRegNo[PlatformArm64::maxUsableRegNum] = {
+    8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7,
+};
+
+RegVariable * PlatformArm64::intRegVal[PlatformArm64::maxRegNum] = {
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[0], 0),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[1], 1),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[2], 2),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[3], 3),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[4], 4),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[5], 5),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[6], 6),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[7], 7),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[8], 8),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[9], 9),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[10], 10),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[11], 11),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[12], 12),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[13], 13),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[14], 14),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[15], 15),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[16], 16),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[17], 17),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[18], 18),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[19], 19),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[20], 20),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[21], 21),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[22], 22),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[23], 23),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[24], 24),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[25], 25),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[26], 26),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[27], 27),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[28], 28),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[29], 29),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[30], 30),
+    new RegVariable(IntegerType::getTypeInt(), PlatformArm64::regName[31], 31),
+};
+
+/// @brief 判断是否是add/sub指令可编码的立即数，即12位无符号数，可左移12位
+/// @param num 立即数
+/// @return 是否可编码
+bool PlatformArm64::isAddSubImm(int64_t num)
+{
+    if ((num >= 0) && (num <= 0xfff)) {
+        return true;
+    }
+
+    return ((num & 0xfff) == 0) && (num > 0) && (num <= 0xfff000);
+}
+
+/// @brief 判断是否是mov指令一条可加载的32位立即数，即movz或movn可表示的数
+/// @param num 立即数
+/// @return 是否可编码
+bool PlatformArm64::isMovImm(int64_t num)
+{
+    // movz可加载0到0xffff，movn可加载-0x10000到-1
+    if ((num >= -0x10000) && (num <= 0xffff)) {
+        return true;
+    }
+
+    // 32位时低16位为0的数可用movz加左移16位加载
+    return ((num & 0xffff) == 0) && (num >= INT32_MIN) && (num <= UINT32_MAX);
+}
+
+/// @brief 判断是否是ldr/str可编码的缩放偏移，即非负且为访问字节数的整数倍，缩放后不超过12位
+/// @param offset 偏移
+/// @param size 访问的字节数
+/// @return 是否可编码
+bool PlatformArm64::isScaledOffset(int64_t offset, int32_t size)
+{
+    return (offset >= 0) && (offset % size == 0) && (offset / size <= 0xfff);
+}
+
+/// @brief 判断是否是ldur/stur可编码的未缩放偏移，即9位有符号数
+/// @param offset 偏移
+/// @return 是否可编码
+bool PlatformArm64::isUnscaledOffset(int64_t offset)
+{
+    return (offset >= -256) && (offset <= 255);
+}
+
+/// @brief 判断是否是合法的寄存器名
+/// @param name 寄存器名字
+/// @return 是否是
+bool PlatformArm64::isReg(std::string name)
+{
+    for (int k = 0; k < maxRegNum; ++k) {
+        if ((name == regName[k]) || (name == wregName[k])) {
+            return true;
+        }
+    }
+
+    return (name == "fp") || (name == "lr") || (name == "xzr") || (name == "wzr");
+}
+
+/// @brief 类型在ARM64上占用的字节数，指针为8字节
+/// @param type 类型
+/// @return 字节数
+int32_t PlatformArm64::typeSize(Type * type)
+{
+    if (type->isPointerType()) {
+        return 8;
+    }
+
+    // 数组元素目前只有int，数组的大小与ARM32相同
+    int32_t size = type->getSize();
+    return (size > 0) ? size : 4;
+}
+
+/// @brief 类型在ARM64上的对齐字节数，指针为8字节
+/// @param type 类型
+/// @return 对齐字节数
+int32_t PlatformArm64::typeAlignment(Type * type)
+{
+    if (type->isPointerType()) {
+        return 8;
+    }
+
+    int32_t align = type->getAlignment();
+    return (align > 4) ? align : 4;
+}
+
+/// @brief 值是否需要用64位寄存器操作，指针以及数组（取地址）需要64位
+/// @param val 值
+/// @return true：64位，false：32位
+bool PlatformArm64::isWide(Value * val)
+{
+    return val->getType()->isPointerType() || val->getType()->isArrayType();
+}
@@ -0,0 +1,97 @@
+///
+/// @file PlatformArm64.h
+/// @brief ARM64(AArch64)平台相关头文件
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "RegVariable.h"
+
+// 在操作过程中临时借助的寄存器为ARM64_TMP_REG_NO，即x16(IP0)
+#define ARM64_TMP_REG_NO 16
+
+// 栈寄存器SP和FP，SP在指令编码中占用31号
+#define ARM64_SP_REG_NO 31
+#define ARM64_FP_REG_NO 29
+
+// 函数跳转寄存器LR
+#define ARM64_LR_REG_NO 30
+
+/// @brief ARM64平台信息
+class PlatformArm64 {
+
+public:
+    /// @brief 判断是否是add/sub指令可编码的立即数，即12位无符号数，可左移12位
+    /// @param num 立即数
+    /// @return 是否可编码
+    static bool isAddSubImm(int64_t num);
+
+    /// @brief 判断是否是mov指令一条可加载的32位立即数，即movz或movn可表示的数
+    /// @param num 立即数
+    /// @return 是否可编码
+    static bool isMovImm(int64_t num);
+
+    /// @brief 判断是否是ldr/str可编码的缩放偏移，即非负且为访问字节数的整数倍，缩放后不超过12位
+    /// @param offset 偏移
+    /// @param size 访问的字节数
+    /// @return 是否可编码
+    static bool isScaledOffset(int64_t offset, int32_t size);
+
+    /// @brief 判断是否是ldur/stur可编码的未缩放偏移，即9位有符号数
+    /// @param offset 偏移
+    /// @return 是否可编码
+    static bool isUnscaledOffset(int64_t offset);
+
+    /// @brief 判断是否是合法的寄存器名
+    /// @param name 寄存器名字
+    /// @return 是否是
+    static bool isReg(std::string name);
+
+    /// @brief 类型在ARM64上占用的字节数，指针为8字节
+    /// @param type 类型
+    /// @return 字节数
+    static int32_t typeSize(Type * type);
+
+    /// @brief 类型在ARM64上的对齐字节数，指针为8字节
+    /// @param type 类型
+    /// @return 对齐字节数
+    static int32_t typeAlignment(Type * type);
+
+    /// @brief 值是否需要用64位寄存器操作，指针以及数组（取地址）需要64位
+    /// @param val 值
+    /// @return true：64位，false：32位
+    static bool isWide(Value * val);
+
+    /// @brief 最大寄存器数目，x0-x30以及sp
+    static const int maxRegNum = 32;
+
+    /// @brief 可使用的通用寄存器的个数x0-x15，都是调用者保存的寄存器，函数内使用时不需要保护
+    static const int maxUsableRegNum = 16;
+
+    /// @brief 通过寄存器传递的参数个数x0-x7
+    static const int maxArgRegNum = 8;
+
+    /// @brief 64位寄存器的名字，x0-x30与sp
+    static const std::string regName[maxRegNum];
+
+    /// @brief 32位寄存器的名字，w0-w30与wsp
+    static const std::string wregName[maxRegNum];
+
+    /// @brief 可使用的通用寄存器的编号，按分配时的查找次序排列
+    static const int32_t usableRegNo[maxUsableRegNum];
+
+    /// @brief 对寄存器分配Value，记录位置
+    static RegVariable * intRegVal[PlatformArm64::maxRegNum];
+};
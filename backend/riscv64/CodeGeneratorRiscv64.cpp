@@ -0,0 +1,124 @@
+///
+/// @file CodeGeneratorRiscv64.cpp
+/// @brief RISC-V64(RV64GC)的后端处理实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Function.h"
+#include "Module.h"
+#include "PlatformRiscv64.h"
+#include "CodeGeneratorRiscv64.h"
+#include "InstSelectorRiscv64.h"
+#include "OrderedRegisterAllocator.h"
+#include "ILocRiscv64.h"
+#include "TimeReport.h"
+
+/// @brief RISC-V64的汇编伪指令与寄存器
+static const CodeGeneratorAsm64::TargetInfo riscv64Target = {
+    ".global",
+    ".align",
+    "@",
+    ".word",
+    "#",
+    1, // 压缩指令为2字节，函数至少2字节对齐，.align按2的幂次
+    PlatformRiscv64::maxArgRegNum,
+    RISCV64_SP_REG_NO,
+    RISCV64_FP_REG_NO,
+    PlatformRiscv64::regName,
+    PlatformRiscv64::typeSize,
+    PlatformRiscv64::typeAlignment,
+};
+
+/// @brief 构造函数
+/// @param _module 符号表
+CodeGeneratorRiscv64::CodeGeneratorRiscv64(Module * _module) : CodeGeneratorAsm64(_module, riscv64Target)
+{}
+
+/// @brief 产生汇编头部分
+void CodeGeneratorRiscv64::genHeader()
+{
+    fprintf(fp, "%s\n", ".option nopic");
+    fprintf(fp, "%s\n", ".attribute arch, \"rv64gc\"");
+}
+
+/// @brief 对函数进行指令选择，产生函数体的汇编指令
+/// @param func 要处理的函数，已完成寄存器分配
+/// @param insts 函数体的汇编指令
+void CodeGeneratorRiscv64::selectInsts(Function * func, std::string & insts)
+{
+    // ILOC代码序列
+    ILocRiscv64 iloc(module);
+
+    // 简单的朴素寄存器分配方法，每个函数单独一个
+    OrderedRegisterAllocator simpleRegisterAllocator(PlatformRiscv64::usableRegNo, PlatformRiscv64::maxUsableRegNum);
+
+    // 指令选择生成汇编指令
+    {
+        TimeScope scope("InstSelectorRiscv64::run", func->getName());
+        InstSelectorRiscv64 instSelector(func->getInterCode().getInsts(), iloc, func, simpleRegisterAllocator);
+        instSelector.setShowLinearIR(this->showLinearIR);
+        instSelector.run();
+    }
+
+    // 删除无用的Label指令
+    {
+        TimeScope scope("deleteUnusedLabel", func->getName());
+        iloc.deleteUnusedLabel();
+    }
+
+    TimeScope scope("emit", func->getName());
+
+    // ILOC代码输出为汇编代码
+    OutputStream os(insts);
+    iloc.outPut(os);
+}
+
+/// @brief 寄存器分配
+/// @param func 函数指针
+void CodeGeneratorRiscv64::registerAllocation(Function * func)
+{
+    // 内置函数不需要处理
+    if (func->isBuiltin()) {
+        return;
+    }
+
+    // 与ARM32相同采用朴素的寄存器分配：局部变量、形参与临时变量都保存在栈中，
+    // 指令选择时临时加载到调用者保存的t0-t5与a0-a7中，因此不需要保护s1-s11
+
+    // psABI的函数调用约定：
+    // a0-a7用于传参，a0用于返回值，t0-t6为临时寄存器，都不需要保护，这里t6用于立即数过大时借助寻址
+    // s0-s11需要保护，s0为FP，ra为返回地址，ra与s0在入口保存
+    std::vector<int32_t> & protectedRegNo = func->getProtectedReg();
+    protectedRegNo.clear();
+    protectedRegNo.push_back(RISCV64_RA_REG_NO);
+    protectedRegNo.push_back(RISCV64_FP_REG_NO);
+
+    // 为局部变量、临时变量以及寄存器传递的形参在栈内分配空间，FP(s0)指向保存的ra与s0之上。
+    // 采用SP+非负偏移寻址，访存指令的12位有符号偏移可用到2047
+    stackAlloc(func);
+
+    // 栈传递的形参通过FP寻址
+    adjustFormalParamInsts(func);
+}
+
+/// @brief 第一个栈传递的形参相对于FP的偏移，s0即为调用者的sp
+/// @param func 要处理的函数
+/// @return 偏移
+int64_t CodeGeneratorRiscv64::stackParamOffset(Function * func)
+{
+    (void) func;
+    return 0;
+}
@@ -0,0 +1,478 @@
+///
+/// @file ILocRiscv64.cpp
+/// @brief RISC-V64指令序列管理的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <string>
+#include <unordered_set>
+
+#include "ILocRiscv64.h"
+#include "Common.h"
+#include "Function.h"
+#include "PlatformRiscv64.h"
+#include "Module.h"
+
+Riscv64Inst::Riscv64Inst(std::string _opcode, std::string _result, std::string _arg1, std::string _arg2)
+    : opcode(_opcode), result(_result), arg1(_arg1), arg2(_arg2), dead(false)
+{}
+
+/*
+    设置为无效指令
+*/
+void Riscv64Inst::setDead()
+{
+    dead = true;
+}
+
+/*
+    输出函数，直接写入输出流
+*/
+bool Riscv64Inst::outPut(OutputStream & os)
+{
+    // 无用代码或占位指令，什么都不输出
+    if (dead || opcode.empty()) {
+        return false;
+    }
+
+    os << opcode;
+
+    // 结果输出
+    if (!result.empty()) {
+        if (result == ":") {
+            os << result;
+        } else {
+            os << ' ' << result;
+        }
+    }
+
+    // 第一元参数输出
+    if (!arg1.empty()) {
+        os << ',' << arg1;
+    }
+
+    // 第二元参数输出
+    if (!arg2.empty()) {
+        os << ',' << arg2;
+    }
+
+    return true;
+}
+
+#define emit(...) code.push_back(new Riscv64Inst(__VA_ARGS__))
+
+/// @brief 构造函数
+/// @param _module 符号表
+ILocRiscv64::ILocRiscv64(Module * _module)
+{
+    this->module = _module;
+}
+
+/// @brief 析构函数
+ILocRiscv64::~ILocRiscv64()
+{
+    for (auto inst: code) {
+        delete inst;
+    }
+}
+
+/// @brief 获取寄存器的名字
+/// @param reg_no 寄存器编号
+/// @return 寄存器名字
+std::string ILocRiscv64::reg(int reg_no)
+{
+    return PlatformRiscv64::regName[reg_no];
+}
+
+/// @brief 删除无用的Label指令
+void ILocRiscv64::deleteUnusedLabel()
+{
+    // 先收集所有转移语句的目标Label
+    // j的目标为结果，beqz与bnez的目标为第一元参数，两个寄存器比较的分支目标为第二元参数
+    std::unordered_set<std::string> usedLabels;
+    for (Riscv64Inst * inst: code) {
+        if (inst->dead) {
+            continue;
+        }
+
+        if (inst->opcode == "j") {
+            usedLabels.insert(inst->result);
+        } else if ((inst->opcode == "beqz") || (inst->opcode == "bnez")) {
+            usedLabels.insert(inst->arg1);
+        } else if (inst->opcode[0] == 'b') {
+            usedLabels.insert(inst->arg2);
+        }
+    }
+
+    // 没有跳转到该Label的指令，则设置为dead
+    for (Riscv64Inst * inst: code) {
+        if ((!inst->dead) && (inst->opcode[0] == '.') && (inst->result == ":")) {
+            if (usedLabels.find(inst->opcode) == usedLabels.end()) {
+                inst->setDead();
+            }
+        }
+    }
+}
+
+/// @brief 输出汇编到输出流
+/// @param os 输出流
+/// @param outputEmpty 是否输出空语句
+void ILocRiscv64::outPut(OutputStream & os, bool outputEmpty)
+{
+    for (auto inst: code) {
+
+        if (inst->result == ":") {
+            // Label指令，不需要Tab输出
+            if (inst->outPut(os)) {
+                os << '\n';
+            }
+            continue;
+        }
+
+        // 除Label指令外的指令前加Tab，空语句时不加
+        if ((!inst->dead) && (!inst->opcode.empty())) {
+            os << '\t';
+            inst->outPut(os);
+            os << '\n';
+        } else if (outputEmpty) {
+            os << '\n';
+        }
+    }
+}
+
+/// @brief 获取当前的代码序列
+/// @return 代码序列
+std::list<Riscv64Inst *> & ILocRiscv64::getCode()
+{
+    return code;
+}
+
+/**
+ * 数字变字符串，RISC-V的立即数不加前缀
+ */
+std::string ILocRiscv64::toStr(int64_t num)
+{
+    return std::to_string(num);
+}
+
+/*
+    产生标签
+*/
+void ILocRiscv64::label(std::string name)
+{
+    // .L1:
+    emit(name, ":");
+}
+
+/// @brief 0个源操作数指令
+/// @param op 操作码
+/// @param rs 操作数
+void ILocRiscv64::inst(std::string op, std::string rs)
+{
+    emit(op, rs);
+}
+
+/// @brief 一个源操作数指令
+/// @param op 操作码
+/// @param rs 操作数
+/// @param arg1 源操作数
+void ILocRiscv64::inst(std::string op, std::string rs, std::string arg1)
+{
+    emit(op, rs, arg1);
+}
+
+/// @brief 两个源操作数指令
+/// @param op 操作码
+/// @param rs 操作数
+/// @param arg1 源操作数
+/// @param arg2 源操作数
+void ILocRiscv64::inst(std::string op, std::string rs, std::string arg1, std::string arg2)
+{
+    emit(op, rs, arg1, arg2);
+}
+
+///
+/// @brief 注释指令，GNU汇编中RISC-V的行注释为#
+///
+void ILocRiscv64::comment(std::string str)
+{
+    emit("#", str);
+}
+
+/*
+    加载立即数，12位有符号数用一条addi，否则lui加载高20位再用addiw加上低12位
+*/
+void ILocRiscv64::load_imm(int rs_reg_no, int64_t constant)
+{
+    std::string rsReg = reg(rs_reg_no);
+
+    if (PlatformRiscv64::isImm12(constant)) {
+        // addi a0,zero,100
+        emit("addi", rsReg, "zero", toStr(constant));
+        return;
+    }
+
+    // 低12位按有符号数加上，因此高20位需要先加上低12位的符号位
+    int32_t value = (int32_t) constant;
+    int32_t lo = (int32_t) ((uint32_t) value << 20) >> 20;
+    uint32_t hi = (((uint32_t) value - (uint32_t) lo) >> 12) & 0xfffff;
+
+    // lui a0,74565
+    emit("lui", rsReg, toStr(hi));
+
+    // addiw按32位相加并符号扩展，高20位为0x80000附近时也能得到正确的32位数
+    if (lo != 0) {
+        emit("addiw", rsReg, rsReg, toStr(lo));
+    }
+}
+
+/// @brief 加载符号地址 la a0,g
+/// @param rs_reg_no 结果寄存器编号
+/// @param name 符号名
+void ILocRiscv64::load_symbol(int rs_reg_no, std::string name)
+{
+    // 汇编器按代码模型展开为auipc与addi
+    emit("la", reg(rs_reg_no), name);
+}
+
+/// @brief 基址寻址的访存指令，偏移超出12位时借助寄存器计算地址
+/// @param op 访存指令，如lw、sd
+/// @param reg_no 被加载或保存的寄存器
+/// @param base_reg_no 基址寄存器
+/// @param disp 偏移
+/// @param addr_reg_no 偏移不能编码时存放地址的寄存器
+void ILocRiscv64::access_base(std::string op, int reg_no, int base_reg_no, int64_t disp, int addr_reg_no)
+{
+    if (PlatformRiscv64::isImm12(disp)) {
+        // lw a0,16(sp)
+        emit(op, reg(reg_no), toStr(disp) + "(" + reg(base_reg_no) + ")");
+    } else {
+        // 基址加偏移后再访存
+        // lui t6,10; addiw t6,t6,-1856
+        load_imm(addr_reg_no, disp);
+
+        // add t6,sp,t6
+        emit("add", reg(addr_reg_no), reg(base_reg_no), reg(addr_reg_no));
+
+        // lw a0,0(t6)
+        emit(op, reg(reg_no), "0(" + reg(addr_reg_no) + ")");
+    }
+}
+
+/// @brief 基址寻址 lw a0,16(sp)
+/// @param rs_reg_no 结果寄存器
+/// @param base_reg_no 基址寄存器
+/// @param offset 偏移
+/// @param wide true：64位加载，false：32位加载
+void ILocRiscv64::load_base(int rs_reg_no, int base_reg_no, int64_t offset, bool wide)
+{
+    // lw加载后符号扩展到64位，偏移不能编码时借助结果寄存器计算地址
+    access_base(wide ? "ld" : "lw", rs_reg_no, base_reg_no, offset, rs_reg_no);
+}
+
+/// @brief 基址寻址 sw a0,16(sp)
+/// @param src_reg_no 源寄存器
+/// @param base_reg_no 基址寄存器
+/// @param disp 偏移
+/// @param tmp_reg_no 可能需要临时寄存器编号
+/// @param wide true：64位保存，false：32位保存
+void ILocRiscv64::store_base(int src_reg_no, int base_reg_no, int64_t disp, int tmp_reg_no, bool wide)
+{
+    access_base(wide ? "sd" : "sw", src_reg_no, base_reg_no, disp, tmp_reg_no);
+}
+
+/// @brief 寄存器Mov操作
+/// @param rs_reg_no 结果寄存器
+/// @param src_reg_no 源寄存器
+void ILocRiscv64::mov_reg(int rs_reg_no, int src_reg_no)
+{
+    emit("mv", reg(rs_reg_no), reg(src_reg_no));
+}
+
+/// @brief 加载变量到寄存器，保证将变量放到reg中
+/// @param rs_reg_no 结果寄存器
+/// @param src_var 源操作数
+void ILocRiscv64::load_var(int rs_reg_no, Value * src_var)
+{
+    if (Instanceof(constVal, ConstInt *, src_var)) {
+        // 整型常量
+        load_imm(rs_reg_no, constVal->getVal());
+    } else if (src_var->getRegId() != -1) {
+        // 源操作数为寄存器变量
+        int32_t src_regId = src_var->getRegId();
+        if (src_regId != rs_reg_no) {
+            mov_reg(rs_reg_no, src_regId);
+        }
+    } else if (Instanceof(globalVar, GlobalVariable *, src_var)) {
+        // 全局变量，先取得地址
+        // la a0,g
+        load_symbol(rs_reg_no, globalVar->getName());
+
+        // 全局数组只需要地址，全局标量变量需要加载值
+        if (!src_var->getType()->isArrayType()) {
+            // lw a0,0(a0)
+            emit(PlatformRiscv64::isWide(src_var) ? "ld" : "lw", reg(rs_reg_no), "0(" + reg(rs_reg_no) + ")");
+        }
+    } else {
+        // 栈+偏移的寻址方式
+        int32_t var_baseRegId = -1;
+        int64_t var_offset = -1;
+
+        bool result = src_var->getMemoryAddr(&var_baseRegId, &var_offset);
+        if (!result) {
+            minic_log(LOG_ERROR, "BUG");
+        }
+
+        if (src_var->getType()->isArrayType()) {
+            // 局部数组：返回数组首地址（栈基址+偏移）
+            leaStack(rs_reg_no, var_baseRegId, var_offset);
+        } else {
+            // 普通局部变量或指针变量：从栈中加载值，指针为64位
+            load_base(rs_reg_no, var_baseRegId, var_offset, PlatformRiscv64::isWide(src_var));
+        }
+    }
+}
+
+/// @brief 加载变量地址到寄存器（专门用于数组）
+/// @param rs_reg_no 结果寄存器
+/// @param src_var 源操作数
+void ILocRiscv64::load_var_addr(int rs_reg_no, Value * src_var)
+{
+    if (Instanceof(globalVar, GlobalVariable *, src_var)) {
+        // 全局变量地址
+        load_symbol(rs_reg_no, globalVar->getName());
+    } else {
+        lea_var(rs_reg_no, src_var);
+    }
+}
+
+/// @brief 加载变量地址到寄存器
+/// @param rs_reg_no 结果寄存器
+/// @param var 变量
+void ILocRiscv64::lea_var(int rs_reg_no, Value * var)
+{
+    // 栈帧偏移
+    int32_t var_baseRegId = -1;
+    int64_t var_offset = -1;
+
+    bool result = var->getMemoryAddr(&var_baseRegId, &var_offset);
+    if (!result) {
+        minic_log(LOG_ERROR, "BUG");
+    }
+
+    // addi a0,sp,16
+    leaStack(rs_reg_no, var_baseRegId, var_offset);
+}
+
+/// @brief 保存寄存器到变量，按变量的类型确定保存的宽度
+/// @param src_reg_no 源寄存器
+/// @param dest_var 变量
+/// @param tmp_reg_no 第三方寄存器
+void ILocRiscv64::store_var(int src_reg_no, Value * dest_var, int tmp_reg_no)
+{
+    // 被保存目标变量肯定不是常量
+
+    if (dest_var->getRegId() != -1) {
+
+        // 寄存器变量，寄存器不一样才需要mv操作
+        int dest_reg_id = dest_var->getRegId();
+        if (src_reg_no != dest_reg_id) {
+            mov_reg(dest_reg_id, src_reg_no);
+        }
+
+    } else if (Instanceof(globalVar, GlobalVariable *, dest_var)) {
+        // 全局变量
+        // la t6,g
+        // sw a0,0(t6)
+        load_symbol(tmp_reg_no, globalVar->getName());
+        emit(PlatformRiscv64::isWide(dest_var) ? "sd" : "sw", reg(src_reg_no), "0(" + reg(tmp_reg_no) + ")");
+
+    } else {
+
+        // 对于局部变量，则直接从栈基址+偏移寻址
+        int32_t dest_baseRegId = -1;
+        int64_t dest_offset = -1;
+
+        bool result = dest_var->getMemoryAddr(&dest_baseRegId, &dest_offset);
+        if (!result) {
+            minic_log(LOG_ERROR, "BUG");
+        }
+
+        // sw a0,16(sp)
+        store_base(src_reg_no, dest_baseRegId, dest_offset, tmp_reg_no, PlatformRiscv64::isWide(dest_var));
+    }
+}
+
+/// @brief 加载栈内变量地址
+/// @param rs_reg_no 结果寄存器号
+/// @param base_reg_no 基址寄存器
+/// @param off 偏移
+void ILocRiscv64::leaStack(int rs_reg_no, int base_reg_no, int64_t off)
+{
+    if (PlatformRiscv64::isImm12(off)) {
+        // addi a0,sp,16
+        emit("addi", reg(rs_reg_no), reg(base_reg_no), toStr(off));
+    } else {
+        // lui a0,10; addiw a0,a0,-1856
+        load_imm(rs_reg_no, off);
+
+        // add a0,sp,a0
+        emit("add", reg(rs_reg_no), reg(base_reg_no), reg(rs_reg_no));
+    }
+}
+
+/// @brief 函数内栈内空间分配（局部变量、形参变量、函数参数传值，或不能寄存器分配的临时变量等）
+/// @param func 函数
+/// @param tmp_reg_no 栈帧过大时借助的寄存器
+void ILocRiscv64::allocStack(Function * func, int tmp_reg_no)
+{
+    // 计算栈帧大小，已按16字节对齐
+    int64_t off = func->getMaxDep();
+
+    // 不需要在栈内额外分配空间，则什么都不做
+    if (0 == off) {
+        return;
+    }
+
+    if (PlatformRiscv64::isImm12(-off)) {
+        // addi sp,sp,-16
+        emit("addi", "sp", "sp", toStr(-off));
+    } else {
+        // lui t6,10; addiw t6,t6,-1856
+        load_imm(tmp_reg_no, off);
+
+        // sub sp,sp,t6
+        emit("sub", "sp", "sp", reg(tmp_reg_no));
+    }
+}
+
+/// @brief 调用函数
+/// @param name 函数名
+void ILocRiscv64::call_fun(std::string name)
+{
+    // 函数返回值在a0,不需要保护
+    emit("call", name);
+}
+
+/// @brief NOP操作
+void ILocRiscv64::nop()
+{
+    emit("");
+}
+
+///
+/// @brief 无条件跳转指令
+/// @param label 目标Label名称
+///
+void ILocRiscv64::jump(std::string label)
+{
+    emit("j", label);
+}
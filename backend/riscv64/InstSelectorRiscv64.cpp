@@ -0,0 +1,735 @@
+///
+/// @file InstSelectorRiscv64.cpp
+/// @brief 指令选择器-RISC-V64的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <utility>
+
+#include "Common.h"
+#include "Debug.h"
+#include "ILocRiscv64.h"
+#include "InstSelectorRiscv64.h"
+#include "PlatformRiscv64.h"
+#include "ConstInt.h"
+#include "Function.h"
+
+#include "LabelInstruction.h"
+#include "GotoInstruction.h"
+#include "FuncCallInstruction.h"
+#include "MoveInstruction.h"
+
+/// @brief 构造函数
+/// @param _irCode 指令
+/// @param _iloc ILoc
+/// @param _func 函数
+/// @param allocator 寄存器分配器
+InstSelectorRiscv64::InstSelectorRiscv64(std::vector<Instruction *> & _irCode,
+                                         ILocRiscv64 & _iloc,
+                                         Function * _func,
+                                         OrderedRegisterAllocator & allocator)
+    : ir(_irCode), iloc(_iloc), func(_func), simpleRegisterAllocator(allocator)
+{
+    translator_handlers[IRInstOperator::IRINST_OP_ENTRY] = &InstSelectorRiscv64::translate_entry;
+    translator_handlers[IRInstOperator::IRINST_OP_EXIT] = &InstSelectorRiscv64::translate_exit;
+
+    translator_handlers[IRInstOperator::IRINST_OP_LABEL] = &InstSelectorRiscv64::translate_label;
+    translator_handlers[IRInstOperator::IRINST_OP_GOTO] = &InstSelectorRiscv64::translate_goto;
+
+    translator_handlers[IRInstOperator::IRINST_OP_ASSIGN] = &InstSelectorRiscv64::translate_assign;
+
+    translator_handlers[IRInstOperator::IRINST_OP_ADD_I] = &InstSelectorRiscv64::translate_add_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_SUB_I] = &InstSelectorRiscv64::translate_sub_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_MUL_I] = &InstSelectorRiscv64::translate_mul_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_DIV_I] = &InstSelectorRiscv64::translate_div_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_MOD_I] = &InstSelectorRiscv64::translate_mod_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_NEG_I] = &InstSelectorRiscv64::translate_neg_int32;
+
+    translator_handlers[IRInstOperator::IRINST_OP_LT_I] = &InstSelectorRiscv64::translate_lt_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_GT_I] = &InstSelectorRiscv64::translate_gt_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_LE_I] = &InstSelectorRiscv64::translate_le_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_GE_I] = &InstSelectorRiscv64::translate_ge_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_EQ_I] = &InstSelectorRiscv64::translate_eq_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_NE_I] = &InstSelectorRiscv64::translate_ne_int32;
+
+    translator_handlers[IRInstOperator::IRINST_OP_STORE_PTR] = &InstSelectorRiscv64::translate_store_ptr;
+    translator_handlers[IRInstOperator::IRINST_OP_LOAD_PTR] = &InstSelectorRiscv64::translate_load_ptr;
+    translator_handlers[IRInstOperator::IRINST_OP_ADD_PTR] = &InstSelectorRiscv64::translate_add_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_ARRAY_ADDR] = &InstSelectorRiscv64::translate_array_addr;
+
+    translator_handlers[IRInstOperator::IRINST_OP_FUNC_CALL] = &InstSelectorRiscv64::translate_call;
+    translator_handlers[IRInstOperator::IRINST_OP_ARG] = &InstSelectorRiscv64::translate_arg;
+
+    // 栈内布局由栈槽着色给出，这里只在--debug=stack-layout时输出
+    if (_func) {
+        _func->printMemoryLayout();
+    }
+}
+
+/// @brief 指令选择执行
+void InstSelectorRiscv64::run()
+{
+    prevInst = nullptr;
+
+    for (size_t k = 0; k < ir.size(); ++k) {
+
+        Instruction * inst = ir[k];
+        if (inst->isDead()) {
+            continue;
+        }
+
+        // 记录下一条有效指令，用于去掉跳转到下一条Label的跳转指令以及比较与分支的合并
+        nextInst = nullptr;
+        for (size_t next = k + 1; next < ir.size(); ++next) {
+            if (!ir[next]->isDead()) {
+                nextInst = ir[next];
+                break;
+            }
+        }
+
+        // 逐个指令进行翻译
+        translate(inst);
+
+        prevInst = inst;
+    }
+}
+
+/// @brief 指令翻译成RISC-V64汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate(Instruction * inst)
+{
+    // 操作符
+    IRInstOperator op = inst->getOp();
+
+    auto pIter = translator_handlers.find(op);
+    if (pIter == translator_handlers.end()) {
+        // 没有找到，则说明当前不支持
+        minic_log(LOG_ERROR, "Translate: Operator(%d) not support", (int) op);
+        return;
+    }
+
+    // 开启时输出IR指令作为注释
+    if (showLinearIR) {
+        outputIRInstruction(inst);
+    }
+
+    (this->*(pIter->second))(inst);
+}
+
+///
+/// @brief 输出IR指令
+///
+void InstSelectorRiscv64::outputIRInstruction(Instruction * inst)
+{
+    std::string irStr;
+    inst->toString(irStr);
+    if (!irStr.empty()) {
+        iloc.comment(irStr);
+    }
+}
+
+///
+/// @brief 加载操作数到寄存器，已经是寄存器时直接使用
+/// @param val 操作数
+/// @return 寄存器编号
+///
+int32_t InstSelectorRiscv64::loadOperand(Value * val)
+{
+    int32_t reg_no = val->getRegId();
+    if (reg_no == -1) {
+        reg_no = simpleRegisterAllocator.Allocate(val);
+        iloc.load_var(reg_no, val);
+    }
+
+    return reg_no;
+}
+
+///
+/// @brief 获取保存结果的寄存器，结果不是寄存器时分配一个
+/// @param result 结果
+/// @return 寄存器编号
+///
+int32_t InstSelectorRiscv64::resultReg(Value * result)
+{
+    int32_t reg_no = result->getRegId();
+    if (reg_no == -1) {
+        reg_no = simpleRegisterAllocator.Allocate(result);
+    }
+
+    return reg_no;
+}
+
+///
+/// @brief 结果不是寄存器时保存到结果变量中
+/// @param result 结果
+/// @param reg_no 结果所在的寄存器
+///
+void InstSelectorRiscv64::storeResult(Value * result, int32_t reg_no)
+{
+    if (result->getRegId() == -1) {
+        iloc.store_var(reg_no, result, RISCV64_TMP_REG_NO);
+    }
+}
+
+/// @brief Label指令指令翻译成RISC-V64汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_label(Instruction * inst)
+{
+    Instanceof(labelInst, LabelInstruction *, inst);
+
+    iloc.label(labelName(labelInst));
+}
+
+/// @brief 获取Label在汇编中的名字
+/// @param label Label指令
+/// @return 函数名与Label编号组成的名字
+std::string InstSelectorRiscv64::labelName(LabelInstruction * label)
+{
+    return IR_LABEL_PREFIX + func->getName() + "_" + std::to_string(label->getAsmIndex());
+}
+
+///
+/// @brief 判断比较指令能否与紧随其后的条件跳转合并为一条blt/bge/beq等比较分支指令
+/// @param cmpInst 比较指令
+/// @param gotoInst 条件跳转指令
+/// @return true：可以合并，false：不可以
+///
+bool InstSelectorRiscv64::isFusedCompare(Instruction * cmpInst, Instruction * gotoInst)
+{
+    switch (cmpInst->getOp()) {
+        case IRInstOperator::IRINST_OP_LT_I:
+        case IRInstOperator::IRINST_OP_GT_I:
+        case IRInstOperator::IRINST_OP_LE_I:
+        case IRInstOperator::IRINST_OP_GE_I:
+        case IRInstOperator::IRINST_OP_EQ_I:
+        case IRInstOperator::IRINST_OP_NE_I:
+            break;
+        default:
+            return false;
+    }
+
+    // 比较结果只被该条件跳转使用，且两条指令相邻，比较的操作数在跳转时没有被改写
+    if ((gotoInst->getOp() != IRInstOperator::IRINST_OP_GOTO) || (gotoInst->getOperandsNum() == 0) ||
+        (gotoInst->getOperand(0) != cmpInst)) {
+        return false;
+    }
+
+    Use * use = cmpInst->getFirstUse();
+
+    return use && (!use->getNextUse()) && (use->getUser() == gotoInst);
+}
+
+///
+/// @brief 比较分支指令，条件满足时跳转到label
+/// @param cmpInst 比较指令
+/// @param invert 是否取反条件
+/// @param label 目标Label名称
+///
+void InstSelectorRiscv64::branch_cmp(Instruction * cmpInst, bool invert, std::string label)
+{
+    Value * arg1 = cmpInst->getOperand(0);
+    Value * arg2 = cmpInst->getOperand(1);
+
+    std::string opcode;
+    switch (cmpInst->getOp()) {
+        case IRInstOperator::IRINST_OP_LT_I:
+            opcode = invert ? "bge" : "blt";
+            break;
+        case IRInstOperator::IRINST_OP_GT_I:
+            opcode = invert ? "ble" : "bgt";
+            break;
+        case IRInstOperator::IRINST_OP_LE_I:
+            opcode = invert ? "bgt" : "ble";
+            break;
+        case IRInstOperator::IRINST_OP_GE_I:
+            opcode = invert ? "blt" : "bge";
+            break;
+        case IRInstOperator::IRINST_OP_EQ_I:
+            opcode = invert ? "bne" : "beq";
+            break;
+        default:
+            opcode = invert ? "beq" : "bne";
+            break;
+    }
+
+    // 与0比较时直接使用零寄存器
+    auto operandReg = [this](Value * val) {
+        Instanceof(constVal, ConstInt *, val);
+        if (constVal && (constVal->getVal() == 0)) {
+            return ILocRiscv64::reg(RISCV64_ZERO_REG_NO);
+        }
+        return ILocRiscv64::reg(loadOperand(val));
+    };
+
+    std::string arg1Reg = operandReg(arg1);
+    std::string arg2Reg = operandReg(arg2);
+
+    // blt a0,a1,.L1
+    iloc.inst(opcode, arg1Reg, arg2Reg, label);
+
+    simpleRegisterAllocator.free(arg1);
+    simpleRegisterAllocator.free(arg2);
+}
+
+/// @brief goto指令指令翻译成RISC-V64汇编，条件跳转用beqz/bnez，紧邻的比较合并为比较分支
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_goto(Instruction * inst)
+{
+    Instanceof(gotoInst, GotoInstruction *, inst);
+
+    if (gotoInst->getOperandsNum() > 0) {
+
+        Value * condition = gotoInst->getOperand(0);
+        std::string trueLabel = labelName(gotoInst->getTarget());
+        std::string falseLabel = labelName(gotoInst->getFalseTarget());
+
+        if (prevInst && (prevInst == condition) && isFusedCompare(prevInst, inst)) {
+
+            // 比较指令没有计算结果，比较与跳转合并为一条指令
+            if (nextInst == gotoInst->getFalseTarget()) {
+                // 假出口紧随其后，条件满足时跳转到trueLabel即可
+                branch_cmp(prevInst, false, trueLabel);
+            } else if (nextInst == gotoInst->getTarget()) {
+                // 真出口紧随其后，条件不满足时跳转到falseLabel即可
+                branch_cmp(prevInst, true, falseLabel);
+            } else {
+                branch_cmp(prevInst, false, trueLabel);
+                iloc.jump(falseLabel);
+            }
+
+            return;
+        }
+
+        // 条件值与0比较并跳转
+        std::string condReg = ILocRiscv64::reg(loadOperand(condition));
+
+        if (nextInst == gotoInst->getFalseTarget()) {
+            iloc.inst("bnez", condReg, trueLabel);
+        } else if (nextInst == gotoInst->getTarget()) {
+            iloc.inst("beqz", condReg, falseLabel);
+        } else {
+            iloc.inst("bnez", condReg, trueLabel);
+            iloc.jump(falseLabel);
+        }
+
+        simpleRegisterAllocator.free(condition);
+    } else if (nextInst != gotoInst->getTarget()) {
+        // 无条件跳转，目标紧随其后时顺序执行即可
+        iloc.jump(labelName(gotoInst->getTarget()));
+    }
+}
+
+/// @brief 函数入口指令翻译成RISC-V64汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_entry(Instruction * inst)
+{
+    (void) inst;
+
+    // 保存ra与s0，s0指向进入函数时的sp，sp始终保持16字节对齐
+    iloc.inst("addi", "sp", "sp", "-16");
+    iloc.inst("sd", "ra", "8(sp)");
+    iloc.inst("sd", "s0", "0(sp)");
+    iloc.inst("addi", "s0", "sp", "16");
+
+    // 为fun分配栈帧，含局部变量、形参、函数调用值传递的空间等
+    iloc.allocStack(func, RISCV64_TMP_REG_NO);
+
+    // 寄存器传递的形参保存到栈中，函数调用时a0-a7会被改写
+    auto & params = func->getParams();
+    for (int k = 0; k < (int) params.size() && k < PlatformRiscv64::maxArgRegNum; k++) {
+        iloc.store_var(PlatformRiscv64::argRegNo(k), params[k], RISCV64_TMP_REG_NO);
+    }
+}
+
+/// @brief 函数出口指令翻译成RISC-V64汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_exit(Instruction * inst)
+{
+    if (inst->getOperandsNum()) {
+        // 存在返回值，赋值给寄存器a0
+        iloc.load_var(RISCV64_A0_REG_NO, inst->getOperand(0));
+    }
+
+    // 恢复栈空间以及ra与s0
+    iloc.inst("addi", "sp", "s0", "-16");
+    iloc.inst("ld", "ra", "8(sp)");
+    iloc.inst("ld", "s0", "0(sp)");
+    iloc.inst("addi", "sp", "sp", "16");
+
+    iloc.inst("ret", "");
+}
+
+/// @brief 赋值指令翻译成RISC-V64汇编，含指针读写
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_assign(Instruction * inst)
+{
+    Instanceof(moveInst, MoveInstruction *, inst);
+
+    if (moveInst && moveInst->getIsPointerLoad()) {
+        // %l10 = *%l9
+        translate_load_ptr(inst);
+    } else if (moveInst && moveInst->getIsPointerStore()) {
+        // *%l9 = 1
+        translate_store_ptr(inst);
+    } else {
+        translate_move(inst->getOperand(0), inst->getOperand(1));
+    }
+}
+
+/// @brief 把arg1的值传送到result中，供赋值指令及函数调用的传参、取返回值使用
+/// @param result 目的操作数
+/// @param arg1 源操作数
+void InstSelectorRiscv64::translate_move(Value * result, Value * arg1)
+{
+    int32_t arg1_regId = arg1->getRegId();
+    int32_t result_regId = result->getRegId();
+
+    if (arg1_regId != -1) {
+        iloc.store_var(arg1_regId, result, RISCV64_TMP_REG_NO);
+    } else if (result_regId != -1) {
+        iloc.load_var(result_regId, arg1);
+    } else {
+        int32_t temp_regno = simpleRegisterAllocator.Allocate();
+
+        iloc.load_var(temp_regno, arg1);
+        iloc.store_var(temp_regno, result, RISCV64_TMP_REG_NO);
+
+        simpleRegisterAllocator.free(temp_regno);
+    }
+}
+
+/// @brief 整数或指针的加减法指令翻译成RISC-V64汇编，12位立即数不加载到寄存器
+/// @param inst IR指令
+/// @param isAdd true：加法，false：减法
+void InstSelectorRiscv64::translate_add_sub(Instruction * inst, bool isAdd)
+{
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    // 结果为指针时是地址计算，按64位运算，否则用按32位运算并符号扩展的addw/subw
+    bool wide = PlatformRiscv64::isWide(result);
+
+    // 加法的指针在后时交换，使基址在前
+    if (isAdd && PlatformRiscv64::isWide(arg2) && (!PlatformRiscv64::isWide(arg1))) {
+        std::swap(arg1, arg2);
+    }
+
+    int32_t arg1_reg_no = loadOperand(arg1);
+    int32_t result_reg_no = resultReg(result);
+
+    std::string rsReg = ILocRiscv64::reg(result_reg_no);
+    std::string arg1Reg = ILocRiscv64::reg(arg1_reg_no);
+
+    // 减去立即数时改为加上其相反数
+    Instanceof(constArg2, ConstInt *, arg2);
+    int64_t imm = constArg2 ? (isAdd ? (int64_t) constArg2->getVal() : -(int64_t) constArg2->getVal()) : 0;
+
+    if (constArg2 && PlatformRiscv64::isImm12(imm)) {
+        // addiw a0,a1,4
+        iloc.inst(wide ? "addi" : "addiw", rsReg, arg1Reg, iloc.toStr(imm));
+    } else {
+        // 32位整数在寄存器中已符号扩展为64位，可直接参与地址计算
+        int32_t arg2_reg_no = loadOperand(arg2);
+
+        // addw a0,a1,a2
+        std::string opcode = isAdd ? "add" : "sub";
+        iloc.inst(wide ? opcode : opcode + "w", rsReg, arg1Reg, ILocRiscv64::reg(arg2_reg_no));
+    }
+
+    storeResult(result, result_reg_no);
+
+    // 释放寄存器
+    simpleRegisterAllocator.free(arg1);
+    simpleRegisterAllocator.free(arg2);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 整数加法指令翻译成RISC-V64汇编，结果为指针时是地址计算
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_add_int32(Instruction * inst)
+{
+    translate_add_sub(inst, true);
+}
+
+/// @brief 整数减法指令翻译成RISC-V64汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_sub_int32(Instruction * inst)
+{
+    translate_add_sub(inst, false);
+}
+
+/// @brief 数组元素地址计算指令翻译成RISC-V64汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_array_addr(Instruction * inst)
+{
+    translate_add_sub(inst, true);
+}
+
+/// @brief 二元操作指令翻译成RISC-V64汇编，操作数都加载到寄存器中
+/// @param inst IR指令
+/// @param operator_name 操作码
+void InstSelectorRiscv64::translate_two_operator(Instruction * inst, std::string operator_name)
+{
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    int32_t arg1_reg_no = loadOperand(arg1);
+    int32_t arg2_reg_no = loadOperand(arg2);
+    int32_t result_reg_no = resultReg(result);
+
+    // mulw a0,a1,a2
+    iloc.inst(operator_name,
+              ILocRiscv64::reg(result_reg_no),
+              ILocRiscv64::reg(arg1_reg_no),
+              ILocRiscv64::reg(arg2_reg_no));
+
+    storeResult(result, result_reg_no);
+
+    // 释放寄存器
+    simpleRegisterAllocator.free(arg1);
+    simpleRegisterAllocator.free(arg2);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 整数乘法指令翻译成RISC-V64汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_mul_int32(Instruction * inst)
+{
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    // 乘以2的幂次用移位实现
+    Instanceof(constArg, ConstInt *, arg2);
+    Value * var = arg1;
+    if (!constArg) {
+        constArg = dynamic_cast<ConstInt *>(arg1);
+        var = arg2;
+    }
+
+    int32_t value = constArg ? constArg->getVal() : 0;
+    if ((value <= 0) || (value & (value - 1)) || dynamic_cast<ConstInt *>(var)) {
+        translate_two_operator(inst, "mulw");
+        return;
+    }
+
+    int32_t shift = 0;
+    while ((1 << shift) < value) {
+        shift++;
+    }
+
+    int32_t var_reg_no = loadOperand(var);
+    int32_t result_reg_no = resultReg(result);
+
+    // slliw a0,a1,2
+    iloc.inst("slliw", ILocRiscv64::reg(result_reg_no), ILocRiscv64::reg(var_reg_no), iloc.toStr(shift));
+
+    storeResult(result, result_reg_no);
+
+    simpleRegisterAllocator.free(var);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 整数除法指令翻译成RISC-V64汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_div_int32(Instruction * inst)
+{
+    translate_two_operator(inst, "divw");
+}
+
+/// @brief 整数求余指令翻译成RISC-V64汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_mod_int32(Instruction * inst)
+{
+    translate_two_operator(inst, "remw");
+}
+
+/// @brief 整数负号指令翻译成RISC-V64汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_neg_int32(Instruction * inst)
+{
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+
+    int32_t arg1_reg_no = loadOperand(arg1);
+    int32_t result_reg_no = resultReg(result);
+
+    // negw a0,a1
+    iloc.inst("negw", ILocRiscv64::reg(result_reg_no), ILocRiscv64::reg(arg1_reg_no));
+
+    storeResult(result, result_reg_no);
+
+    simpleRegisterAllocator.free(arg1);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 整数关系运算指令翻译成RISC-V64汇编(统一处理函数)
+/// @param inst IR指令
+/// @param condition 比较条件(eq,ne,lt,gt,le,ge)
+void InstSelectorRiscv64::translate_cmp_int32(Instruction * inst, const std::string & condition)
+{
+    // 结果只被紧随其后的条件跳转使用时，在条件跳转处合并为比较分支指令
+    if (nextInst && isFusedCompare(inst, nextInst)) {
+        return;
+    }
+
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    int32_t arg1_reg_no = loadOperand(arg1);
+    int32_t result_reg_no = resultReg(result);
+
+    std::string rsReg = ILocRiscv64::reg(result_reg_no);
+    std::string arg1Reg = ILocRiscv64::reg(arg1_reg_no);
+
+    Instanceof(constArg2, ConstInt *, arg2);
+    bool immArg2 = constArg2 && PlatformRiscv64::isImm12(constArg2->getVal());
+
+    if ((condition == "eq") || (condition == "ne")) {
+
+        // 相等时异或的结果为0
+        if (constArg2 && (constArg2->getVal() == 0)) {
+            iloc.inst(condition == "eq" ? "seqz" : "snez", rsReg, arg1Reg);
+        } else {
+            if (immArg2) {
+                iloc.inst("xori", rsReg, arg1Reg, iloc.toStr(constArg2->getVal()));
+            } else {
+                iloc.inst("xor", rsReg, arg1Reg, ILocRiscv64::reg(loadOperand(arg2)));
+            }
+            iloc.inst(condition == "eq" ? "seqz" : "snez", rsReg, rsReg);
+        }
+    } else if ((condition == "lt") || (condition == "ge")) {
+
+        // a >= b即!(a < b)
+        if (immArg2) {
+            iloc.inst("slti", rsReg, arg1Reg, iloc.toStr(constArg2->getVal()));
+        } else {
+            iloc.inst("slt", rsReg, arg1Reg, ILocRiscv64::reg(loadOperand(arg2)));
+        }
+
+        if (condition == "ge") {
+            iloc.inst("xori", rsReg, rsReg, "1");
+        }
+    } else {
+
+        // a > b即b < a，a <= b即!(b < a)
+        iloc.inst("slt", rsReg, ILocRiscv64::reg(loadOperand(arg2)), arg1Reg);
+
+        if (condition == "le") {
+            iloc.inst("xori", rsReg, rsReg, "1");
+        }
+    }
+
+    storeResult(result, result_reg_no);
+
+    simpleRegisterAllocator.free(arg1);
+    simpleRegisterAllocator.free(arg2);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 函数调用指令翻译成RISC-V64汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_call(Instruction * inst)
+{
+    FuncCallInstruction * callInst = dynamic_cast<FuncCallInstruction *>(inst);
+
+    int32_t operandNum = callInst->getOperandsNum();
+
+    // 强制占用参数传递的寄存器，加载栈传递的实参时不会使用
+    for (int32_t k = 0; k < operandNum && k < PlatformRiscv64::maxArgRegNum; k++) {
+        simpleRegisterAllocator.Allocate(PlatformRiscv64::argRegNo(k));
+    }
+
+    // psABI：前八个参数通过a0-a7传递，后面的参数每个占8字节，从sp开始依次存放
+    for (int32_t k = PlatformRiscv64::maxArgRegNum; k < operandNum; k++) {
+
+        auto arg = callInst->getOperand(k);
+
+        // 新建一个内存变量，用于栈传值到形参变量中
+        MemVariable * newVal = func->newMemVariable(arg->getType());
+        newVal->setMemoryAddr(RISCV64_SP_REG_NO, (k - PlatformRiscv64::maxArgRegNum) * 8);
+
+        translate_move(newVal, arg);
+    }
+
+    for (int32_t k = 0; k < operandNum && k < PlatformRiscv64::maxArgRegNum; k++) {
+        translate_move(PlatformRiscv64::intRegVal[PlatformRiscv64::argRegNo(k)], callInst->getOperand(k));
+    }
+
+    iloc.call_fun(callInst->getName());
+
+    for (int32_t k = 0; k < operandNum && k < PlatformRiscv64::maxArgRegNum; k++) {
+        simpleRegisterAllocator.free(PlatformRiscv64::argRegNo(k));
+    }
+
+    // 返回值a0传送到结果变量
+    if (callInst->hasResultValue()) {
+        translate_move(callInst, PlatformRiscv64::intRegVal[RISCV64_A0_REG_NO]);
+    }
+}
+
+///
+/// @brief 实参指令翻译成RISC-V64汇编，实参在函数调用指令中统一处理
+/// @param inst IR指令
+///
+void InstSelectorRiscv64::translate_arg(Instruction * inst)
+{
+    (void) inst;
+}
+
+/// @brief 指针存储指令翻译成RISC-V64汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_store_ptr(Instruction * inst)
+{
+    Value * ptrVar = inst->getOperand(0);
+    Value * value = inst->getOperand(1);
+
+    std::string addr = "0(" + ILocRiscv64::reg(loadOperand(ptrVar)) + ")";
+    std::string opcode = PlatformRiscv64::isWide(value) ? "sd" : "sw";
+
+    // 常量0直接保存零寄存器
+    Instanceof(constValue, ConstInt *, value);
+    if (constValue && (constValue->getVal() == 0)) {
+        iloc.inst(opcode, "zero", addr);
+    } else {
+        int32_t value_reg_no = loadOperand(value);
+
+        // sw a0,0(a1)
+        iloc.inst(opcode, ILocRiscv64::reg(value_reg_no), addr);
+    }
+
+    simpleRegisterAllocator.free(ptrVar);
+    simpleRegisterAllocator.free(value);
+}
+
+/// @brief 指针解引用指令翻译成RISC-V64汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_load_ptr(Instruction * inst)
+{
+    Value * result = inst->getOperand(0);
+    Value * ptrVar = inst->getOperand(1);
+
+    int32_t ptr_reg_no = loadOperand(ptrVar);
+    int32_t result_reg_no = resultReg(result);
+
+    // lw a0,0(a1)
+    iloc.inst(PlatformRiscv64::isWide(result) ? "ld" : "lw",
+              ILocRiscv64::reg(result_reg_no),
+              "0(" + ILocRiscv64::reg(ptr_reg_no) + ")");
+
+    storeResult(result, result_reg_no);
+
+    simpleRegisterAllocator.free(ptrVar);
+    simpleRegisterAllocator.free(result);
+}
@@ -0,0 +1,150 @@
+///
+/// @file PlatformRiscv64.cpp
+/// @brief RISC-V64(RV64GC)平台相关实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include "PlatformRiscv64.h"
+
+#include "IntegerType.h"
+
+// psABI调用约定下寄存器的用途
+const std::string PlatformRiscv64::regName[PlatformRiscv64::maxRegNum] = {
+    "zero", // x0，零寄存器
+    "ra",   // x1，返回地址
+    "sp",   // x2，堆栈指针寄存器
+    "gp",   // x3，全局指针，不使用
+    "tp",   // x4，线程指针，不使用
+    "t0",   // x5，临时寄存器，不需要栈保护
+    "t1",   // x6，临时寄存器，不需要栈保护
+    "t2",   // x7，临时寄存器，不需要栈保护
+    "s0",   // x8，FP，栈帧寄存器
+    "s1",   // x9，需要栈保护
+    "a0",   // x10，用于传参或返回值，不需要栈保护
+    "a1",   // x11，用于传参，不需要栈保护
+    "a2",   // x12，用于传参，不需要栈保护
+    "a3",   // x13，用于传参，不需要栈保护
+    "a4",   // x14，用于传参，不需要栈保护
+    "a5",   // x15，用于传参，不需要栈保护
+    "a6",   // x16，用于传参，不需要栈保护
+    "a7",   // x17，用于传参，不需要栈保护
+    "s2",   // x18，需要栈保护
+    "s3",   // x19，需要栈保护
+    "s4",   // x20，需要栈保护
+    "s5",   // x21，需要栈保护
+    "s6",   // x22，需要栈保护
+    "s7",   // x23，需要栈保护
+    "s8",   // x24，需要栈保护
+    "s9",   // x25，需要栈保护
+    "s10",  // x26，需要栈保护
+    "s11",  // x27，需要栈保护
+    "t3",   // x28，临时寄存器，不需要栈保护
+    "t4",   // x29，临时寄存器，不需要栈保护
+    "t5",   // x30，临时寄存器，不需要栈保护
+    "t6",   // x31，临时寄存器，立即数过大时借助寻址
+};
+
+// 先使用临时寄存器，再使用参数寄存器，尽量不占用传参的寄存器
+const int32_t PlatformRiscv64::usableRegNo[PlatformRiscv64::maxUsableRegNum] = {
+    5, 6, 7, 28, 29, 30, 17, 16, 15, 14, 13, 12, 11, 10,
+};
+
+RegVariable * PlatformRiscv64::intRegVal[PlatformRiscv64::maxRegNum] = {
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[0], 0),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[1], 1),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[2], 2),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[3], 3),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[4], 4),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[5], 5),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[6], 6),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[7], 7),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[8], 8),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[9], 9),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[10], 10),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[11], 11),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[12], 12),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[13], 13),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[14], 14),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[15], 15),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[16], 16),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[17], 17),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[18], 18),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[19], 19),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[20], 20),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[21], 21),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[22], 22),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[23], 23),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[24], 24),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[25], 25),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[26], 26),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[27], 27),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[28], 28),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[29], 29),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[30], 30),
+    new RegVariable(IntegerType::getTypeInt(), PlatformRiscv64::regName[31], 31),
+};
+
+/// @brief 判断是否是12位有符号立即数，addi、slti以及访存的偏移都是该范围
+/// @param num 立即数
+/// @return 是否可编码
+bool PlatformRiscv64::isImm12(int64_t num)
+{
+    return (num >= -2048) && (num <= 2047);
+}
+
+/// @brief 判断是否是合法的寄存器名
+/// @param name 寄存器名字
+/// @return 是否是
+bool PlatformRiscv64::isReg(std::string name)
+{
+    for (int k = 0; k < maxRegNum; ++k) {
+        if ((name == regName[k]) || (name == "x" + std::to_string(k))) {
+            return true;
+        }
+    }
+
+    return name == "fp";
+}
+
+/// @brief 类型在RISC-V64上占用的字节数，指针为8字节
+/// @param type 类型
+/// @return 字节数
+int32_t PlatformRiscv64::typeSize(Type * type)
+{
+    if (type->isPointerType()) {
+        return 8;
+    }
+
+    // 数组元素目前只有int，数组的大小与ARM32相同
+    int32_t size = type->getSize();
+    return (size > 0) ? size : 4;
+}
+
+/// @brief 类型在RISC-V64上的对齐字节数，指针为8字节
+/// @param type 类型
+/// @return 对齐字节数
+int32_t PlatformRiscv64::typeAlignment(Type * type)
+{
+    if (type->isPointerType()) {
+        return 8;
+    }
+
+    int32_t align = type->getAlignment();
+    return (align > 4) ? align : 4;
+}
+
+/// @brief 值是否需要按64位访存，指针以及数组（取地址）需要64位
+/// @param val 值
+/// @return true：64位，false：32位
+bool PlatformRiscv64::isWide(Value * val)
+{
+    return val->getType()->isPointerType() || val->getType()->isArrayType();
+}
@@ -0,0 +1,92 @@
+///
+/// @file PlatformRiscv64.h
+/// @brief RISC-V64(RV64GC)平台相关头文件
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "RegVariable.h"
+
+// 零寄存器x0
+#define RISCV64_ZERO_REG_NO 0
+
+// 函数返回地址寄存器ra
+#define RISCV64_RA_REG_NO 1
+
+// 栈寄存器SP和FP(s0)
+#define RISCV64_SP_REG_NO 2
+#define RISCV64_FP_REG_NO 8
+
+// 在操作过程中临时借助的寄存器为RISCV64_TMP_REG_NO，即t6
+#define RISCV64_TMP_REG_NO 31
+
+// 第一个参数寄存器a0，也是返回值寄存器
+#define RISCV64_A0_REG_NO 10
+
+/// @brief RISC-V64平台信息
+class PlatformRiscv64 {
+
+public:
+    /// @brief 判断是否是12位有符号立即数，addi、slti以及访存的偏移都是该范围
+    /// @param num 立即数
+    /// @return 是否可编码
+    static bool isImm12(int64_t num);
+
+    /// @brief 判断是否是合法的寄存器名
+    /// @param name 寄存器名字
+    /// @return 是否是
+    static bool isReg(std::string name);
+
+    /// @brief 类型在RISC-V64上占用的字节数，指针为8字节
+    /// @param type 类型
+    /// @return 字节数
+    static int32_t typeSize(Type * type);
+
+    /// @brief 类型在RISC-V64上的对齐字节数，指针为8字节
+    /// @param type 类型
+    /// @return 对齐字节数
+    static int32_t typeAlignment(Type * type);
+
+    /// @brief 值是否需要按64位访存，指针以及数组（取地址）需要64位
+    /// @param val 值
+    /// @return true：64位，false：32位
+    static bool isWide(Value * val);
+
+    /// @brief 第k个参数寄存器的编号，即ak
+    /// @param k 参数序号
+    /// @return 寄存器编号
+    static int32_t argRegNo(int32_t k)
+    {
+        return RISCV64_A0_REG_NO + k;
+    }
+
+    /// @brief 最大寄存器数目，x0-x31
+    static const int maxRegNum = 32;
+
+    /// @brief 可使用的通用寄存器的个数t0-t5与a0-a7，都是调用者保存的寄存器，函数内使用时不需要保护
+    static const int maxUsableRegNum = 14;
+
+    /// @brief 通过寄存器传递的参数个数a0-a7
+    static const int maxArgRegNum = 8;
+
+    /// @brief 寄存器的ABI名字
+    static const std::string regName[maxRegNum];
+
+    /// @brief 可使用的通用寄存器的编号，按分配时的查找次序排列
+    static const int32_t usableRegNo[maxUsableRegNum];
+
+    /// @brief 对寄存器分配Value，记录位置
+    static RegVariable * intRegVal[PlatformRiscv64::maxRegNum];
+};
@@ -0,0 +1,123 @@
+///
+/// @file CodeGeneratorX86_64.cpp
+/// @brief x86-64(System V AMD64 ABI)的后端处理实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Function.h"
+#include "Module.h"
+#include "PlatformX86_64.h"
+#include "CodeGeneratorX86_64.h"
+#include "InstSelectorX86_64.h"
+#include "OrderedRegisterAllocator.h"
+#include "ILocX86_64.h"
+#include "TimeReport.h"
+
+/// @brief x86-64的汇编伪指令与寄存器
+static const CodeGeneratorAsm64::TargetInfo x86_64Target = {
+    ".globl",
+    ".balign",
+    "@",
+    ".long",
+    "#",
+    16, // 函数入口至少按16字节对齐，.balign按字节数
+    PlatformX86_64::maxArgRegNum,
+    X86_64_SP_REG_NO,
+    X86_64_FP_REG_NO,
+    PlatformX86_64::regName,
+    PlatformX86_64::typeSize,
+    PlatformX86_64::typeAlignment,
+};
+
+/// @brief 构造函数
+/// @param _module 符号表
+CodeGeneratorX86_64::CodeGeneratorX86_64(Module * _module) : CodeGeneratorAsm64(_module, x86_64Target)
+{}
+
+/// @brief 产生汇编头部分
+void CodeGeneratorX86_64::genHeader()
+{
+    // 声明不需要可执行栈，避免链接时的警告
+    fprintf(fp, "%s\n", ".section .note.GNU-stack,\"\",@progbits");
+}
+
+/// @brief 对函数进行指令选择，产生函数体的汇编指令
+/// @param func 要处理的函数，已完成寄存器分配
+/// @param insts 函数体的汇编指令
+void CodeGeneratorX86_64::selectInsts(Function * func, std::string & insts)
+{
+    // ILOC代码序列
+    ILocX86_64 iloc(module);
+
+    // 简单的朴素寄存器分配方法，每个函数单独一个
+    OrderedRegisterAllocator simpleRegisterAllocator(PlatformX86_64::usableRegNo, PlatformX86_64::maxUsableRegNum);
+
+    // 指令选择生成汇编指令
+    {
+        TimeScope scope("InstSelectorX86_64::run", func->getName());
+        InstSelectorX86_64 instSelector(func->getInterCode().getInsts(), iloc, func, simpleRegisterAllocator);
+        instSelector.setShowLinearIR(this->showLinearIR);
+        instSelector.run();
+    }
+
+    // 删除无用的Label指令
+    {
+        TimeScope scope("deleteUnusedLabel", func->getName());
+        iloc.deleteUnusedLabel();
+    }
+
+    TimeScope scope("emit", func->getName());
+
+    // ILOC代码输出为汇编代码
+    OutputStream os(insts);
+    iloc.outPut(os);
+}
+
+/// @brief 寄存器分配
+/// @param func 函数指针
+void CodeGeneratorX86_64::registerAllocation(Function * func)
+{
+    // 内置函数不需要处理
+    if (func->isBuiltin()) {
+        return;
+    }
+
+    // 与ARM32相同采用朴素的寄存器分配：局部变量、形参与临时变量都保存在栈中，
+    // 指令选择时临时加载到调用者保存的rax、rcx、rdx、rsi、rdi、r8-r10中，因此不需要保护rbx与r12-r15
+
+    // System V AMD64 ABI的函数调用约定：
+    // rdi、rsi、rdx、rcx、r8、r9用于传参，rax用于返回值，r10与r11为临时寄存器，都不需要保护
+    // rbx、rbp、r12-r15需要保护，rbp为FP，在入口保存，返回地址由call指令压栈
+    std::vector<int32_t> & protectedRegNo = func->getProtectedReg();
+    protectedRegNo.clear();
+    protectedRegNo.push_back(X86_64_FP_REG_NO);
+
+    // 为局部变量、临时变量以及寄存器传递的形参在栈内分配空间，rbp指向保存的rbp，其上为返回地址。
+    // 采用rsp+非负偏移寻址，压入rbp后rsp已16字节对齐，栈帧大小也按16字节对齐，保证call时rsp 16字节对齐
+    stackAlloc(func);
+
+    // 栈传递的形参通过FP寻址
+    adjustFormalParamInsts(func);
+}
+
+/// @brief 第一个栈传递的形参相对于FP的偏移，位于保存的rbp与返回地址之上
+/// @param func 要处理的函数
+/// @return 偏移
+int64_t CodeGeneratorX86_64::stackParamOffset(Function * func)
+{
+    (void) func;
+    return 16;
+}
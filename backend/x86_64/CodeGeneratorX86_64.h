@@ -0,0 +1,46 @@
+///
+/// @file CodeGeneratorX86_64.h
+/// @brief x86-64(System V AMD64 ABI)的后端处理头文件
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include "CodeGeneratorAsm64.h"
+
+class CodeGeneratorX86_64 : public CodeGeneratorAsm64 {
+
+public:
+    /// @brief 构造函数
+    /// @param module 符号表
+    CodeGeneratorX86_64(Module * module);
+
+    /// @brief 析构函数
+    ~CodeGeneratorX86_64() override = default;
+
+protected:
+    /// @brief 产生汇编头部分
+    void genHeader() override;
+
+    /// @brief 对函数进行指令选择，产生函数体的汇编指令
+    /// @param func 要处理的函数，已完成寄存器分配
+    /// @param insts 函数体的汇编指令
+    void selectInsts(Function * func, std::string & insts) override;
+
+    /// @brief 寄存器分配
+    /// @param func 要处理的函数
+    void registerAllocation(Function * func) override;
+
+    /// @brief 第一个栈传递的形参相对于FP的偏移
+    /// @param func 要处理的函数
+    /// @return 偏移
+    int64_t stackParamOffset(Function * func) override;
+};
@@ -0,0 +1,380 @@
+///
+/// @file ILocX86_64.cpp
+/// @brief x86-64指令序列管理的实现，采用AT&T语法
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <string>
+#include <unordered_set>
+
+#include "ILocX86_64.h"
+#include "Common.h"
+#include "Function.h"
+#include "PlatformX86_64.h"
+#include "Module.h"
+
+X86_64Inst::X86_64Inst(std::string _opcode, std::string _src, std::string _dst)
+    : opcode(_opcode), src(_src), dst(_dst), dead(false)
+{}
+
+/*
+    设置为无效指令
+*/
+void X86_64Inst::setDead()
+{
+    dead = true;
+}
+
+/*
+    输出函数，直接写入输出流
+*/
+bool X86_64Inst::outPut(OutputStream & os)
+{
+    // 无用代码或占位指令，什么都不输出
+    if (dead || opcode.empty()) {
+        return false;
+    }
+
+    os << opcode;
+
+    // 源操作数输出
+    if (!src.empty()) {
+        if (src == ":") {
+            os << src;
+        } else {
+            os << ' ' << src;
+        }
+    }
+
+    // 目的操作数输出
+    if (!dst.empty()) {
+        os << ',' << dst;
+    }
+
+    return true;
+}
+
+#define emit(...) code.push_back(new X86_64Inst(__VA_ARGS__))
+
+/// @brief 构造函数
+/// @param _module 符号表
+ILocX86_64::ILocX86_64(Module * _module)
+{
+    this->module = _module;
+}
+
+/// @brief 析构函数
+ILocX86_64::~ILocX86_64()
+{
+    for (auto inst: code) {
+        delete inst;
+    }
+}
+
+/// @brief 获取寄存器的名字
+/// @param reg_no 寄存器编号
+/// @param wide true：64位名字，false：32位名字
+/// @return 寄存器名字
+std::string ILocX86_64::reg(int reg_no, bool wide)
+{
+    return wide ? PlatformX86_64::regName[reg_no] : PlatformX86_64::dregName[reg_no];
+}
+
+/// @brief 访存的操作数 16(%rsp)
+/// @param base_reg_no 基址寄存器
+/// @param disp 偏移
+/// @return 操作数
+std::string ILocX86_64::mem(int base_reg_no, int64_t disp)
+{
+    std::string str = "(" + PlatformX86_64::regName[base_reg_no] + ")";
+
+    if (disp) {
+        str = std::to_string(disp) + str;
+    }
+
+    return str;
+}
+
+/// @brief 变量作为指令操作数时的字符串，常量为立即数，寄存器变量为寄存器，
+/// 非数组的局部变量与全局变量为内存操作数
+/// @param var 变量
+/// @param str 操作数
+/// @return true：可直接作为操作数，false：需要先加载到寄存器
+bool ILocX86_64::operand(Value * var, std::string & str)
+{
+    int32_t baseRegId;
+    int64_t offset;
+
+    if (Instanceof(constVal, ConstInt *, var)) {
+        // $100
+        str = "$" + std::to_string(constVal->getVal());
+    } else if (var->getRegId() != -1) {
+        // %eax
+        str = reg(var->getRegId(), PlatformX86_64::isWide(var));
+    } else if (var->getType()->isArrayType()) {
+        // 数组需要计算地址
+        return false;
+    } else if (Instanceof(globalVar, GlobalVariable *, var)) {
+        // g(%rip)
+        str = globalVar->getName() + "(%rip)";
+    } else if (var->getMemoryAddr(&baseRegId, &offset)) {
+        // 16(%rsp)
+        str = mem(baseRegId, offset);
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+/// @brief 删除无用的Label指令
+void ILocX86_64::deleteUnusedLabel()
+{
+    // 先收集所有转移语句的目标Label，jmp与jcc的目标都是源操作数
+    std::unordered_set<std::string> usedLabels;
+    for (X86_64Inst * inst: code) {
+        if ((!inst->dead) && (inst->opcode[0] == 'j')) {
+            usedLabels.insert(inst->src);
+        }
+    }
+
+    // 没有跳转到该Label的指令，则设置为dead
+    for (X86_64Inst * inst: code) {
+        if ((!inst->dead) && (inst->opcode[0] == '.') && (inst->src == ":")) {
+            if (usedLabels.find(inst->opcode) == usedLabels.end()) {
+                inst->setDead();
+            }
+        }
+    }
+}
+
+/// @brief 输出汇编到输出流
+/// @param os 输出流
+/// @param outputEmpty 是否输出空语句
+void ILocX86_64::outPut(OutputStream & os, bool outputEmpty)
+{
+    for (auto inst: code) {
+
+        if (inst->src == ":") {
+            // Label指令，不需要Tab输出
+            if (inst->outPut(os)) {
+                os << '\n';
+            }
+            continue;
+        }
+
+        // 除Label指令外的指令前加Tab，空语句时不加
+        if ((!inst->dead) && (!inst->opcode.empty())) {
+            os << '\t';
+            inst->outPut(os);
+            os << '\n';
+        } else if (outputEmpty) {
+            os << '\n';
+        }
+    }
+}
+
+/// @brief 获取当前的代码序列
+/// @return 代码序列
+std::list<X86_64Inst *> & ILocX86_64::getCode()
+{
+    return code;
+}
+
+/**
+ * 数字变立即数，AT&T语法的立即数加$
+ */
+std::string ILocX86_64::toStr(int64_t num)
+{
+    return "$" + std::to_string(num);
+}
+
+/*
+    产生标签
+*/
+void ILocX86_64::label(std::string name)
+{
+    // .L1:
+    emit(name, ":");
+}
+
+/// @brief 一个操作数指令
+/// @param op 操作码
+/// @param rs 操作数
+void ILocX86_64::inst(std::string op, std::string rs)
+{
+    emit(op, rs);
+}
+
+/// @brief 两个操作数指令
+/// @param op 操作码
+/// @param src 源操作数
+/// @param dst 目的操作数
+void ILocX86_64::inst(std::string op, std::string src, std::string dst)
+{
+    emit(op, src, dst);
+}
+
+///
+/// @brief 注释指令，GNU汇编中x86的行注释为#
+///
+void ILocX86_64::comment(std::string str)
+{
+    emit("#", str);
+}
+
+/*
+    加载立即数 movl $100,%eax，写32位寄存器时高32位清零
+*/
+void ILocX86_64::load_imm(int rs_reg_no, int64_t constant)
+{
+    if (constant == 0) {
+        // 异或清零的指令更短
+        emit("xorl", reg(rs_reg_no, false), reg(rs_reg_no, false));
+    } else {
+        emit("movl", toStr(constant), reg(rs_reg_no, false));
+    }
+}
+
+/// @brief 寄存器Mov操作，按64位传送
+/// @param rs_reg_no 结果寄存器
+/// @param src_reg_no 源寄存器
+void ILocX86_64::mov_reg(int rs_reg_no, int src_reg_no)
+{
+    emit("movq", reg(src_reg_no, true), reg(rs_reg_no, true));
+}
+
+/// @brief 加载变量到寄存器，保证将变量放到reg中
+/// @param rs_reg_no 结果寄存器
+/// @param src_var 源操作数
+void ILocX86_64::load_var(int rs_reg_no, Value * src_var)
+{
+    std::string str;
+
+    if (Instanceof(constVal, ConstInt *, src_var)) {
+        // 整型常量
+        load_imm(rs_reg_no, constVal->getVal());
+    } else if (src_var->getRegId() != -1) {
+        // 源操作数为寄存器变量
+        int32_t src_regId = src_var->getRegId();
+        if (src_regId != rs_reg_no) {
+            mov_reg(rs_reg_no, src_regId);
+        }
+    } else if (src_var->getType()->isArrayType()) {
+        // 数组：加载首地址
+        load_var_addr(rs_reg_no, src_var);
+    } else if (operand(src_var, str)) {
+        // 普通变量或指针变量：从内存中加载值，指针为64位
+        // movl 16(%rsp),%eax
+        bool wide = PlatformX86_64::isWide(src_var);
+        emit(wide ? "movq" : "movl", str, reg(rs_reg_no, wide));
+    } else {
+        minic_log(LOG_ERROR, "BUG");
+    }
+}
+
+/// @brief 加载变量地址到寄存器（专门用于数组）
+/// @param rs_reg_no 结果寄存器
+/// @param src_var 源操作数
+void ILocX86_64::load_var_addr(int rs_reg_no, Value * src_var)
+{
+    if (Instanceof(globalVar, GlobalVariable *, src_var)) {
+        // 全局变量地址，采用相对于rip的寻址
+        // leaq g(%rip),%rax
+        emit("leaq", globalVar->getName() + "(%rip)", reg(rs_reg_no, true));
+    } else {
+        lea_var(rs_reg_no, src_var);
+    }
+}
+
+/// @brief 加载变量地址到寄存器
+/// @param rs_reg_no 结果寄存器
+/// @param var 变量
+void ILocX86_64::lea_var(int rs_reg_no, Value * var)
+{
+    // 栈帧偏移
+    int32_t var_baseRegId = -1;
+    int64_t var_offset = -1;
+
+    bool result = var->getMemoryAddr(&var_baseRegId, &var_offset);
+    if (!result) {
+        minic_log(LOG_ERROR, "BUG");
+    }
+
+    // leaq 16(%rsp),%rax
+    emit("leaq", mem(var_baseRegId, var_offset), reg(rs_reg_no, true));
+}
+
+/// @brief 保存寄存器到变量，按变量的类型确定保存的宽度
+/// @param src_reg_no 源寄存器
+/// @param dest_var 变量
+void ILocX86_64::store_var(int src_reg_no, Value * dest_var)
+{
+    // 被保存目标变量肯定不是常量
+    std::string str;
+
+    if (dest_var->getRegId() != -1) {
+
+        // 寄存器变量，寄存器不一样才需要mov操作
+        int dest_reg_id = dest_var->getRegId();
+        if (src_reg_no != dest_reg_id) {
+            mov_reg(dest_reg_id, src_reg_no);
+        }
+
+    } else if (operand(dest_var, str)) {
+
+        // 全局变量或局部变量，内存操作数的偏移为32位，不需要借助寄存器
+        // movl %eax,16(%rsp)
+        bool wide = PlatformX86_64::isWide(dest_var);
+        emit(wide ? "movq" : "movl", reg(src_reg_no, wide), str);
+    } else {
+        minic_log(LOG_ERROR, "BUG");
+    }
+}
+
+/// @brief 函数内栈内空间分配（局部变量、形参变量、函数参数传值，或不能寄存器分配的临时变量等）
+/// @param func 函数
+void ILocX86_64::allocStack(Function * func)
+{
+    // 计算栈帧大小，已按16字节对齐
+    int64_t off = func->getMaxDep();
+
+    // 不需要在栈内额外分配空间，则什么都不做
+    if (0 == off) {
+        return;
+    }
+
+    // subq $16,%rsp
+    emit("subq", toStr(off), "%rsp");
+}
+
+/// @brief 调用函数
+/// @param name 函数名
+void ILocX86_64::call_fun(std::string name)
+{
+    // 函数返回值在eax,不需要保护
+    emit("call", name);
+}
+
+/// @brief NOP操作
+void ILocX86_64::nop()
+{
+    emit("");
+}
+
+///
+/// @brief 无条件跳转指令
+/// @param label 目标Label名称
+///
+void ILocX86_64::jump(std::string label)
+{
+    emit("jmp", label);
+}
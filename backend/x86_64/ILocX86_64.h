@@ -0,0 +1,176 @@
+///
+/// @file ILocX86_64.h
+/// @brief x86-64指令序列管理的头文件，采用AT&T语法
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <string>
+
+#include "Module.h"
+#include "OutputStream.h"
+
+#define Instanceof(res, type, var) auto res = dynamic_cast<type>(var)
+
+/// @brief 底层汇编指令：x86-64，AT&T语法源操作数在前，目的操作数在后
+struct X86_64Inst {
+
+    /// @brief 操作码
+    std::string opcode;
+
+    /// @brief 源操作数，Label指令时为:
+    std::string src;
+
+    /// @brief 目的操作数
+    std::string dst;
+
+    /// @brief 标识指令是否无效
+    bool dead;
+
+    /// @brief 构造函数
+    /// @param op 操作码
+    /// @param s 源操作数
+    /// @param d 目的操作数
+    X86_64Inst(std::string op, std::string s = "", std::string d = "");
+
+    /// @brief 设置死指令
+    void setDead();
+
+    /// @brief 指令直接输出到输出流，不产生临时字符串
+    /// @param os 输出流
+    /// @return true：有输出，false：无用指令或占位指令，没有输出
+    bool outPut(OutputStream & os);
+};
+
+/// @brief 底层汇编序列-x86-64
+class ILocX86_64 {
+
+    /// @brief x86-64汇编序列
+    std::list<X86_64Inst *> code;
+
+    /// @brief 符号表
+    Module * module;
+
+public:
+    /// @brief 构造函数
+    /// @param _module 符号表-模块
+    ILocX86_64(Module * _module);
+
+    /// @brief 析构函数
+    ~ILocX86_64();
+
+    /// @brief 获取寄存器的名字
+    /// @param reg_no 寄存器编号
+    /// @param wide true：64位名字，false：32位名字
+    /// @return 寄存器名字
+    static std::string reg(int reg_no, bool wide);
+
+    /// @brief 访存的操作数 16(%rsp)
+    /// @param base_reg_no 基址寄存器
+    /// @param disp 偏移
+    /// @return 操作数
+    static std::string mem(int base_reg_no, int64_t disp);
+
+    /// @brief 变量作为指令操作数时的字符串，常量为立即数，寄存器变量为寄存器，
+    /// 非数组的局部变量与全局变量为内存操作数
+    /// @param var 变量
+    /// @param str 操作数
+    /// @return true：可直接作为操作数，false：需要先加载到寄存器
+    static bool operand(Value * var, std::string & str);
+
+    ///
+    /// @brief 注释指令
+    /// @param str 注释内容
+    ///
+    void comment(std::string str);
+
+    /// @brief 数字变立即数 $100
+    /// @param num 立即数
+    /// @return 字符串
+    std::string toStr(int64_t num);
+
+    /// @brief 获取当前的代码序列
+    /// @return 代码序列
+    std::list<X86_64Inst *> & getCode();
+
+    /// @brief 加载立即数 movl $100,%eax
+    /// @param rs_reg_no 结果寄存器号
+    /// @param num 立即数
+    void load_imm(int rs_reg_no, int64_t num);
+
+    /// @brief 标签指令
+    /// @param name 标签名
+    void label(std::string name);
+
+    /// @brief 一个操作数指令
+    /// @param op 操作码
+    /// @param rs 操作数
+    void inst(std::string op, std::string rs);
+
+    /// @brief 两个操作数指令
+    /// @param op 操作码
+    /// @param src 源操作数
+    /// @param dst 目的操作数
+    void inst(std::string op, std::string src, std::string dst);
+
+    /// @brief 加载变量到寄存器，指针与数组地址加载到64位寄存器
+    /// @param rs_reg_no 结果寄存器
+    /// @param var 变量
+    void load_var(int rs_reg_no, Value * var);
+
+    /// @brief 加载变量地址到寄存器
+    /// @param rs_reg_no 结果寄存器
+    /// @param var 变量
+    void lea_var(int rs_reg_no, Value * var);
+
+    /// @brief 保存寄存器到变量，按变量的类型确定保存的宽度
+    /// @param src_reg_no 源寄存器号
+    /// @param var 变量
+    void store_var(int src_reg_no, Value * var);
+
+    /// @brief 寄存器Mov操作，按64位传送
+    /// @param rs_reg_no 结果寄存器
+    /// @param src_reg_no 源寄存器
+    void mov_reg(int rs_reg_no, int src_reg_no);
+
+    /// @brief 加载变量地址到寄存器（专门用于数组）
+    /// @param rs_reg_no 结果寄存器
+    /// @param src_var 源操作数
+    void load_var_addr(int rs_reg_no, Value * src_var);
+
+    /// @brief 调用函数
+    /// @param name 函数名
+    void call_fun(std::string name);
+
+    /// @brief 分配栈帧
+    /// @param func 函数
+    void allocStack(Function * func);
+
+    /// @brief NOP操作
+    void nop();
+
+    ///
+    /// @brief 无条件跳转指令
+    /// @param label 目标Label名称
+    ///
+    void jump(std::string label);
+
+    /// @brief 输出汇编到输出流
+    /// @param os 输出流
+    /// @param outputEmpty 是否输出空语句
+    void outPut(OutputStream & os, bool outputEmpty = false);
+
+    /// @brief 删除无用的Label指令
+    void deleteUnusedLabel();
+};
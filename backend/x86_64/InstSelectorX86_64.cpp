@@ -0,0 +1,828 @@
+///
+/// @file InstSelectorX86_64.cpp
+/// @brief 指令选择器-x86-64的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <utility>
+
+#include "Common.h"
+#include "Debug.h"
+#include "ILocX86_64.h"
+#include "InstSelectorX86_64.h"
+#include "PlatformX86_64.h"
+#include "ConstInt.h"
+#include "Function.h"
+
+#include "LabelInstruction.h"
+#include "GotoInstruction.h"
+#include "FuncCallInstruction.h"
+#include "MoveInstruction.h"
+
+/// @brief 构造函数
+/// @param _irCode 指令
+/// @param _iloc ILoc
+/// @param _func 函数
+/// @param allocator 寄存器分配器
+InstSelectorX86_64::InstSelectorX86_64(std::vector<Instruction *> & _irCode,
+                                       ILocX86_64 & _iloc,
+                                       Function * _func,
+                                       OrderedRegisterAllocator & allocator)
+    : ir(_irCode), iloc(_iloc), func(_func), simpleRegisterAllocator(allocator)
+{
+    translator_handlers[IRInstOperator::IRINST_OP_ENTRY] = &InstSelectorX86_64::translate_entry;
+    translator_handlers[IRInstOperator::IRINST_OP_EXIT] = &InstSelectorX86_64::translate_exit;
+
+    translator_handlers[IRInstOperator::IRINST_OP_LABEL] = &InstSelectorX86_64::translate_label;
+    translator_handlers[IRInstOperator::IRINST_OP_GOTO] = &InstSelectorX86_64::translate_goto;
+
+    translator_handlers[IRInstOperator::IRINST_OP_ASSIGN] = &InstSelectorX86_64::translate_assign;
+
+    translator_handlers[IRInstOperator::IRINST_OP_ADD_I] = &InstSelectorX86_64::translate_add_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_SUB_I] = &InstSelectorX86_64::translate_sub_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_MUL_I] = &InstSelectorX86_64::translate_mul_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_DIV_I] = &InstSelectorX86_64::translate_div_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_MOD_I] = &InstSelectorX86_64::translate_mod_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_NEG_I] = &InstSelectorX86_64::translate_neg_int32;
+
+    translator_handlers[IRInstOperator::IRINST_OP_LT_I] = &InstSelectorX86_64::translate_cmp_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_GT_I] = &InstSelectorX86_64::translate_cmp_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_LE_I] = &InstSelectorX86_64::translate_cmp_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_GE_I] = &InstSelectorX86_64::translate_cmp_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_EQ_I] = &InstSelectorX86_64::translate_cmp_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_NE_I] = &InstSelectorX86_64::translate_cmp_int32;
+
+    translator_handlers[IRInstOperator::IRINST_OP_STORE_PTR] = &InstSelectorX86_64::translate_store_ptr;
+    translator_handlers[IRInstOperator::IRINST_OP_LOAD_PTR] = &InstSelectorX86_64::translate_load_ptr;
+    translator_handlers[IRInstOperator::IRINST_OP_ADD_PTR] = &InstSelectorX86_64::translate_add_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_ARRAY_ADDR] = &InstSelectorX86_64::translate_array_addr;
+
+    translator_handlers[IRInstOperator::IRINST_OP_FUNC_CALL] = &InstSelectorX86_64::translate_call;
+    translator_handlers[IRInstOperator::IRINST_OP_ARG] = &InstSelectorX86_64::translate_arg;
+
+    // 栈内布局由栈槽着色给出，这里只在--debug=stack-layout时输出
+    if (_func) {
+        _func->printMemoryLayout();
+    }
+}
+
+/// @brief 指令选择执行
+void InstSelectorX86_64::run()
+{
+    prevInst = nullptr;
+
+    for (size_t k = 0; k < ir.size(); ++k) {
+
+        Instruction * inst = ir[k];
+        if (inst->isDead()) {
+            continue;
+        }
+
+        // 记录下一条有效指令，用于去掉跳转到下一条Label的跳转指令以及相邻指令的合并
+        nextInst = nullptr;
+        for (size_t next = k + 1; next < ir.size(); ++next) {
+            if (!ir[next]->isDead()) {
+                nextInst = ir[next];
+                break;
+            }
+        }
+
+        // 逐个指令进行翻译
+        translate(inst);
+
+        prevInst = inst;
+    }
+}
+
+/// @brief 指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate(Instruction * inst)
+{
+    // 操作符
+    IRInstOperator op = inst->getOp();
+
+    auto pIter = translator_handlers.find(op);
+    if (pIter == translator_handlers.end()) {
+        // 没有找到，则说明当前不支持
+        minic_log(LOG_ERROR, "Translate: Operator(%d) not support", (int) op);
+        return;
+    }
+
+    // 开启时输出IR指令作为注释
+    if (showLinearIR) {
+        outputIRInstruction(inst);
+    }
+
+    (this->*(pIter->second))(inst);
+}
+
+///
+/// @brief 输出IR指令
+///
+void InstSelectorX86_64::outputIRInstruction(Instruction * inst)
+{
+    std::string irStr;
+    inst->toString(irStr);
+    if (!irStr.empty()) {
+        iloc.comment(irStr);
+    }
+}
+
+///
+/// @brief 加载操作数到寄存器，已经是寄存器时直接使用
+/// @param val 操作数
+/// @return 寄存器编号
+///
+int32_t InstSelectorX86_64::loadOperand(Value * val)
+{
+    int32_t reg_no = val->getRegId();
+    if (reg_no == -1) {
+        reg_no = simpleRegisterAllocator.Allocate(val);
+        iloc.load_var(reg_no, val);
+    }
+
+    return reg_no;
+}
+
+///
+/// @brief 获取源操作数，立即数、寄存器与内存操作数直接使用，否则加载到寄存器
+/// @param val 操作数
+/// @return 操作数字符串
+///
+std::string InstSelectorX86_64::srcOperand(Value * val)
+{
+    std::string str;
+    if (!ILocX86_64::operand(val, str)) {
+        str = ILocX86_64::reg(loadOperand(val), PlatformX86_64::isWide(val));
+    }
+
+    return str;
+}
+
+///
+/// @brief 获取保存结果的寄存器，结果不是寄存器时分配一个
+/// @param result 结果
+/// @return 寄存器编号
+///
+int32_t InstSelectorX86_64::resultReg(Value * result)
+{
+    int32_t reg_no = result->getRegId();
+    if (reg_no == -1) {
+        reg_no = simpleRegisterAllocator.Allocate(result);
+    }
+
+    return reg_no;
+}
+
+///
+/// @brief 结果不是寄存器时保存到结果变量中
+/// @param result 结果
+/// @param reg_no 结果所在的寄存器
+///
+void InstSelectorX86_64::storeResult(Value * result, int32_t reg_no)
+{
+    if (result->getRegId() == -1) {
+        iloc.store_var(reg_no, result);
+    }
+}
+
+/// @brief Label指令指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_label(Instruction * inst)
+{
+    Instanceof(labelInst, LabelInstruction *, inst);
+
+    iloc.label(labelName(labelInst));
+}
+
+/// @brief 获取Label在汇编中的名字
+/// @param label Label指令
+/// @return 函数名与Label编号组成的名字
+std::string InstSelectorX86_64::labelName(LabelInstruction * label)
+{
+    return IR_LABEL_PREFIX + func->getName() + "_" + std::to_string(label->getAsmIndex());
+}
+
+///
+/// @brief 判断比较指令能否与紧随其后的条件跳转合并为cmp与jcc，比较结果不需要保存
+/// @param cmpInst 比较指令
+/// @param gotoInst 条件跳转指令
+/// @return true：可以合并，false：不可以
+///
+bool InstSelectorX86_64::isFusedCompare(Instruction * cmpInst, Instruction * gotoInst)
+{
+    switch (cmpInst->getOp()) {
+        case IRInstOperator::IRINST_OP_LT_I:
+        case IRInstOperator::IRINST_OP_GT_I:
+        case IRInstOperator::IRINST_OP_LE_I:
+        case IRInstOperator::IRINST_OP_GE_I:
+        case IRInstOperator::IRINST_OP_EQ_I:
+        case IRInstOperator::IRINST_OP_NE_I:
+            break;
+        default:
+            return false;
+    }
+
+    // 比较结果只被该条件跳转使用，且两条指令相邻，标志位在跳转时没有被改写
+    if ((gotoInst->getOp() != IRInstOperator::IRINST_OP_GOTO) || (gotoInst->getOperandsNum() == 0) ||
+        (gotoInst->getOperand(0) != cmpInst)) {
+        return false;
+    }
+
+    Use * use = cmpInst->getFirstUse();
+
+    return use && (!use->getNextUse()) && (use->getUser() == gotoInst);
+}
+
+///
+/// @brief 比较指令的条件码
+/// @param cmpInst 比较指令
+/// @param invert 是否取反条件
+/// @return 条件码，如l、ge
+///
+std::string InstSelectorX86_64::condCode(Instruction * cmpInst, bool invert)
+{
+    switch (cmpInst->getOp()) {
+        case IRInstOperator::IRINST_OP_LT_I:
+            return invert ? "ge" : "l";
+        case IRInstOperator::IRINST_OP_GT_I:
+            return invert ? "le" : "g";
+        case IRInstOperator::IRINST_OP_LE_I:
+            return invert ? "g" : "le";
+        case IRInstOperator::IRINST_OP_GE_I:
+            return invert ? "l" : "ge";
+        case IRInstOperator::IRINST_OP_EQ_I:
+            return invert ? "ne" : "e";
+        default:
+            return invert ? "e" : "ne";
+    }
+}
+
+///
+/// @brief 比较指令的两个操作数进行比较，设置标志位
+/// @param cmpInst 比较指令
+///
+void InstSelectorX86_64::compare(Instruction * cmpInst)
+{
+    Value * arg1 = cmpInst->getOperand(0);
+    Value * arg2 = cmpInst->getOperand(1);
+
+    bool wide = PlatformX86_64::isWide(arg1) || PlatformX86_64::isWide(arg2);
+    std::string opcode = wide ? "cmpq" : "cmpl";
+
+    // 与立即数比较时第一个操作数可以是内存操作数，否则加载到寄存器，另一个操作数可以是内存操作数
+    std::string arg1Str;
+    if (dynamic_cast<ConstInt *>(arg2) && (!dynamic_cast<ConstInt *>(arg1)) && ILocX86_64::operand(arg1, arg1Str)) {
+        // cmpl $10,16(%rsp)
+        iloc.inst(opcode, srcOperand(arg2), arg1Str);
+    } else {
+        arg1Str = ILocX86_64::reg(loadOperand(arg1), wide);
+
+        // cmpl 16(%rsp),%eax
+        iloc.inst(opcode, srcOperand(arg2), arg1Str);
+    }
+}
+
+/// @brief goto指令指令翻译成x86-64汇编，紧邻的比较与条件跳转合并为cmp与jcc
+/// @param inst IR指令
+void InstSelectorX86_64::translate_goto(Instruction * inst)
+{
+    Instanceof(gotoInst, GotoInstruction *, inst);
+
+    if (gotoInst->getOperandsNum() > 0) {
+
+        Value * condition = gotoInst->getOperand(0);
+        std::string trueLabel = labelName(gotoInst->getTarget());
+        std::string falseLabel = labelName(gotoInst->getFalseTarget());
+
+        // 真出口与假出口的条件码
+        std::string trueCode = "ne";
+        std::string falseCode = "e";
+
+        if (prevInst && (prevInst == condition) && isFusedCompare(prevInst, inst)) {
+
+            // 比较指令没有计算结果，在这里比较并按比较的条件跳转
+            compare(prevInst);
+
+            trueCode = condCode(prevInst, false);
+            falseCode = condCode(prevInst, true);
+
+            simpleRegisterAllocator.free(prevInst->getOperand(0));
+            simpleRegisterAllocator.free(prevInst->getOperand(1));
+        } else {
+
+            // 条件值与0比较，常量需要先加载到寄存器
+            std::string condStr;
+            if (dynamic_cast<ConstInt *>(condition) || (!ILocX86_64::operand(condition, condStr))) {
+                condStr = ILocX86_64::reg(loadOperand(condition), false);
+            }
+
+            // cmpl $0,16(%rsp)
+            iloc.inst("cmpl", iloc.toStr(0), condStr);
+
+            simpleRegisterAllocator.free(condition);
+        }
+
+        if (nextInst == gotoInst->getFalseTarget()) {
+            // 假出口紧随其后，条件满足时跳转到trueLabel即可
+            iloc.inst("j" + trueCode, trueLabel);
+        } else if (nextInst == gotoInst->getTarget()) {
+            // 真出口紧随其后，条件不满足时跳转到falseLabel即可
+            iloc.inst("j" + falseCode, falseLabel);
+        } else {
+            iloc.inst("j" + trueCode, trueLabel);
+            iloc.jump(falseLabel);
+        }
+    } else if (nextInst != gotoInst->getTarget()) {
+        // 无条件跳转，目标紧随其后时顺序执行即可
+        iloc.jump(labelName(gotoInst->getTarget()));
+    }
+}
+
+/// @brief 函数入口指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_entry(Instruction * inst)
+{
+    (void) inst;
+
+    // 保存rbp并建立栈帧，call压入返回地址后再压入rbp，rsp恢复16字节对齐
+    iloc.inst("pushq", "%rbp");
+    iloc.inst("movq", "%rsp", "%rbp");
+
+    // 为fun分配栈帧，含局部变量、形参、函数调用值传递的空间等
+    iloc.allocStack(func);
+
+    // 寄存器传递的形参保存到栈中，函数调用时参数寄存器会被改写
+    auto & params = func->getParams();
+    for (int k = 0; k < (int) params.size() && k < PlatformX86_64::maxArgRegNum; k++) {
+        iloc.store_var(PlatformX86_64::argRegNo[k], params[k]);
+    }
+}
+
+/// @brief 函数出口指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_exit(Instruction * inst)
+{
+    if (inst->getOperandsNum()) {
+        // 存在返回值，赋值给寄存器eax
+        iloc.load_var(X86_64_RAX_REG_NO, inst->getOperand(0));
+    }
+
+    // 恢复rsp与rbp
+    iloc.inst("leave", "");
+
+    iloc.inst("ret", "");
+}
+
+/// @brief 赋值指令翻译成x86-64汇编，含指针读写
+/// @param inst IR指令
+void InstSelectorX86_64::translate_assign(Instruction * inst)
+{
+    Instanceof(moveInst, MoveInstruction *, inst);
+
+    if (moveInst && moveInst->getIsPointerLoad()) {
+        // %l10 = *%l9
+        translate_load_ptr(inst);
+    } else if (moveInst && moveInst->getIsPointerStore()) {
+        // *%l9 = 1
+        translate_store_ptr(inst);
+    } else {
+        translate_move(inst->getOperand(0), inst->getOperand(1));
+    }
+}
+
+/// @brief 把arg1的值传送到result中，供赋值指令及函数调用的传参、取返回值使用
+/// @param result 目的操作数
+/// @param arg1 源操作数
+void InstSelectorX86_64::translate_move(Value * result, Value * arg1)
+{
+    int32_t arg1_regId = arg1->getRegId();
+    int32_t result_regId = result->getRegId();
+
+    std::string resultStr;
+
+    if (arg1_regId != -1) {
+        iloc.store_var(arg1_regId, result);
+    } else if (result_regId != -1) {
+        iloc.load_var(result_regId, arg1);
+    } else if (dynamic_cast<ConstInt *>(arg1) && ILocX86_64::operand(result, resultStr)) {
+        // 常量直接保存到内存中
+        // movl $1,16(%rsp)
+        iloc.inst(PlatformX86_64::isWide(result) ? "movq" : "movl", srcOperand(arg1), resultStr);
+    } else {
+        int32_t temp_regno = simpleRegisterAllocator.Allocate();
+
+        iloc.load_var(temp_regno, arg1);
+        iloc.store_var(temp_regno, result);
+
+        simpleRegisterAllocator.free(temp_regno);
+    }
+}
+
+///
+/// @brief 判断地址计算的偏移是否是乘以1、2、4、8的结果，是则可合并到leaq (%rax,%rcx,4),%rax中
+/// @param addInst 地址计算指令
+/// @param mulInst 乘法指令，是addInst的偏移操作数
+/// @param index 乘法的另一个操作数，即下标
+/// @param scale 比例因子
+/// @return true：可以合并，false：不可以
+///
+bool InstSelectorX86_64::foldScaledIndex(Instruction * addInst, Instruction * mulInst, Value *& index, int32_t & scale)
+{
+    if (mulInst->getOp() != IRInstOperator::IRINST_OP_MUL_I) {
+        return false;
+    }
+
+    Value * other = mulInst->getOperand(0);
+    Instanceof(scaleVal, ConstInt *, mulInst->getOperand(1));
+    if (!scaleVal) {
+        other = mulInst->getOperand(1);
+        scaleVal = dynamic_cast<ConstInt *>(mulInst->getOperand(0));
+    }
+
+    // 下标为常量时整个偏移是常量，不需要合并
+    if ((!scaleVal) || dynamic_cast<ConstInt *>(other)) {
+        return false;
+    }
+
+    // 比例因子只能是1、2、4、8
+    int32_t value = scaleVal->getVal();
+    if ((value != 1) && (value != 2) && (value != 4) && (value != 8)) {
+        return false;
+    }
+
+    // 下标在乘法与地址计算之间不能被改写。临时变量只定义一次，其它变量要求两条指令相邻，
+    // 翻译乘法指令时看下一条指令，翻译地址计算指令时看上一条指令
+    bool adjacent = (prevInst == mulInst) || (nextInst == addInst);
+    if ((!dynamic_cast<Instruction *>(other)) && (!adjacent)) {
+        return false;
+    }
+
+    index = other;
+    scale = value;
+
+    return true;
+}
+
+/// @brief 整数或指针的加减法指令翻译成x86-64汇编，立即数与内存操作数不加载到寄存器
+/// @param inst IR指令
+/// @param isAdd true：加法，false：减法
+void InstSelectorX86_64::translate_add_sub(Instruction * inst, bool isAdd)
+{
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    // 结果为指针时是地址计算，用64位寄存器
+    bool wide = PlatformX86_64::isWide(result);
+
+    // 加法的指针在后时交换，使基址在前
+    if (isAdd && PlatformX86_64::isWide(arg2) && (!PlatformX86_64::isWide(arg1))) {
+        std::swap(arg1, arg2);
+    }
+
+    std::string opcode = std::string(isAdd ? "add" : "sub") + (wide ? "q" : "l");
+
+    // 双操作数指令，第一个操作数先放到结果寄存器中
+    int32_t result_reg_no = resultReg(result);
+    iloc.load_var(result_reg_no, arg1);
+
+    std::string rsReg = ILocX86_64::reg(result_reg_no, wide);
+
+    Instanceof(mulInst, Instruction *, arg2);
+
+    Value * index = arg2;
+    int32_t scale = 1;
+
+    if (wide && (!PlatformX86_64::isWide(arg2)) && (!dynamic_cast<ConstInt *>(arg2))) {
+
+        // 偏移为32位整数，符号扩展后参与地址计算，乘以1、2、4、8的偏移合并为比例变址寻址
+        bool fold = isAdd && mulInst && foldScaledIndex(inst, mulInst, index, scale);
+
+        std::string indexStr = srcOperand(index);
+        int32_t index_reg_no = simpleRegisterAllocator.Allocate(index);
+
+        // movslq 16(%rsp),%rcx
+        iloc.inst("movslq", indexStr, ILocX86_64::reg(index_reg_no, true));
+
+        if (fold) {
+            // leaq (%rax,%rcx,4),%rax
+            iloc.inst("leaq",
+                      "(" + rsReg + "," + ILocX86_64::reg(index_reg_no, true) + "," + std::to_string(scale) + ")",
+                      rsReg);
+        } else {
+            // addq %rcx,%rax
+            iloc.inst(opcode, ILocX86_64::reg(index_reg_no, true), rsReg);
+        }
+    } else {
+        // addl $4,%eax
+        // addl 16(%rsp),%eax
+        iloc.inst(opcode, srcOperand(arg2), rsReg);
+    }
+
+    storeResult(result, result_reg_no);
+
+    // 释放寄存器
+    simpleRegisterAllocator.free(arg1);
+    simpleRegisterAllocator.free(arg2);
+    simpleRegisterAllocator.free(index);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 整数加法指令翻译成x86-64汇编，结果为指针时是地址计算
+/// @param inst IR指令
+void InstSelectorX86_64::translate_add_int32(Instruction * inst)
+{
+    translate_add_sub(inst, true);
+}
+
+/// @brief 整数减法指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_sub_int32(Instruction * inst)
+{
+    translate_add_sub(inst, false);
+}
+
+/// @brief 数组元素地址计算指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_array_addr(Instruction * inst)
+{
+    translate_add_sub(inst, true);
+}
+
+/// @brief 二元操作指令翻译成x86-64汇编，第一个操作数放到结果寄存器中，第二个操作数可以是立即数或内存操作数
+/// @param inst IR指令
+/// @param operator_name 操作码
+void InstSelectorX86_64::translate_two_operator(Instruction * inst, std::string operator_name)
+{
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    int32_t result_reg_no = resultReg(result);
+    iloc.load_var(result_reg_no, arg1);
+
+    // imull 16(%rsp),%eax
+    iloc.inst(operator_name, srcOperand(arg2), ILocX86_64::reg(result_reg_no, false));
+
+    storeResult(result, result_reg_no);
+
+    // 释放寄存器
+    simpleRegisterAllocator.free(arg1);
+    simpleRegisterAllocator.free(arg2);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 整数乘法指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_mul_int32(Instruction * inst)
+{
+    // 结果只被紧随其后或下标不变的地址计算使用时，合并到地址计算的比例变址寻址中，不需要单独计算
+    Use * use = inst->getFirstUse();
+    if (use && (!use->getNextUse())) {
+        Instanceof(user, Instruction *, use->getUser());
+        if (user && (!user->isDead()) && (user->getOp() == IRInstOperator::IRINST_OP_ADD_I) &&
+            PlatformX86_64::isWide(user) && (user->getOperand(1) == inst) &&
+            PlatformX86_64::isWide(user->getOperand(0))) {
+            Value * index;
+            int32_t scale;
+            if (foldScaledIndex(user, inst, index, scale)) {
+                return;
+            }
+        }
+    }
+
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    // 乘以2的幂次用移位实现
+    Instanceof(constArg, ConstInt *, arg2);
+    Value * var = arg1;
+    if (!constArg) {
+        constArg = dynamic_cast<ConstInt *>(arg1);
+        var = arg2;
+    }
+
+    int32_t value = constArg ? constArg->getVal() : 0;
+    if ((value <= 0) || (value & (value - 1)) || dynamic_cast<ConstInt *>(var)) {
+        translate_two_operator(inst, "imull");
+        return;
+    }
+
+    int32_t shift = 0;
+    while ((1 << shift) < value) {
+        shift++;
+    }
+
+    int32_t result_reg_no = resultReg(result);
+    iloc.load_var(result_reg_no, var);
+
+    if (shift > 0) {
+        // shll $2,%eax
+        iloc.inst("shll", iloc.toStr(shift), ILocX86_64::reg(result_reg_no, false));
+    }
+
+    storeResult(result, result_reg_no);
+
+    simpleRegisterAllocator.free(var);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 整数除法或求余指令翻译成x86-64汇编，被除数在edx:eax中，商在eax，余数在edx
+/// @param inst IR指令
+/// @param isDiv true：除法，false：求余
+void InstSelectorX86_64::translate_div_mod(Instruction * inst, bool isDiv)
+{
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    // 强制占用eax与edx，除数不会加载到这两个寄存器中
+    simpleRegisterAllocator.Allocate(X86_64_RAX_REG_NO);
+    simpleRegisterAllocator.Allocate(X86_64_RDX_REG_NO);
+
+    iloc.load_var(X86_64_RAX_REG_NO, arg1);
+
+    // 被除数符号扩展到edx:eax
+    iloc.inst("cltd", "");
+
+    // 除数不能是立即数
+    std::string divisor;
+    if (dynamic_cast<ConstInt *>(arg2) || (!ILocX86_64::operand(arg2, divisor))) {
+        divisor = ILocX86_64::reg(loadOperand(arg2), false);
+    }
+
+    // idivl 16(%rsp)
+    iloc.inst("idivl", divisor);
+
+    iloc.store_var(isDiv ? X86_64_RAX_REG_NO : X86_64_RDX_REG_NO, result);
+
+    simpleRegisterAllocator.free(arg2);
+    simpleRegisterAllocator.free(X86_64_RAX_REG_NO);
+    simpleRegisterAllocator.free(X86_64_RDX_REG_NO);
+}
+
+/// @brief 整数除法指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_div_int32(Instruction * inst)
+{
+    translate_div_mod(inst, true);
+}
+
+/// @brief 整数求余指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_mod_int32(Instruction * inst)
+{
+    translate_div_mod(inst, false);
+}
+
+/// @brief 整数负号指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_neg_int32(Instruction * inst)
+{
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+
+    int32_t result_reg_no = resultReg(result);
+    iloc.load_var(result_reg_no, arg1);
+
+    // negl %eax
+    iloc.inst("negl", ILocX86_64::reg(result_reg_no, false));
+
+    storeResult(result, result_reg_no);
+
+    simpleRegisterAllocator.free(arg1);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 整数关系运算指令翻译成x86-64汇编，条件码由比较的运算符确定
+/// @param inst IR指令
+void InstSelectorX86_64::translate_cmp_int32(Instruction * inst)
+{
+    // 结果只被紧随其后的条件跳转使用时，在条件跳转处比较并跳转
+    if (nextInst && isFusedCompare(inst, nextInst)) {
+        return;
+    }
+
+    Value * result = inst;
+
+    compare(inst);
+
+    // 条件满足时为1，否则为0，setcc只设置低8位
+    int32_t result_reg_no = resultReg(result);
+    iloc.inst("set" + condCode(inst, false), PlatformX86_64::bregName[result_reg_no]);
+    iloc.inst("movzbl", PlatformX86_64::bregName[result_reg_no], ILocX86_64::reg(result_reg_no, false));
+
+    storeResult(result, result_reg_no);
+
+    simpleRegisterAllocator.free(inst->getOperand(0));
+    simpleRegisterAllocator.free(inst->getOperand(1));
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 函数调用指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_call(Instruction * inst)
+{
+    FuncCallInstruction * callInst = dynamic_cast<FuncCallInstruction *>(inst);
+
+    int32_t operandNum = callInst->getOperandsNum();
+
+    // 强制占用参数传递的寄存器，加载栈传递的实参时不会使用
+    for (int32_t k = 0; k < operandNum && k < PlatformX86_64::maxArgRegNum; k++) {
+        simpleRegisterAllocator.Allocate(PlatformX86_64::argRegNo[k]);
+    }
+
+    // System V：前六个参数通过寄存器传递，后面的参数每个占8字节，从rsp开始依次存放
+    for (int32_t k = PlatformX86_64::maxArgRegNum; k < operandNum; k++) {
+
+        auto arg = callInst->getOperand(k);
+
+        // 新建一个内存变量，用于栈传值到形参变量中
+        MemVariable * newVal = func->newMemVariable(arg->getType());
+        newVal->setMemoryAddr(X86_64_SP_REG_NO, (k - PlatformX86_64::maxArgRegNum) * 8);
+
+        translate_move(newVal, arg);
+    }
+
+    for (int32_t k = 0; k < operandNum && k < PlatformX86_64::maxArgRegNum; k++) {
+        translate_move(PlatformX86_64::intRegVal[PlatformX86_64::argRegNo[k]], callInst->getOperand(k));
+    }
+
+    iloc.call_fun(callInst->getName());
+
+    for (int32_t k = 0; k < operandNum && k < PlatformX86_64::maxArgRegNum; k++) {
+        simpleRegisterAllocator.free(PlatformX86_64::argRegNo[k]);
+    }
+
+    // 返回值eax传送到结果变量
+    if (callInst->hasResultValue()) {
+        translate_move(callInst, PlatformX86_64::intRegVal[X86_64_RAX_REG_NO]);
+    }
+}
+
+///
+/// @brief 实参指令翻译成x86-64汇编，实参在函数调用指令中统一处理
+/// @param inst IR指令
+///
+void InstSelectorX86_64::translate_arg(Instruction * inst)
+{
+    (void) inst;
+}
+
+/// @brief 指针存储指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_store_ptr(Instruction * inst)
+{
+    Value * ptrVar = inst->getOperand(0);
+    Value * value = inst->getOperand(1);
+
+    std::string addr = "(" + ILocX86_64::reg(loadOperand(ptrVar), true) + ")";
+    bool wide = PlatformX86_64::isWide(value);
+
+    // 常量直接保存，否则先加载到寄存器
+    std::string valueStr;
+    if (dynamic_cast<ConstInt *>(value)) {
+        valueStr = srcOperand(value);
+    } else {
+        valueStr = ILocX86_64::reg(loadOperand(value), wide);
+    }
+
+    // movl %eax,(%rcx)
+    iloc.inst(wide ? "movq" : "movl", valueStr, addr);
+
+    simpleRegisterAllocator.free(ptrVar);
+    simpleRegisterAllocator.free(value);
+}
+
+/// @brief 指针解引用指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_load_ptr(Instruction * inst)
+{
+    Value * result = inst->getOperand(0);
+    Value * ptrVar = inst->getOperand(1);
+
+    int32_t ptr_reg_no = loadOperand(ptrVar);
+    int32_t result_reg_no = resultReg(result);
+
+    bool wide = PlatformX86_64::isWide(result);
+
+    // movl (%rcx),%eax
+    iloc.inst(wide ? "movq" : "movl",
+              "(" + ILocX86_64::reg(ptr_reg_no, true) + ")",
+              ILocX86_64::reg(result_reg_no, wide));
+
+    storeResult(result, result_reg_no);
+
+    simpleRegisterAllocator.free(ptrVar);
+    simpleRegisterAllocator.free(result);
+}
@@ -0,0 +1,121 @@
+///
+/// @file PlatformX86_64.cpp
+/// @brief x86-64平台相关实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include "PlatformX86_64.h"
+
+#include "IntegerType.h"
+
+// System V AMD64 ABI调用约定下寄存器的用途
+const std::string PlatformX86_64::regName[PlatformX86_64::maxRegNum] = {
+    "%rax", // 返回值，除法的被除数与商，不需要栈保护
+    "%rcx", // 第四个参数，不需要栈保护
+    "%rdx", // 第三个参数，除法的余数，不需要栈保护
+    "%rbx", // 需要栈保护
+    "%rsp", // 堆栈指针寄存器
+    "%rbp", // FP，栈帧寄存器
+    "%rsi", // 第二个参数，不需要栈保护
+    "%rdi", // 第一个参数，不需要栈保护
+    "%r8",  // 第五个参数，不需要栈保护
+    "%r9",  // 第六个参数，不需要栈保护
+    "%r10", // 临时寄存器，不需要栈保护
+    "%r11", // 临时寄存器，立即数或内存操作数过多时借助
+    "%r12", // 需要栈保护
+    "%r13", // 需要栈保护
+    "%r14", // 需要栈保护
+    "%r15", // 需要栈保护
+};
+
+const std::string PlatformX86_64::dregName[PlatformX86_64::maxRegNum] = {
+    "%eax", "%ecx", "%edx", "%ebx", "%esp", "%ebp", "%esi", "%edi",
+    "%r8d", "%r9d", "%r10d", "%r11d", "%r12d", "%r13d", "%r14d", "%r15d",
+};
+
+const std::string PlatformX86_64::bregName[PlatformX86_64::maxRegNum] = {
+    "%al", "%cl", "%dl", "%bl", "%spl", "%bpl", "%sil", "%dil",
+    "%r8b", "%r9b", "%r10b", "%r11b", "%r12b", "%r13b", "%r14b", "%r15b",
+};
+
+// rdi、rsi、rdx、rcx、r8、r9依次传递前六个参数
+const int32_t PlatformX86_64::argRegNo[PlatformX86_64::maxArgRegNum] = {7, 6, 2, 1, 8, 9};
+
+// 先使用不传参的r10与rax，再倒序使用参数寄存器，尽量不占用前面的参数寄存器
+const int32_t PlatformX86_64::usableRegNo[PlatformX86_64::maxUsableRegNum] = {10, 0, 9, 8, 1, 2, 6, 7};
+
+RegVariable * PlatformX86_64::intRegVal[PlatformX86_64::maxRegNum] = {
+    new RegVariable(IntegerType::getTypeInt(), PlatformX86_64::regName[0], 0),
+    new RegVariable(IntegerType::getTypeInt(), PlatformX86_64::regName[1], 1),
+    new RegVariable(IntegerType::getTypeInt(), PlatformX86_64::regName[2], 2),
+    new RegVariable(IntegerType::getTypeInt(), PlatformX86_64::regName[3], 3),
+    new RegVariable(IntegerType::getTypeInt(), PlatformX86_64::regName[4], 4),
+    new RegVariable(IntegerType::getTypeInt(), PlatformX86_64::regName[5], 5),
+    new RegVariable(IntegerType::getTypeInt(), PlatformX86_64::regName[6], 6),
+    new RegVariable(IntegerType::getTypeInt(), PlatformX86_64::regName[7], 7),
+    new RegVariable(IntegerType::getTypeInt(), PlatformX86_64::regName[8], 8),
+    new RegVariable(IntegerType::getTypeInt(), PlatformX86_64::regName[9], 9),
+    new RegVariable(IntegerType::getTypeInt(), PlatformX86_64::regName[10], 10),
+    new RegVariable(IntegerType::getTypeInt(), PlatformX86_64::regName[11], 11),
+    new RegVariable(IntegerType::getTypeInt(), PlatformX86_64::regName[12], 12),
+    new RegVariable(IntegerType::getTypeInt(), PlatformX86_64::regName[13], 13),
+    new RegVariable(IntegerType::getTypeInt(), PlatformX86_64::regName[14], 14),
+    new RegVariable(IntegerType::getTypeInt(), PlatformX86_64::regName[15], 15),
+};
+
+/// @brief 判断是否是合法的寄存器名
+/// @param name 寄存器名字
+/// @return 是否是
+bool PlatformX86_64::isReg(std::string name)
+{
+    for (int k = 0; k < maxRegNum; ++k) {
+        if ((name == regName[k]) || (name == dregName[k]) || (name == bregName[k])) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// @brief 类型在x86-64上占用的字节数，指针为8字节
+/// @param type 类型
+/// @return 字节数
+int32_t PlatformX86_64::typeSize(Type * type)
+{
+    if (type->isPointerType()) {
+        return 8;
+    }
+
+    // 数组元素目前只有int，数组的大小与ARM32相同
+    int32_t size = type->getSize();
+    return (size > 0) ? size : 4;
+}
+
+/// @brief 类型在x86-64上的对齐字节数，指针为8字节
+/// @param type 类型
+/// @return 对齐字节数
+int32_t PlatformX86_64::typeAlignment(Type * type)
+{
+    if (type->isPointerType()) {
+        return 8;
+    }
+
+    int32_t align = type->getAlignment();
+    return (align > 4) ? align : 4;
+}
+
+/// @brief 值是否需要用64位寄存器操作，指针以及数组（取地址）需要64位
+/// @param val 值
+/// @return true：64位，false：32位
+bool PlatformX86_64::isWide(Value * val)
+{
+    return val->getType()->isPointerType() || val->getType()->isArrayType();
+}
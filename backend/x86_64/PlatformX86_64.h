@@ -0,0 +1,86 @@
+///
+/// @file PlatformX86_64.h
+/// @brief x86-64平台相关头文件
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "RegVariable.h"
+
+// 寄存器编号与指令编码一致
+// 返回值寄存器rax，也是除法的被除数与商
+#define X86_64_RAX_REG_NO 0
+
+// 除法的余数寄存器rdx
+#define X86_64_RDX_REG_NO 2
+
+// 栈寄存器SP和FP
+#define X86_64_SP_REG_NO 4
+#define X86_64_FP_REG_NO 5
+
+// 在操作过程中临时借助的寄存器为X86_64_TMP_REG_NO，即r11
+#define X86_64_TMP_REG_NO 11
+
+/// @brief x86-64平台信息
+class PlatformX86_64 {
+
+public:
+    /// @brief 判断是否是合法的寄存器名
+    /// @param name 寄存器名字
+    /// @return 是否是
+    static bool isReg(std::string name);
+
+    /// @brief 类型在x86-64上占用的字节数，指针为8字节
+    /// @param type 类型
+    /// @return 字节数
+    static int32_t typeSize(Type * type);
+
+    /// @brief 类型在x86-64上的对齐字节数，指针为8字节
+    /// @param type 类型
+    /// @return 对齐字节数
+    static int32_t typeAlignment(Type * type);
+
+    /// @brief 值是否需要用64位寄存器操作，指针以及数组（取地址）需要64位
+    /// @param val 值
+    /// @return true：64位，false：32位
+    static bool isWide(Value * val);
+
+    /// @brief 最大寄存器数目，rax-r15
+    static const int maxRegNum = 16;
+
+    /// @brief 可使用的通用寄存器的个数，都是调用者保存的寄存器，函数内使用时不需要保护
+    static const int maxUsableRegNum = 8;
+
+    /// @brief 通过寄存器传递的参数个数rdi、rsi、rdx、rcx、r8、r9
+    static const int maxArgRegNum = 6;
+
+    /// @brief 64位寄存器的名字
+    static const std::string regName[maxRegNum];
+
+    /// @brief 32位寄存器的名字
+    static const std::string dregName[maxRegNum];
+
+    /// @brief 8位寄存器的名字
+    static const std::string bregName[maxRegNum];
+
+    /// @brief 参数寄存器的编号，按参数的次序排列
+    static const int32_t argRegNo[maxArgRegNum];
+
+    /// @brief 可使用的通用寄存器的编号，按分配时的查找次序排列
+    static const int32_t usableRegNo[maxUsableRegNum];
+
+    /// @brief 对寄存器分配Value，记录位置
+    static RegVariable * intRegVal[PlatformX86_64::maxRegNum];
+};
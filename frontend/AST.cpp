@@ -482,6 +482,9 @@ ast_node* create_array_def(ast_node* name_node, const std::vector<ast_node*>& di
     
     // 保存数组名
     array_def_node->name = name_node->name;
+
+    // 记录维度的个数，用于区分维度节点与初始化值节点
+    array_def_node->integer_val = (uint32_t) dims.size();
     
     // 添加数组名节点
     array_def_node->insert_son_node(name_node);
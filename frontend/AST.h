@@ -344,7 +344,7 @@ ast_node * create_var_decl_stmt_node(type_attr & type, var_id_attr & id);
 ast_node * add_var_decl_node(ast_node * stmt_node, var_id_attr & id);
 
 // 添加数组相关操作码-lxg
-/// @brief 创建数组定义节点
+/// @brief 创建数组定义节点，节点的integer_val记录维度的个数
 /// @param name_node 数组名节点
 /// @param dims 维度节点列表
 /// @param init_node 初始化值节点(可选)
@@ -0,0 +1,249 @@
+///
+/// @file IRBinaryFormat.h
+/// @brief 线性IR(DragonIR)二进制格式的常量定义以及变长整数的编解码
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+/// 二进制IR文件的布局如下，除文件头外的整数都采用LEB128变长编码：
+///
+///     文件头：    魔数"DIRB"，4字节小端的格式版本号
+///     字符串表：  个数，每项为长度与内容，全局变量名、函数名、局部变量名等都引用字符串表的下标
+///     类型表：    个数，每项为类型种类以及附加信息，引用的类型必须在前面出现
+///     全局变量表：个数，每项为名字、类型以及初值（个数与ZigZag编码的各元素值，末尾的0不保存，浮点数为位模式）
+///     函数索引：  个数，每项为函数名、返回值类型、形参、函数体相对函数体区的偏移与字节数
+///     函数体区：  各函数体依次存放，可根据函数索引单独解码任意一个函数
+///
+/// 函数体内的Value按编号引用：形参、局部变量、有结果的指令依次编号；Label按出现的顺序另行编号。
+/// 操作数的低2位为种类，整数常量为ZigZag编码的值，浮点常量为单精度的位模式，
+/// 全局变量为全局变量表的下标，其它为函数内的编号
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/// @brief 二进制IR文件的魔数
+#define IR_BINARY_MAGIC "DIRB"
+
+/// @brief 二进制IR的格式版本号，格式变化时必须修改
+#define IR_BINARY_VERSION 3
+
+///
+/// @brief 类型表中的类型种类
+///
+enum class IRBinaryType : uint8_t {
+    VOID,
+    INTEGER,
+    POINTER,
+    ARRAY,
+    FLOAT,
+};
+
+///
+/// @brief 操作数的种类，保存在操作数编码的低2位
+///
+enum class IRBinaryOperand : uint8_t {
+    CONST_INT,
+    GLOBAL,
+    LOCAL,
+    CONST_FLOAT,
+};
+
+///
+/// @brief 二进制格式中的指令编码，与IRInstOperator独立，保证文件格式不随内部枚举的调整而变化
+///
+enum class IRBinaryOp : uint8_t {
+    ENTRY,
+    EXIT,
+    LABEL,
+    GOTO,
+    BRANCH,
+    MOVE,
+    FUNC_CALL,
+    ARG,
+    ADD_I,
+    SUB_I,
+    MUL_I,
+    DIV_I,
+    MOD_I,
+    NEG_I,
+    LT_I,
+    GT_I,
+    LE_I,
+    GE_I,
+    EQ_I,
+    NE_I,
+    ADD_F,
+    SUB_F,
+    MUL_F,
+    DIV_F,
+    NEG_F,
+    LT_F,
+    GT_F,
+    LE_F,
+    GE_F,
+    EQ_F,
+    NE_F,
+    ITOF,
+    FTOI,
+    MAX,
+};
+
+/// @brief MOVE指令的标志位：指针存储
+#define IR_BINARY_MOVE_STORE 0x1
+
+/// @brief MOVE指令的标志位：指针读取
+#define IR_BINARY_MOVE_LOAD 0x2
+
+/// @brief MOVE指令的标志位：数组转换成指针
+#define IR_BINARY_MOVE_ARRAY_TO_POINTER 0x4
+
+///
+/// @brief 无符号整数按LEB128变长编码追加到缓冲区
+/// @param buf 缓冲区
+/// @param value 整数值
+///
+inline void irBinaryPutVarint(std::string & buf, uint64_t value)
+{
+    while (value >= 0x80) {
+        buf.push_back((char) ((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    buf.push_back((char) value);
+}
+
+///
+/// @brief 有符号整数ZigZag编码，使绝对值小的负数也只占少量字节
+/// @param value 整数值
+/// @return 编码后的无符号整数
+///
+inline uint64_t irBinaryZigZag(int64_t value)
+{
+    return ((uint64_t) value << 1) ^ (uint64_t) (value >> 63);
+}
+
+///
+/// @brief ZigZag编码的逆运算
+/// @param value 编码后的无符号整数
+/// @return 整数值
+///
+inline int64_t irBinaryUnZigZag(uint64_t value)
+{
+    return (int64_t) (value >> 1) ^ -(int64_t) (value & 1);
+}
+
+///
+/// @brief 二进制数据的顺序读取，越界或变长整数格式错误时置错误标志，之后的读取都返回0
+///
+class IRBinaryCursor {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _data 数据的起始地址
+    /// @param _size 字节数
+    ///
+    IRBinaryCursor(const uint8_t * _data, size_t _size) : data(_data), end(_data + _size)
+    {}
+
+    ///
+    /// @brief 读取一个字节
+    /// @return 字节值
+    ///
+    uint8_t byte()
+    {
+        if (data >= end) {
+            failed = true;
+            return 0;
+        }
+
+        return *data++;
+    }
+
+    ///
+    /// @brief 读取LEB128变长编码的无符号整数
+    /// @return 整数值
+    ///
+    uint64_t varint()
+    {
+        uint64_t value = 0;
+
+        for (int shift = 0; shift < 64; shift += 7) {
+
+            if (data >= end) {
+                failed = true;
+                return 0;
+            }
+
+            uint8_t b = *data++;
+            value |= (uint64_t) (b & 0x7f) << shift;
+            if (!(b & 0x80)) {
+                return value;
+            }
+        }
+
+        failed = true;
+        return 0;
+    }
+
+    ///
+    /// @brief 读取指定长度的字节串
+    /// @param size 字节数
+    /// @return 字节串
+    ///
+    std::string bytes(size_t size)
+    {
+        if ((size_t) (end - data) < size) {
+            failed = true;
+            data = end;
+            return "";
+        }
+
+        std::string str((const char *) data, size);
+        data += size;
+
+        return str;
+    }
+
+    ///
+    /// @brief 是否读取失败
+    ///
+    [[nodiscard]] bool fail() const
+    {
+        return failed;
+    }
+
+    ///
+    /// @brief 是否已读取完毕
+    ///
+    [[nodiscard]] bool atEnd() const
+    {
+        return data == end;
+    }
+
+    ///
+    /// @brief 当前读取位置
+    ///
+    [[nodiscard]] const uint8_t * position() const
+    {
+        return data;
+    }
+
+private:
+    /// @brief 当前读取位置
+    const uint8_t * data;
+
+    /// @brief 数据的结束位置
+    const uint8_t * end;
+
+    /// @brief 是否读取失败
+    bool failed = false;
+};
@@ -0,0 +1,656 @@
+///
+/// @file IRBinaryReader.cpp
+/// @brief 读取二进制格式的线性IR(DragonIR)的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "IRBinaryReader.h"
+#include "FloatType.h"
+#include "IntegerType.h"
+#include "VoidType.h"
+#include "PointerType.h"
+#include "GlobalVariable.h"
+#include "ArgInstruction.h"
+#include "BinaryInstruction.h"
+#include "EntryInstruction.h"
+#include "ExitInstruction.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "LabelInstruction.h"
+#include "MoveInstruction.h"
+
+namespace {
+
+/// @brief 二进制格式中二元运算、比较运算、求负运算以及类型转换的指令编码到IR操作码的转换
+IRInstOperator toIROp(IRBinaryOp op)
+{
+    switch (op) {
+        case IRBinaryOp::ADD_I:
+            return IRInstOperator::IRINST_OP_ADD_I;
+        case IRBinaryOp::SUB_I:
+            return IRInstOperator::IRINST_OP_SUB_I;
+        case IRBinaryOp::MUL_I:
+            return IRInstOperator::IRINST_OP_MUL_I;
+        case IRBinaryOp::DIV_I:
+            return IRInstOperator::IRINST_OP_DIV_I;
+        case IRBinaryOp::MOD_I:
+            return IRInstOperator::IRINST_OP_MOD_I;
+        case IRBinaryOp::NEG_I:
+            return IRInstOperator::IRINST_OP_NEG_I;
+        case IRBinaryOp::LT_I:
+            return IRInstOperator::IRINST_OP_LT_I;
+        case IRBinaryOp::GT_I:
+            return IRInstOperator::IRINST_OP_GT_I;
+        case IRBinaryOp::LE_I:
+            return IRInstOperator::IRINST_OP_LE_I;
+        case IRBinaryOp::GE_I:
+            return IRInstOperator::IRINST_OP_GE_I;
+        case IRBinaryOp::EQ_I:
+            return IRInstOperator::IRINST_OP_EQ_I;
+        case IRBinaryOp::NE_I:
+            return IRInstOperator::IRINST_OP_NE_I;
+        case IRBinaryOp::ADD_F:
+            return IRInstOperator::IRINST_OP_ADD_F;
+        case IRBinaryOp::SUB_F:
+            return IRInstOperator::IRINST_OP_SUB_F;
+        case IRBinaryOp::MUL_F:
+            return IRInstOperator::IRINST_OP_MUL_F;
+        case IRBinaryOp::DIV_F:
+            return IRInstOperator::IRINST_OP_DIV_F;
+        case IRBinaryOp::NEG_F:
+            return IRInstOperator::IRINST_OP_NEG_F;
+        case IRBinaryOp::LT_F:
+            return IRInstOperator::IRINST_OP_LT_F;
+        case IRBinaryOp::GT_F:
+            return IRInstOperator::IRINST_OP_GT_F;
+        case IRBinaryOp::LE_F:
+            return IRInstOperator::IRINST_OP_LE_F;
+        case IRBinaryOp::GE_F:
+            return IRInstOperator::IRINST_OP_GE_F;
+        case IRBinaryOp::EQ_F:
+            return IRInstOperator::IRINST_OP_EQ_F;
+        case IRBinaryOp::NE_F:
+            return IRInstOperator::IRINST_OP_NE_F;
+        case IRBinaryOp::ITOF:
+            return IRInstOperator::IRINST_OP_ITOF;
+        case IRBinaryOp::FTOI:
+            return IRInstOperator::IRINST_OP_FTOI;
+        default:
+            return IRInstOperator::IRINST_OP_MAX;
+    }
+}
+
+} // namespace
+
+/// @brief 构造函数
+/// @param _fileName 二进制IR文件名
+/// @param _module 要填充的模块
+IRBinaryReader::IRBinaryReader(const std::string & _fileName, Module * _module) : fileName(_fileName), module(_module)
+{}
+
+/// @brief 析构函数，解除文件的映射
+IRBinaryReader::~IRBinaryReader()
+{
+#ifndef _WIN32
+    if (mapped) {
+        munmap(const_cast<uint8_t *>(data), size);
+    }
+#endif
+}
+
+/// @brief 检查文件是否是二进制IR文件，根据文件头的魔数判断
+/// @param fileName 文件名
+/// @return true：是，false：不是或者文件打开失败
+bool IRBinaryReader::isBinaryFile(const std::string & fileName)
+{
+    FILE * fp = fopen(fileName.c_str(), "rb");
+    if (!fp) {
+        return false;
+    }
+
+    char magic[4];
+    bool result = (fread(magic, 1, sizeof(magic), fp) == sizeof(magic)) && (memcmp(magic, IR_BINARY_MAGIC, 4) == 0);
+
+    fclose(fp);
+
+    return result;
+}
+
+/// @brief 文件映射到内存
+/// @return true：成功，false：失败
+bool IRBinaryReader::mapFile()
+{
+#ifndef _WIN32
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) {
+        setLastError("IR文件(" + fileName + ")打开失败");
+        return false;
+    }
+
+    struct stat st;
+    if ((fstat(fd, &st) == 0) && (st.st_size > 0)) {
+        void * addr = mmap(nullptr, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED) {
+            data = static_cast<const uint8_t *>(addr);
+            size = (size_t) st.st_size;
+            mapped = true;
+        }
+    }
+
+    close(fd);
+
+    if (mapped) {
+        return true;
+    }
+#endif
+
+    // 不能映射时读取整个文件
+    FILE * fp = fopen(fileName.c_str(), "rb");
+    if (!fp) {
+        setLastError("IR文件(" + fileName + ")打开失败");
+        return false;
+    }
+
+    char buf[8192];
+    size_t len;
+    while ((len = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        content.append(buf, len);
+    }
+    fclose(fp);
+
+    data = reinterpret_cast<const uint8_t *>(content.data());
+    size = content.size();
+
+    return true;
+}
+
+/// @brief 读取二进制IR文件并重建模块
+/// @param lazy true：函数体延迟到materialize时解码，false：立即解码所有函数体
+/// @return true：成功，false：失败
+bool IRBinaryReader::run(bool lazy)
+{
+    if (!mapFile()) {
+        return false;
+    }
+
+    if ((size < 8) || (memcmp(data, IR_BINARY_MAGIC, 4) != 0)) {
+        setLastError(fileName + ": 不是二进制IR文件");
+        return false;
+    }
+
+    uint32_t version = (uint32_t) data[4] | ((uint32_t) data[5] << 8) | ((uint32_t) data[6] << 16) |
+                       ((uint32_t) data[7] << 24);
+    if (version != IR_BINARY_VERSION) {
+        setLastError(fileName + ": 不支持的二进制IR版本" + std::to_string(version));
+        return false;
+    }
+
+    IRBinaryCursor cursor(data + 8, size - 8);
+    if (!readHeader(cursor)) {
+        return false;
+    }
+
+    return lazy ? true : materializeAll();
+}
+
+/// @brief 根据下标获取类型
+/// @param index 类型表的下标
+/// @return 类型，下标越界时为空
+Type * IRBinaryReader::getType(uint64_t index)
+{
+    return index < types.size() ? types[index] : nullptr;
+}
+
+/// @brief 根据下标获取字符串
+/// @param index 字符串表的下标
+/// @param str 字符串
+/// @return true：成功，false：下标越界
+bool IRBinaryReader::getString(uint64_t index, std::string & str)
+{
+    if (index >= strings.size()) {
+        return false;
+    }
+
+    str = strings[index];
+    return true;
+}
+
+/// @brief 读取字符串表、类型表、全局变量表以及函数索引
+/// @param cursor 读取位置
+/// @return true：成功，false：失败
+bool IRBinaryReader::readHeader(IRBinaryCursor & cursor)
+{
+    // 字符串表，每项的长度至少占1字节，个数超过剩余字节数说明文件已损坏
+    uint64_t count = cursor.varint();
+    if (count > size) {
+        setLastError(fileName + ": 字符串表格式错误");
+        return false;
+    }
+    strings.reserve(count);
+    for (uint64_t k = 0; k < count && !cursor.fail(); ++k) {
+        strings.push_back(cursor.bytes(cursor.varint()));
+    }
+
+    // 类型表，引用的类型必须在前面出现
+    count = cursor.varint();
+    if (count > size) {
+        setLastError(fileName + ": 类型表格式错误");
+        return false;
+    }
+    for (uint64_t k = 0; k < count && !cursor.fail(); ++k) {
+
+        Type * type = nullptr;
+
+        switch ((IRBinaryType) cursor.byte()) {
+            case IRBinaryType::VOID:
+                type = VoidType::getType();
+                break;
+            case IRBinaryType::INTEGER: {
+                uint64_t bitWidth = cursor.varint();
+                if (bitWidth == 1) {
+                    type = IntegerType::getTypeBool();
+                } else if (bitWidth == 32) {
+                    type = IntegerType::getTypeInt();
+                }
+                break;
+            }
+            case IRBinaryType::FLOAT:
+                type = FloatType::getTypeFloat();
+                break;
+            case IRBinaryType::POINTER: {
+                Type * pointee = getType(cursor.varint());
+                if (pointee) {
+                    type = const_cast<Type *>(static_cast<const Type *>(PointerType::get(pointee)));
+                }
+                break;
+            }
+            case IRBinaryType::ARRAY: {
+                Type * elemType = getType(cursor.varint());
+                uint64_t dimCount = cursor.varint();
+                std::vector<int> dims;
+                for (uint64_t d = 0; d < dimCount && !cursor.fail(); ++d) {
+                    dims.push_back((int) cursor.varint());
+                }
+                if (elemType && !dims.empty()) {
+                    type = ArrayType::get(elemType, dims);
+                }
+                break;
+            }
+            default:
+                break;
+        }
+
+        if (!type) {
+            setLastError(fileName + ": 类型表中第" + std::to_string(k) + "项格式错误");
+            return false;
+        }
+
+        types.push_back(type);
+    }
+
+    // 全局变量表
+    count = cursor.varint();
+    for (uint64_t k = 0; k < count && !cursor.fail(); ++k) {
+
+        std::string name;
+        if (!getString(cursor.varint(), name)) {
+            setLastError(fileName + ": 全局变量名格式错误");
+            return false;
+        }
+
+        Type * type = getType(cursor.varint());
+        if (!type) {
+            setLastError(fileName + ": 全局变量" + name + "的类型格式错误");
+            return false;
+        }
+
+        // 函数外创建的变量为全局变量
+        Value * var = module->newVarValue(type, name);
+        if (!var) {
+            setLastError(fileName + ": 全局变量创建失败：" + name);
+            return false;
+        }
+
+        // 初值，末尾为0的元素不保存
+        uint64_t initCount = cursor.varint();
+        if (initCount > (uint64_t) std::max(1, type->getSize() / 4)) {
+            setLastError(fileName + ": 全局变量" + name + "的初值个数格式错误");
+            return false;
+        }
+
+        std::vector<int32_t> initValues;
+        for (uint64_t j = 0; j < initCount; ++j) {
+            initValues.push_back((int32_t) irBinaryUnZigZag(cursor.varint()));
+        }
+        static_cast<GlobalVariable *>(var)->setInitValues(initValues);
+
+        globals.push_back(var);
+    }
+
+    // 函数索引，先创建所有的函数，函数体可以调用后面定义的函数
+    std::vector<std::pair<Function *, std::pair<uint64_t, uint64_t>>> funcs;
+
+    count = cursor.varint();
+    for (uint64_t k = 0; k < count && !cursor.fail(); ++k) {
+
+        std::string name;
+        Type * returnType = nullptr;
+        if (!getString(cursor.varint(), name) || !(returnType = getType(cursor.varint()))) {
+            setLastError(fileName + ": 函数索引格式错误");
+            return false;
+        }
+
+        std::vector<FormalParam *> params;
+        uint64_t paramCount = cursor.varint();
+        for (uint64_t p = 0; p < paramCount && !cursor.fail(); ++p) {
+            Type * paramType = getType(cursor.varint());
+            std::string paramName;
+            if (!paramType || !getString(cursor.varint(), paramName)) {
+                setLastError(fileName + ": 函数" + name + "的形参格式错误");
+                return false;
+            }
+            params.push_back(new FormalParam{paramType, paramName});
+        }
+
+        uint64_t offset = cursor.varint();
+        uint64_t bodySize = cursor.varint();
+
+        if (module->findFunction(name)) {
+            setLastError(fileName + ": 函数重复定义：" + name);
+            return false;
+        }
+
+        Function * func = module->newFunction(name, returnType, params);
+        if (!func) {
+            setLastError(fileName + ": 函数创建失败：" + name);
+            return false;
+        }
+
+        funcs.emplace_back(func, std::make_pair(offset, bodySize));
+    }
+
+    if (cursor.fail()) {
+        setLastError(fileName + ": 文件头格式错误");
+        return false;
+    }
+
+    // 函数体区紧跟在函数索引之后
+    bodyBase = cursor.position();
+    size_t bodyAreaSize = size - (size_t) (bodyBase - data);
+
+    for (auto & item: funcs) {
+        uint64_t offset = item.second.first;
+        uint64_t bodySize = item.second.second;
+        if ((offset > bodyAreaSize) || (bodySize > bodyAreaSize - offset)) {
+            setLastError(fileName + ": 函数" + item.first->getName() + "的函数体超出文件范围");
+            return false;
+        }
+        pending[item.first] = {(size_t) offset, (size_t) bodySize};
+    }
+
+    return true;
+}
+
+/// @brief 解码一个函数的函数体，已解码的函数直接返回成功
+/// @param func 函数
+/// @return true：成功，false：失败
+bool IRBinaryReader::materialize(Function * func)
+{
+    auto pIter = pending.find(func);
+    if (pIter == pending.end()) {
+        return true;
+    }
+
+    IRBinaryCursor cursor(bodyBase + pIter->second.first, pIter->second.second);
+    pending.erase(pIter);
+
+    if (!readFunctionBody(func, cursor)) {
+        return false;
+    }
+
+    return true;
+}
+
+/// @brief 解码所有尚未解码的函数体
+/// @return true：成功，false：失败
+bool IRBinaryReader::materializeAll()
+{
+    // 按模块中函数的顺序解码，保证每次重建的结果相同
+    for (auto func: module->getFunctionList()) {
+        if (!materialize(func)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// @brief 解码一个操作数
+/// @param cursor 读取位置
+/// @return 操作数，失败时为空
+Value * IRBinaryReader::readOperand(IRBinaryCursor & cursor)
+{
+    uint64_t value = cursor.varint();
+    uint64_t index = value >> 2;
+
+    switch ((IRBinaryOperand) (value & 0x3)) {
+        case IRBinaryOperand::CONST_INT:
+            return module->newConstInt((int32_t) irBinaryUnZigZag(index));
+        case IRBinaryOperand::GLOBAL:
+            return index < globals.size() ? globals[index] : nullptr;
+        case IRBinaryOperand::LOCAL:
+            return index < locals.size() ? locals[index] : nullptr;
+        case IRBinaryOperand::CONST_FLOAT:
+            return index <= UINT32_MAX ? module->newConstFloatBits((int32_t) (uint32_t) index) : nullptr;
+        default:
+            return nullptr;
+    }
+}
+
+/// @brief 解码函数体
+/// @param func 函数
+/// @param cursor 函数体的数据
+/// @return true：成功，false：失败
+bool IRBinaryReader::readFunctionBody(Function * func, IRBinaryCursor & cursor)
+{
+    std::string error = fileName + ": 函数" + func->getName() + "的函数体格式错误";
+
+    locals.assign(func->getParams().begin(), func->getParams().end());
+
+    // 局部变量
+    uint64_t count = cursor.varint();
+    for (uint64_t k = 0; k < count && !cursor.fail(); ++k) {
+        Type * type = getType(cursor.varint());
+        std::string name;
+        if (!type || !getString(cursor.varint(), name)) {
+            setLastError(error);
+            return false;
+        }
+        int32_t scopeLevel = (int32_t) irBinaryUnZigZag(cursor.varint());
+
+        locals.push_back(func->newLocalVarValue(type, name, scopeLevel));
+    }
+
+    // Label先全部创建，跳转指令可以引用后面的Label
+    uint64_t labelCount = cursor.varint();
+    if (labelCount > size) {
+        setLastError(error);
+        return false;
+    }
+    std::vector<LabelInstruction *> labels;
+    for (uint64_t k = 0; k < labelCount; ++k) {
+        labels.push_back(new LabelInstruction(func));
+    }
+    size_t nextLabel = 0;
+
+    // 出口Label与返回值变量，0表示没有，其它为编号加1
+    uint64_t exitLabel = cursor.varint();
+    uint64_t returnValue = cursor.varint();
+    if (exitLabel > labelCount) {
+        setLastError(error);
+        return false;
+    }
+    if (exitLabel > 0) {
+        func->setExitLabel(labels[exitLabel - 1]);
+    }
+    if (returnValue > 0) {
+        Value * val = returnValue <= locals.size() ? locals[returnValue - 1] : nullptr;
+        Instanceof(retVal, LocalVariable *, val);
+        if (!retVal) {
+            setLastError(error);
+            return false;
+        }
+        func->setReturnValue(retVal);
+    }
+
+    func->setExistFuncCall(cursor.varint() != 0);
+    func->setMaxFuncCallArgCnt((int) cursor.varint());
+
+    InterCode & irCode = func->getInterCode();
+
+    count = cursor.varint();
+    for (uint64_t k = 0; k < count && !cursor.fail(); ++k) {
+
+        IRBinaryOp op = (IRBinaryOp) cursor.byte();
+        Instruction * inst = nullptr;
+
+        switch (op) {
+            case IRBinaryOp::ENTRY:
+                inst = new EntryInstruction(func);
+                break;
+
+            case IRBinaryOp::EXIT: {
+                Value * result = nullptr;
+                if (cursor.varint() > 0) {
+                    result = readOperand(cursor);
+                    if (!result) {
+                        break;
+                    }
+                }
+                inst = new ExitInstruction(func, result);
+                break;
+            }
+
+            case IRBinaryOp::LABEL:
+                if (nextLabel < labels.size()) {
+                    inst = labels[nextLabel++];
+                }
+                break;
+
+            case IRBinaryOp::GOTO: {
+                uint64_t target = cursor.varint();
+                if (target < labelCount) {
+                    inst = new GotoInstruction(func, labels[target]);
+                }
+                break;
+            }
+
+            case IRBinaryOp::BRANCH: {
+                Value * cond = readOperand(cursor);
+                uint64_t trueTarget = cursor.varint();
+                uint64_t falseTarget = cursor.varint();
+                if (cond && (trueTarget < labelCount) && (falseTarget < labelCount)) {
+                    inst = new GotoInstruction(func, cond, labels[trueTarget], labels[falseTarget]);
+                }
+                break;
+            }
+
+            case IRBinaryOp::MOVE: {
+                uint64_t flags = cursor.varint();
+                Value * dst = readOperand(cursor);
+                Value * src = readOperand(cursor);
+                if (dst && src) {
+                    auto * moveInst = new MoveInstruction(func, dst, src);
+                    moveInst->setIsPointerStore(flags & IR_BINARY_MOVE_STORE);
+                    moveInst->setIsPointerLoad(flags & IR_BINARY_MOVE_LOAD);
+                    moveInst->setIsArrayToPointer(flags & IR_BINARY_MOVE_ARRAY_TO_POINTER);
+                    inst = moveInst;
+                }
+                break;
+            }
+
+            case IRBinaryOp::FUNC_CALL: {
+                Type * type = getType(cursor.varint());
+                std::string name;
+                Function * calledFunc = getString(cursor.varint(), name) ? module->findFunction(name) : nullptr;
+                uint64_t argCount = cursor.varint();
+
+                std::vector<Value *> args;
+                for (uint64_t a = 0; a < argCount && !cursor.fail(); ++a) {
+                    Value * arg = readOperand(cursor);
+                    if (!arg) {
+                        break;
+                    }
+                    args.push_back(arg);
+                }
+
+                if (type && calledFunc && (args.size() == argCount)) {
+                    inst = new FuncCallInstruction(func, calledFunc, args, type);
+                }
+                break;
+            }
+
+            case IRBinaryOp::ARG: {
+                Value * src = readOperand(cursor);
+                if (src) {
+                    inst = new ArgInstruction(func, src);
+                }
+                break;
+            }
+
+            default: {
+                // 二元运算、比较运算、求负运算以及类型转换
+                IRInstOperator irOp = toIROp(op);
+                if (irOp == IRInstOperator::IRINST_OP_MAX) {
+                    break;
+                }
+
+                bool unary = BinaryInstruction::isUnaryOp(irOp);
+                Type * type = getType(cursor.varint());
+                Value * src1 = readOperand(cursor);
+                Value * src2 = unary ? nullptr : readOperand(cursor);
+                if (type && src1 && (unary || src2)) {
+                    inst = new BinaryInstruction(func, irOp, src1, src2, type);
+                }
+                break;
+            }
+        }
+
+        if (!inst || cursor.fail()) {
+            setLastError(error + "，第" + std::to_string(k) + "条指令错误");
+            return false;
+        }
+
+        irCode.addInst(inst);
+
+        if (inst->hasResultValue()) {
+            locals.push_back(inst);
+        }
+    }
+
+    if (cursor.fail() || !cursor.atEnd() || (nextLabel != labels.size())) {
+        setLastError(error);
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,144 @@
+///
+/// @file IRBinaryReader.h
+/// @brief 读取二进制格式的线性IR(DragonIR)，重建Module、Function以及IR指令
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Module.h"
+#include "IRBinaryFormat.h"
+
+///
+/// @brief 二进制IR的读取，格式见IRBinaryFormat.h。文件通过mmap映射到内存，
+/// 先读取字符串表、类型表、全局变量与函数索引，创建所有的全局变量与函数；
+/// 函数体可立即全部解码，也可以延迟到需要时通过materialize逐个解码。
+/// 延迟解码时读取器必须在所有函数解码完成前保持有效
+///
+class IRBinaryReader {
+
+public:
+    /// @brief 构造函数
+    /// @param _fileName 二进制IR文件名
+    /// @param _module 要填充的模块
+    IRBinaryReader(const std::string & _fileName, Module * _module);
+
+    /// @brief 析构函数，解除文件的映射
+    ~IRBinaryReader();
+
+    IRBinaryReader(const IRBinaryReader &) = delete;
+    IRBinaryReader & operator=(const IRBinaryReader &) = delete;
+
+    /// @brief 检查文件是否是二进制IR文件，根据文件头的魔数判断
+    /// @param fileName 文件名
+    /// @return true：是，false：不是或者文件打开失败
+    static bool isBinaryFile(const std::string & fileName);
+
+    /// @brief 读取二进制IR文件并重建模块
+    /// @param lazy true：函数体延迟到materialize时解码，false：立即解码所有函数体
+    /// @return true：成功，false：失败
+    bool run(bool lazy = false);
+
+    /// @brief 解码一个函数的函数体，已解码的函数直接返回成功
+    /// @param func 函数
+    /// @return true：成功，false：失败
+    bool materialize(Function * func);
+
+    /// @brief 解码所有尚未解码的函数体
+    /// @return true：成功，false：失败
+    bool materializeAll();
+
+    void setLastError(const std::string & error)
+    {
+        lastError = error;
+    }
+    std::string getLastError() const
+    {
+        return lastError;
+    }
+
+protected:
+    /// @brief 文件映射到内存
+    /// @return true：成功，false：失败
+    bool mapFile();
+
+    /// @brief 读取字符串表、类型表、全局变量表以及函数索引
+    /// @param cursor 读取位置
+    /// @return true：成功，false：失败
+    bool readHeader(IRBinaryCursor & cursor);
+
+    /// @brief 解码函数体
+    /// @param func 函数
+    /// @param cursor 函数体的数据
+    /// @return true：成功，false：失败
+    bool readFunctionBody(Function * func, IRBinaryCursor & cursor);
+
+    /// @brief 根据下标获取类型
+    /// @param index 类型表的下标
+    /// @return 类型，下标越界时为空
+    Type * getType(uint64_t index);
+
+    /// @brief 根据下标获取字符串
+    /// @param index 字符串表的下标
+    /// @param str 字符串
+    /// @return true：成功，false：下标越界
+    bool getString(uint64_t index, std::string & str);
+
+    /// @brief 解码一个操作数
+    /// @param cursor 读取位置
+    /// @return 操作数，失败时为空
+    Value * readOperand(IRBinaryCursor & cursor);
+
+private:
+    /// @brief 二进制IR文件名
+    std::string fileName;
+
+    /// @brief 要填充的模块
+    Module * module;
+
+    /// @brief 文件内容的起始地址
+    const uint8_t * data = nullptr;
+
+    /// @brief 文件的字节数
+    size_t size = 0;
+
+    /// @brief 是否通过mmap映射，否则内容读取到content中
+    bool mapped = false;
+
+    /// @brief 不能映射时读取的文件内容
+    std::string content;
+
+    /// @brief 函数体区的起始地址
+    const uint8_t * bodyBase = nullptr;
+
+    /// @brief 字符串表
+    std::vector<std::string> strings;
+
+    /// @brief 类型表
+    std::vector<Type *> types;
+
+    /// @brief 全局变量表
+    std::vector<Value *> globals;
+
+    /// @brief 尚未解码的函数体在函数体区中的偏移与字节数
+    std::unordered_map<Function *, std::pair<size_t, size_t>> pending;
+
+    /// @brief 当前函数内按编号排列的形参、局部变量与有结果的指令
+    std::vector<Value *> locals;
+
+    /// @brief 错误信息
+    std::string lastError;
+};
@@ -0,0 +1,551 @@
+///
+/// @file IRBinaryWriter.cpp
+/// @brief 线性IR(DragonIR)按二进制格式输出的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <cstdio>
+
+#include "IRBinaryWriter.h"
+#include "IRBinaryFormat.h"
+#include "ConstFloat.h"
+#include "ConstInt.h"
+#include "IntegerType.h"
+#include "PointerType.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "MoveInstruction.h"
+
+namespace {
+
+/// @brief IR操作码到二进制格式指令编码的转换，不支持的指令返回IRBinaryOp::MAX
+IRBinaryOp toBinaryOp(Instruction * inst)
+{
+    switch (inst->getOp()) {
+        case IRInstOperator::IRINST_OP_ENTRY:
+            return IRBinaryOp::ENTRY;
+        case IRInstOperator::IRINST_OP_EXIT:
+            return IRBinaryOp::EXIT;
+        case IRInstOperator::IRINST_OP_LABEL:
+            return IRBinaryOp::LABEL;
+        case IRInstOperator::IRINST_OP_GOTO:
+            return static_cast<GotoInstruction *>(inst)->getFalseTarget() ? IRBinaryOp::BRANCH : IRBinaryOp::GOTO;
+        case IRInstOperator::IRINST_OP_ASSIGN:
+            return IRBinaryOp::MOVE;
+        case IRInstOperator::IRINST_OP_FUNC_CALL:
+            return IRBinaryOp::FUNC_CALL;
+        case IRInstOperator::IRINST_OP_ARG:
+            return IRBinaryOp::ARG;
+        case IRInstOperator::IRINST_OP_ADD_I:
+            return IRBinaryOp::ADD_I;
+        case IRInstOperator::IRINST_OP_SUB_I:
+            return IRBinaryOp::SUB_I;
+        case IRInstOperator::IRINST_OP_MUL_I:
+            return IRBinaryOp::MUL_I;
+        case IRInstOperator::IRINST_OP_DIV_I:
+            return IRBinaryOp::DIV_I;
+        case IRInstOperator::IRINST_OP_MOD_I:
+            return IRBinaryOp::MOD_I;
+        case IRInstOperator::IRINST_OP_NEG_I:
+            return IRBinaryOp::NEG_I;
+        case IRInstOperator::IRINST_OP_LT_I:
+            return IRBinaryOp::LT_I;
+        case IRInstOperator::IRINST_OP_GT_I:
+            return IRBinaryOp::GT_I;
+        case IRInstOperator::IRINST_OP_LE_I:
+            return IRBinaryOp::LE_I;
+        case IRInstOperator::IRINST_OP_GE_I:
+            return IRBinaryOp::GE_I;
+        case IRInstOperator::IRINST_OP_EQ_I:
+            return IRBinaryOp::EQ_I;
+        case IRInstOperator::IRINST_OP_NE_I:
+            return IRBinaryOp::NE_I;
+        case IRInstOperator::IRINST_OP_ADD_F:
+            return IRBinaryOp::ADD_F;
+        case IRInstOperator::IRINST_OP_SUB_F:
+            return IRBinaryOp::SUB_F;
+        case IRInstOperator::IRINST_OP_MUL_F:
+            return IRBinaryOp::MUL_F;
+        case IRInstOperator::IRINST_OP_DIV_F:
+            return IRBinaryOp::DIV_F;
+        case IRInstOperator::IRINST_OP_NEG_F:
+            return IRBinaryOp::NEG_F;
+        case IRInstOperator::IRINST_OP_LT_F:
+            return IRBinaryOp::LT_F;
+        case IRInstOperator::IRINST_OP_GT_F:
+            return IRBinaryOp::GT_F;
+        case IRInstOperator::IRINST_OP_LE_F:
+            return IRBinaryOp::LE_F;
+        case IRInstOperator::IRINST_OP_GE_F:
+            return IRBinaryOp::GE_F;
+        case IRInstOperator::IRINST_OP_EQ_F:
+            return IRBinaryOp::EQ_F;
+        case IRInstOperator::IRINST_OP_NE_F:
+            return IRBinaryOp::NE_F;
+        case IRInstOperator::IRINST_OP_ITOF:
+            return IRBinaryOp::ITOF;
+        case IRInstOperator::IRINST_OP_FTOI:
+            return IRBinaryOp::FTOI;
+        default:
+            return IRBinaryOp::MAX;
+    }
+}
+
+} // namespace
+
+/// @brief 清空映射，并按预计的项数预留空间
+/// @param expected 预计的项数
+void IRBinaryIndexMap::reset(size_t expected)
+{
+    // 装载因子不超过1/2
+    size_t capacity = 16;
+    while (capacity < expected * 2) {
+        capacity <<= 1;
+    }
+
+    slots.assign(capacity, {nullptr, 0});
+    count = 0;
+}
+
+/// @brief 加入映射，已存在时不修改
+/// @param key 键
+/// @param index 编号
+void IRBinaryIndexMap::insert(const void * key, uint32_t index)
+{
+    if (slots.empty() || ((count + 1) * 2 > slots.size())) {
+
+        // 扩容后重新插入
+        std::vector<std::pair<const void *, uint32_t>> old;
+        old.swap(slots);
+        reset(count + 1 > old.size() ? count + 1 : old.size());
+
+        for (auto & slot: old) {
+            if (slot.first) {
+                insert(slot.first, slot.second);
+            }
+        }
+    }
+
+    size_t mask = slots.size() - 1;
+    for (size_t pos = slotOf(key);; pos = (pos + 1) & mask) {
+        if (!slots[pos].first) {
+            slots[pos] = {key, index};
+            count++;
+            return;
+        }
+        if (slots[pos].first == key) {
+            return;
+        }
+    }
+}
+
+/// @brief 查找编号
+/// @param key 键
+/// @param index 找到时为编号
+/// @return true：找到，false：未找到
+bool IRBinaryIndexMap::find(const void * key, uint32_t & index) const
+{
+    if (slots.empty() || !key) {
+        return false;
+    }
+
+    size_t mask = slots.size() - 1;
+    for (size_t pos = slotOf(key); slots[pos].first; pos = (pos + 1) & mask) {
+        if (slots[pos].first == key) {
+            index = slots[pos].second;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// @brief 构造函数
+/// @param _module 要输出的模块
+IRBinaryWriter::IRBinaryWriter(Module * _module) : module(_module)
+{}
+
+/// @brief 字符串加入字符串表
+/// @param str 字符串
+/// @return 字符串表的下标
+uint32_t IRBinaryWriter::internString(const std::string & str)
+{
+    auto result = stringIndex.emplace(str, (uint32_t) strings.size());
+    if (result.second) {
+        strings.push_back(str);
+    }
+
+    return result.first->second;
+}
+
+/// @brief 类型加入类型表，元素类型等先于该类型加入
+/// @param type 类型
+/// @return 类型表的下标，不支持的类型时为-1
+int32_t IRBinaryWriter::internType(Type * type)
+{
+    auto pIter = typeIndex.find(type);
+    if (pIter != typeIndex.end()) {
+        return (int32_t) pIter->second;
+    }
+
+    std::string entry;
+
+    if (type->isVoidType()) {
+        entry.push_back((char) IRBinaryType::VOID);
+    } else if (type->isFloatType()) {
+        entry.push_back((char) IRBinaryType::FLOAT);
+    } else if (type->isIntegerType()) {
+        entry.push_back((char) IRBinaryType::INTEGER);
+        irBinaryPutVarint(entry, (uint64_t) static_cast<IntegerType *>(type)->getBitWidth());
+    } else if (type->isPointerType()) {
+        Type * pointee = const_cast<Type *>(static_cast<PointerType *>(type)->getPointeeType());
+        int32_t pointeeIndex = internType(pointee);
+        if (pointeeIndex < 0) {
+            return -1;
+        }
+        entry.push_back((char) IRBinaryType::POINTER);
+        irBinaryPutVarint(entry, (uint64_t) pointeeIndex);
+    } else if (type->isArrayType()) {
+        auto * arrayType = static_cast<ArrayType *>(type);
+        int32_t elemIndex = internType(arrayType->getElementType());
+        if (elemIndex < 0) {
+            return -1;
+        }
+        entry.push_back((char) IRBinaryType::ARRAY);
+        irBinaryPutVarint(entry, (uint64_t) elemIndex);
+        irBinaryPutVarint(entry, arrayType->getDimensions().size());
+        for (int dim: arrayType->getDimensions()) {
+            irBinaryPutVarint(entry, (uint64_t) dim);
+        }
+    } else {
+        setLastError("不支持的类型：" + type->toString());
+        return -1;
+    }
+
+    typeTable += entry;
+    typeIndex[type] = typeCount;
+
+    return (int32_t) typeCount++;
+}
+
+/// @brief 编码一个操作数
+/// @param val 操作数
+/// @param buf 编码追加到这里
+/// @return true：成功，false：操作数不是本函数内可引用的Value
+bool IRBinaryWriter::encodeOperand(Value * val, std::string & buf)
+{
+    // 操作数大多是函数内的Value，先查找函数内的编号，最后才进行常量的类型转换
+    uint32_t index;
+    if (localIndex.find(val, index)) {
+        irBinaryPutVarint(buf, ((uint64_t) index << 2) | (uint64_t) IRBinaryOperand::LOCAL);
+        return true;
+    }
+
+    if (globalIndex.find(val, index)) {
+        irBinaryPutVarint(buf, ((uint64_t) index << 2) | (uint64_t) IRBinaryOperand::GLOBAL);
+        return true;
+    }
+
+    if (Instanceof(constVal, ConstInt *, val)) {
+        irBinaryPutVarint(buf, (irBinaryZigZag(constVal->getVal()) << 2) | (uint64_t) IRBinaryOperand::CONST_INT);
+        return true;
+    }
+
+    if (Instanceof(constFloat, ConstFloat *, val)) {
+        irBinaryPutVarint(buf, ((uint64_t) (uint32_t) constFloat->getBits() << 2) | (uint64_t) IRBinaryOperand::CONST_FLOAT);
+        return true;
+    }
+
+    setLastError("操作数不能引用：" + val->getName());
+    return false;
+}
+
+/// @brief 编码一个函数的函数体
+/// @param func 函数
+/// @param buf 函数体的编码追加到这里
+/// @return true：成功，false：失败
+bool IRBinaryWriter::encodeFunction(Function * func, std::string & buf)
+{
+    auto & vars = func->getVarValues();
+    auto & insts = func->getInterCode().getInsts();
+
+    localIndex.reset(func->getParams().size() + vars.size() + insts.size());
+    labelIndex.reset(0);
+
+    // 形参、局部变量依次编号，指令的结果在编码指令时编号
+    for (auto param: func->getParams()) {
+        localIndex.insert(param, (uint32_t) localIndex.size());
+    }
+
+    irBinaryPutVarint(buf, vars.size());
+    for (auto var: vars) {
+        int32_t typeIndex = internType(var->getType());
+        if (typeIndex < 0) {
+            return false;
+        }
+        irBinaryPutVarint(buf, (uint64_t) typeIndex);
+        irBinaryPutVarint(buf, internString(var->getName()));
+        irBinaryPutVarint(buf, irBinaryZigZag(var->getScopeLevel()));
+
+        localIndex.insert(var, (uint32_t) localIndex.size());
+    }
+
+    // Label按出现的顺序编号，解码时先创建好，跳转指令可以引用后面的Label
+    for (auto inst: insts) {
+        if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
+            labelIndex.insert(inst, (uint32_t) labelIndex.size());
+        }
+    }
+    irBinaryPutVarint(buf, labelIndex.size());
+
+    // 出口Label与返回值变量，0表示没有，其它为编号加1
+    uint32_t index;
+    irBinaryPutVarint(buf, labelIndex.find(func->getExitLabel(), index) ? index + 1 : 0);
+    irBinaryPutVarint(buf, localIndex.find(func->getReturnValue(), index) ? index + 1 : 0);
+
+    irBinaryPutVarint(buf, (uint64_t) func->getExistFuncCall());
+    irBinaryPutVarint(buf, (uint64_t) func->getMaxFuncCallArgCnt());
+
+    irBinaryPutVarint(buf, insts.size());
+
+    for (auto inst: insts) {
+
+        IRBinaryOp op = toBinaryOp(inst);
+        if (op == IRBinaryOp::MAX) {
+            setLastError("函数" + func->getName() + "中含有不支持的指令");
+            return false;
+        }
+
+        buf.push_back((char) op);
+
+        switch (op) {
+            case IRBinaryOp::ENTRY:
+            case IRBinaryOp::LABEL:
+                break;
+
+            case IRBinaryOp::EXIT:
+                irBinaryPutVarint(buf, inst->getOperandsNum());
+                if ((inst->getOperandsNum() > 0) && !encodeOperand(inst->getOperand(0), buf)) {
+                    return false;
+                }
+                break;
+
+            case IRBinaryOp::GOTO:
+                if (!labelIndex.find(static_cast<GotoInstruction *>(inst)->getTarget(), index)) {
+                    setLastError("函数" + func->getName() + "中跳转到的Label不在函数内");
+                    return false;
+                }
+                irBinaryPutVarint(buf, index);
+                break;
+
+            case IRBinaryOp::BRANCH: {
+                auto * gotoInst = static_cast<GotoInstruction *>(inst);
+                uint32_t falseIndex;
+                if (!labelIndex.find(gotoInst->getTarget(), index) ||
+                    !labelIndex.find(gotoInst->getFalseTarget(), falseIndex)) {
+                    setLastError("函数" + func->getName() + "中跳转到的Label不在函数内");
+                    return false;
+                }
+                if (!encodeOperand(inst->getOperand(0), buf)) {
+                    return false;
+                }
+                irBinaryPutVarint(buf, index);
+                irBinaryPutVarint(buf, falseIndex);
+                break;
+            }
+
+            case IRBinaryOp::MOVE: {
+                auto * moveInst = static_cast<MoveInstruction *>(inst);
+                uint64_t flags = 0;
+                if (moveInst->getIsPointerStore()) {
+                    flags |= IR_BINARY_MOVE_STORE;
+                }
+                if (moveInst->getIsPointerLoad()) {
+                    flags |= IR_BINARY_MOVE_LOAD;
+                }
+                if (moveInst->getIsArrayToPointer()) {
+                    flags |= IR_BINARY_MOVE_ARRAY_TO_POINTER;
+                }
+                irBinaryPutVarint(buf, flags);
+                if (!encodeOperand(inst->getOperand(0), buf) || !encodeOperand(inst->getOperand(1), buf)) {
+                    return false;
+                }
+                break;
+            }
+
+            case IRBinaryOp::FUNC_CALL: {
+                int32_t typeIndex = internType(inst->getType());
+                if (typeIndex < 0) {
+                    return false;
+                }
+                irBinaryPutVarint(buf, (uint64_t) typeIndex);
+                irBinaryPutVarint(buf, internString(static_cast<FuncCallInstruction *>(inst)->getCalledName()));
+                irBinaryPutVarint(buf, (uint64_t) inst->getOperandsNum());
+                for (int32_t k = 0; k < inst->getOperandsNum(); ++k) {
+                    if (!encodeOperand(inst->getOperand(k), buf)) {
+                        return false;
+                    }
+                }
+                break;
+            }
+
+            case IRBinaryOp::ARG:
+                if (!encodeOperand(inst->getOperand(0), buf)) {
+                    return false;
+                }
+                break;
+
+            default: {
+                // 二元运算、比较运算、求负运算以及类型转换
+                int32_t typeIndex = internType(inst->getType());
+                if (typeIndex < 0) {
+                    return false;
+                }
+                irBinaryPutVarint(buf, (uint64_t) typeIndex);
+                for (int32_t k = 0; k < inst->getOperandsNum(); ++k) {
+                    if (!encodeOperand(inst->getOperand(k), buf)) {
+                        return false;
+                    }
+                }
+                break;
+            }
+        }
+
+        if (inst->hasResultValue()) {
+            localIndex.insert(inst, (uint32_t) localIndex.size());
+        }
+    }
+
+    return true;
+}
+
+/// @brief 模块编码成二进制数据
+/// @param data 编码后的数据
+/// @return true：成功，false：失败
+bool IRBinaryWriter::encode(std::string & data)
+{
+    // 全局变量表
+    std::string globalTable;
+    auto & globals = module->getGlobalVariables();
+    globalIndex.reset(globals.size());
+    irBinaryPutVarint(globalTable, globals.size());
+    for (auto var: globals) {
+        int32_t typeIndex = internType(var->getType());
+        if (typeIndex < 0) {
+            return false;
+        }
+        irBinaryPutVarint(globalTable, internString(var->getName()));
+        irBinaryPutVarint(globalTable, (uint64_t) typeIndex);
+
+        // 初值，末尾为0的元素不保存
+        auto & initValues = var->getInitValues();
+        irBinaryPutVarint(globalTable, initValues.size());
+        for (int32_t value: initValues) {
+            irBinaryPutVarint(globalTable, irBinaryZigZag(value));
+        }
+
+        globalIndex.insert(var, (uint32_t) globalIndex.size());
+    }
+
+    // 先编码函数体，确定各函数体的偏移，同时收集字符串与类型
+    std::string funcIndex;
+    std::string bodies;
+    uint64_t funcCount = 0;
+
+    for (auto func: module->getFunctionList()) {
+
+        if (func->isBuiltin()) {
+            continue;
+        }
+
+        int32_t returnTypeIndex = internType(func->getReturnType());
+        if (returnTypeIndex < 0) {
+            return false;
+        }
+
+        irBinaryPutVarint(funcIndex, internString(func->getName()));
+        irBinaryPutVarint(funcIndex, (uint64_t) returnTypeIndex);
+        irBinaryPutVarint(funcIndex, func->getParams().size());
+        for (auto param: func->getParams()) {
+            int32_t typeIndex = internType(param->getType());
+            if (typeIndex < 0) {
+                return false;
+            }
+            irBinaryPutVarint(funcIndex, (uint64_t) typeIndex);
+            irBinaryPutVarint(funcIndex, internString(param->getName()));
+        }
+
+        size_t offset = bodies.size();
+        if (!encodeFunction(func, bodies)) {
+            return false;
+        }
+
+        irBinaryPutVarint(funcIndex, offset);
+        irBinaryPutVarint(funcIndex, bodies.size() - offset);
+
+        funcCount++;
+    }
+
+    // 文件头
+    data.clear();
+    data.append(IR_BINARY_MAGIC, 4);
+    for (int k = 0; k < 4; ++k) {
+        data.push_back((char) ((IR_BINARY_VERSION >> (k * 8)) & 0xff));
+    }
+
+    // 字符串表
+    irBinaryPutVarint(data, strings.size());
+    for (auto & str: strings) {
+        irBinaryPutVarint(data, str.size());
+        data += str;
+    }
+
+    // 类型表
+    irBinaryPutVarint(data, typeCount);
+    data += typeTable;
+
+    data += globalTable;
+
+    // 函数索引以及函数体区
+    irBinaryPutVarint(data, funcCount);
+    data += funcIndex;
+    data += bodies;
+
+    return true;
+}
+
+/// @brief 模块按二进制格式写入文件
+/// @param fileName 文件名
+/// @return true：成功，false：失败
+bool IRBinaryWriter::writeFile(const std::string & fileName)
+{
+    std::string data;
+    if (!encode(data)) {
+        return false;
+    }
+
+    FILE * fp = fopen(fileName.c_str(), "wb");
+    if (!fp) {
+        setLastError("文件(" + fileName + ")打开失败");
+        return false;
+    }
+
+    bool ok = fwrite(data.data(), 1, data.size(), fp) == data.size();
+    if (fclose(fp) != 0) {
+        ok = false;
+    }
+
+    if (!ok) {
+        setLastError("文件(" + fileName + ")写入失败");
+    }
+
+    return ok;
+}
@@ -0,0 +1,153 @@
+///
+/// @file IRBinaryWriter.h
+/// @brief 线性IR(DragonIR)按二进制格式输出
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Module.h"
+
+///
+/// @brief Value到编号的映射，开放寻址的哈希表，插入时不分配结点。
+/// 输出时每个操作数都要查找一次编号，std::unordered_map的结点分配与链表访问占了大部分时间
+///
+class IRBinaryIndexMap {
+
+public:
+    /// @brief 清空映射，并按预计的项数预留空间
+    /// @param expected 预计的项数
+    void reset(size_t expected);
+
+    /// @brief 加入映射，已存在时不修改
+    /// @param key 键
+    /// @param index 编号
+    void insert(const void * key, uint32_t index);
+
+    /// @brief 查找编号
+    /// @param key 键
+    /// @param index 找到时为编号
+    /// @return true：找到，false：未找到
+    bool find(const void * key, uint32_t & index) const;
+
+    /// @brief 项数
+    [[nodiscard]] size_t size() const
+    {
+        return count;
+    }
+
+private:
+    /// @brief 键在哈希表中的初始位置
+    [[nodiscard]] size_t slotOf(const void * key) const
+    {
+        // 乘法后取高位，对象地址的低位大多相同
+        return (size_t) ((((uint64_t) (uintptr_t) key) * 0x9e3779b97f4a7c15ULL) >> 32) & (slots.size() - 1);
+    }
+
+    /// @brief 哈希表，大小为2的幂，键为空表示该位置未使用
+    std::vector<std::pair<const void *, uint32_t>> slots;
+
+    /// @brief 项数
+    size_t count = 0;
+};
+
+///
+/// @brief 二进制IR的输出，格式见IRBinaryFormat.h。名字与类型分别放入字符串表与类型表，
+/// 指令中只保存编号，因此不需要事先对IR进行重命名
+///
+class IRBinaryWriter {
+
+public:
+    /// @brief 构造函数
+    /// @param _module 要输出的模块
+    explicit IRBinaryWriter(Module * _module);
+
+    /// @brief 析构函数
+    ~IRBinaryWriter() = default;
+
+    /// @brief 模块编码成二进制数据
+    /// @param data 编码后的数据
+    /// @return true：成功，false：失败
+    bool encode(std::string & data);
+
+    /// @brief 模块按二进制格式写入文件
+    /// @param fileName 文件名
+    /// @return true：成功，false：失败
+    bool writeFile(const std::string & fileName);
+
+    void setLastError(const std::string & error)
+    {
+        lastError = error;
+    }
+    std::string getLastError() const
+    {
+        return lastError;
+    }
+
+protected:
+    /// @brief 编码一个函数的函数体
+    /// @param func 函数
+    /// @param buf 函数体的编码追加到这里
+    /// @return true：成功，false：失败
+    bool encodeFunction(Function * func, std::string & buf);
+
+    /// @brief 编码一个操作数
+    /// @param val 操作数
+    /// @param buf 编码追加到这里
+    /// @return true：成功，false：操作数不是本函数内可引用的Value
+    bool encodeOperand(Value * val, std::string & buf);
+
+    /// @brief 字符串加入字符串表
+    /// @param str 字符串
+    /// @return 字符串表的下标
+    uint32_t internString(const std::string & str);
+
+    /// @brief 类型加入类型表，元素类型等先于该类型加入
+    /// @param type 类型
+    /// @return 类型表的下标，不支持的类型时为-1
+    int32_t internType(Type * type);
+
+private:
+    /// @brief 要输出的模块
+    Module * module;
+
+    /// @brief 字符串表
+    std::vector<std::string> strings;
+
+    /// @brief 字符串到字符串表下标的映射
+    std::unordered_map<std::string, uint32_t> stringIndex;
+
+    /// @brief 类型表的编码
+    std::string typeTable;
+
+    /// @brief 类型表的项数
+    uint32_t typeCount = 0;
+
+    /// @brief 类型到类型表下标的映射
+    std::unordered_map<Type *, uint32_t> typeIndex;
+
+    /// @brief 全局变量到全局变量表下标的映射
+    IRBinaryIndexMap globalIndex;
+
+    /// @brief 当前函数内的Value到编号的映射
+    IRBinaryIndexMap localIndex;
+
+    /// @brief 当前函数内的Label指令到编号的映射
+    IRBinaryIndexMap labelIndex;
+
+    /// @brief 错误信息
+    std::string lastError;
+};
@@ -22,6 +22,8 @@
 #include "IRConstant.h"
 #include "Function.h"
 #include "Types/PointerType.h" // 包含 ArrayType 定义-lxg
+#include "Debug.h"
+#include "OutputStream.h"
 
 /// @brief 指定函数名字、函数类型的构造函数
 /// @param _name 函数名称
@@ -76,6 +78,16 @@ bool Function::isBuiltin()
 /// @brief 函数指令信息输出
 /// @param str 函数指令
 void Function::toString(std::string & str)
+{
+    str.clear();
+
+    OutputStream os(str);
+    print(os);
+}
+
+/// @brief 函数指令信息输出到输出流，不产生整个函数的文本
+/// @param os 输出流
+void Function::print(OutputStream & os)
 {
     if (builtIn) {
         // 内置函数则什么都不输出
@@ -83,7 +95,7 @@ void Function::toString(std::string & str)
     }
 
     // 输出函数头
-    str = "define " + getReturnType()->toString() + " " + getIRName() + "(";
+    os << "define " << getReturnType()->toString() << " " << getIRName() << "(";
 
     bool firstParam = false;
     for (auto & param: params) {
@@ -91,17 +103,15 @@ void Function::toString(std::string & str)
         if (!firstParam) {
             firstParam = true;
         } else {
-            str += ", ";
+            os << ", ";
         }
 
-        std::string param_str = param->getType()->toString() + param->getIRName();
-
-        str += param_str;
+        os << param->getType()->toString() << param->getIRName();
     }
 
-    str += ")\n";
+    os << ")\n";
 
-    str += "{\n";
+    os << "{\n";
 
     // 输出局部变量的名字与IR名字
     for (auto & var: this->varsVector) {
@@ -112,28 +122,28 @@ void Function::toString(std::string & str)
             const std::vector<int> & dimensions = arrayType->getDimensions();
 
             // 输出基本类型和变量名：declare i32 %l1
-            str += "\tdeclare " + elemType->toString() + " " + var->getIRName();
+            os << "\tdeclare " << elemType->toString() << " " << var->getIRName();
 
             // 添加数组维度信息：[10][10]
             for (int dim: dimensions) {
-                str += "[" + std::to_string(dim) + "]";
+                os << "[" << dim << "]";
             }
 
             // 添加注释：;数组a
-            std::string realName = var->getName();
+            const std::string & realName = var->getName();
             if (!realName.empty()) {
-                str += " ;数组" + realName;
+                os << " ;数组" << realName;
             }
         } else {
             // 非数组类型使用原有格式
-            str += "\tdeclare " + var->getType()->toString() + " " + var->getIRName();
+            os << "\tdeclare " << var->getType()->toString() << " " << var->getIRName();
 
-            std::string realName = var->getName();
+            const std::string & realName = var->getName();
             if (!realName.empty()) {
-                str += " ; " + std::to_string(var->getScopeLevel()) + ":" + realName;
+                os << " ; " << var->getScopeLevel() << ":" << realName;
             }
         }
-        str += "\n";
+        os << "\n";
     }
 
     // 输出临时变量的declare形式
@@ -143,29 +153,30 @@ void Function::toString(std::string & str)
         if (inst->hasResultValue()) {
 
             // 局部变量和临时变量需要输出declare语句
-            str += "\tdeclare " + inst->getType()->toString() + " " + inst->getIRName() + "\n";
+            os << "\tdeclare " << inst->getType()->toString() << " " << inst->getIRName() << "\n";
         }
     }
 
     // 遍历所有的线性IR指令，文本输出
+    // 指令文本的字符串在各指令间复用，只保存一条指令的文本
+    std::string instStr;
     for (auto & inst: code.getInsts()) {
 
-        std::string instStr;
+        instStr.clear();
         inst->toString(instStr);
 
         if (!instStr.empty()) {
 
             // Label指令不加Tab键
-            if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
-                str += instStr + "\n";
-            } else {
-                str += "\t" + instStr + "\n";
+            if (inst->getOp() != IRInstOperator::IRINST_OP_LABEL) {
+                os << '\t';
             }
+            os << instStr << '\n';
         }
     }
 
     // 输出函数尾部
-    str += "}\n";
+    os << "}\n";
 }
 
 /// @brief 设置函数出口指令
@@ -309,23 +320,25 @@ void Function::renameIR()
 
     int32_t nameIndex = 0;
 
+    // 只分配编号，输出IR文本时才生成名字字符串
+
     // 形式参数重命名
     for (auto & param: this->params) {
-        param->setIRName(IR_TEMP_VARNAME_PREFIX + std::to_string(nameIndex++));
+        param->setIRSlot(IR_TEMP_VARNAME_PREFIX, nameIndex++);
     }
 
     // 局部变量重命名
     for (auto & var: this->varsVector) {
 
-        var->setIRName(IR_LOCAL_VARNAME_PREFIX + std::to_string(nameIndex++));
+        var->setIRSlot(IR_LOCAL_VARNAME_PREFIX, nameIndex++);
     }
 
     // 遍历所有的指令进行命名
     for (auto inst: this->getInterCode().getInsts()) {
         if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
-            inst->setIRName(IR_LABEL_PREFIX + std::to_string(nameIndex++));
+            inst->setIRSlot(IR_LABEL_PREFIX, nameIndex++);
         } else if (inst->hasResultValue()) {
-            inst->setIRName(IR_TEMP_VARNAME_PREFIX + std::to_string(nameIndex++));
+            inst->setIRSlot(IR_TEMP_VARNAME_PREFIX, nameIndex++);
         }
     }
 }
@@ -360,24 +373,11 @@ void Function::realArgCountReset()
 /// @return 变量占用的总字节数
 int32_t Function::calculateVariableSize(Type * type)
 {
-    if (!type) {
-        return 4; // 默认4字节
-    }
+    // 类型的大小在创建时已算好，数组为总大小，指针在ARM32中是4字节
+    int32_t size = type ? type->getSize() : -1;
 
-    if (type->isArrayType()) {
-        // 使用ArrayType的getTotalSize()方法
-        ArrayType * arrayType = dynamic_cast<ArrayType *>(type);
-        if (arrayType) {
-            int32_t totalSize = arrayType->getTotalSize();
-            printf("Array size calculation: %d bytes\n", totalSize);
-            return totalSize;
-        }
-        return 32; // 备用默认值
-    } else if (type->isPointerType()) {
-        return 4; // 指针在ARM32中是4字节
-    } else {
-        return 4; // 普通类型默认4字节
-    }
+    // 没有大小的类型默认4字节
+    return (size > 0) ? size : 4;
 }
 
 /// @brief 重新分配所有变量的内存地址（修复地址冲突）
@@ -387,7 +387,10 @@ void Function::reallocateMemory()
         return;
     }
 
-    printf("=== Starting Memory Reallocation for Function %s ===\n", getName().c_str());
+    // 调试信息整段收集后输出，--debug=stack-layout未开启时不做任何格式化
+    std::string log;
+
+    minic_debug_buf(DEBUG_STACK_LAYOUT, log, "=== Starting Memory Reallocation for Function %s ===\n", getName().c_str());
 
     const int32_t framePointerReg = 11;
 
@@ -396,13 +399,13 @@ void Function::reallocateMemory()
     int32_t totalVarSize = 0;
     int32_t arrayCount = 0;
 
-    printf("--- Phase 1: Calculating Space Requirements ---\n");
+    minic_debug_buf(DEBUG_STACK_LAYOUT, log, "--- Phase 1: Calculating Space Requirements ---\n");
     for (auto & var: varsVector) {
         int32_t varSize = calculateVariableSize(var->getType());
         if (var->getType()->isArrayType()) {
             totalArraySize += varSize;
             arrayCount++;
-            printf("Array %s: %d bytes\n", var->getName().c_str(), varSize);
+            minic_debug_buf(DEBUG_STACK_LAYOUT, log, "Array %s: %d bytes\n", var->getName().c_str(), varSize);
         } else {
             totalVarSize += varSize;
         }
@@ -412,15 +415,17 @@ void Function::reallocateMemory()
         totalVarSize += calculateVariableSize(memVar->getType());
     }
 
-    printf("Total space needed: arrays=%d bytes (%d arrays), variables=%d bytes\n",
-           totalArraySize,
-           arrayCount,
-           totalVarSize);
+    minic_debug_buf(DEBUG_STACK_LAYOUT,
+                    log,
+                    "Total space needed: arrays=%d bytes (%d arrays), variables=%d bytes\n",
+                    totalArraySize,
+                    arrayCount,
+                    totalVarSize);
 
     // 第二步：从fp-4开始，往负方向分配
     int32_t currentOffset = -4;
 
-    printf("--- Phase 2: Allocating Arrays (corrected layout) ---\n");
+    minic_debug_buf(DEBUG_STACK_LAYOUT, log, "--- Phase 2: Allocating Arrays (corrected layout) ---\n");
 
     // 先分配所有数组
     for (size_t i = 0; i < varsVector.size(); i++) {
@@ -438,30 +443,26 @@ void Function::reallocateMemory()
             // b[n-1] = base + (n-1)*4 指向最低地址
             int32_t arrayBaseOffset = currentOffset + arraySize - 4;
 
-            printf("Allocating Array[%zu] %s: size=%d, base at fp%+d",
-                   i,
-                   var->getName().c_str(),
-                   arraySize,
-                   arrayBaseOffset);
-
             var->setMemoryAddr(framePointerReg, arrayBaseOffset);
 
-            // 验证数组访问范围
-            printf(" (elements: fp%+d to fp%+d)", arrayBaseOffset, currentOffset);
-
-            // 验证访问安全性
-            if (currentOffset < 0) {
-                printf(" ✓ SAFE\n");
-            } else {
-                printf(" ⚠️  WARNING: Array extends to positive offsets!\n");
-            }
+            // 验证数组访问范围以及访问安全性
+            minic_debug_buf(DEBUG_STACK_LAYOUT,
+                            log,
+                            "Allocating Array[%zu] %s: size=%d, base at fp%+d (elements: fp%+d to fp%+d) %s\n",
+                            i,
+                            var->getName().c_str(),
+                            arraySize,
+                            arrayBaseOffset,
+                            arrayBaseOffset,
+                            currentOffset,
+                            currentOffset < 0 ? "SAFE" : "WARNING: Array extends to positive offsets!");
 
             // 留4字节间隙
             currentOffset -= 4;
         }
     }
 
-    printf("--- Phase 3: Allocating Non-Array Variables ---\n");
+    minic_debug_buf(DEBUG_STACK_LAYOUT, log, "--- Phase 3: Allocating Non-Array Variables ---\n");
 
     // 分配非数组变量
     for (size_t i = 0; i < varsVector.size(); i++) {
@@ -470,18 +471,20 @@ void Function::reallocateMemory()
         if (!var->getType()->isArrayType()) {
             int32_t varSize = calculateVariableSize(var->getType());
 
-            printf("Allocating LocalVar[%zu] %s: size=%d, at fp%+d\n",
-                   i,
-                   var->getName().c_str(),
-                   varSize,
-                   currentOffset);
+            minic_debug_buf(DEBUG_STACK_LAYOUT,
+                            log,
+                            "Allocating LocalVar[%zu] %s: size=%d, at fp%+d\n",
+                            i,
+                            var->getName().c_str(),
+                            varSize,
+                            currentOffset);
 
             var->setMemoryAddr(framePointerReg, currentOffset);
             currentOffset -= varSize;
         }
     }
 
-    printf("--- Phase 4: Allocating MemVariables ---\n");
+    minic_debug_buf(DEBUG_STACK_LAYOUT, log, "--- Phase 4: Allocating MemVariables ---\n");
 
     // 分配MemVariable
     for (size_t i = 0; i < memVector.size(); i++) {
@@ -489,7 +492,13 @@ void Function::reallocateMemory()
 
         int32_t varSize = calculateVariableSize(memVar->getType());
 
-        printf("Allocating MemVar[%zu] %s: size=%d, at fp%+d\n", i, memVar->getName().c_str(), varSize, currentOffset);
+        minic_debug_buf(DEBUG_STACK_LAYOUT,
+                        log,
+                        "Allocating MemVar[%zu] %s: size=%d, at fp%+d\n",
+                        i,
+                        memVar->getName().c_str(),
+                        varSize,
+                        currentOffset);
 
         memVar->setMemoryAddr(framePointerReg, currentOffset);
         currentOffset -= varSize;
@@ -504,76 +513,127 @@ void Function::reallocateMemory()
     int32_t oldMaxDepth = getMaxDep();
     setMaxDep(totalStackSize);
 
-    printf("--- Final Memory Layout Summary ---\n");
-    printf("Stack frame size updated: %d -> %d bytes (8-byte aligned)\n", oldMaxDepth, totalStackSize);
-    printf("Memory layout:\n");
-    printf("  Allocation range: fp-4 to fp%+d\n", currentOffset);
-    printf("  Total usage: %d bytes\n", totalStackSize);
-    printf("  Arrays: %d bytes (%d arrays)\n", totalArraySize, arrayCount);
-    printf("  Variables: %d bytes\n", totalVarSize);
+    minic_debug_buf(DEBUG_STACK_LAYOUT, log, "--- Final Memory Layout Summary ---\n");
+    minic_debug_buf(DEBUG_STACK_LAYOUT,
+                    log,
+                    "Stack frame size updated: %d -> %d bytes (8-byte aligned)\n",
+                    oldMaxDepth,
+                    totalStackSize);
+    minic_debug_buf(DEBUG_STACK_LAYOUT, log, "Allocation range: fp-4 to fp%+d\n", currentOffset);
+    minic_debug_buf(DEBUG_STACK_LAYOUT,
+                    log,
+                    "Total usage: %d bytes, arrays: %d bytes (%d arrays), variables: %d bytes\n",
+                    totalStackSize,
+                    totalArraySize,
+                    arrayCount,
+                    totalVarSize);
 
     memoryFixed = true;
-    printf("=== Memory Reallocation Complete ===\n");
+
+    minic_debug_buf(DEBUG_STACK_LAYOUT, log, "=== Memory Reallocation Complete ===\n");
+    debugOutput(DEBUG_STACK_LAYOUT, log);
 }
 
 /// @brief 验证内存分配是否有冲突
 bool Function::validateMemoryAllocation()
 {
-    printf("=== Validating Memory Allocation ===\n");
-
-    // 使用map来收集所有的地址分配信息
-    std::map<int64_t, std::vector<std::string>> offsetMap;
+    // 按基址寄存器与栈内偏移收集变量，变量的描述信息只在输出调试信息时才生成
+    std::map<std::pair<int32_t, int64_t>, std::vector<Value *>> offsetMap;
 
     // 收集所有LocalVariable的地址
     for (auto & var: varsVector) {
         int32_t baseReg;
         int64_t offset;
         if (var->getMemoryAddr(&baseReg, &offset)) {
-            std::string varInfo =
-                var->getName() + " (LocalVar, " + (var->getType()->isPointerType() ? "pointer)" : "normal)");
-            offsetMap[offset].push_back(varInfo);
+            offsetMap[{baseReg, offset}].push_back(var);
         }
     }
 
     // 收集所有MemVariable的地址
+    // 基于SP寻址的MemVariable是函数调用时栈传递的实参，不同的函数调用可重复使用同一个位置，不检查
+    const int32_t stackPointerReg = 13;
     for (auto & memVar: memVector) {
         int32_t baseReg;
         int64_t offset;
-        if (memVar->getMemoryAddr(&baseReg, &offset)) {
-            std::string varInfo =
-                memVar->getName() + " (MemVar, " + (memVar->getType()->isPointerType() ? "pointer)" : "normal)");
-            offsetMap[offset].push_back(varInfo);
+        if (memVar->getMemoryAddr(&baseReg, &offset) && (baseReg != stackPointerReg)) {
+            offsetMap[{baseReg, offset}].push_back(memVar);
         }
     }
 
     // 检查冲突
-    bool hasConflict = false;
     int conflictCount = 0;
 
+    std::string log;
+    minic_debug_buf(DEBUG_STACK_LAYOUT, log, "=== Validating Memory Allocation for Function %s ===\n", getName().c_str());
+
     for (auto & pair: offsetMap) {
-        if (pair.second.size() > 1) {
-            printf("CONFLICT #%d at offset %ld:\n", ++conflictCount, pair.first);
-            for (auto & varInfo: pair.second) {
-                printf("  - %s\n", varInfo.c_str());
+
+        // 栈槽着色后活跃区间不相交的对象共享同一个偏移，不是冲突
+        bool conflict = false;
+        for (size_t i = 0; i < pair.second.size() && !conflict; ++i) {
+            for (size_t j = i + 1; j < pair.second.size(); ++j) {
+                if (!canShareStackSlot(pair.second[i], pair.second[j])) {
+                    conflict = true;
+                    break;
+                }
+            }
+        }
+
+        if (conflict) {
+            ++conflictCount;
+
+            minic_debug_buf(DEBUG_STACK_LAYOUT,
+                            log,
+                            "CONFLICT #%d at offset %ld:\n",
+                            conflictCount,
+                            (long) pair.first.second);
+            for (auto val: pair.second) {
+                minic_debug_buf(DEBUG_STACK_LAYOUT,
+                                log,
+                                "  - %s (%s, %s)\n",
+                                val->getName().c_str(),
+                                dynamic_cast<MemVariable *>(val) ? "MemVar" : "LocalVar",
+                                val->getType()->isPointerType() ? "pointer" : "normal");
             }
-            hasConflict = true;
         }
     }
 
-    if (!hasConflict) {
-        printf("✓ No memory allocation conflicts detected.\n");
+    if (conflictCount == 0) {
+        minic_debug_buf(DEBUG_STACK_LAYOUT, log, "No memory allocation conflicts detected.\n");
     } else {
-        printf("✗ Found %d memory allocation conflicts.\n", conflictCount);
+        minic_debug_buf(DEBUG_STACK_LAYOUT, log, "Found %d memory allocation conflicts.\n", conflictCount);
+    }
+
+    minic_debug_buf(DEBUG_STACK_LAYOUT, log, "=== Validation Complete ===\n");
+    debugOutput(DEBUG_STACK_LAYOUT, log);
+
+    return conflictCount == 0;
+}
+
+/// @brief 检查两个栈内对象能否共享栈内偏移
+/// @param a 对象a
+/// @param b 对象b
+/// @return true表示活跃区间不相交，可以共享
+bool Function::canShareStackSlot(Value * a, Value * b)
+{
+    auto aIter = stackLiveRanges.find(a);
+    auto bIter = stackLiveRanges.find(b);
+    if ((aIter == stackLiveRanges.end()) || (bIter == stackLiveRanges.end())) {
+        return false;
     }
 
-    printf("=== Validation Complete ===\n");
-    return !hasConflict;
+    return (aIter->second.second < bIter->second.first) || (bIter->second.second < aIter->second.first);
 }
 
-/// @brief 打印详细的内存布局信息（调试用）
+/// @brief 打印详细的内存布局信息（调试用），只在--debug=stack-layout开启时输出
 void Function::printMemoryLayout()
 {
-    printf("=== Memory Layout for Function %s ===\n", getName().c_str());
+    if (!debugEnabled(DEBUG_STACK_LAYOUT)) {
+        return;
+    }
+
+    std::string log;
+    debugAppend(log, "=== Memory Layout for Function %s ===\n", getName().c_str());
 
     // 收集所有变量的地址信息
     std::vector<std::tuple<int64_t, std::string, std::string, std::string, int32_t>> layout;
@@ -587,7 +647,7 @@ void Function::printMemoryLayout()
             int32_t size;
 
             if (var->getType()->isArrayType()) {
-                ArrayType * arrayType = dynamic_cast<ArrayType *>(var->getType());
+                ArrayType * arrayType = ArrayType::cast(var->getType());
                 if (arrayType) {
                     auto & dims = arrayType->getDimensions();
                     typeStr = "array[";
@@ -631,20 +691,23 @@ void Function::printMemoryLayout()
     });
 
     // 打印布局表
-    printf("Stack layout (high to low address):\n");
-    printf("  Address    | Variable   | Category | Type            | Size\n");
-    printf("  -----------|------------|----------|-----------------|------\n");
+    debugAppend(log, "Stack layout (high to low address):\n");
+    debugAppend(log, "  Address    | Variable   | Category | Type            | Size\n");
+    debugAppend(log, "  -----------|------------|----------|-----------------|------\n");
 
     for (auto & item: layout) {
-        printf("  fp%+ld | %-10s | %-8s | %-15s | %d\n",
-               std::get<0>(item),         // offset
-               std::get<1>(item).c_str(), // name
-               std::get<2>(item).c_str(), // category
-               std::get<3>(item).c_str(), // type
-               std::get<4>(item));        // size
+        debugAppend(log,
+                    "  fp%+ld | %-10s | %-8s | %-15s | %d\n",
+                    (long) std::get<0>(item),  // offset
+                    std::get<1>(item).c_str(), // name
+                    std::get<2>(item).c_str(), // category
+                    std::get<3>(item).c_str(), // type
+                    std::get<4>(item));        // size
     }
 
-    printf("Total variables: LocalVar=%zu, MemVar=%zu\n", varsVector.size(), memVector.size());
-    printf("Current stack frame size: %d bytes\n", getMaxDep());
-    printf("=== End Memory Layout ===\n");
-}
\ No newline at end of file
+    debugAppend(log, "Total variables: LocalVar=%zu, MemVar=%zu\n", varsVector.size(), memVector.size());
+    debugAppend(log, "Current stack frame size: %d bytes\n", getMaxDep());
+    debugAppend(log, "=== End Memory Layout ===\n");
+
+    debugOutput(DEBUG_STACK_LAYOUT, log);
+}
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "GlobalValue.h"
@@ -28,6 +29,7 @@
 // 在这里添加前向声明-lxg
 class BinaryInstruction;
 class MoveInstruction;
+class OutputStream;
 
 ///
 /// @brief 描述函数信息的类，是全局静态存储，其Value的类型为FunctionType
@@ -67,6 +69,10 @@ public:
     /// @param str 函数指令
     void toString(std::string & str);
 
+    /// @brief 函数指令信息输出到输出流，不产生整个函数的文本
+    /// @param os 输出流
+    void print(OutputStream & os);
+
     /// @brief 设置函数出口指令
     /// @param inst 出口Label指令
     void setExitLabel(Instruction * inst);
@@ -222,6 +228,21 @@ public:
     /// @brief 打印详细的内存布局信息（调试用）
     void printMemoryLayout();
 
+    /// @brief 记录栈槽着色时对象的活跃区间，活跃区间不相交的对象可以共享栈内偏移
+    /// @param val 变量或指令
+    /// @param start 活跃区间的开始指令序号
+    /// @param end 活跃区间的结束指令序号
+    void setStackLiveRange(Value * val, int32_t start, int32_t end)
+    {
+        stackLiveRanges[val] = {start, end};
+    }
+
+    /// @brief 检查两个栈内对象能否共享栈内偏移
+    /// @param a 对象a
+    /// @param b 对象b
+    /// @return true表示活跃区间不相交，可以共享
+    bool canShareStackSlot(Value * a, Value * b);
+
     /// @brief 计算变量的实际大小（字节）
     /// @param type 变量类型
     /// @return 变量占用的总字节数
@@ -243,6 +264,20 @@ public:
         return memVector;
     }
 
+    /// @brief 设置函数的调用次数，来自--profile-use读入的profile数据
+    /// @param count 调用次数
+    void setEntryCount(int64_t count)
+    {
+        entryCount = count;
+    }
+
+    /// @brief 获取函数的调用次数
+    /// @return 调用次数，-1表示没有profile数据
+    [[nodiscard]] int64_t getEntryCount() const
+    {
+        return entryCount;
+    }
+
 private:
     ///
     /// @brief 函数的返回值类型，有点冗余，可删除，直接从type中取得即可
@@ -283,6 +318,11 @@ private:
     ///
     std::vector<MemVariable *> memVector;
 
+    ///
+    /// @brief 栈槽着色得到的对象活跃区间，用于检查栈内偏移是否冲突
+    ///
+    std::unordered_map<Value *, std::pair<int32_t, int32_t>> stackLiveRanges;
+
     ///
     /// @brief 函数出口Label指令
     ///
@@ -313,6 +353,11 @@ private:
     ///
     int maxFuncCallArgCnt = 0;
 
+    ///
+    /// @brief 函数的调用次数，-1表示没有profile数据
+    ///
+    int64_t entryCount = -1;
+
     ///
     /// @brief 函数是否需要重定位，栈帧发生变化
     ///
@@ -34,7 +34,19 @@
 #include "MoveInstruction.h"
 #include "GotoInstruction.h"
 #include "ConstInt.h"          //添加ConstInt-lxg
+#include "GlobalVariable.h"
 #include "Types/PointerType.h" // 引入包含 ArrayType 的头文件-lxg
+#include "VoidType.h"
+#include "FloatType.h"
+
+/// @brief 局部数组的元素个数不超过该值时逐个存储初值，不整体清零
+#define LOCAL_ARRAY_STORE_MAX 4
+
+/// @brief 局部数组的非零常量初值至少有该个数时从只读段的模板复制
+#define LOCAL_ARRAY_TEMPLATE_MIN 4
+
+/// @brief 从模板复制时非零常量初值占元素个数的最小比例的倒数
+#define LOCAL_ARRAY_TEMPLATE_RATIO 4
 
 /// @brief 构造函数
 /// @param _root AST的根
@@ -43,6 +55,7 @@ IRGenerator::IRGenerator(ast_node * _root, Module * _module) : root(_root), modu
 {
     /* 叶子节点 */
     ast2ir_handlers[ast_operator_type::AST_OP_LEAF_LITERAL_UINT] = &IRGenerator::ir_leaf_node_uint;
+    ast2ir_handlers[ast_operator_type::AST_OP_LEAF_LITERAL_FLOAT] = &IRGenerator::ir_leaf_node_float;
     ast2ir_handlers[ast_operator_type::AST_OP_LEAF_VAR_ID] = &IRGenerator::ir_leaf_node_var_id;
     ast2ir_handlers[ast_operator_type::AST_OP_LEAF_TYPE] = &IRGenerator::ir_leaf_node_type;
 
@@ -382,22 +395,6 @@ bool IRGenerator::ir_function_define(ast_node * node)
     // 创建并加入Entry入口指令
     irCode.addInst(new EntryInstruction(newFunc));
 
-    // 在 ir_function_define 函数中，创建Entry指令后添加：-lxg
-    if (name_node->name == "main" && !globalVarInitValues.empty()) {
-        // 在main函数开始时添加全局变量初始化代码
-        for (auto & pair: globalVarInitValues) {
-            std::string varName = pair.first;
-            int initValue = pair.second;
-
-            Value * globalVar = module->findVarValue(varName);
-            if (globalVar) {
-                MoveInstruction * initInst = new MoveInstruction(newFunc, globalVar, module->newConstInt(initValue));
-                irCode.addInst(initInst);
-                printf("DEBUG: 在main函数中初始化全局变量 %s = %d\n", varName.c_str(), initValue);
-            }
-        }
-    }
-
     // 创建出口指令并不加入出口指令，等函数内的指令处理完毕后加入出口指令
     LabelInstruction * exitLabelInst = new LabelInstruction(newFunc);
 
@@ -836,7 +833,7 @@ bool IRGenerator::ir_function_call(ast_node * node)
                     return false;
                 }
 
-                if (ArrayType * arrayParamType = dynamic_cast<ArrayType *>(formalParamType)) {
+                if (ArrayType * arrayParamType = ArrayType::cast(formalParamType)) {
                     // 形参是数组类型 int[0][2][3]...
                     const std::vector<int> & paramDimensions = arrayParamType->getDimensions();
                     printf("DEBUG: 形参是多维数组类型，维度数: %zu\n", paramDimensions.size());
@@ -934,8 +931,14 @@ bool IRGenerator::ir_function_call(ast_node * node)
                 return false;
             }
 
-            realParams.push_back(temp->val);
             node->blockInsts.addInst(temp->blockInsts);
+
+            // 实参按形参的类型进行int与float之间的转换
+            Value * arg = temp->val;
+            if (i < formalParams.size()) {
+                arg = convertValue(node, arg, formalParams[i]->getType());
+            }
+            realParams.push_back(arg);
         }
     }
 
@@ -1034,17 +1037,21 @@ bool IRGenerator::ir_add(ast_node * node)
         return false;
     }
 
-    // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
-
-    BinaryInstruction * addInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                        IRInstOperator::IRINST_OP_ADD_I,
-                                                        left->val,
-                                                        right->val,
-                                                        IntegerType::getTypeInt());
-
     // 创建临时变量保存IR的值，以及线性IR指令
     node->blockInsts.addInst(left->blockInsts);
     node->blockInsts.addInst(right->blockInsts);
+
+    // 有一个操作数为float时按float运算
+    Value * src1 = left->val;
+    Value * src2 = right->val;
+    bool isFloat = promoteOperands(node, src1, src2);
+
+    BinaryInstruction * addInst = new BinaryInstruction(module->getCurrentFunction(),
+                                                        isFloat ? IRInstOperator::IRINST_OP_ADD_F
+                                                                : IRInstOperator::IRINST_OP_ADD_I,
+                                                        src1,
+                                                        src2,
+                                                        isFloat ? src1->getType() : IntegerType::getTypeInt());
     node->blockInsts.addInst(addInst);
 
     node->val = addInst;
@@ -1076,17 +1083,21 @@ bool IRGenerator::ir_sub(ast_node * node)
         return false;
     }
 
-    // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
-
-    BinaryInstruction * subInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                        IRInstOperator::IRINST_OP_SUB_I,
-                                                        left->val,
-                                                        right->val,
-                                                        IntegerType::getTypeInt());
-
     // 创建临时变量保存IR的值，以及线性IR指令
     node->blockInsts.addInst(left->blockInsts);
     node->blockInsts.addInst(right->blockInsts);
+
+    // 有一个操作数为float时按float运算
+    Value * src1 = left->val;
+    Value * src2 = right->val;
+    bool isFloat = promoteOperands(node, src1, src2);
+
+    BinaryInstruction * subInst = new BinaryInstruction(module->getCurrentFunction(),
+                                                        isFloat ? IRInstOperator::IRINST_OP_SUB_F
+                                                                : IRInstOperator::IRINST_OP_SUB_I,
+                                                        src1,
+                                                        src2,
+                                                        isFloat ? src1->getType() : IntegerType::getTypeInt());
     node->blockInsts.addInst(subInst);
 
     node->val = subInst;
@@ -1131,17 +1142,21 @@ bool IRGenerator::ir_mul(ast_node * node)
         return false;
     }
 
-    // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
-
-    BinaryInstruction * mulInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                        IRInstOperator::IRINST_OP_MUL_I,
-                                                        left->val,
-                                                        right->val,
-                                                        IntegerType::getTypeInt());
-
     // 创建临时变量保存IR的值，以及线性IR指令
     node->blockInsts.addInst(left->blockInsts);
     node->blockInsts.addInst(right->blockInsts);
+
+    // 有一个操作数为float时按float运算
+    Value * src1 = left->val;
+    Value * src2 = right->val;
+    bool isFloat = promoteOperands(node, src1, src2);
+
+    BinaryInstruction * mulInst = new BinaryInstruction(module->getCurrentFunction(),
+                                                        isFloat ? IRInstOperator::IRINST_OP_MUL_F
+                                                                : IRInstOperator::IRINST_OP_MUL_I,
+                                                        src1,
+                                                        src2,
+                                                        isFloat ? src1->getType() : IntegerType::getTypeInt());
     node->blockInsts.addInst(mulInst);
 
     node->val = mulInst;
@@ -1173,17 +1188,21 @@ bool IRGenerator::ir_div(ast_node * node)
         return false;
     }
 
-    // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
-
-    BinaryInstruction * divInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                        IRInstOperator::IRINST_OP_DIV_I,
-                                                        left->val,
-                                                        right->val,
-                                                        IntegerType::getTypeInt());
-
     // 创建临时变量保存IR的值，以及线性IR指令
     node->blockInsts.addInst(left->blockInsts);
     node->blockInsts.addInst(right->blockInsts);
+
+    // 有一个操作数为float时按float运算
+    Value * src1 = left->val;
+    Value * src2 = right->val;
+    bool isFloat = promoteOperands(node, src1, src2);
+
+    BinaryInstruction * divInst = new BinaryInstruction(module->getCurrentFunction(),
+                                                        isFloat ? IRInstOperator::IRINST_OP_DIV_F
+                                                                : IRInstOperator::IRINST_OP_DIV_I,
+                                                        src1,
+                                                        src2,
+                                                        isFloat ? src1->getType() : IntegerType::getTypeInt());
     node->blockInsts.addInst(divInst);
 
     node->val = divInst;
@@ -1248,12 +1267,14 @@ bool IRGenerator::ir_neg(ast_node * node)
         return false;
     }
 
-    // 创建一元负号指令
+    // 创建一元负号指令，float操作数求负的结果仍为float
+    bool isFloat = operand->val->getType()->isFloatType();
     BinaryInstruction * negInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                        IRInstOperator::IRINST_OP_NEG_I,
+                                                        isFloat ? IRInstOperator::IRINST_OP_NEG_F
+                                                                : IRInstOperator::IRINST_OP_NEG_I,
                                                         operand->val,
                                                         nullptr, // 一元运算符第二个操作数为空
-                                                        IntegerType::getTypeInt());
+                                                        isFloat ? operand->val->getType() : IntegerType::getTypeInt());
 
     // 将操作数的指令和负号指令添加到当前节点
     node->blockInsts.addInst(operand->blockInsts);
@@ -1292,12 +1313,15 @@ bool IRGenerator::ir_lt(ast_node * node)
     node->blockInsts.addInst(left_node->blockInsts);
     node->blockInsts.addInst(right_node->blockInsts);
 
+    // 有一个操作数为float时按float比较
+    bool isFloat = promoteOperands(node, left, right);
+
     // 创建临时变量存储比较结果 - 使用布尔类型
     LocalVariable * result = static_cast<LocalVariable *>(module->newVarValue(IntegerType::getTypeBool()));
 
     // 添加比较指令 - 使用布尔类型
     BinaryInstruction * ltInst =
-        new BinaryInstruction(func, IRInstOperator::IRINST_OP_LT_I, left, right, IntegerType::getTypeBool());
+        new BinaryInstruction(func, isFloat ? IRInstOperator::IRINST_OP_LT_F : IRInstOperator::IRINST_OP_LT_I, left, right, IntegerType::getTypeBool());
     node->blockInsts.addInst(ltInst);
 
     // 将结果移动到临时变量中
@@ -1333,12 +1357,15 @@ bool IRGenerator::ir_gt(ast_node * node)
     node->blockInsts.addInst(left_node->blockInsts);
     node->blockInsts.addInst(right_node->blockInsts);
 
+    // 有一个操作数为float时按float比较
+    bool isFloat = promoteOperands(node, left, right);
+
     // 使用布尔类型
     LocalVariable * result = static_cast<LocalVariable *>(module->newVarValue(IntegerType::getTypeBool()));
 
     // 使用布尔类型
     BinaryInstruction * gtInst =
-        new BinaryInstruction(func, IRInstOperator::IRINST_OP_GT_I, left, right, IntegerType::getTypeBool());
+        new BinaryInstruction(func, isFloat ? IRInstOperator::IRINST_OP_GT_F : IRInstOperator::IRINST_OP_GT_I, left, right, IntegerType::getTypeBool());
     node->blockInsts.addInst(gtInst);
 
     // 将结果移动到临时变量中
@@ -1374,12 +1401,15 @@ bool IRGenerator::ir_le(ast_node * node)
     node->blockInsts.addInst(left_node->blockInsts);
     node->blockInsts.addInst(right_node->blockInsts);
 
+    // 有一个操作数为float时按float比较
+    bool isFloat = promoteOperands(node, left, right);
+
     // 使用布尔类型
     LocalVariable * result = static_cast<LocalVariable *>(module->newVarValue(IntegerType::getTypeBool()));
 
     // 使用布尔类型
     BinaryInstruction * leInst =
-        new BinaryInstruction(func, IRInstOperator::IRINST_OP_LE_I, left, right, IntegerType::getTypeBool());
+        new BinaryInstruction(func, isFloat ? IRInstOperator::IRINST_OP_LE_F : IRInstOperator::IRINST_OP_LE_I, left, right, IntegerType::getTypeBool());
     node->blockInsts.addInst(leInst);
 
     // 将结果移动到临时变量中
@@ -1415,12 +1445,15 @@ bool IRGenerator::ir_ge(ast_node * node)
     node->blockInsts.addInst(left_node->blockInsts);
     node->blockInsts.addInst(right_node->blockInsts);
 
+    // 有一个操作数为float时按float比较
+    bool isFloat = promoteOperands(node, left, right);
+
     // 使用布尔类型
     LocalVariable * result = static_cast<LocalVariable *>(module->newVarValue(IntegerType::getTypeBool()));
 
     // 使用布尔类型
     BinaryInstruction * geInst =
-        new BinaryInstruction(func, IRInstOperator::IRINST_OP_GE_I, left, right, IntegerType::getTypeBool());
+        new BinaryInstruction(func, isFloat ? IRInstOperator::IRINST_OP_GE_F : IRInstOperator::IRINST_OP_GE_I, left, right, IntegerType::getTypeBool());
     node->blockInsts.addInst(geInst);
 
     // 将结果移动到临时变量中
@@ -1456,12 +1489,15 @@ bool IRGenerator::ir_eq(ast_node * node)
     node->blockInsts.addInst(left_node->blockInsts);
     node->blockInsts.addInst(right_node->blockInsts);
 
+    // 有一个操作数为float时按float比较
+    bool isFloat = promoteOperands(node, left, right);
+
     // 使用布尔类型
     LocalVariable * result = static_cast<LocalVariable *>(module->newVarValue(IntegerType::getTypeBool()));
 
     // 使用布尔类型
     BinaryInstruction * eqInst =
-        new BinaryInstruction(func, IRInstOperator::IRINST_OP_EQ_I, left, right, IntegerType::getTypeBool());
+        new BinaryInstruction(func, isFloat ? IRInstOperator::IRINST_OP_EQ_F : IRInstOperator::IRINST_OP_EQ_I, left, right, IntegerType::getTypeBool());
     node->blockInsts.addInst(eqInst);
 
     // 将结果移动到临时变量中
@@ -1497,12 +1533,15 @@ bool IRGenerator::ir_ne(ast_node * node)
     node->blockInsts.addInst(left_node->blockInsts);
     node->blockInsts.addInst(right_node->blockInsts);
 
+    // 有一个操作数为float时按float比较
+    bool isFloat = promoteOperands(node, left, right);
+
     // 使用布尔类型
     LocalVariable * result = static_cast<LocalVariable *>(module->newVarValue(IntegerType::getTypeBool()));
 
     // 使用布尔类型
     BinaryInstruction * neInst =
-        new BinaryInstruction(func, IRInstOperator::IRINST_OP_NE_I, left, right, IntegerType::getTypeBool());
+        new BinaryInstruction(func, isFloat ? IRInstOperator::IRINST_OP_NE_F : IRInstOperator::IRINST_OP_NE_I, left, right, IntegerType::getTypeBool());
     node->blockInsts.addInst(neInst);
 
     // 将结果移动到临时变量中
@@ -2095,9 +2134,15 @@ bool IRGenerator::ir_assign(ast_node * node)
     // 检查左侧是否是数组访问
     if (son1_node->node_type == ast_operator_type::AST_OP_ARRAY_ACCESS && left->arrayPtr) {
         // 通过指针为数组元素赋值
+        // 右侧的值按元素的类型转换
+        Value * src = right->val;
+        if (left->arrayPtr->getType()->isPointerType()) {
+            const Type * elemType = static_cast<PointerType *>(left->arrayPtr->getType())->getPointeeType();
+            src = convertValue(node, src, const_cast<Type *>(elemType));
+        }
         MoveInstruction * storeInst = new MoveInstruction(module->getCurrentFunction(),
                                                           left->arrayPtr, // 数组元素的指针
-                                                          right->val      // 右侧值
+                                                          src             // 右侧值
         );
         storeInst->setIsPointerStore(true); // 标记为指针存储，需要在MoveInstruction类中添加此字段和方法
         node->blockInsts.addInst(storeInst);
@@ -2107,7 +2152,8 @@ bool IRGenerator::ir_assign(ast_node * node)
                right->val->getIRName().c_str());
     } else {
         // 普通赋值
-        MoveInstruction * movInst = new MoveInstruction(module->getCurrentFunction(), left->val, right->val);
+        Value * src = convertValue(node, right->val, left->val->getType());
+        MoveInstruction * movInst = new MoveInstruction(module->getCurrentFunction(), left->val, src);
         node->blockInsts.addInst(movInst);
     }
 
@@ -2146,7 +2192,8 @@ bool IRGenerator::ir_return(ast_node * node)
         node->blockInsts.addInst(right->blockInsts);
 
         // 返回值赋值到函数返回值变量上，然后跳转到函数的尾部
-        node->blockInsts.addInst(new MoveInstruction(currentFunc, currentFunc->getReturnValue(), right->val));
+        Value * retVal = convertValue(node, right->val, currentFunc->getReturnType());
+        node->blockInsts.addInst(new MoveInstruction(currentFunc, currentFunc->getReturnValue(), retVal));
 
         node->val = right->val;
     } else {
@@ -2250,6 +2297,68 @@ bool IRGenerator::ir_leaf_node_uint(ast_node * node)
     return true;
 }
 
+/// @brief float数字面量叶子节点翻译成线性中间IR
+/// @param node AST节点
+/// @return 翻译是否成功，true：成功，false：失败
+bool IRGenerator::ir_leaf_node_float(ast_node * node)
+{
+    // 新建一个float常量Value
+    node->val = module->newConstFloat(node->float_val);
+
+    return true;
+}
+
+/// @brief 值转换为指定的类型，int与float之间插入sitofp或fptosi指令，其它情况不转换
+/// @param node AST节点，转换指令加入其中
+/// @param val 要转换的值
+/// @param type 目标类型
+/// @return 转换后的值，常量直接转换
+Value * IRGenerator::convertValue(ast_node * node, Value * val, Type * type)
+{
+    Type * srcType = val->getType();
+
+    if (type->isFloatType() && srcType->isIntegerType()) {
+
+        if (Instanceof(constVal, ConstInt *, val)) {
+            return module->newConstFloat((float) constVal->getVal());
+        }
+
+        auto * inst = new BinaryInstruction(module->getCurrentFunction(), IRInstOperator::IRINST_OP_ITOF, val, nullptr, type);
+        node->blockInsts.addInst(inst);
+        return inst;
+    }
+
+    if (type->isIntegerType() && srcType->isFloatType()) {
+
+        auto * inst = new BinaryInstruction(module->getCurrentFunction(),
+                                            IRInstOperator::IRINST_OP_FTOI,
+                                            val,
+                                            nullptr,
+                                            IntegerType::getTypeInt());
+        node->blockInsts.addInst(inst);
+        return inst;
+    }
+
+    return val;
+}
+
+/// @brief 算术运算与比较运算的类型提升，有一个操作数为float时另一个操作数转换为float
+/// @param node AST节点，转换指令加入其中
+/// @param left 左操作数，转换时被替换
+/// @param right 右操作数，转换时被替换
+/// @return true：按float运算，false：按整数运算
+bool IRGenerator::promoteOperands(ast_node * node, Value *& left, Value *& right)
+{
+    if (!left->getType()->isFloatType() && !right->getType()->isFloatType()) {
+        return false;
+    }
+
+    left = convertValue(node, left, FloatType::getTypeFloat());
+    right = convertValue(node, right, FloatType::getTypeFloat());
+
+    return true;
+}
+
 /// @brief 变量声明语句节点翻译成线性中间IR
 /// @param node AST节点
 /// @return 翻译是否成功，true：成功，false：失败
@@ -2297,8 +2406,12 @@ bool IRGenerator::ir_variable_declare(ast_node * node)
 
     // 检查第二个子节点是否是数组定义节点
     if (node->sons[1]->node_type == ast_operator_type::AST_OP_ARRAY_DEF) {
-        // 处理数组定义
-        return ir_array_def(node->sons[1]);
+        // 处理数组定义，局部数组的初始化指令加入到声明节点中
+        if (!ir_array_def(node->sons[1])) {
+            return false;
+        }
+        node->blockInsts.addInst(node->sons[1]->blockInsts);
+        return true;
     }
 
     std::string varName = node->sons[1]->name;
@@ -2358,16 +2471,15 @@ bool IRGenerator::ir_variable_declare(ast_node * node)
                 printf("DEBUG: 为局部变量 %s 生成了初始化指令\n", varName.c_str());
             }
         } else {
-            // 全局变量初始化
-            if (node->sons[2]->node_type == ast_operator_type::AST_OP_LEAF_LITERAL_UINT) {
-                uint32_t value = node->sons[2]->integer_val;
-                printf("DEBUG: 记录全局变量 %s 的初始值 %u\n", varName.c_str(), value);
-
-                // 保存全局变量的初始值
-                globalVarInitValues[varName] = value;
-            } else {
-                printf("DEBUG: 全局变量 %s 的初始化表达式太复杂，当前不支持\n", varName.c_str());
+            // 全局变量初始化，初值放到数据段中，不在运行时赋值
+            int32_t value;
+            if (!evalConstExpr(node->sons[2], value)) {
+                setLastError("全局变量 " + varName + " 的初值必须是常量表达式");
+                return false;
             }
+
+            static_cast<GlobalVariable *>(var)->setInitValues({value});
+            printf("DEBUG: 记录全局变量 %s 的初始值 %d\n", varName.c_str(), value);
         }
     } else if (currentFunc) {
         // 对于未初始化的局部变量，我们可以默认初始化为0
@@ -2382,6 +2494,61 @@ bool IRGenerator::ir_variable_declare(ast_node * node)
     return true;
 }
 
+/// @brief 计算常量表达式的值，用于全局变量的初值
+/// @param node AST节点
+/// @param value 表达式的值
+/// @return true：是常量表达式，false：不是
+bool IRGenerator::evalConstExpr(ast_node * node, int32_t & value)
+{
+    if (!node) {
+        return false;
+    }
+
+    if (node->node_type == ast_operator_type::AST_OP_LEAF_LITERAL_UINT) {
+        value = (int32_t) node->integer_val;
+        return true;
+    }
+
+    if ((node->node_type == ast_operator_type::AST_OP_NEG) && (node->sons.size() == 1)) {
+        if (!evalConstExpr(node->sons[0], value)) {
+            return false;
+        }
+        value = (int32_t) (0u - (uint32_t) value);
+        return true;
+    }
+
+    if (node->sons.size() != 2) {
+        return false;
+    }
+
+    int32_t left, right;
+    if (!evalConstExpr(node->sons[0], left) || !evalConstExpr(node->sons[1], right)) {
+        return false;
+    }
+
+    // 按32位补码运算，溢出时回绕
+    switch (node->node_type) {
+        case ast_operator_type::AST_OP_ADD:
+            value = (int32_t) ((uint32_t) left + (uint32_t) right);
+            return true;
+        case ast_operator_type::AST_OP_SUB:
+            value = (int32_t) ((uint32_t) left - (uint32_t) right);
+            return true;
+        case ast_operator_type::AST_OP_MUL:
+            value = (int32_t) ((uint32_t) left * (uint32_t) right);
+            return true;
+        case ast_operator_type::AST_OP_DIV:
+        case ast_operator_type::AST_OP_MOD:
+            if ((right == 0) || ((left == INT32_MIN) && (right == -1))) {
+                return false;
+            }
+            value = (node->node_type == ast_operator_type::AST_OP_DIV) ? left / right : left % right;
+            return true;
+        default:
+            return false;
+    }
+}
+
 // 实现数组定义和访问的处理函数-lxg
 /// @brief 数组定义节点翻译成线性中间IR
 /// @param node AST节点
@@ -2397,11 +2564,15 @@ bool IRGenerator::ir_array_def(ast_node * node)
     std::string arrayName = node->sons[0]->name;
     printf("DEBUG: 处理数组定义: %s\n", arrayName.c_str());
 
-    // 收集维度信息
+    // 收集维度信息，节点的integer_val为维度的个数，维度节点之后是可选的初始化值节点
+    size_t dimCount = node->integer_val;
+    if (node->sons.size() < dimCount + 1) {
+        setLastError("数组定义节点格式错误");
+        return false;
+    }
+
     std::vector<int> dimensions;
-    for (size_t i = 1;
-         i < node->sons.size() - (node->sons.back()->node_type != ast_operator_type::AST_OP_LEAF_LITERAL_UINT ? 1 : 0);
-         i++) {
+    for (size_t i = 1; i <= dimCount; i++) {
         // 确保维度是常量表达式
         if (node->sons[i]->node_type == ast_operator_type::AST_OP_LEAF_LITERAL_UINT) {
             int dimSize = node->sons[i]->integer_val; // 直接使用节点中的整数值
@@ -2450,7 +2621,7 @@ bool IRGenerator::ir_array_def(ast_node * node)
 
     // 创建数组类型
     Type * elementType = IntegerType::getTypeInt(); // 假设元素类型是int
-    Type * arrayType = new ArrayType(elementType, dimensions);
+    Type * arrayType = ArrayType::get(elementType, dimensions);
 
     // 创建数组变量
     Function * currentFunc = module->getCurrentFunction();
@@ -2461,26 +2632,148 @@ bool IRGenerator::ir_array_def(ast_node * node)
         arrayVar = module->newVarValue(arrayType, arrayName);
         printf("DEBUG: 创建局部数组变量: %s\n", arrayName.c_str());
 
-        // 处理数组初始化 (如果有)
-        if (node->sons.size() > dimensions.size() + 1) {
+        // 局部数组初始化，与{expr}相同，首个元素为表达式的值，其余元素为0
+        if (node->sons.size() > dimCount + 1) {
             ast_node * initNode = node->sons.back();
-            if (initNode) {
-                printf("DEBUG: 数组初始化暂不支持\n");
-                // 目前不处理数组初始化，这需要更复杂的实现
+
+            Value * first;
+            int32_t value;
+            if (evalConstExpr(initNode, value)) {
+                first = module->newConstInt(value);
+            } else {
+                ast_node * expr = ir_visit_ast_node(initNode);
+                if (!expr || !expr->val) {
+                    setLastError("局部数组 " + arrayName + " 的初值计算失败");
+                    return false;
+                }
+                node->blockInsts.addInst(expr->blockInsts);
+                first = expr->val;
             }
+
+            std::vector<Value *> elems(arrayType->getSize() / 4, nullptr);
+            elems[0] = first;
+            ir_local_array_init(node, arrayVar, elems);
         }
     } else {
         // 全局数组变量
         arrayVar = module->newVarValue(arrayType, arrayName);
         printf("DEBUG: 创建全局数组变量: %s\n", arrayName.c_str());
 
-        // 全局数组初始化同样暂不支持
+        // 全局数组初始化，与{expr}相同，首个元素为表达式的值，其余元素为0，初值放到数据段中
+        if (node->sons.size() > dimCount + 1) {
+            int32_t value;
+            if (!evalConstExpr(node->sons.back(), value)) {
+                setLastError("全局数组 " + arrayName + " 的初值必须是常量表达式");
+                return false;
+            }
+
+            static_cast<GlobalVariable *>(arrayVar)->setInitValues({value});
+        }
     }
 
     node->val = arrayVar;
     return true;
 }
 
+/// @brief 计算数组基址加常量偏移的元素地址
+/// @param node AST节点，产生的指令加入其中
+/// @param arrayVar 数组
+/// @param offset 字节偏移
+/// @return 保存元素地址的局部变量
+Value * IRGenerator::newArrayAddress(ast_node * node, Value * arrayVar, int32_t offset)
+{
+    Function * currentFunc = module->getCurrentFunction();
+
+    Type * ptrType = const_cast<Type *>(static_cast<const Type *>(PointerType::get(IntegerType::getTypeInt())));
+    LocalVariable * elemPtr = static_cast<LocalVariable *>(module->newVarValue(ptrType));
+
+    BinaryInstruction * ptrInst = new BinaryInstruction(currentFunc,
+                                                        IRInstOperator::IRINST_OP_ADD_I,
+                                                        arrayVar,
+                                                        module->newConstInt(offset),
+                                                        ptrType);
+    node->blockInsts.addInst(ptrInst);
+    node->blockInsts.addInst(new MoveInstruction(currentFunc, elemPtr, ptrInst));
+
+    return elemPtr;
+}
+
+/// @brief 局部数组的初始化。元素较少时逐个存储初值；否则先整体清零，
+/// 非零常量较多时改为从只读段的模板复制，再逐个存储其余的元素
+/// @param node 数组定义节点，产生的指令加入其中
+/// @param arrayVar 局部数组
+/// @param elems 按行优先展开的各元素的初值，空指针为0
+void IRGenerator::ir_local_array_init(ast_node * node, Value * arrayVar, const std::vector<Value *> & elems)
+{
+    Function * currentFunc = module->getCurrentFunction();
+    int32_t size = arrayVar->getType()->getSize();
+
+    // 非零常量的初值，其余为0，用于模板
+    std::vector<int32_t> constValues(elems.size(), 0);
+    size_t constCount = 0;
+    for (size_t k = 0; k < elems.size(); ++k) {
+        auto constInt = dynamic_cast<ConstInt *>(elems[k]);
+        if (constInt && (constInt->getVal() != 0)) {
+            constValues[k] = constInt->getVal();
+            constCount++;
+        }
+    }
+
+    bool useTemplate = false;
+
+    if (elems.size() > LOCAL_ARRAY_STORE_MAX) {
+
+        useTemplate = (constCount >= LOCAL_ARRAY_TEMPLATE_MIN) &&
+                      (constCount * LOCAL_ARRAY_TEMPLATE_RATIO >= elems.size());
+
+        std::vector<Value *> args{newArrayAddress(node, arrayVar, 0)};
+        Function * callee;
+
+        if (useTemplate) {
+            // 非零常量的初值放到只读段的模板中，整体复制
+            std::string name = "__init_" + currentFunc->getName() + "_" + arrayVar->getName() + "_" +
+                               std::to_string(initTemplateCount++);
+            GlobalVariable * initTemplate = module->newReadOnlyGlobal(arrayVar->getType(), name);
+            initTemplate->setInitValues(constValues);
+
+            callee = module->findFunction("memcpy");
+            args.push_back(newArrayAddress(node, initTemplate, 0));
+        } else {
+            // 整体清零
+            callee = module->findFunction("memset");
+            args.push_back(module->newConstInt(0));
+        }
+        args.push_back(module->newConstInt(size));
+
+        node->blockInsts.addInst(new FuncCallInstruction(currentFunc, callee, args, VoidType::getType()));
+
+        currentFunc->setExistFuncCall(true);
+        if ((int32_t) args.size() > currentFunc->getMaxFuncCallArgCnt()) {
+            currentFunc->setMaxFuncCallArgCnt((int32_t) args.size());
+        }
+    }
+
+    for (size_t k = 0; k < elems.size(); ++k) {
+
+        Value * value = elems[k];
+
+        // 整体清零后不需存储0，从模板复制后不需存储常量
+        if (elems.size() > LOCAL_ARRAY_STORE_MAX) {
+            bool isConst = dynamic_cast<ConstInt *>(value) != nullptr;
+            if (!value || (isConst && (useTemplate || (constValues[k] == 0)))) {
+                continue;
+            }
+        } else if (!value) {
+            value = module->newConstInt(0);
+        }
+
+        MoveInstruction * storeInst =
+            new MoveInstruction(currentFunc, newArrayAddress(node, arrayVar, (int32_t) k * 4), value);
+        storeInst->setIsPointerStore(true);
+        node->blockInsts.addInst(storeInst);
+    }
+}
+
 /// @brief 数组访问节点翻译成线性中间IR
 /// @param node AST节点
 /// @return 翻译是否成功，true：成功，false：失败
@@ -2667,7 +2960,7 @@ Value * IRGenerator::calculateLinearOffset(ast_node * node, InterCode & blockIns
     }
 
     // 获取数组维度信息
-    ArrayType * arrayType = dynamic_cast<ArrayType *>(arrayVar->getType());
+    ArrayType * arrayType = ArrayType::cast(arrayVar->getType());
     if (!arrayType) {
         printf("DEBUG: 数组参数无法获取维度信息，使用简化计算\n");
         return module->newConstInt(0);
@@ -2832,7 +3125,7 @@ Value * IRGenerator::calculateArrayAccessOffset(ast_node * arrayAccessNode, Inte
     }
 
     // 获取数组维度信息
-    ArrayType * arrayType = dynamic_cast<ArrayType *>(arrayVar->getType());
+    ArrayType * arrayType = ArrayType::cast(arrayVar->getType());
     if (!arrayType) {
         // 如果无法获取维度信息，使用简化计算
         printf("DEBUG: 无法获取数组维度信息，使用简化偏移计算\n");
@@ -137,6 +137,20 @@ protected:
     /// 布尔值转整数
     bool bool_to_int(Value * val, Value ** int_val);
 
+    /// @brief 值转换为指定的类型，int与float之间插入sitofp或fptosi指令，其它情况不转换
+    /// @param node AST节点，转换指令加入其中
+    /// @param val 要转换的值
+    /// @param type 目标类型
+    /// @return 转换后的值，常量直接转换
+    Value * convertValue(ast_node * node, Value * val, Type * type);
+
+    /// @brief 算术运算与比较运算的类型提升，有一个操作数为float时另一个操作数转换为float
+    /// @param node AST节点，转换指令加入其中
+    /// @param left 左操作数，转换时被替换
+    /// @param right 右操作数，转换时被替换
+    /// @return true：按float运算，false：按整数运算
+    bool promoteOperands(ast_node * node, Value *& left, Value *& right);
+
     bool ir_assign(ast_node * node);
 
     // 添加数组相关方法的声明-lxg
@@ -145,6 +159,20 @@ protected:
     /// @return 翻译是否成功，true：成功，false：失败
     bool ir_array_def(ast_node * node);
 
+    /// @brief 局部数组的初始化。元素较少时逐个存储初值；否则先整体清零，
+    /// 非零常量较多时改为从只读段的模板复制，再逐个存储其余的元素
+    /// @param node 数组定义节点，产生的指令加入其中
+    /// @param arrayVar 局部数组
+    /// @param elems 按行优先展开的各元素的初值，空指针为0
+    void ir_local_array_init(ast_node * node, Value * arrayVar, const std::vector<Value *> & elems);
+
+    /// @brief 计算数组基址加常量偏移的元素地址
+    /// @param node AST节点，产生的指令加入其中
+    /// @param arrayVar 数组
+    /// @param offset 字节偏移
+    /// @return 保存元素地址的局部变量
+    Value * newArrayAddress(ast_node * node, Value * arrayVar, int32_t offset);
+
     /// @brief 数组访问节点翻译成线性中间IR
     /// @param node AST节点
     /// @return 翻译是否成功，true：成功，false：失败
@@ -243,6 +271,12 @@ protected:
     /// @return 翻译是否成功，true：成功，false：失败
     bool ir_variable_declare(ast_node * node);
 
+    /// @brief 计算常量表达式的值，用于全局变量的初值
+    /// @param node AST节点
+    /// @param value 表达式的值
+    /// @return true：是常量表达式，false：不是
+    bool evalConstExpr(ast_node * node, int32_t & value);
+
     /// @brief 未知节点类型的节点处理
     /// @param node AST节点
     /// @return 翻译是否成功，true：成功，false：失败
@@ -266,8 +300,9 @@ private:
     /// @brief 符号表:模块
     Module * module;
     std::string lastError;
-    /// @brief 全局变量初始值映射-lxg
-    std::unordered_map<std::string, int> globalVarInitValues;
     // 保存函数参数的原始维度信息-lxg
     std::map<std::string, std::map<int, std::vector<int>>> functionParameterDimensions;
+
+    /// @brief 已创建的局部数组初始化模板的个数，用于模板命名
+    int32_t initTemplateCount = 0;
 };
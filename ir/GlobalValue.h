@@ -66,14 +66,13 @@ public:
     GlobalValue(Type * _type, std::string _name) : Constant(_type)
     {
         this->name = _name;
-        this->IRName = IR_GLOBAL_VARNAME_PREFIX + this->name;
     }
 
-    /// @brief 获取名字
+    /// @brief 获取名字，由全局符号名加前缀生成，不单独保存
     /// @return 变量名
     [[nodiscard]] std::string getIRName() const override
     {
-        return IRName;
+        return IR_GLOBAL_VARNAME_PREFIX + this->name;
     }
 
     ///
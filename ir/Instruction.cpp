@@ -17,6 +17,7 @@
 
 #include "Instruction.h"
 #include "Function.h"
+#include "SlabAllocator.h"
 
 /// @brief 构造函数
 /// @param op
@@ -24,7 +25,32 @@
 /// @param srcVal1
 /// @param srcVal2
 Instruction::Instruction(Function * _func, IRInstOperator _op, Type * _type) : User(_type), op(_op), func(_func)
-{}
+{
+    setInlineOperands(inlineOperands, INSTRUCTION_INLINE_OPERANDS);
+}
+
+/// @brief 析构函数
+Instruction::~Instruction()
+{
+    // 内嵌的操作数数组先于User析构，必须在这里清除操作数
+    clearOperands();
+}
+
+/// @brief 指令对象从分块分配器中分配
+/// @param size 字节数
+/// @return void* 内存
+void * Instruction::operator new(std::size_t size)
+{
+    return SlabAllocator::allocate(size);
+}
+
+/// @brief 指令对象归还到分块分配器
+/// @param p 内存
+/// @param size 字节数
+void Instruction::operator delete(void * p, std::size_t size) noexcept
+{
+    SlabAllocator::deallocate(p, size);
+}
 
 /// @brief 获取指令操作码
 /// @return 指令操作码
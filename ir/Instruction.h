@@ -15,10 +15,15 @@
 ///
 #pragma once
 
+#include <cstddef>
+
 #include "User.h"
 
 class Function;
 
+/// @brief 指令内嵌的操作数个数，二元运算、赋值等指令的操作数都在指令对象内，不需另外分配
+#define INSTRUCTION_INLINE_OPERANDS 2
+
 /// @brief IR指令操作码
 enum class IRInstOperator : std::int8_t {
 
@@ -90,6 +95,35 @@ enum class IRInstOperator : std::int8_t {
     /// @brief 数组首地址获取指令
     IRINST_OP_GET_ARRAY_ADDR,
 
+    /// @brief float的加法指令，二元运算
+    IRINST_OP_ADD_F,
+
+    /// @brief float的减法指令，二元运算
+    IRINST_OP_SUB_F,
+
+    /// @brief float的乘法指令，二元运算
+    IRINST_OP_MUL_F,
+
+    /// @brief float的除法指令，二元运算
+    IRINST_OP_DIV_F,
+
+    /// @brief float的一元负号运算指令
+    IRINST_OP_NEG_F,
+
+    /// @brief float比较，结果为i1
+    IRINST_OP_LT_F, // <
+    IRINST_OP_GT_F, // >
+    IRINST_OP_LE_F, // <=
+    IRINST_OP_GE_F, // >=
+    IRINST_OP_EQ_F, // ==
+    IRINST_OP_NE_F, // !=
+
+    /// @brief 有符号整数转换为float，一元运算
+    IRINST_OP_ITOF,
+
+    /// @brief float向零取整转换为有符号整数，一元运算
+    IRINST_OP_FTOI,
+
     /// @brief 最大指令码，也是无效指令
     IRINST_OP_MAX
 };
@@ -106,7 +140,21 @@ public:
     explicit Instruction(Function * _func, IRInstOperator op, Type * _type);
 
     /// @brief 析构函数
-    virtual ~Instruction() = default;
+    ~Instruction() override;
+
+    ///
+    /// @brief 指令对象从分块分配器中分配，减少逐个malloc的开销和内存占用
+    /// @param size 字节数
+    /// @return void* 内存
+    ///
+    static void * operator new(std::size_t size);
+
+    ///
+    /// @brief 指令对象归还到分块分配器
+    /// @param p 内存
+    /// @param size 字节数，虚析构函数保证为实际派生类的大小
+    ///
+    static void operator delete(void * p, std::size_t size) noexcept;
 
     /// @brief 获取指令操作码
     /// @return 指令操作码
@@ -245,4 +293,9 @@ protected:
     /// @brief 变量加载到寄存器中时对应的寄存器编号
     ///
     int32_t loadRegNo = -1;
+
+    ///
+    /// @brief 内嵌的操作数数组，超过时由User改为在堆上分配
+    ///
+    Use inlineOperands[INSTRUCTION_INLINE_OPERANDS];
 };
@@ -32,7 +32,7 @@ BinaryInstruction::BinaryInstruction(Function * _func,
     // addOperand(_srcVal2);
 	// 对于一元操作符，不添加第二个操作数-lxg
 	addOperand(_srcVal1);
-	if (_srcVal2 != nullptr || _op != IRInstOperator::IRINST_OP_NEG_I) {
+	if (_srcVal2 != nullptr || !isUnaryOp(_op)) {
 		addOperand(_srcVal2);
 	}
 }
@@ -89,9 +89,59 @@ void BinaryInstruction::toString(std::string & str)
 		case IRInstOperator::IRINST_OP_NE_I:
 			str = getIRName() + " = icmp ne " + src1->getIRName() + "," + src2->getIRName();
 			break;
+        case IRInstOperator::IRINST_OP_ADD_F:
+            str = getIRName() + " = fadd " + src1->getIRName() + "," + src2->getIRName();
+            break;
+        case IRInstOperator::IRINST_OP_SUB_F:
+            str = getIRName() + " = fsub " + src1->getIRName() + "," + src2->getIRName();
+            break;
+        case IRInstOperator::IRINST_OP_MUL_F:
+            str = getIRName() + " = fmul " + src1->getIRName() + "," + src2->getIRName();
+            break;
+        case IRInstOperator::IRINST_OP_DIV_F:
+            str = getIRName() + " = fdiv " + src1->getIRName() + "," + src2->getIRName();
+            break;
+        case IRInstOperator::IRINST_OP_NEG_F:
+            str = getIRName() + " = fneg " + src1->getIRName();
+            break;
+        case IRInstOperator::IRINST_OP_LT_F:
+            str = getIRName() + " = fcmp lt " + src1->getIRName() + "," + src2->getIRName();
+            break;
+        case IRInstOperator::IRINST_OP_GT_F:
+            str = getIRName() + " = fcmp gt " + src1->getIRName() + "," + src2->getIRName();
+            break;
+        case IRInstOperator::IRINST_OP_LE_F:
+            str = getIRName() + " = fcmp le " + src1->getIRName() + "," + src2->getIRName();
+            break;
+        case IRInstOperator::IRINST_OP_GE_F:
+            str = getIRName() + " = fcmp ge " + src1->getIRName() + "," + src2->getIRName();
+            break;
+        case IRInstOperator::IRINST_OP_EQ_F:
+            str = getIRName() + " = fcmp eq " + src1->getIRName() + "," + src2->getIRName();
+            break;
+        case IRInstOperator::IRINST_OP_NE_F:
+            str = getIRName() + " = fcmp ne " + src1->getIRName() + "," + src2->getIRName();
+            break;
+        case IRInstOperator::IRINST_OP_ITOF:
+            // 有符号整数转换为float
+            str = getIRName() + " = sitofp " + src1->getIRName();
+            break;
+        case IRInstOperator::IRINST_OP_FTOI:
+            // float向零取整转换为有符号整数
+            str = getIRName() + " = fptosi " + src1->getIRName();
+            break;
         default:
             // 未知指令
             Instruction::toString(str);
             break;
     }
-}
\ No newline at end of file
+}
+
+/// @brief 是否是只有一个操作数的运算：求负以及int与float的转换
+/// @param op 操作符
+/// @return true：一元运算，false：二元运算
+bool BinaryInstruction::isUnaryOp(IRInstOperator op)
+{
+    return (op == IRInstOperator::IRINST_OP_NEG_I) || (op == IRInstOperator::IRINST_OP_NEG_F) ||
+           (op == IRInstOperator::IRINST_OP_ITOF) || (op == IRInstOperator::IRINST_OP_FTOI);
+}
@@ -33,4 +33,9 @@ public:
 
     /// @brief 转换成字符串
     void toString(std::string & str) override;
+
+    /// @brief 是否是只有一个操作数的运算：求负以及int与float的转换
+    /// @param op 操作符
+    /// @return true：一元运算，false：二元运算
+    static bool isUnaryOp(IRInstOperator op);
 };
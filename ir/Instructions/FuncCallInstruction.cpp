@@ -30,7 +30,8 @@ FuncCallInstruction::FuncCallInstruction(Function * _func,
 {
     name = calledFunc->getName();
 
-    // 实参拷贝
+    // 实参拷贝，实参较多时一次分配好操作数数组
+    reserveOperands((int32_t) _srcVal.size());
     for (auto & val: _srcVal) {
         addOperand(val);
     }
@@ -50,10 +51,6 @@ void FuncCallInstruction::toString(std::string & str)
         }
     }
 
-    // TODO 这里应该根据函数名查找函数定义或者声明获取函数的类型
-    // 这里假定所有函数返回类型要么是i32，要么是void
-    // 函数参数的类型是i32
-
     if (type->isVoidType()) {
 
         // 函数没有返回值设置
@@ -61,7 +58,7 @@ void FuncCallInstruction::toString(std::string & str)
     } else {
 
         // 函数有返回值要设置到结果变量中
-        str = getIRName() + " = call i32 " + calledFunction->getIRName() + "(";
+        str = getIRName() + " = call " + type->toString() + " " + calledFunction->getIRName() + "(";
     }
 
     // if (argCount == 0) {
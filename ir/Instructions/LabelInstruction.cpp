@@ -29,5 +29,10 @@ LabelInstruction::LabelInstruction(Function * _func)
 /// @param str 返回指令字符串
 void LabelInstruction::toString(std::string & str)
 {
-    str = IRName + ":";
+    str = getIRName() + ":";
+
+    // 有profile数据时以注释的形式显示执行次数
+    if (profileCount >= 0) {
+        str += " ; count=" + std::to_string(profileCount);
+    }
 }
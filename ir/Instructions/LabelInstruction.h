@@ -16,6 +16,7 @@
 ///
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 #include "Instruction.h"
@@ -39,4 +40,51 @@ public:
     /// @param str 返回指令字符串
     ///
     void toString(std::string & str) override;
+
+    ///
+    /// @brief 设置Label的执行次数，来自--profile-use读入的profile数据
+    /// @param count 执行次数
+    ///
+    void setProfileCount(int64_t count)
+    {
+        profileCount = count;
+    }
+
+    ///
+    /// @brief 获取Label的执行次数
+    /// @return 执行次数，-1表示没有profile数据
+    ///
+    [[nodiscard]] int64_t getProfileCount() const
+    {
+        return profileCount;
+    }
+
+    ///
+    /// @brief 设置汇编中Label的编号，汇编Label名由函数名和编号组成，函数内唯一
+    /// @param index 编号
+    ///
+    void setAsmIndex(int32_t index)
+    {
+        asmIndex = index;
+    }
+
+    ///
+    /// @brief 获取汇编中Label的编号
+    /// @return 编号，-1表示没有分配
+    ///
+    [[nodiscard]] int32_t getAsmIndex() const
+    {
+        return asmIndex;
+    }
+
+private:
+    ///
+    /// @brief 执行次数，-1表示没有profile数据
+    ///
+    int64_t profileCount = -1;
+
+    ///
+    /// @brief 汇编中Label的编号
+    ///
+    int32_t asmIndex = -1;
 };
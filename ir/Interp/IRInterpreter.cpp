@@ -0,0 +1,857 @@
+///
+/// @file IRInterpreter.cpp
+/// @brief 线性IR(DragonIR)的解释执行的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <cinttypes>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+
+#include "IRInterpreter.h"
+#include "ConstFloat.h"
+#include "ConstInt.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "MoveInstruction.h"
+#include "ProfileFormat.h"
+
+/// @brief 模拟内存中最低的有效地址，低于它的地址按空指针访问处理
+#define INTERP_NULL_GUARD 16
+
+/// @brief 模拟内存的最大字节数
+#define INTERP_MAX_MEMORY (256u * 1024u * 1024u)
+
+/// @brief 函数调用的最大层次
+#define INTERP_MAX_CALL_DEPTH 1000000
+
+/// @brief 单精度浮点数的运算与比较
+/// @param op 操作码
+/// @param a 左操作数，求负时为操作数
+/// @param b 右操作数
+/// @return 运算结果的位模式，比较运算为0或1
+static int32_t floatOp(IRInstOperator op, float a, float b)
+{
+    switch (op) {
+        case IRInstOperator::IRINST_OP_ADD_F:
+            return ConstFloat::floatToBits(a + b);
+        case IRInstOperator::IRINST_OP_SUB_F:
+            return ConstFloat::floatToBits(a - b);
+        case IRInstOperator::IRINST_OP_MUL_F:
+            return ConstFloat::floatToBits(a * b);
+        case IRInstOperator::IRINST_OP_DIV_F:
+            return ConstFloat::floatToBits(a / b);
+        case IRInstOperator::IRINST_OP_NEG_F:
+            return ConstFloat::floatToBits(-a);
+        case IRInstOperator::IRINST_OP_LT_F:
+            return a < b;
+        case IRInstOperator::IRINST_OP_GT_F:
+            return a > b;
+        case IRInstOperator::IRINST_OP_LE_F:
+            return a <= b;
+        case IRInstOperator::IRINST_OP_GE_F:
+            return a >= b;
+        case IRInstOperator::IRINST_OP_EQ_F:
+            return a == b;
+        case IRInstOperator::IRINST_OP_NE_F:
+            // NaN参与时不相等成立，与C一致
+            return a != b;
+        default:
+            return 0;
+    }
+}
+
+/// @brief 构造函数
+/// @param _module 要执行的模块
+IRInterpreter::IRInterpreter(Module * _module) : module(_module)
+{}
+
+/// @brief 析构函数
+IRInterpreter::~IRInterpreter()
+{
+    for (auto & item: funcInfos) {
+        delete item.second;
+    }
+}
+
+/// @brief 从模拟内存中读取4字节整数
+/// @return true：成功，false：地址越界
+bool IRInterpreter::load(uint32_t addr, int32_t & value)
+{
+    if ((addr < INTERP_NULL_GUARD) || ((uint64_t) addr + 4 > stackTop)) {
+        return false;
+    }
+
+    memcpy(&value, &memory[addr], 4);
+    return true;
+}
+
+/// @brief 向模拟内存写入4字节整数
+/// @return true：成功，false：地址越界
+bool IRInterpreter::store(uint32_t addr, int32_t value)
+{
+    if ((addr < INTERP_NULL_GUARD) || ((uint64_t) addr + 4 > stackTop)) {
+        return false;
+    }
+
+    memcpy(&memory[addr], &value, 4);
+    return true;
+}
+
+/// @brief 设置运行时错误
+/// @param frame 出错的活动记录
+/// @param error 错误信息
+/// @return 恒为false，便于直接返回
+bool IRInterpreter::runtimeError(const Frame & frame, const std::string & error)
+{
+    setLastError("函数" + frame.info->func->getName() + "的第" + std::to_string(frame.pc) + "条指令：" + error);
+    return false;
+}
+
+/// @brief 分配全局变量的模拟内存，并设置全局变量的初值
+void IRInterpreter::allocGlobals()
+{
+    uint32_t addr = INTERP_NULL_GUARD;
+
+    for (auto var: module->getGlobalVariables()) {
+
+        int32_t size = var->getType()->getSize();
+        if (size < 4) {
+            size = 4;
+        }
+
+        globalAddr[var] = addr;
+        addr += ((uint32_t) size + 3) & ~3u;
+    }
+
+    memory.assign(addr, 0);
+
+    for (auto var: module->getGlobalVariables()) {
+        auto & initValues = var->getInitValues();
+        for (size_t k = 0; k < initValues.size(); ++k) {
+            memcpy(&memory[globalAddr[var] + k * 4], &initValues[k], 4);
+        }
+    }
+    stackTop = addr;
+}
+
+/// @brief 获取函数的预处理信息，第一次获取时进行预处理
+/// @param func 函数
+/// @return 预处理信息，失败时为空
+IRInterpreter::FuncInfo * IRInterpreter::getFuncInfo(Function * func)
+{
+    auto pIter = funcInfos.find(func);
+    if (pIter != funcInfos.end()) {
+        return pIter->second;
+    }
+
+    FuncInfo * info = new FuncInfo();
+    info->func = func;
+    funcInfos[func] = info;
+
+    if (!prepare(info)) {
+        return nullptr;
+    }
+
+    return info;
+}
+
+/// @brief 函数的指令预处理成便于执行的形式
+/// @param info 预处理信息
+/// @return true：成功，false：失败
+bool IRInterpreter::prepare(FuncInfo * info)
+{
+    Function * func = info->func;
+
+    // 形参、标量局部变量与有结果的指令使用值槽，局部数组在局部数组区中分配
+    std::unordered_map<Value *, Operand> operands;
+
+    for (auto param: func->getParams()) {
+        operands[param] = {OperandKind::SLOT, info->slotCount++};
+    }
+
+    for (auto var: func->getVarValues()) {
+        if (var->getType()->isArrayType()) {
+            operands[var] = {OperandKind::FRAME_ADDR, info->frameSize};
+            info->frameSize += (var->getType()->getSize() + 3) & ~3;
+        } else {
+            operands[var] = {OperandKind::SLOT, info->slotCount++};
+        }
+    }
+
+    auto & insts = func->getInterCode().getInsts();
+
+    std::unordered_map<Instruction *, int32_t> labelIndex;
+    for (size_t k = 0; k < insts.size(); ++k) {
+        if (insts[k]->getOp() == IRInstOperator::IRINST_OP_LABEL) {
+            labelIndex[insts[k]] = (int32_t) k;
+        }
+        if (insts[k]->hasResultValue()) {
+            operands[insts[k]] = {OperandKind::SLOT, info->slotCount++};
+        }
+    }
+
+    // 操作数转换，全局数组的地址固定，按常量处理
+    auto toOperand = [&](Value * val, Operand & operand) -> bool {
+        if (Instanceof(constVal, ConstInt *, val)) {
+            operand = {OperandKind::CONST, constVal->getVal()};
+            return true;
+        }
+
+        // 浮点常量按位模式保存，运算时再转换
+        if (Instanceof(constFloat, ConstFloat *, val)) {
+            operand = {OperandKind::CONST, constFloat->getBits()};
+            return true;
+        }
+
+        auto pIter = operands.find(val);
+        if (pIter != operands.end()) {
+            operand = pIter->second;
+            return true;
+        }
+
+        auto gIter = globalAddr.find(val);
+        if (gIter != globalAddr.end()) {
+            bool isArray = val->getType()->isArrayType();
+            operand = {isArray ? OperandKind::CONST : OperandKind::GLOBAL, (int32_t) gIter->second};
+            return true;
+        }
+
+        setLastError("函数" + func->getName() + "中的操作数不能识别：" + val->getName());
+        return false;
+    };
+
+    auto toLabel = [&](Instruction * label, int32_t & target) -> bool {
+        auto pIter = labelIndex.find(label);
+        if (pIter == labelIndex.end()) {
+            setLastError("函数" + func->getName() + "中跳转到的Label不在函数内");
+            return false;
+        }
+        target = pIter->second;
+        return true;
+    };
+
+    info->code.resize(insts.size());
+    info->counts.assign(insts.size(), 0);
+
+    for (size_t k = 0; k < insts.size(); ++k) {
+
+        Instruction * inst = insts[k];
+        Code & code = info->code[k];
+        code.op = inst->getOp();
+
+        bool ok = true;
+
+        switch (code.op) {
+            case IRInstOperator::IRINST_OP_ENTRY:
+            case IRInstOperator::IRINST_OP_LABEL:
+            case IRInstOperator::IRINST_OP_ARG:
+                // 实参由函数调用指令的操作数给出，ARG指令不需要执行
+                break;
+
+            case IRInstOperator::IRINST_OP_EXIT:
+                if (inst->getOperandsNum() > 0) {
+                    ok = toOperand(inst->getOperand(0), code.src1);
+                }
+                break;
+
+            case IRInstOperator::IRINST_OP_GOTO:
+            case IRInstOperator::IRINST_OP_BRANCH: {
+                auto * gotoInst = dynamic_cast<GotoInstruction *>(inst);
+                if (!gotoInst) {
+                    setLastError("函数" + func->getName() + "中的跳转指令格式错误");
+                    return false;
+                }
+                ok = toLabel(gotoInst->getTarget(), code.target);
+                if (ok && gotoInst->getFalseTarget()) {
+                    ok = toOperand(inst->getOperand(0), code.src1) && toLabel(gotoInst->getFalseTarget(), code.falseTarget);
+                }
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_ASSIGN: {
+                auto * moveInst = static_cast<MoveInstruction *>(inst);
+                code.moveKind = moveInst->getIsPointerStore() ? 1 : (moveInst->getIsPointerLoad() ? 2 : 0);
+                ok = toOperand(inst->getOperand(0), code.dst) && toOperand(inst->getOperand(1), code.src1);
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_STORE_PTR:
+                // 操作数0为地址，操作数1为要存储的值
+                code.moveKind = 1;
+                ok = toOperand(inst->getOperand(0), code.dst) && toOperand(inst->getOperand(1), code.src1);
+                break;
+
+            case IRInstOperator::IRINST_OP_LOAD_PTR:
+                // 操作数0为结果变量，操作数1为地址
+                code.moveKind = 2;
+                ok = toOperand(inst->getOperand(0), code.dst) && toOperand(inst->getOperand(1), code.src1);
+                break;
+
+            case IRInstOperator::IRINST_OP_GET_ARRAY_ADDR:
+                // 数组作为操作数时的值就是它的地址
+                ok = toOperand(inst, code.dst) && toOperand(inst->getOperand(0), code.src1);
+                break;
+
+            case IRInstOperator::IRINST_OP_FUNC_CALL: {
+                CallSite site;
+                site.callee = static_cast<FuncCallInstruction *>(inst)->calledFunction;
+
+                if (site.callee->isBuiltin()) {
+                    static const std::unordered_map<std::string, Builtin> builtins = {
+                        {"getint", Builtin::GETINT},
+                        {"getch", Builtin::GETCH},
+                        {"getarray", Builtin::GETARRAY},
+                        {"putint", Builtin::PUTINT},
+                        {"putch", Builtin::PUTCH},
+                        {"putarray", Builtin::PUTARRAY},
+                        {"putstr", Builtin::PUTSTR},
+                        {"getfloat", Builtin::GETFLOAT},
+                        {"putfloat", Builtin::PUTFLOAT},
+                        {"memset", Builtin::MEMSET},
+                        {"memcpy", Builtin::MEMCPY},
+                        {PROFILE_DUMP_FUNC, Builtin::PROF_DUMP},
+                    };
+                    auto bIter = builtins.find(site.callee->getName());
+                    site.builtin = (bIter == builtins.end()) ? Builtin::UNSUPPORTED : bIter->second;
+                }
+
+                for (int32_t a = 0; ok && a < inst->getOperandsNum(); ++a) {
+                    Operand arg;
+                    ok = toOperand(inst->getOperand(a), arg);
+                    site.args.push_back(arg);
+                }
+
+                if (inst->hasResultValue()) {
+                    ok = ok && toOperand(inst, code.dst);
+                }
+
+                code.call = (int32_t) info->calls.size();
+                info->calls.push_back(std::move(site));
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_NEG_I:
+            case IRInstOperator::IRINST_OP_NEG_F:
+            case IRInstOperator::IRINST_OP_ITOF:
+            case IRInstOperator::IRINST_OP_FTOI:
+                ok = toOperand(inst, code.dst) && toOperand(inst->getOperand(0), code.src1);
+                break;
+
+            case IRInstOperator::IRINST_OP_ADD_I:
+            case IRInstOperator::IRINST_OP_SUB_I:
+            case IRInstOperator::IRINST_OP_MUL_I:
+            case IRInstOperator::IRINST_OP_DIV_I:
+            case IRInstOperator::IRINST_OP_MOD_I:
+            case IRInstOperator::IRINST_OP_LT_I:
+            case IRInstOperator::IRINST_OP_GT_I:
+            case IRInstOperator::IRINST_OP_LE_I:
+            case IRInstOperator::IRINST_OP_GE_I:
+            case IRInstOperator::IRINST_OP_EQ_I:
+            case IRInstOperator::IRINST_OP_NE_I:
+            case IRInstOperator::IRINST_OP_ADD_F:
+            case IRInstOperator::IRINST_OP_SUB_F:
+            case IRInstOperator::IRINST_OP_MUL_F:
+            case IRInstOperator::IRINST_OP_DIV_F:
+            case IRInstOperator::IRINST_OP_LT_F:
+            case IRInstOperator::IRINST_OP_GT_F:
+            case IRInstOperator::IRINST_OP_LE_F:
+            case IRInstOperator::IRINST_OP_GE_F:
+            case IRInstOperator::IRINST_OP_EQ_F:
+            case IRInstOperator::IRINST_OP_NE_F:
+            case IRInstOperator::IRINST_OP_ADD_PTR:
+            case IRInstOperator::IRINST_OP_ARRAY_ADDR:
+                // 指针加法与数组元素地址计算都是基址加字节偏移
+                ok = toOperand(inst, code.dst) && toOperand(inst->getOperand(0), code.src1) &&
+                     toOperand(inst->getOperand(1), code.src2);
+                break;
+
+            default:
+                setLastError("函数" + func->getName() + "中含有不支持解释执行的指令");
+                return false;
+        }
+
+        if (!ok) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// @brief 执行内置函数
+/// @param frame 调用者的活动记录
+/// @param site 调用点
+/// @param result 返回值
+/// @return true：成功，false：运行时错误
+bool IRInterpreter::callBuiltin(Frame & frame, CallSite & site, int32_t & result)
+{
+    std::vector<int32_t> args;
+    for (auto & arg: site.args) {
+        args.push_back(eval(frame, arg));
+    }
+
+    result = 0;
+
+    switch (site.builtin) {
+        case Builtin::GETINT:
+            if (fscanf(in, "%d", &result) != 1) {
+                result = 0;
+            }
+            return true;
+
+        case Builtin::GETCH: {
+            int ch = fgetc(in);
+            result = (ch == EOF) ? -1 : ch;
+            return true;
+        }
+
+        case Builtin::GETARRAY: {
+            if (fscanf(in, "%d", &result) != 1) {
+                result = 0;
+            }
+            for (int32_t k = 0; k < result; ++k) {
+                int32_t value = 0;
+                if (fscanf(in, "%d", &value) != 1) {
+                    value = 0;
+                }
+                if (!store((uint32_t) args[0] + (uint32_t) k * 4, value)) {
+                    return runtimeError(frame, "getarray访问越界");
+                }
+            }
+            return true;
+        }
+
+        case Builtin::PUTINT:
+            fprintf(out, "%d", args[0]);
+            return true;
+
+        case Builtin::PUTCH:
+            fputc((char) args[0], out);
+            return true;
+
+        case Builtin::PUTARRAY:
+            fprintf(out, "%d:", args[0]);
+            for (int32_t k = 0; k < args[0]; ++k) {
+                int32_t value;
+                if (!load((uint32_t) args[1] + (uint32_t) k * 4, value)) {
+                    return runtimeError(frame, "putarray访问越界");
+                }
+                fprintf(out, " %d", value);
+            }
+            fputc('\n', out);
+            return true;
+
+        case Builtin::GETFLOAT: {
+            // 与tests/std.c相同按%a读取，也接受十进制形式
+            float value;
+            if (fscanf(in, "%a", &value) != 1) {
+                value = 0.0f;
+            }
+            result = ConstFloat::floatToBits(value);
+            return true;
+        }
+
+        case Builtin::PUTFLOAT:
+            fprintf(out, "%a", (double) ConstFloat::bitsToFloat(args[0]));
+            return true;
+
+        case Builtin::PUTSTR:
+            for (uint32_t addr = (uint32_t) args[0];; ++addr) {
+                if ((addr < INTERP_NULL_GUARD) || (addr >= stackTop)) {
+                    return runtimeError(frame, "putstr访问越界");
+                }
+                if (memory[addr] == 0) {
+                    break;
+                }
+                fputc(memory[addr], out);
+            }
+            return true;
+
+        case Builtin::MEMSET:
+        case Builtin::MEMCPY: {
+            // 按字节填充或复制，目的与源的范围都要在模拟内存内
+            uint32_t dst = (uint32_t) args[0];
+            uint32_t src = (uint32_t) args[1];
+            uint32_t size = (uint32_t) args[2];
+            if ((dst < INTERP_NULL_GUARD) || ((uint64_t) dst + size > stackTop)) {
+                return runtimeError(frame, site.callee->getName() + "访问越界");
+            }
+            if (site.builtin == Builtin::MEMSET) {
+                memset(&memory[dst], args[1], size);
+            } else {
+                if ((src < INTERP_NULL_GUARD) || ((uint64_t) src + size > stackTop)) {
+                    return runtimeError(frame, "memcpy访问越界");
+                }
+                memmove(&memory[dst], &memory[src], size);
+            }
+            return true;
+        }
+
+        case Builtin::PROF_DUMP: {
+            // 与tests/std.c中的运行时输出相同格式的profile
+            const char * fileName = getenv(PROFILE_FILE_ENV);
+            if (!fileName || !fileName[0]) {
+                fileName = PROFILE_DEFAULT_FILE;
+            }
+
+            FILE * fp = fopen(fileName, "w");
+            if (!fp) {
+                return true;
+            }
+
+            fprintf(fp, "%s %d\n%u %d\n", PROFILE_MAGIC, PROFILE_VERSION, (unsigned) args[0], args[1]);
+            for (int32_t k = 0; k < args[1]; ++k) {
+                int32_t value;
+                if (!load((uint32_t) args[2] + (uint32_t) k * 4, value)) {
+                    fclose(fp);
+                    return runtimeError(frame, std::string(PROFILE_DUMP_FUNC) + "访问越界");
+                }
+                fprintf(fp, "%u\n", (unsigned) value);
+            }
+
+            fclose(fp);
+            return true;
+        }
+
+        default:
+            return runtimeError(frame, "不支持解释执行的内置函数：" + site.callee->getName());
+    }
+}
+
+/// @brief 执行main函数
+/// @param exitCode main函数的返回值
+/// @return true：成功，false：运行时错误，如除零、访问越界等
+bool IRInterpreter::run(int32_t & exitCode)
+{
+    Function * mainFunc = module->findFunction("main");
+    if (!mainFunc || mainFunc->isBuiltin()) {
+        setLastError("没有main函数");
+        return false;
+    }
+
+    allocGlobals();
+
+    std::vector<Frame> frames;
+
+    // 新建活动记录，局部数组区清零，使得每次执行的结果确定
+    auto pushFrame = [&](FuncInfo * info) -> bool {
+        uint32_t frameAddr = stackTop;
+        uint64_t newTop = (uint64_t) stackTop + (uint32_t) info->frameSize;
+        if ((newTop > INTERP_MAX_MEMORY) || (frames.size() >= INTERP_MAX_CALL_DEPTH)) {
+            setLastError("调用函数" + info->func->getName() + "时栈溢出");
+            return false;
+        }
+        if (newTop > memory.size()) {
+            memory.resize(std::max<uint64_t>(newTop, std::min<uint64_t>(memory.size() * 2, INTERP_MAX_MEMORY)));
+        }
+        memset(&memory[frameAddr], 0, (size_t) info->frameSize);
+        stackTop = (uint32_t) newTop;
+
+        frames.push_back({info, 0, slots.size(), frameAddr});
+        slots.resize(slots.size() + info->slotCount, 0);
+        info->callCount++;
+        return true;
+    };
+
+    FuncInfo * mainInfo = getFuncInfo(mainFunc);
+    if (!mainInfo || !pushFrame(mainInfo)) {
+        return false;
+    }
+
+    while (true) {
+
+        Frame & frame = frames.back();
+        FuncInfo * info = frame.info;
+
+        if (frame.pc >= info->code.size()) {
+            return runtimeError(frame, "函数没有执行exit指令");
+        }
+
+        const Code & code = info->code[frame.pc];
+        info->counts[frame.pc]++;
+        totalInstCount++;
+        frame.pc++;
+
+        switch (code.op) {
+            case IRInstOperator::IRINST_OP_ENTRY:
+            case IRInstOperator::IRINST_OP_LABEL:
+            case IRInstOperator::IRINST_OP_ARG:
+                break;
+
+            case IRInstOperator::IRINST_OP_GOTO:
+            case IRInstOperator::IRINST_OP_BRANCH:
+                if ((code.falseTarget < 0) || (eval(frame, code.src1) != 0)) {
+                    frame.pc = (size_t) code.target;
+                } else {
+                    frame.pc = (size_t) code.falseTarget;
+                }
+                break;
+
+            case IRInstOperator::IRINST_OP_ASSIGN:
+            case IRInstOperator::IRINST_OP_STORE_PTR:
+            case IRInstOperator::IRINST_OP_LOAD_PTR:
+            case IRInstOperator::IRINST_OP_GET_ARRAY_ADDR: {
+                int32_t value = eval(frame, code.src1);
+                if (code.moveKind == 1) {
+                    // 指针存储，目的操作数的值为地址
+                    if (!store((uint32_t) eval(frame, code.dst), value)) {
+                        return runtimeError(frame, "写内存越界");
+                    }
+                    break;
+                }
+                if ((code.moveKind == 2) && !load((uint32_t) value, value)) {
+                    return runtimeError(frame, "读内存越界");
+                }
+                if (!assign(frame, code.dst, value)) {
+                    return runtimeError(frame, "写全局变量越界");
+                }
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_NEG_I:
+                slots[frame.slotBase + code.dst.value] = (int32_t) (0u - (uint32_t) eval(frame, code.src1));
+                break;
+
+            case IRInstOperator::IRINST_OP_ADD_I:
+            case IRInstOperator::IRINST_OP_ADD_PTR:
+            case IRInstOperator::IRINST_OP_ARRAY_ADDR:
+                // 按32位无符号运算，溢出时回绕
+                slots[frame.slotBase + code.dst.value] =
+                    (int32_t) ((uint32_t) eval(frame, code.src1) + (uint32_t) eval(frame, code.src2));
+                break;
+
+            case IRInstOperator::IRINST_OP_SUB_I:
+                slots[frame.slotBase + code.dst.value] =
+                    (int32_t) ((uint32_t) eval(frame, code.src1) - (uint32_t) eval(frame, code.src2));
+                break;
+
+            case IRInstOperator::IRINST_OP_MUL_I:
+                slots[frame.slotBase + code.dst.value] =
+                    (int32_t) ((uint32_t) eval(frame, code.src1) * (uint32_t) eval(frame, code.src2));
+                break;
+
+            case IRInstOperator::IRINST_OP_DIV_I:
+            case IRInstOperator::IRINST_OP_MOD_I: {
+                int32_t a = eval(frame, code.src1);
+                int32_t b = eval(frame, code.src2);
+                if (b == 0) {
+                    return runtimeError(frame, "除数为0");
+                }
+
+                // INT_MIN / -1 溢出，结果与ARM32的sdiv一致
+                int32_t value;
+                if ((a == INT32_MIN) && (b == -1)) {
+                    value = (code.op == IRInstOperator::IRINST_OP_DIV_I) ? INT32_MIN : 0;
+                } else {
+                    value = (code.op == IRInstOperator::IRINST_OP_DIV_I) ? a / b : a % b;
+                }
+                slots[frame.slotBase + code.dst.value] = value;
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_LT_I:
+                slots[frame.slotBase + code.dst.value] = eval(frame, code.src1) < eval(frame, code.src2);
+                break;
+            case IRInstOperator::IRINST_OP_GT_I:
+                slots[frame.slotBase + code.dst.value] = eval(frame, code.src1) > eval(frame, code.src2);
+                break;
+            case IRInstOperator::IRINST_OP_LE_I:
+                slots[frame.slotBase + code.dst.value] = eval(frame, code.src1) <= eval(frame, code.src2);
+                break;
+            case IRInstOperator::IRINST_OP_GE_I:
+                slots[frame.slotBase + code.dst.value] = eval(frame, code.src1) >= eval(frame, code.src2);
+                break;
+            case IRInstOperator::IRINST_OP_EQ_I:
+                slots[frame.slotBase + code.dst.value] = eval(frame, code.src1) == eval(frame, code.src2);
+                break;
+            case IRInstOperator::IRINST_OP_NE_I:
+                slots[frame.slotBase + code.dst.value] = eval(frame, code.src1) != eval(frame, code.src2);
+                break;
+
+            case IRInstOperator::IRINST_OP_NEG_F:
+                slots[frame.slotBase + code.dst.value] =
+                    floatOp(code.op, ConstFloat::bitsToFloat(eval(frame, code.src1)), 0.0f);
+                break;
+
+            case IRInstOperator::IRINST_OP_ADD_F:
+            case IRInstOperator::IRINST_OP_SUB_F:
+            case IRInstOperator::IRINST_OP_MUL_F:
+            case IRInstOperator::IRINST_OP_DIV_F:
+            case IRInstOperator::IRINST_OP_LT_F:
+            case IRInstOperator::IRINST_OP_GT_F:
+            case IRInstOperator::IRINST_OP_LE_F:
+            case IRInstOperator::IRINST_OP_GE_F:
+            case IRInstOperator::IRINST_OP_EQ_F:
+            case IRInstOperator::IRINST_OP_NE_F:
+                slots[frame.slotBase + code.dst.value] =
+                    floatOp(code.op,
+                            ConstFloat::bitsToFloat(eval(frame, code.src1)),
+                            ConstFloat::bitsToFloat(eval(frame, code.src2)));
+                break;
+
+            case IRInstOperator::IRINST_OP_ITOF:
+                slots[frame.slotBase + code.dst.value] = ConstFloat::floatToBits((float) eval(frame, code.src1));
+                break;
+
+            case IRInstOperator::IRINST_OP_FTOI: {
+                // 与ARM32的vcvt.s32.f32一致，向零舍入，NaN为0，超出范围时饱和
+                float value = ConstFloat::bitsToFloat(eval(frame, code.src1));
+                int32_t result;
+                if (value != value) {
+                    result = 0;
+                } else if (value >= 2147483648.0f) {
+                    result = INT32_MAX;
+                } else if (value <= -2147483648.0f) {
+                    result = INT32_MIN;
+                } else {
+                    result = (int32_t) value;
+                }
+                slots[frame.slotBase + code.dst.value] = result;
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_FUNC_CALL: {
+                CallSite & site = info->calls[code.call];
+
+                if (site.builtin != Builtin::NONE) {
+                    int32_t result;
+                    if (!callBuiltin(frame, site, result)) {
+                        return false;
+                    }
+                    if (code.dst.kind != OperandKind::NONE) {
+                        slots[frame.slotBase + code.dst.value] = result;
+                    }
+                    break;
+                }
+
+                if (!site.calleeInfo) {
+                    site.calleeInfo = getFuncInfo(site.callee);
+                    if (!site.calleeInfo) {
+                        return false;
+                    }
+                }
+
+                // 实参先求值，新活动记录入栈后frame引用失效
+                std::vector<int32_t> args;
+                args.reserve(site.args.size());
+                for (auto & arg: site.args) {
+                    args.push_back(eval(frame, arg));
+                }
+
+                if (args.size() != site.callee->getParams().size()) {
+                    return runtimeError(frame, "调用函数" + site.callee->getName() + "的实参个数不正确");
+                }
+
+                if (!pushFrame(site.calleeInfo)) {
+                    return false;
+                }
+
+                // 形参为最前面的值槽
+                std::copy(args.begin(), args.end(), slots.begin() + (long) frames.back().slotBase);
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_EXIT: {
+                int32_t result = (code.src1.kind == OperandKind::NONE) ? 0 : eval(frame, code.src1);
+
+                stackTop = frame.frameAddr;
+                slots.resize(frame.slotBase);
+                frames.pop_back();
+
+                if (frames.empty()) {
+                    exitCode = result;
+                    fflush(out);
+                    return true;
+                }
+
+                // 返回值写入调用者的函数调用指令的结果
+                Frame & caller = frames.back();
+                const Code & callCode = caller.info->code[caller.pc - 1];
+                if (callCode.dst.kind != OperandKind::NONE) {
+                    slots[caller.slotBase + callCode.dst.value] = result;
+                }
+                break;
+            }
+
+            default:
+                return runtimeError(frame, "不支持解释执行的指令");
+        }
+    }
+}
+
+/// @brief 获取指令的执行次数，Label指令的执行次数即进入该Label的次数
+/// @param inst 指令
+/// @return 执行次数
+uint64_t IRInterpreter::getInstCount(Instruction * inst)
+{
+    auto pIter = funcInfos.find(inst->getFunction());
+    if ((pIter == funcInfos.end()) || !pIter->second) {
+        return 0;
+    }
+
+    auto & insts = inst->getFunction()->getInterCode().getInsts();
+    for (size_t k = 0; k < insts.size() && k < pIter->second->counts.size(); ++k) {
+        if (insts[k] == inst) {
+            return pIter->second->counts[k];
+        }
+    }
+
+    return 0;
+}
+
+/// @brief 获取函数的调用次数
+/// @param func 函数
+/// @return 调用次数
+uint64_t IRInterpreter::getCallCount(Function * func)
+{
+    auto pIter = funcInfos.find(func);
+    return (pIter == funcInfos.end()) ? 0 : pIter->second->callCount;
+}
+
+/// @brief 输出执行次数统计，IR指令前加上执行次数，要求IR已经重命名
+/// @param os 输出流
+void IRInterpreter::printProfile(OutputStream & os)
+{
+    os.printf("; 共执行%" PRIu64 "条指令\n", totalInstCount);
+
+    std::string instStr;
+
+    for (auto func: module->getFunctionList()) {
+
+        if (func->isBuiltin()) {
+            continue;
+        }
+
+        auto pIter = funcInfos.find(func);
+        FuncInfo * info = (pIter == funcInfos.end()) ? nullptr : pIter->second;
+
+        os.printf("\n; %s: 调用%" PRIu64 "次\n", func->getIRName().c_str(), info ? info->callCount : (uint64_t) 0);
+
+        auto & insts = func->getInterCode().getInsts();
+        for (size_t k = 0; k < insts.size(); ++k) {
+
+            instStr.clear();
+            insts[k]->toString(instStr);
+            if (instStr.empty()) {
+                continue;
+            }
+
+            uint64_t count = (info && k < info->counts.size()) ? info->counts[k] : 0;
+            os.printf("%12" PRIu64 "  %s%s\n",
+                      count,
+                      insts[k]->getOp() == IRInstOperator::IRINST_OP_LABEL ? "" : "\t",
+                      instStr.c_str());
+        }
+    }
+}
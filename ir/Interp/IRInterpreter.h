@@ -0,0 +1,305 @@
+///
+/// @file IRInterpreter.h
+/// @brief 线性IR(DragonIR)的解释执行，同时统计每条指令的执行次数
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Module.h"
+#include "OutputStream.h"
+
+///
+/// @brief 线性IR解释器，从main函数开始执行模块。
+/// 全局变量与局部数组放在模拟的字节寻址内存中，指针为模拟内存中的地址；
+/// 标量的局部变量、形参与临时变量保存在每个函数调用的值槽中。
+/// 函数调用不使用宿主的栈，递归调用的层次只受模拟内存大小的限制。
+/// 每个函数在第一次被调用时把指令预处理成便于执行的形式，同时分配统计执行次数的计数器
+///
+class IRInterpreter {
+
+public:
+    /// @brief 构造函数
+    /// @param _module 要执行的模块
+    explicit IRInterpreter(Module * _module);
+
+    /// @brief 析构函数
+    ~IRInterpreter();
+
+    /// @brief 设置内置函数的输入与输出，默认为标准输入与标准输出
+    /// @param _in 输入
+    /// @param _out 输出
+    void setIO(FILE * _in, FILE * _out)
+    {
+        in = _in;
+        out = _out;
+    }
+
+    /// @brief 执行main函数
+    /// @param exitCode main函数的返回值
+    /// @return true：成功，false：运行时错误，如除零、访问越界等
+    bool run(int32_t & exitCode);
+
+    /// @brief 获取指令的执行次数，Label指令的执行次数即进入该Label的次数
+    /// @param inst 指令
+    /// @return 执行次数
+    uint64_t getInstCount(Instruction * inst);
+
+    /// @brief 获取函数的调用次数
+    /// @param func 函数
+    /// @return 调用次数
+    uint64_t getCallCount(Function * func);
+
+    /// @brief 获取执行的指令总数
+    /// @return 指令总数
+    [[nodiscard]] uint64_t getTotalInstCount() const
+    {
+        return totalInstCount;
+    }
+
+    /// @brief 输出执行次数统计，IR指令前加上执行次数，要求IR已经重命名
+    /// @param os 输出流
+    void printProfile(OutputStream & os);
+
+    void setLastError(const std::string & error)
+    {
+        lastError = error;
+    }
+    std::string getLastError() const
+    {
+        return lastError;
+    }
+
+protected:
+    /// @brief 操作数的种类
+    enum class OperandKind : uint8_t {
+        /// @brief 无操作数
+        NONE,
+
+        /// @brief 常量，全局数组的地址也是常量
+        CONST,
+
+        /// @brief 函数调用的值槽
+        SLOT,
+
+        /// @brief 全局标量变量，值为模拟内存中的地址
+        GLOBAL,
+
+        /// @brief 局部数组，值为相对函数调用的数组区的偏移
+        FRAME_ADDR,
+    };
+
+    /// @brief 预处理后的操作数
+    struct Operand {
+        OperandKind kind = OperandKind::NONE;
+        int32_t value = 0;
+    };
+
+    /// @brief 内置函数
+    enum class Builtin : uint8_t {
+        NONE,
+        GETINT,
+        GETCH,
+        GETARRAY,
+        PUTINT,
+        PUTCH,
+        PUTARRAY,
+        PUTSTR,
+        GETFLOAT,
+        PUTFLOAT,
+        MEMSET,
+        MEMCPY,
+        PROF_DUMP,
+        UNSUPPORTED,
+    };
+
+    struct FuncInfo;
+
+    /// @brief 函数调用点
+    struct CallSite {
+        /// @brief 被调用函数
+        Function * callee = nullptr;
+
+        /// @brief 被调用函数的预处理信息，第一次调用时设置
+        FuncInfo * calleeInfo = nullptr;
+
+        /// @brief 内置函数
+        Builtin builtin = Builtin::NONE;
+
+        /// @brief 实参
+        std::vector<Operand> args;
+    };
+
+    /// @brief 预处理后的指令
+    struct Code {
+        /// @brief 操作码
+        IRInstOperator op;
+
+        /// @brief 赋值指令的种类，0：普通赋值，1：指针存储，2：指针读取
+        uint8_t moveKind = 0;
+
+        /// @brief 结果
+        Operand dst;
+
+        /// @brief 源操作数
+        Operand src1;
+        Operand src2;
+
+        /// @brief 跳转目标的指令下标，条件跳转时为真出口
+        int32_t target = -1;
+
+        /// @brief 条件跳转的假出口的指令下标
+        int32_t falseTarget = -1;
+
+        /// @brief 函数调用点的下标
+        int32_t call = -1;
+    };
+
+    /// @brief 函数的预处理信息
+    struct FuncInfo {
+        Function * func = nullptr;
+
+        /// @brief 预处理后的指令，与函数的指令一一对应
+        std::vector<Code> code;
+
+        /// @brief 每条指令的执行次数
+        std::vector<uint64_t> counts;
+
+        /// @brief 函数调用点
+        std::vector<CallSite> calls;
+
+        /// @brief 值槽的个数
+        int32_t slotCount = 0;
+
+        /// @brief 局部数组占用的字节数
+        int32_t frameSize = 0;
+
+        /// @brief 调用次数
+        uint64_t callCount = 0;
+    };
+
+    /// @brief 函数调用的活动记录
+    struct Frame {
+        FuncInfo * info;
+
+        /// @brief 下一条要执行的指令下标
+        size_t pc;
+
+        /// @brief 值槽的起始下标
+        size_t slotBase;
+
+        /// @brief 局部数组区在模拟内存中的起始地址
+        uint32_t frameAddr;
+    };
+
+    /// @brief 获取函数的预处理信息，第一次获取时进行预处理
+    /// @param func 函数
+    /// @return 预处理信息，失败时为空
+    FuncInfo * getFuncInfo(Function * func);
+
+    /// @brief 函数的指令预处理成便于执行的形式
+    /// @param info 预处理信息
+    /// @return true：成功，false：失败
+    bool prepare(FuncInfo * info);
+
+    /// @brief 分配全局变量的模拟内存，并设置全局变量的初值
+    void allocGlobals();
+
+    /// @brief 执行内置函数
+    /// @param frame 调用者的活动记录
+    /// @param site 调用点
+    /// @param result 返回值
+    /// @return true：成功，false：运行时错误
+    bool callBuiltin(Frame & frame, CallSite & site, int32_t & result);
+
+    /// @brief 计算操作数的值
+    int32_t eval(const Frame & frame, const Operand & operand)
+    {
+        switch (operand.kind) {
+            case OperandKind::CONST:
+                return operand.value;
+            case OperandKind::SLOT:
+                return slots[frame.slotBase + operand.value];
+            case OperandKind::GLOBAL: {
+                int32_t value = 0;
+                load((uint32_t) operand.value, value);
+                return value;
+            }
+            case OperandKind::FRAME_ADDR:
+                return (int32_t) (frame.frameAddr + (uint32_t) operand.value);
+            default:
+                return 0;
+        }
+    }
+
+    /// @brief 写入结果
+    /// @return true：成功，false：运行时错误
+    bool assign(const Frame & frame, const Operand & operand, int32_t value)
+    {
+        if (operand.kind == OperandKind::SLOT) {
+            slots[frame.slotBase + operand.value] = value;
+            return true;
+        }
+
+        return (operand.kind == OperandKind::GLOBAL) && store((uint32_t) operand.value, value);
+    }
+
+    /// @brief 从模拟内存中读取4字节整数
+    /// @return true：成功，false：地址越界
+    bool load(uint32_t addr, int32_t & value);
+
+    /// @brief 向模拟内存写入4字节整数
+    /// @return true：成功，false：地址越界
+    bool store(uint32_t addr, int32_t value);
+
+    /// @brief 设置运行时错误
+    /// @param frame 出错的活动记录
+    /// @param error 错误信息
+    /// @return 恒为false，便于直接返回
+    bool runtimeError(const Frame & frame, const std::string & error);
+
+private:
+    /// @brief 要执行的模块
+    Module * module;
+
+    /// @brief 内置函数的输入
+    FILE * in = stdin;
+
+    /// @brief 内置函数的输出
+    FILE * out = stdout;
+
+    /// @brief 模拟内存，低地址为全局变量，其后为各函数调用的局部数组区
+    std::vector<uint8_t> memory;
+
+    /// @brief 局部数组区的栈顶
+    uint32_t stackTop = 0;
+
+    /// @brief 全局变量的地址
+    std::unordered_map<Value *, uint32_t> globalAddr;
+
+    /// @brief 函数的预处理信息
+    std::unordered_map<Function *, FuncInfo *> funcInfos;
+
+    /// @brief 所有活动记录的值槽
+    std::vector<int32_t> slots;
+
+    /// @brief 执行的指令总数
+    uint64_t totalInstCount = 0;
+
+    /// @brief 错误信息
+    std::string lastError;
+};
@@ -0,0 +1,395 @@
+///
+/// @file GlobalConstFolding.cpp
+/// @brief 识别没有写入的全局变量，放到只读段并把对其的读取折叠为常量
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include "GlobalConstFolding.h"
+#include "ConstFloat.h"
+#include "ConstInt.h"
+#include "FuncCallInstruction.h"
+#include "GlobalVariable.h"
+#include "LocalVariable.h"
+#include "PointerType.h"
+
+/// @brief 常量计算的最大递归深度
+#define CONST_EVAL_MAX_DEPTH 16
+
+/// @brief 构造函数
+/// @param _module 要处理的模块
+GlobalConstFolding::GlobalConstFolding(Module * _module) : module(_module)
+{}
+
+/// @brief 统计函数内Value的使用与定值
+/// @param func 函数
+/// @param info 使用与定值
+void GlobalConstFolding::collectUses(Function * func, FuncUses & info)
+{
+    info.uses.clear();
+    info.defs.clear();
+
+    for (auto inst: func->getInterCode().getInsts()) {
+
+        if (inst->isDead()) {
+            continue;
+        }
+
+        bool isMove = inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN;
+
+        for (int32_t k = 0; k < inst->getOperandsNum(); ++k) {
+
+            Value * operand = inst->getOperand(k);
+
+            // 赋值的目的操作数为定值，通过指针存储时为指针的使用
+            if (isMove && (k == 0) && !static_cast<MoveInstruction *>(inst)->getIsPointerStore()) {
+                info.defs[operand].push_back(static_cast<MoveInstruction *>(inst));
+            } else {
+                info.uses[operand].emplace_back(inst, k);
+            }
+        }
+    }
+}
+
+/// @brief 是否作为memcpy的源地址，即只读取
+/// @param inst 使用的指令
+/// @param index 操作数的下标
+/// @return true：是，false：不是
+bool GlobalConstFolding::isCopySource(Instruction * inst, int32_t index)
+{
+    auto callInst = dynamic_cast<FuncCallInstruction *>(inst);
+
+    return callInst && (index == 1) && (callInst->getCalledName() == "memcpy");
+}
+
+/// @brief 检查数组元素地址的使用，只用于指针读取时返回true
+/// @param info 函数内的使用与定值
+/// @param addr 地址
+/// @param loads 读取该地址的指令
+/// @param visited 已检查过的Value，防止赋值成环时无限递归
+/// @return true：只读，false：可能写入
+bool GlobalConstFolding::checkAddress(FuncUses & info,
+                                      Value * addr,
+                                      std::vector<MoveInstruction *> & loads,
+                                      std::unordered_set<Value *> & visited)
+{
+    if (!visited.insert(addr).second) {
+        return true;
+    }
+
+    auto pIter = info.uses.find(addr);
+    if (pIter == info.uses.end()) {
+        return true;
+    }
+
+    for (auto & use: pIter->second) {
+
+        if (isCopySource(use.first, use.second)) {
+            continue;
+        }
+
+        if ((use.first->getOp() != IRInstOperator::IRINST_OP_ASSIGN) || (use.second != 1)) {
+            return false;
+        }
+
+        auto move = static_cast<MoveInstruction *>(use.first);
+
+        if (move->getIsPointerLoad()) {
+            loads.push_back(move);
+            continue;
+        }
+
+        // 地址复制到局部变量时检查局部变量的使用
+        Value * dst = move->getOperand(0);
+        if (move->getIsPointerStore() || !dynamic_cast<LocalVariable *>(dst) ||
+            !checkAddress(info, dst, loads, visited)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// @brief 计算函数内的常量值，局部变量要求只有一次定值
+/// @param info 函数内的使用与定值
+/// @param val Value
+/// @param value 常量值
+/// @param depth 递归深度
+/// @return true：是常量，false：不是
+bool GlobalConstFolding::evalConst(FuncUses & info, Value * val, int32_t & value, int32_t depth)
+{
+    if (depth > CONST_EVAL_MAX_DEPTH) {
+        return false;
+    }
+
+    if (auto constInt = dynamic_cast<ConstInt *>(val)) {
+        value = constInt->getVal();
+        return true;
+    }
+
+    if (dynamic_cast<LocalVariable *>(val)) {
+        auto pIter = info.defs.find(val);
+        if ((pIter == info.defs.end()) || (pIter->second.size() != 1) || pIter->second[0]->getIsPointerLoad()) {
+            return false;
+        }
+        return evalConst(info, pIter->second[0]->getOperand(1), value, depth + 1);
+    }
+
+    auto inst = dynamic_cast<Instruction *>(val);
+    if (!inst || (inst->getOperandsNum() != 2)) {
+        return false;
+    }
+
+    int32_t left, right;
+    if (!evalConst(info, inst->getOperand(0), left, depth + 1) ||
+        !evalConst(info, inst->getOperand(1), right, depth + 1)) {
+        return false;
+    }
+
+    switch (inst->getOp()) {
+        case IRInstOperator::IRINST_OP_ADD_I:
+            value = (int32_t) ((uint32_t) left + (uint32_t) right);
+            return true;
+        case IRInstOperator::IRINST_OP_SUB_I:
+            value = (int32_t) ((uint32_t) left - (uint32_t) right);
+            return true;
+        case IRInstOperator::IRINST_OP_MUL_I:
+            value = (int32_t) ((uint32_t) left * (uint32_t) right);
+            return true;
+        default:
+            return false;
+    }
+}
+
+/// @brief 找到指针读取的地址对应的基址加偏移指令，局部变量要求只有一次定值
+/// @param info 函数内的使用与定值
+/// @param ptr 指针
+/// @return 基址加偏移的指令，找不到时为空
+Instruction * GlobalConstFolding::findAddress(FuncUses & info, Value * ptr)
+{
+    for (int32_t depth = 0; depth < CONST_EVAL_MAX_DEPTH; ++depth) {
+
+        auto inst = dynamic_cast<Instruction *>(ptr);
+        if (inst) {
+            return inst->getOp() == IRInstOperator::IRINST_OP_ADD_I ? inst : nullptr;
+        }
+
+        auto pIter = info.defs.find(ptr);
+        if (!dynamic_cast<LocalVariable *>(ptr) || (pIter == info.defs.end()) || (pIter->second.size() != 1) ||
+            pIter->second[0]->getIsPointerLoad()) {
+            return nullptr;
+        }
+
+        ptr = pIter->second[0]->getOperand(1);
+    }
+
+    return nullptr;
+}
+
+/// @brief 删除不再使用的Value的定值指令，并递归处理其操作数
+/// @param info 函数内的使用与定值
+/// @param val Value
+/// @param useCount 各Value仍被使用的次数
+void GlobalConstFolding::removeIfUnused(FuncUses & info, Value * val, std::unordered_map<Value *, int32_t> & useCount)
+{
+    if (useCount[val] > 0) {
+        return;
+    }
+
+    std::vector<Value *> operands;
+
+    auto inst = dynamic_cast<Instruction *>(val);
+    if (inst) {
+
+        // 只删除没有副作用的地址计算指令
+        IRInstOperator op = inst->getOp();
+        if (inst->isDead() || ((op != IRInstOperator::IRINST_OP_ADD_I) && (op != IRInstOperator::IRINST_OP_SUB_I) &&
+                               (op != IRInstOperator::IRINST_OP_MUL_I))) {
+            return;
+        }
+
+        inst->setDead();
+        operands = inst->getOperandsValue();
+    } else if (dynamic_cast<LocalVariable *>(val)) {
+
+        // 局部变量不再使用，其定值都可删除
+        for (auto def: info.defs[val]) {
+            if (!def->isDead()) {
+                def->setDead();
+                operands.push_back(def->getOperand(1));
+            }
+        }
+    }
+
+    for (auto operand: operands) {
+        useCount[operand]--;
+        removeIfUnused(info, operand, useCount);
+    }
+}
+
+/// @brief 按类型把全局变量的初值转换为常量，float的初值为位模式
+/// @param type 标量或数组元素的类型
+/// @param value 初值
+/// @return 常量
+Constant * GlobalConstFolding::newInitConst(Type * type, int32_t value)
+{
+    if (type->isFloatType()) {
+        return module->newConstFloatBits(value);
+    }
+
+    return module->newConstInt(value);
+}
+
+/// @brief 识别只读的全局变量并折叠对其的读取
+/// @return 折叠的读取个数
+int32_t GlobalConstFolding::run()
+{
+    std::vector<Function *> funcs;
+    for (auto func: module->getFunctionList()) {
+        if (!func->isBuiltin()) {
+            funcs.push_back(func);
+        }
+    }
+
+    std::vector<FuncUses> infos(funcs.size());
+    for (size_t f = 0; f < funcs.size(); ++f) {
+        collectUses(funcs[f], infos[f]);
+    }
+
+    // 各只读全局变量可折叠的标量读取以及数组元素读取，按函数记录
+    std::vector<std::pair<GlobalVariable *, std::pair<Instruction *, int32_t>>> scalarReads;
+    std::vector<std::vector<std::pair<GlobalVariable *, MoveInstruction *>>> arrayLoads(funcs.size());
+
+    for (auto var: module->getGlobalVariables()) {
+
+        bool isArray = var->getType()->isArrayType();
+        bool readOnly = true;
+
+        std::vector<std::pair<Instruction *, int32_t>> reads;
+        std::vector<std::vector<MoveInstruction *>> loads(funcs.size());
+
+        for (size_t f = 0; (f < funcs.size()) && readOnly; ++f) {
+
+            FuncUses & info = infos[f];
+
+            // 作为赋值的目的操作数，即写入
+            if (info.defs.count(var)) {
+                readOnly = false;
+                break;
+            }
+
+            auto pIter = info.uses.find(var);
+            if (pIter == info.uses.end()) {
+                continue;
+            }
+
+            for (auto & use: pIter->second) {
+
+                if (!isArray) {
+
+                    // 标量通过指针存储写入不会出现，保守处理
+                    if ((use.first->getOp() == IRInstOperator::IRINST_OP_ASSIGN) && (use.second == 0)) {
+                        readOnly = false;
+                        break;
+                    }
+                    reads.push_back(use);
+                } else if (use.first->getOp() == IRInstOperator::IRINST_OP_ADD_I) {
+
+                    // 数组基址加偏移，检查元素地址的使用
+                    std::unordered_set<Value *> visited;
+                    if (!checkAddress(info, use.first, loads[f], visited)) {
+                        readOnly = false;
+                        break;
+                    }
+                } else if (!isCopySource(use.first, use.second)) {
+
+                    // 作为实参传递等，可能通过指针写入
+                    readOnly = false;
+                    break;
+                }
+            }
+        }
+
+        var->setReadOnly(readOnly);
+        if (!readOnly) {
+            continue;
+        }
+
+        for (auto & read: reads) {
+            scalarReads.emplace_back(var, read);
+        }
+        for (size_t f = 0; f < funcs.size(); ++f) {
+            for (auto load: loads[f]) {
+                arrayLoads[f].emplace_back(var, load);
+            }
+        }
+    }
+
+    int32_t folded = 0;
+
+    // 标量的读取替换为初值，先于数组进行，数组的偏移中可能用到标量
+    for (auto & item: scalarReads) {
+        item.second.first->setOperand(item.second.second, newInitConst(item.first->getType(), item.first->getInitValue(0)));
+        folded++;
+    }
+
+    for (size_t f = 0; f < funcs.size(); ++f) {
+
+        if (arrayLoads[f].empty()) {
+            continue;
+        }
+
+        FuncUses & info = infos[f];
+        collectUses(funcs[f], info);
+
+        std::vector<Value *> oldPtrs;
+
+        for (auto & item: arrayLoads[f]) {
+
+            GlobalVariable * var = item.first;
+            MoveInstruction * load = item.second;
+            Value * ptr = load->getOperand(1);
+
+            Instruction * addr = findAddress(info, ptr);
+            if (!addr) {
+                continue;
+            }
+
+            Value * offsetVal = (addr->getOperand(0) == var) ? addr->getOperand(1) : addr->getOperand(0);
+
+            int32_t offset;
+            if (!evalConst(info, offsetVal, offset) || (offset < 0) || (offset % 4) ||
+                (offset >= var->getType()->getSize())) {
+                continue;
+            }
+
+            // 读取改为常量赋值
+            Type * elemType = static_cast<ArrayType *>(var->getType())->getElementType();
+            load->setOperand(1, newInitConst(elemType, var->getInitValue((size_t) offset / 4)));
+            load->setIsPointerLoad(false);
+            oldPtrs.push_back(ptr);
+            folded++;
+        }
+
+        // 删除不再使用的地址计算
+        collectUses(funcs[f], info);
+
+        std::unordered_map<Value *, int32_t> useCount;
+        for (auto & item: info.uses) {
+            useCount[item.first] = (int32_t) item.second.size();
+        }
+
+        for (auto ptr: oldPtrs) {
+            removeIfUnused(info, ptr, useCount);
+        }
+    }
+
+    return folded;
+}
@@ -0,0 +1,106 @@
+///
+/// @file GlobalConstFolding.h
+/// @brief 识别没有写入的全局变量，放到只读段并把对其的读取折叠为常量
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Module.h"
+#include "MoveInstruction.h"
+
+///
+/// @brief 全局变量常量折叠。全局变量只能通过以下方式使用时视为只读：
+/// (1) 标量作为赋值的源操作数、运算的操作数或函数调用的实参；
+/// (2) 数组的基址加上偏移得到的元素地址只用于指针读取；
+/// (3) 数组或其地址作为memcpy的源地址，如局部数组初始化的模板。
+/// 数组作为实参传递、元素地址被写入或参与其它运算时视为可写。
+/// 只读的全局变量放到.rodata段；标量的读取替换为初值，偏移为常量的数组元素读取替换为元素的初值，
+/// 随后删除不再使用的地址计算指令
+///
+class GlobalConstFolding {
+
+public:
+    /// @brief 构造函数
+    /// @param _module 要处理的模块
+    explicit GlobalConstFolding(Module * _module);
+
+    /// @brief 识别只读的全局变量并折叠对其的读取
+    /// @return 折叠的读取个数
+    int32_t run();
+
+private:
+    /// @brief 函数内Value的使用与定值
+    struct FuncUses {
+        /// @brief 各Value被使用的位置，即指令与操作数的下标
+        std::unordered_map<Value *, std::vector<std::pair<Instruction *, int32_t>>> uses;
+
+        /// @brief 各局部变量的定值指令
+        std::unordered_map<Value *, std::vector<MoveInstruction *>> defs;
+    };
+
+    /// @brief 统计函数内Value的使用与定值
+    /// @param func 函数
+    /// @param info 使用与定值
+    static void collectUses(Function * func, FuncUses & info);
+
+    /// @brief 是否作为memcpy的源地址，即只读取
+    /// @param inst 使用的指令
+    /// @param index 操作数的下标
+    /// @return true：是，false：不是
+    static bool isCopySource(Instruction * inst, int32_t index);
+
+    /// @brief 检查数组元素地址的使用，只用于指针读取时返回true
+    /// @param info 函数内的使用与定值
+    /// @param addr 地址
+    /// @param loads 读取该地址的指令
+    /// @param visited 已检查过的Value，防止赋值成环时无限递归
+    /// @return true：只读，false：可能写入
+    static bool checkAddress(FuncUses & info,
+                             Value * addr,
+                             std::vector<MoveInstruction *> & loads,
+                             std::unordered_set<Value *> & visited);
+
+    /// @brief 计算函数内的常量值，局部变量要求只有一次定值
+    /// @param info 函数内的使用与定值
+    /// @param val Value
+    /// @param value 常量值
+    /// @param depth 递归深度
+    /// @return true：是常量，false：不是
+    static bool evalConst(FuncUses & info, Value * val, int32_t & value, int32_t depth = 0);
+
+    /// @brief 找到指针读取的地址对应的基址加偏移指令，局部变量要求只有一次定值
+    /// @param info 函数内的使用与定值
+    /// @param ptr 指针
+    /// @return 基址加偏移的指令，找不到时为空
+    static Instruction * findAddress(FuncUses & info, Value * ptr);
+
+    /// @brief 删除不再使用的Value的定值指令，并递归处理其操作数
+    /// @param info 函数内的使用与定值
+    /// @param val Value
+    /// @param useCount 各Value仍被使用的次数
+    static void removeIfUnused(FuncUses & info, Value * val, std::unordered_map<Value *, int32_t> & useCount);
+
+    /// @brief 按类型把全局变量的初值转换为常量，float的初值为位模式
+    /// @param type 标量或数组元素的类型
+    /// @param value 初值
+    /// @return 常量
+    Constant * newInitConst(Type * type, int32_t value);
+
+    /// @brief 要处理的模块
+    Module * module;
+};
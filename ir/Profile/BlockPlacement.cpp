@@ -0,0 +1,170 @@
+///
+/// @file BlockPlacement.cpp
+/// @brief 根据profile的执行次数调整函数内基本块的排列次序
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <unordered_map>
+
+#include "BlockPlacement.h"
+#include "GotoInstruction.h"
+#include "LabelInstruction.h"
+
+/// @brief 构造函数
+/// @param _func 要处理的函数
+BlockPlacement::BlockPlacement(Function * _func) : func(_func)
+{}
+
+/// @brief 指令序列划分成基本块，块从函数入口或Label指令开始
+void BlockPlacement::splitBlocks()
+{
+    auto & insts = func->getInterCode().getInsts();
+
+    blocks.clear();
+
+    std::unordered_map<Instruction *, size_t> labelBlock;
+    for (size_t k = 0; k < insts.size(); ++k) {
+        if ((k == 0) || (insts[k]->getOp() == IRInstOperator::IRINST_OP_LABEL)) {
+            if (!blocks.empty()) {
+                blocks.back().end = k;
+            }
+
+            Block block;
+            block.begin = k;
+            block.end = insts.size();
+            block.count = (k == 0) ? func->getEntryCount()
+                                   : static_cast<LabelInstruction *>(insts[k])->getProfileCount();
+            if (block.count < 0) {
+                block.count = 0;
+            }
+            blocks.push_back(block);
+
+            labelBlock[insts[k]] = blocks.size() - 1;
+        }
+    }
+
+    for (size_t b = 0; b < blocks.size(); ++b) {
+
+        Block & block = blocks[b];
+
+        // 块内第一条跳转或出口指令决定后继，其后的指令不可达
+        block.fallThrough = true;
+        for (size_t k = block.begin; k < block.end; ++k) {
+
+            Instruction * inst = insts[k];
+            if (inst->getOp() == IRInstOperator::IRINST_OP_EXIT) {
+                block.fallThrough = false;
+                break;
+            }
+
+            if (inst->getOp() == IRInstOperator::IRINST_OP_GOTO) {
+                auto * gotoInst = static_cast<GotoInstruction *>(inst);
+                block.succs.push_back(labelBlock[gotoInst->getTarget()]);
+                if (gotoInst->getFalseTarget()) {
+                    block.succs.push_back(labelBlock[gotoInst->getFalseTarget()]);
+                }
+                block.fallThrough = false;
+                break;
+            }
+        }
+
+        if (block.fallThrough && (b + 1 < blocks.size())) {
+            block.succs.push_back(b + 1);
+        }
+    }
+}
+
+/// @brief 选择下一个要排列的块
+/// @param last 刚排列的块
+/// @return 块的下标
+size_t BlockPlacement::selectNext(size_t last)
+{
+    // 次数相同时取原来次序靠前的块
+    size_t best = blocks.size();
+    for (auto succ: blocks[last].succs) {
+        if ((!blocks[succ].placed) && ((best == blocks.size()) || (blocks[succ].count > blocks[best].count) ||
+                                       ((blocks[succ].count == blocks[best].count) && (succ < best)))) {
+            best = succ;
+        }
+    }
+
+    if ((best != blocks.size()) && (blocks[best].count > 0)) {
+        return best;
+    }
+
+    // 后继都已排列或者都没有执行过，从剩余的块中取执行次数最多的块
+    size_t hottest = blocks.size();
+    for (size_t b = 0; b < blocks.size(); ++b) {
+        if ((!blocks[b].placed) && ((hottest == blocks.size()) || (blocks[b].count > blocks[hottest].count))) {
+            hottest = b;
+        }
+    }
+
+    if ((best != blocks.size()) && (blocks[hottest].count == 0)) {
+        return best;
+    }
+
+    return hottest;
+}
+
+/// @brief 调整基本块的次序
+/// @return true：次序有变化，false：保持原来的次序
+bool BlockPlacement::run()
+{
+    if (func->isBuiltin() || (func->getEntryCount() <= 0)) {
+        return false;
+    }
+
+    splitBlocks();
+    if (blocks.size() <= 2) {
+        return false;
+    }
+
+    // 入口块必须在最前面
+    std::vector<size_t> order;
+    order.reserve(blocks.size());
+    order.push_back(0);
+    blocks[0].placed = true;
+
+    bool changed = false;
+    while (order.size() < blocks.size()) {
+        size_t next = selectNext(order.back());
+        blocks[next].placed = true;
+        changed |= (next != order.size());
+        order.push_back(next);
+    }
+
+    if (!changed) {
+        return false;
+    }
+
+    auto & insts = func->getInterCode().getInsts();
+
+    std::vector<Instruction *> newInsts;
+    newInsts.reserve(insts.size() + blocks.size());
+
+    for (size_t pos = 0; pos < order.size(); ++pos) {
+
+        Block & block = blocks[order[pos]];
+        newInsts.insert(newInsts.end(), insts.begin() + (long) block.begin, insts.begin() + (long) block.end);
+
+        // 原来顺序执行到下一个块的，下一个块不再紧随其后时需显式跳转
+        size_t follow = order[pos] + 1;
+        if (block.fallThrough && (follow < blocks.size()) &&
+            ((pos + 1 == order.size()) || (order[pos + 1] != follow))) {
+            newInsts.push_back(new GotoInstruction(func, insts[blocks[follow].begin]));
+        }
+    }
+
+    insts.swap(newInsts);
+
+    return true;
+}
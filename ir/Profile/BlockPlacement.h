@@ -0,0 +1,78 @@
+///
+/// @file BlockPlacement.h
+/// @brief 根据profile的执行次数调整函数内基本块的排列次序
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Function.h"
+
+///
+/// @brief 基本块排列。从入口块开始，每次把执行次数最多的未排列后继块紧接着放在后面，
+/// 使热路径上的跳转变成顺序执行，指令选择时省去跳转到下一条Label的指令；
+/// 执行次数为0的块按原来的次序移到函数末尾。
+/// 函数没有profile数据或者没有执行过时保持原来的次序
+///
+class BlockPlacement {
+
+public:
+    /// @brief 构造函数
+    /// @param _func 要处理的函数
+    explicit BlockPlacement(Function * _func);
+
+    /// @brief 析构函数
+    ~BlockPlacement() = default;
+
+    /// @brief 调整基本块的次序
+    /// @return true：次序有变化，false：保持原来的次序
+    bool run();
+
+protected:
+    /// @brief 基本块
+    struct Block {
+        /// @brief 第一条指令的下标
+        size_t begin;
+
+        /// @brief 最后一条指令的下一个下标
+        size_t end;
+
+        /// @brief 执行次数
+        int64_t count;
+
+        /// @brief 后继块，条件跳转时真出口在前
+        std::vector<size_t> succs;
+
+        /// @brief 没有跳转或出口指令，顺序执行到下一个块
+        bool fallThrough = false;
+
+        /// @brief 是否已经排列
+        bool placed = false;
+    };
+
+    /// @brief 指令序列划分成基本块，块从函数入口或Label指令开始
+    void splitBlocks();
+
+    /// @brief 选择下一个要排列的块
+    /// @param last 刚排列的块
+    /// @return 块的下标
+    size_t selectNext(size_t last);
+
+private:
+    /// @brief 要处理的函数
+    Function * func;
+
+    /// @brief 基本块，按原来的次序排列
+    std::vector<Block> blocks;
+};
@@ -0,0 +1,93 @@
+///
+/// @file ProfileFormat.h
+/// @brief 块计数profile的文件格式以及插桩与读取共用的块编号规则
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+/// profile文件为文本格式，由插桩后程序的运行时(tests/std.c)或者解释器输出：
+///
+///     minic-profile 1
+///     <模块校验值> <计数器个数>
+///     <计数器0>
+///     <计数器1>
+///     ...
+///
+/// 计数器按函数在模块中的次序排列，每个函数的第一个计数器对应函数入口，
+/// 其后依次对应函数内的Label指令。模块校验值由函数名与每个函数的块数计算得到，
+/// 源程序变化导致块的编号不一致时，--profile-use拒绝使用该profile
+///
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Module.h"
+#include "CompileCache.h"
+
+/// @brief profile文件的魔数
+#define PROFILE_MAGIC "minic-profile"
+
+/// @brief profile文件的版本号
+#define PROFILE_VERSION 1
+
+/// @brief 块计数器数组的全局变量名
+#define PROFILE_COUNTERS_NAME "__minic_prof"
+
+/// @brief 输出块计数器的运行时函数名
+#define PROFILE_DUMP_FUNC "__minic_prof_dump"
+
+/// @brief 运行时输出profile的文件名由该环境变量指定
+#define PROFILE_FILE_ENV "MINIC_PROFILE"
+
+/// @brief 没有指定环境变量时的profile文件名
+#define PROFILE_DEFAULT_FILE "minic.profdata"
+
+///
+/// @brief 获取函数内所有块的首指令：第一条指令（函数入口）以及所有的Label指令
+/// @param func 函数
+/// @param heads 块的首指令，按指令次序排列
+///
+inline void profileBlockHeads(Function * func, std::vector<Instruction *> & heads)
+{
+    heads.clear();
+
+    auto & insts = func->getInterCode().getInsts();
+    for (size_t k = 0; k < insts.size(); ++k) {
+        if ((k == 0) || (insts[k]->getOp() == IRInstOperator::IRINST_OP_LABEL)) {
+            heads.push_back(insts[k]);
+        }
+    }
+}
+
+///
+/// @brief 计算模块的校验值，由非内置函数的函数名与块数决定
+/// @param module 模块
+/// @return 校验值
+///
+inline uint32_t profileModuleHash(Module * module)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    std::vector<Instruction *> heads;
+    for (auto func: module->getFunctionList()) {
+        if (func->isBuiltin()) {
+            continue;
+        }
+
+        profileBlockHeads(func, heads);
+
+        uint32_t blocks = (uint32_t) heads.size();
+        hash = CompileCache::hash(func->getName().data(), func->getName().size() + 1, hash);
+        hash = CompileCache::hash(&blocks, sizeof(blocks), hash);
+    }
+
+    return (uint32_t) (hash ^ (hash >> 32));
+}
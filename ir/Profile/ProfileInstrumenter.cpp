@@ -0,0 +1,148 @@
+///
+/// @file ProfileInstrumenter.cpp
+/// @brief --profile-generate的IR插桩，每个块入口对块计数器加1
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include "ProfileInstrumenter.h"
+#include "ProfileFormat.h"
+#include "IntegerType.h"
+#include "VoidType.h"
+#include "PointerType.h"
+#include "BinaryInstruction.h"
+#include "FuncCallInstruction.h"
+#include "MoveInstruction.h"
+
+/// @brief 构造函数
+/// @param _module 要插桩的模块
+ProfileInstrumenter::ProfileInstrumenter(Module * _module) : module(_module)
+{}
+
+/// @brief 对模块的所有函数插桩
+/// @return true：成功，false：失败
+bool ProfileInstrumenter::run()
+{
+    if (!module->findFunction("main")) {
+        setLastError("没有main函数，无法输出profile");
+        return false;
+    }
+
+    if (!module->findFunction(PROFILE_DUMP_FUNC)) {
+        setLastError(std::string("缺少运行时函数") + PROFILE_DUMP_FUNC);
+        return false;
+    }
+
+    // 校验值与块编号都要在插入指令之前确定，插桩不增加Label指令，块数不变
+    moduleHash = profileModuleHash(module);
+
+    std::vector<Instruction *> heads;
+    counterCount = 0;
+    for (auto func: module->getFunctionList()) {
+        if (!func->isBuiltin()) {
+            profileBlockHeads(func, heads);
+            counterCount += (int32_t) heads.size();
+        }
+    }
+
+    // 块计数器为全局数组，BSS段中初值为0
+    module->setCurrentFunction(nullptr);
+    counters = module->newVarValue(ArrayType::get(IntegerType::getTypeInt(), {counterCount}), PROFILE_COUNTERS_NAME);
+    if (!counters) {
+        setLastError(std::string("全局变量") + PROFILE_COUNTERS_NAME + "已经存在");
+        return false;
+    }
+
+    int32_t firstCounter = 0;
+    for (auto func: module->getFunctionList()) {
+        if (func->isBuiltin()) {
+            continue;
+        }
+
+        profileBlockHeads(func, heads);
+        instrumentFunction(func, firstCounter);
+        firstCounter += (int32_t) heads.size();
+    }
+
+    return true;
+}
+
+/// @brief 对一个函数插桩
+/// @param func 函数
+/// @param firstCounter 函数入口对应的计数器编号
+void ProfileInstrumenter::instrumentFunction(Function * func, int32_t firstCounter)
+{
+    Type * intType = IntegerType::getTypeInt();
+    Type * ptrType = const_cast<Type *>(static_cast<const Type *>(PointerType::get(intType)));
+
+    // 计数器的地址与值保存在局部变量中，同一函数内的所有块共用
+    LocalVariable * counterPtr = func->newLocalVarValue(ptrType);
+    LocalVariable * counterValue = func->newLocalVarValue(intType);
+
+    auto & insts = func->getInterCode().getInsts();
+
+    std::vector<Instruction *> newInsts;
+    newInsts.reserve(insts.size() * 2);
+
+    int32_t counter = firstCounter;
+    for (size_t k = 0; k < insts.size(); ++k) {
+
+        Instruction * inst = insts[k];
+
+        if ((inst->getOp() == IRInstOperator::IRINST_OP_EXIT) && (func->getName() == "main")) {
+
+            // main函数返回前输出所有的计数器
+            std::vector<Value *> args = {module->newConstInt((int32_t) moduleHash),
+                                         module->newConstInt(counterCount),
+                                         counters};
+            newInsts.push_back(
+                new FuncCallInstruction(func, module->findFunction(PROFILE_DUMP_FUNC), args, VoidType::getType()));
+
+            func->setExistFuncCall(true);
+            if ((int) args.size() > func->getMaxFuncCallArgCnt()) {
+                func->setMaxFuncCallArgCnt((int) args.size());
+            }
+        }
+
+        newInsts.push_back(inst);
+
+        if ((k != 0) && (inst->getOp() != IRInstOperator::IRINST_OP_LABEL)) {
+            continue;
+        }
+
+        // 块入口：%p = @__minic_prof + 4 * counter，*%p = *%p + 1
+        BinaryInstruction * addrInst = new BinaryInstruction(func,
+                                                             IRInstOperator::IRINST_OP_ADD_I,
+                                                             counters,
+                                                             module->newConstInt(counter * 4),
+                                                             ptrType);
+        newInsts.push_back(addrInst);
+        newInsts.push_back(new MoveInstruction(func, counterPtr, addrInst));
+
+        MoveInstruction * loadInst = new MoveInstruction(func, counterValue, counterPtr);
+        loadInst->setIsPointerLoad(true);
+        newInsts.push_back(loadInst);
+
+        BinaryInstruction * incInst = new BinaryInstruction(func,
+                                                            IRInstOperator::IRINST_OP_ADD_I,
+                                                            counterValue,
+                                                            module->newConstInt(1),
+                                                            intType);
+        newInsts.push_back(incInst);
+
+        MoveInstruction * storeInst = new MoveInstruction(func, counterPtr, incInst);
+        storeInst->setIsPointerStore(true);
+        newInsts.push_back(storeInst);
+
+        counter++;
+    }
+
+    insts.swap(newInsts);
+}
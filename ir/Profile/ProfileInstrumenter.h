@@ -0,0 +1,72 @@
+///
+/// @file ProfileInstrumenter.h
+/// @brief --profile-generate的IR插桩，每个块入口对块计数器加1
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "Module.h"
+
+///
+/// @brief 块计数插桩。新建全局数组@__minic_prof作为块计数器，块的编号见ProfileFormat.h；
+/// 函数入口指令与每条Label指令之后插入对应计数器的加1，
+/// main函数的出口指令之前调用运行时函数__minic_prof_dump输出所有的计数器。
+/// 插桩只使用已有的IR指令，后端与解释器都不需要特殊处理
+///
+class ProfileInstrumenter {
+
+public:
+    /// @brief 构造函数
+    /// @param _module 要插桩的模块
+    explicit ProfileInstrumenter(Module * _module);
+
+    /// @brief 析构函数
+    ~ProfileInstrumenter() = default;
+
+    /// @brief 对模块的所有函数插桩
+    /// @return true：成功，false：失败
+    bool run();
+
+    void setLastError(const std::string & error)
+    {
+        lastError = error;
+    }
+    std::string getLastError() const
+    {
+        return lastError;
+    }
+
+protected:
+    /// @brief 对一个函数插桩
+    /// @param func 函数
+    /// @param firstCounter 函数入口对应的计数器编号
+    void instrumentFunction(Function * func, int32_t firstCounter);
+
+private:
+    /// @brief 要插桩的模块
+    Module * module;
+
+    /// @brief 块计数器数组
+    Value * counters = nullptr;
+
+    /// @brief 块计数器的个数
+    int32_t counterCount = 0;
+
+    /// @brief 模块校验值
+    uint32_t moduleHash = 0;
+
+    /// @brief 错误信息
+    std::string lastError;
+};
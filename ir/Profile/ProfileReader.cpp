@@ -0,0 +1,100 @@
+///
+/// @file ProfileReader.cpp
+/// @brief --profile-use读取块计数profile，执行次数记录到函数与Label指令上
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <cstdio>
+#include <cstring>
+
+#include "ProfileReader.h"
+#include "ProfileFormat.h"
+#include "LabelInstruction.h"
+
+/// @brief 构造函数
+/// @param _fileName profile文件名
+/// @param _module 模块，必须与生成profile时的模块有相同的函数与块
+ProfileReader::ProfileReader(const std::string & _fileName, Module * _module) : fileName(_fileName), module(_module)
+{}
+
+/// @brief 读取profile并记录执行次数
+/// @return true：成功，false：文件错误或者与模块不匹配
+bool ProfileReader::run()
+{
+    FILE * fp = fopen(fileName.c_str(), "r");
+    if (!fp) {
+        setLastError("profile文件(" + fileName + ")无法打开");
+        return false;
+    }
+
+    char magic[32] = {0};
+    int version = 0;
+    unsigned hash = 0;
+    int count = 0;
+    if ((fscanf(fp, "%31s %d %u %d", magic, &version, &hash, &count) != 4) || strcmp(magic, PROFILE_MAGIC) != 0) {
+        fclose(fp);
+        setLastError("profile文件(" + fileName + ")格式错误");
+        return false;
+    }
+
+    if (version != PROFILE_VERSION) {
+        fclose(fp);
+        setLastError("profile文件(" + fileName + ")的版本" + std::to_string(version) + "不支持");
+        return false;
+    }
+
+    std::vector<int64_t> counts;
+    counts.reserve(count > 0 ? count : 0);
+    for (int k = 0; k < count; ++k) {
+        unsigned long long value;
+        if (fscanf(fp, "%llu", &value) != 1) {
+            fclose(fp);
+            setLastError("profile文件(" + fileName + ")不完整");
+            return false;
+        }
+        counts.push_back((int64_t) value);
+    }
+
+    fclose(fp);
+
+    // 函数或者块有变化时计数器的编号不再对应，不能使用
+    std::vector<Instruction *> heads;
+    size_t total = 0;
+    for (auto func: module->getFunctionList()) {
+        if (!func->isBuiltin()) {
+            profileBlockHeads(func, heads);
+            total += heads.size();
+        }
+    }
+
+    if ((hash != profileModuleHash(module)) || (total != counts.size())) {
+        setLastError("profile文件(" + fileName + ")与源程序不匹配，源程序修改后需重新生成");
+        return false;
+    }
+
+    size_t index = 0;
+    for (auto func: module->getFunctionList()) {
+        if (func->isBuiltin()) {
+            continue;
+        }
+
+        profileBlockHeads(func, heads);
+        for (size_t k = 0; k < heads.size(); ++k, ++index) {
+            if (k == 0) {
+                func->setEntryCount(counts[index]);
+            } else {
+                static_cast<LabelInstruction *>(heads[k])->setProfileCount(counts[index]);
+            }
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,58 @@
+///
+/// @file ProfileReader.h
+/// @brief --profile-use读取块计数profile，执行次数记录到函数与Label指令上
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <string>
+
+#include "Module.h"
+
+///
+/// @brief profile的读取，格式与块编号见ProfileFormat.h。
+/// 函数入口的计数记录为函数的调用次数，其余计数记录到对应的Label指令
+///
+class ProfileReader {
+
+public:
+    /// @brief 构造函数
+    /// @param _fileName profile文件名
+    /// @param _module 模块，必须与生成profile时的模块有相同的函数与块
+    ProfileReader(const std::string & _fileName, Module * _module);
+
+    /// @brief 析构函数
+    ~ProfileReader() = default;
+
+    /// @brief 读取profile并记录执行次数
+    /// @return true：成功，false：文件错误或者与模块不匹配
+    bool run();
+
+    void setLastError(const std::string & error)
+    {
+        lastError = error;
+    }
+    std::string getLastError() const
+    {
+        return lastError;
+    }
+
+private:
+    /// @brief profile文件名
+    std::string fileName;
+
+    /// @brief 模块
+    Module * module;
+
+    /// @brief 错误信息
+    std::string lastError;
+};
@@ -0,0 +1,906 @@
+///
+/// @file IRReader.cpp
+/// @brief 读取文本形式的线性IR(DragonIR)的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#include "IRReader.h"
+#include "IRConstant.h"
+#include "IntegerType.h"
+#include "FloatType.h"
+#include "VoidType.h"
+#include "PointerType.h"
+#include "GlobalVariable.h"
+#include "ArgInstruction.h"
+#include "BinaryInstruction.h"
+#include "EntryInstruction.h"
+#include "ExitInstruction.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "MoveInstruction.h"
+
+namespace {
+
+/// @brief 去掉首尾的空白字符
+std::string trim(const std::string & str)
+{
+    size_t start = 0;
+    size_t end = str.size();
+
+    while ((start < end) && isspace((unsigned char) str[start])) {
+        start++;
+    }
+
+    while ((end > start) && isspace((unsigned char) str[end - 1])) {
+        end--;
+    }
+
+    return str.substr(start, end - start);
+}
+
+/// @brief 去掉行尾的注释，注释以;开始
+std::string stripComment(const std::string & str, std::string * comment = nullptr)
+{
+    size_t pos = str.find(';');
+    if (pos == std::string::npos) {
+        if (comment) {
+            comment->clear();
+        }
+        return str;
+    }
+
+    if (comment) {
+        *comment = trim(str.substr(pos + 1));
+    }
+
+    return str.substr(0, pos);
+}
+
+/// @brief 检查是否以指定的前缀开始
+bool startsWith(const std::string & str, const char * prefix)
+{
+    return str.compare(0, strlen(prefix), prefix) == 0;
+}
+
+/// @brief 按分隔符拆分，各部分去掉首尾空白，空串返回空列表
+std::vector<std::string> split(const std::string & str, char sep)
+{
+    std::vector<std::string> parts;
+
+    if (trim(str).empty()) {
+        return parts;
+    }
+
+    size_t start = 0;
+    while (true) {
+        size_t pos = str.find(sep, start);
+        if (pos == std::string::npos) {
+            parts.push_back(trim(str.substr(start)));
+            break;
+        }
+        parts.push_back(trim(str.substr(start, pos - start)));
+        start = pos + 1;
+    }
+
+    return parts;
+}
+
+/// @brief 解析十进制整数
+/// @param text 文本
+/// @param value 整数值
+/// @return true：成功，false：格式错误
+bool parseInt(const std::string & text, int32_t & value)
+{
+    char * end;
+    long val = strtol(text.c_str(), &end, 10);
+    value = (int32_t) val;
+
+    return !text.empty() && (*end == '\0');
+}
+
+/// @brief 是否是float常量的形式：0x开头的位模式，或带小数点、指数的十进制数
+/// @param text 文本
+/// @return true：是，false：不是
+bool isFloatText(const std::string & text)
+{
+    if ((text.size() > 2) && (text[0] == '0') && ((text[1] == 'x') || (text[1] == 'X'))) {
+        return true;
+    }
+
+    return (isdigit((unsigned char) text[0]) || (text[0] == '-') || (text[0] == '.')) &&
+           (text.find_first_of(".eE") != std::string::npos);
+}
+
+/// @brief 解析float常量为位模式，整数形式也可以
+/// @param text 文本
+/// @param bits IEEE 754单精度位模式
+/// @return true：成功，false：格式错误
+bool parseFloatBits(const std::string & text, int32_t & bits)
+{
+    char * end;
+
+    if ((text.size() > 2) && (text[0] == '0') && ((text[1] == 'x') || (text[1] == 'X'))) {
+        bits = (int32_t) strtoul(text.c_str() + 2, &end, 16);
+        return (text.size() == 10) && (*end == '\0');
+    }
+
+    float val = strtof(text.c_str(), &end);
+    bits = ConstFloat::floatToBits(val);
+
+    return !text.empty() && (*end == '\0');
+}
+
+/// @brief 运算指令的助记符与IR操作码的对应关系
+struct BinaryOpName {
+    const char * name;
+    IRInstOperator op;
+};
+
+const BinaryOpName binaryOpTable[] = {
+    {"add", IRInstOperator::IRINST_OP_ADD_I},
+    {"sub", IRInstOperator::IRINST_OP_SUB_I},
+    {"mul", IRInstOperator::IRINST_OP_MUL_I},
+    {"div", IRInstOperator::IRINST_OP_DIV_I},
+    {"mod", IRInstOperator::IRINST_OP_MOD_I},
+    {"icmp lt", IRInstOperator::IRINST_OP_LT_I},
+    {"icmp gt", IRInstOperator::IRINST_OP_GT_I},
+    {"icmp le", IRInstOperator::IRINST_OP_LE_I},
+    {"icmp ge", IRInstOperator::IRINST_OP_GE_I},
+    {"icmp eq", IRInstOperator::IRINST_OP_EQ_I},
+    {"icmp ne", IRInstOperator::IRINST_OP_NE_I},
+    {"fadd", IRInstOperator::IRINST_OP_ADD_F},
+    {"fsub", IRInstOperator::IRINST_OP_SUB_F},
+    {"fmul", IRInstOperator::IRINST_OP_MUL_F},
+    {"fdiv", IRInstOperator::IRINST_OP_DIV_F},
+    {"fcmp lt", IRInstOperator::IRINST_OP_LT_F},
+    {"fcmp gt", IRInstOperator::IRINST_OP_GT_F},
+    {"fcmp le", IRInstOperator::IRINST_OP_LE_F},
+    {"fcmp ge", IRInstOperator::IRINST_OP_GE_F},
+    {"fcmp eq", IRInstOperator::IRINST_OP_EQ_F},
+    {"fcmp ne", IRInstOperator::IRINST_OP_NE_F},
+    {"neg", IRInstOperator::IRINST_OP_NEG_I},
+    {"fneg", IRInstOperator::IRINST_OP_NEG_F},
+    {"sitofp", IRInstOperator::IRINST_OP_ITOF},
+    {"fptosi", IRInstOperator::IRINST_OP_FTOI},
+};
+
+} // namespace
+
+/// @brief 构造函数
+/// @param _fileName IR文件名
+/// @param _module 要填充的模块
+IRReader::IRReader(const std::string & _fileName, Module * _module) : fileName(_fileName), module(_module)
+{}
+
+/// @brief 设置带行号的错误信息
+/// @param error 错误信息
+/// @return 恒为false，便于直接返回
+bool IRReader::error(const std::string & error)
+{
+    setLastError(fileName + ":" + std::to_string(curLine + 1) + ": " + error);
+    return false;
+}
+
+/// @brief 读取IR文件并重建模块
+/// @return true：成功，false：失败
+bool IRReader::run()
+{
+    std::ifstream in(fileName);
+    if (!in) {
+        setLastError("IR文件(" + fileName + ")打开失败");
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(in, line)) {
+        lines.push_back(line);
+    }
+
+    // 第一遍：全局变量以及函数头，函数体跳过
+    std::vector<std::pair<Function *, size_t>> bodies;
+
+    for (curLine = 0; curLine < lines.size(); ++curLine) {
+
+        std::string text = trim(lines[curLine]);
+
+        if (text.empty() || text[0] == ';') {
+            continue;
+        }
+
+        if (startsWith(text, IR_KEYWORD_DECLARE " ")) {
+            if (!readGlobalDeclare(text)) {
+                return false;
+            }
+        } else if (startsWith(text, IR_KEYWORD_DEFINE " ")) {
+
+            Function * func = readFunctionHeader(text);
+            if (!func) {
+                return false;
+            }
+
+            bodies.emplace_back(func, curLine);
+
+            // 跳过函数体
+            while ((curLine < lines.size()) && (trim(lines[curLine]) != "}")) {
+                curLine++;
+            }
+
+            if (curLine == lines.size()) {
+                return error("函数" + func->getName() + "缺少}");
+            }
+        } else {
+            return error("不认识的内容：" + text);
+        }
+    }
+
+    // 第二遍：逐个函数处理函数体
+    for (auto & item: bodies) {
+        if (!readFunctionBody(item.first, item.second)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// @brief 处理全局变量的declare
+/// @param line 行文本
+/// @return true：成功，false：失败
+bool IRReader::readGlobalDeclare(const std::string & line)
+{
+    // declare i32 @a 或 declare i32 @a[10][10] ;全局数组a
+    // 有初值时为declare i32 @a = 5 或 declare i32 @a[10] = {1, 2, 3}
+    std::string text = trim(stripComment(line.substr(strlen(IR_KEYWORD_DECLARE))));
+
+    std::vector<std::string> initItems;
+    size_t assign = text.find('=');
+    if (assign != std::string::npos) {
+        std::string initText = trim(text.substr(assign + 1));
+        text = trim(text.substr(0, assign));
+
+        if (!initText.empty() && (initText.front() == '{')) {
+            if (initText.back() != '}') {
+                return error("全局变量初值格式错误：" + initText);
+            }
+            initText = initText.substr(1, initText.size() - 2);
+        }
+
+        size_t start = 0;
+        while (start <= initText.size()) {
+            size_t comma = initText.find(',', start);
+            std::string item = trim(initText.substr(start, comma == std::string::npos ? std::string::npos : comma - start));
+            if (!item.empty()) {
+                initItems.push_back(item);
+            }
+            if (comma == std::string::npos) {
+                break;
+            }
+            start = comma + 1;
+        }
+    }
+
+    size_t pos = text.find(' ');
+    if (pos == std::string::npos) {
+        return error("全局变量声明格式错误");
+    }
+
+    Type * type = parseType(text.substr(0, pos));
+    if (!type) {
+        return error("不支持的类型：" + text.substr(0, pos));
+    }
+
+    std::string name = trim(text.substr(pos + 1));
+
+    // 初值按元素类型解析，float保存位模式
+    std::vector<int32_t> initValues;
+    for (auto & item: initItems) {
+        int32_t value;
+        if (type->isFloatType() ? !parseFloatBits(item, value) : !parseInt(item, value)) {
+            return error("全局变量初值格式错误：" + item);
+        }
+        initValues.push_back(value);
+    }
+
+    // 数组的维度
+    std::vector<int> dims;
+    size_t bracket = name.find('[');
+    if (bracket != std::string::npos) {
+        std::string dimText = name.substr(bracket);
+        name = name.substr(0, bracket);
+
+        size_t k = 0;
+        while (k < dimText.size() && dimText[k] == '[') {
+            size_t close = dimText.find(']', k);
+            if (close == std::string::npos) {
+                return error("数组维度格式错误");
+            }
+            dims.push_back(atoi(dimText.substr(k + 1, close - k - 1).c_str()));
+            k = close + 1;
+        }
+
+        type = ArrayType::get(type, dims);
+    }
+
+    if (!startsWith(name, IR_GLOBAL_VARNAME_PREFIX)) {
+        return error("全局变量名必须以@开始：" + name);
+    }
+
+    if (globals.count(name)) {
+        return error("全局变量重复声明：" + name);
+    }
+
+    // 函数外创建的变量为全局变量
+    Value * var = module->newVarValue(type, name.substr(1));
+    if (!var) {
+        return error("全局变量创建失败：" + name);
+    }
+
+    if (!initValues.empty()) {
+        if ((int32_t) initValues.size() > std::max(1, type->getSize() / 4)) {
+            return error("全局变量初值个数超出变量大小：" + name);
+        }
+        static_cast<GlobalVariable *>(var)->setInitValues(initValues);
+    }
+
+    globals[name] = var;
+
+    return true;
+}
+
+/// @brief 处理函数头define，创建函数以及形参
+/// @param line 行文本
+/// @return 函数，失败时为空
+Function * IRReader::readFunctionHeader(const std::string & line)
+{
+    // define i32 @f(i32%t0, i32*%t1)
+    std::string text = trim(line.substr(strlen(IR_KEYWORD_DEFINE)));
+
+    size_t space = text.find(' ');
+    size_t lparen = text.find('(');
+    size_t rparen = text.rfind(')');
+    if ((space == std::string::npos) || (lparen == std::string::npos) || (rparen == std::string::npos) ||
+        (lparen < space) || (rparen < lparen)) {
+        error("函数头格式错误");
+        return nullptr;
+    }
+
+    Type * returnType = parseType(text.substr(0, space));
+    if (!returnType) {
+        error("不支持的返回类型：" + text.substr(0, space));
+        return nullptr;
+    }
+
+    std::string name = trim(text.substr(space + 1, lparen - space - 1));
+    if (!startsWith(name, IR_GLOBAL_VARNAME_PREFIX)) {
+        error("函数名必须以@开始：" + name);
+        return nullptr;
+    }
+    name = name.substr(1);
+
+    // 形参，类型与名字之间可能没有空格
+    std::vector<FormalParam *> params;
+    std::vector<std::string> paramNames;
+    for (auto & paramText: split(text.substr(lparen + 1, rparen - lparen - 1), ',')) {
+
+        size_t pos = paramText.find('%');
+        if (pos == std::string::npos) {
+            error("形参格式错误：" + paramText);
+            return nullptr;
+        }
+
+        Type * paramType = parseType(trim(paramText.substr(0, pos)));
+        if (!paramType) {
+            error("不支持的形参类型：" + paramText);
+            return nullptr;
+        }
+
+        params.push_back(new FormalParam{paramType, ""});
+        paramNames.push_back(trim(paramText.substr(pos)));
+    }
+
+    if (module->findFunction(name)) {
+        error("函数重复定义：" + name);
+        return nullptr;
+    }
+
+    Function * func = module->newFunction(name, returnType, params);
+    if (!func) {
+        error("函数创建失败：" + name);
+        return nullptr;
+    }
+
+    // 形参的名字只在函数内有效，先记录到形参上，处理函数体时使用
+    for (size_t k = 0; k < params.size(); ++k) {
+        params[k]->setIRName(paramNames[k]);
+    }
+
+    return func;
+}
+
+/// @brief 处理函数体，从函数头的下一行开始到}为止
+/// @param func 函数
+/// @param lineNo 函数头的行号，从0开始
+/// @return true：成功，false：失败
+bool IRReader::readFunctionBody(Function * func, size_t lineNo)
+{
+    locals.clear();
+    tempTypes.clear();
+    labels.clear();
+    placedLabels.clear();
+
+    for (auto param: func->getParams()) {
+        locals[param->getIRName()] = param;
+    }
+
+    module->setCurrentFunction(func);
+
+    curLine = lineNo + 1;
+    if ((curLine >= lines.size()) || (trim(lines[curLine]) != "{")) {
+        return error("函数" + func->getName() + "缺少{");
+    }
+
+    for (curLine++; curLine < lines.size(); ++curLine) {
+
+        std::string text = trim(lines[curLine]);
+
+        if (text.empty()) {
+            continue;
+        }
+
+        if (text == "}") {
+            break;
+        }
+
+        bool result;
+        if (startsWith(text, IR_KEYWORD_DECLARE " ")) {
+            result = readLocalDeclare(func, trim(text.substr(strlen(IR_KEYWORD_DECLARE))));
+        } else {
+            result = readInstruction(func, text);
+        }
+
+        if (!result) {
+            module->setCurrentFunction(nullptr);
+            return false;
+        }
+    }
+
+    module->setCurrentFunction(nullptr);
+
+    // 跳转到的Label必须在函数内出现
+    for (auto & item: labels) {
+        if (!placedLabels.count(item.second)) {
+            return error("函数" + func->getName() + "中的Label未定义：" + item.first);
+        }
+    }
+
+    // 出口指令前的Label为函数出口，出口指令的操作数为返回值变量
+    auto & insts = func->getInterCode().getInsts();
+    for (size_t k = 0; k < insts.size(); ++k) {
+        if (insts[k]->getOp() == IRInstOperator::IRINST_OP_EXIT) {
+            if ((k > 0) && (insts[k - 1]->getOp() == IRInstOperator::IRINST_OP_LABEL)) {
+                func->setExitLabel(insts[k - 1]);
+            }
+            if (insts[k]->getOperandsNum() > 0) {
+                if (Instanceof(retVal, LocalVariable *, insts[k]->getOperand(0))) {
+                    func->setReturnValue(retVal);
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+/// @brief 处理函数内的declare
+/// @param func 函数
+/// @param text 去掉declare后的文本
+/// @return true：成功，false：失败
+bool IRReader::readLocalDeclare(Function * func, const std::string & text)
+{
+    // declare i32 %l1 ; 1:a
+    // declare i32 %l1[10][10] ;数组a
+    // declare i32 %t4
+    std::string comment;
+    std::string decl = trim(stripComment(text, &comment));
+
+    size_t pos = decl.find(' ');
+    if (pos == std::string::npos) {
+        return error("变量声明格式错误");
+    }
+
+    Type * type = parseType(decl.substr(0, pos));
+    if (!type) {
+        return error("不支持的类型：" + decl.substr(0, pos));
+    }
+
+    std::string name = trim(decl.substr(pos + 1));
+
+    if (startsWith(name, IR_TEMP_VARNAME_PREFIX)) {
+        // 临时变量由定义它的指令创建，这里只记录类型
+        tempTypes[name] = type;
+        return true;
+    }
+
+    if (!startsWith(name, IR_LOCAL_VARNAME_PREFIX)) {
+        return error("局部变量名必须以%l开始：" + name);
+    }
+
+    std::vector<int> dims;
+    size_t bracket = name.find('[');
+    if (bracket != std::string::npos) {
+        std::string dimText = name.substr(bracket);
+        name = name.substr(0, bracket);
+
+        size_t k = 0;
+        while (k < dimText.size() && dimText[k] == '[') {
+            size_t close = dimText.find(']', k);
+            if (close == std::string::npos) {
+                return error("数组维度格式错误");
+            }
+            dims.push_back(atoi(dimText.substr(k + 1, close - k - 1).c_str()));
+            k = close + 1;
+        }
+
+        type = ArrayType::get(type, dims);
+    }
+
+    // 注释中为作用域层级与源程序中的名字，如1:a，数组为"数组a"
+    std::string realName;
+    int32_t scopeLevel = 1;
+    if (!comment.empty()) {
+        size_t colon = comment.find(':');
+        if ((colon != std::string::npos) && isdigit((unsigned char) comment[0])) {
+            scopeLevel = atoi(comment.substr(0, colon).c_str());
+            realName = comment.substr(colon + 1);
+        } else if (startsWith(comment, "数组")) {
+            realName = comment.substr(strlen("数组"));
+        }
+    }
+
+    if (locals.count(name)) {
+        return error("变量重复声明：" + name);
+    }
+
+    locals[name] = func->newLocalVarValue(type, realName, scopeLevel);
+
+    return true;
+}
+
+/// @brief 处理一条指令
+/// @param func 函数
+/// @param text 指令文本
+/// @return true：成功，false：失败
+bool IRReader::readInstruction(Function * func, const std::string & text)
+{
+    InterCode & irCode = func->getInterCode();
+
+    // Label指令，可能带有profile执行次数的注释：.L3: ; count=143
+    std::string comment;
+    std::string labelText = trim(stripComment(text, &comment));
+    if ((!labelText.empty()) && (labelText.back() == ':')) {
+
+        LabelInstruction * label = getLabel(func, labelText.substr(0, labelText.size() - 1));
+        if (placedLabels.count(label)) {
+            return error("Label重复定义：" + labelText);
+        }
+
+        if (startsWith(comment, "count=")) {
+            label->setProfileCount(strtoll(comment.c_str() + strlen("count="), nullptr, 10));
+        }
+
+        placedLabels[label] = true;
+        irCode.addInst(label);
+        return true;
+    }
+
+    if (text == "entry") {
+        irCode.addInst(new EntryInstruction(func));
+        return true;
+    }
+
+    if ((text == "exit") || startsWith(text, "exit ")) {
+
+        Value * result = nullptr;
+        if (text.size() > 4) {
+            result = parseOperand(text.substr(4));
+            if (!result) {
+                return false;
+            }
+        }
+
+        irCode.addInst(new ExitInstruction(func, result));
+        return true;
+    }
+
+    if (startsWith(text, "br label ")) {
+        irCode.addInst(new GotoInstruction(func, getLabel(func, trim(text.substr(9)))));
+        return true;
+    }
+
+    if (startsWith(text, "bc ")) {
+
+        // bc %t1, label .L2, label .L3
+        auto parts = split(text.substr(3), ',');
+        if ((parts.size() != 3) || !startsWith(parts[1], "label ") || !startsWith(parts[2], "label ")) {
+            return error("条件跳转指令格式错误");
+        }
+
+        Value * cond = parseOperand(parts[0]);
+        if (!cond) {
+            return false;
+        }
+
+        irCode.addInst(new GotoInstruction(func,
+                                           cond,
+                                           getLabel(func, trim(parts[1].substr(6))),
+                                           getLabel(func, trim(parts[2].substr(6)))));
+        return true;
+    }
+
+    if (startsWith(text, "call ")) {
+        return readCall(func, "", text.substr(5));
+    }
+
+    if (startsWith(text, "arg ")) {
+        Value * src = parseOperand(stripComment(text.substr(4)));
+        if (!src) {
+            return false;
+        }
+        irCode.addInst(new ArgInstruction(func, src));
+        return true;
+    }
+
+    // 剩下的都是赋值形式：左侧 = 右侧
+    size_t eq = text.find(" = ");
+    if (eq == std::string::npos) {
+        return error("不认识的指令：" + text);
+    }
+
+    std::string lhs = trim(text.substr(0, eq));
+    std::string rhs = trim(text.substr(eq + 3));
+
+    // 指针存储：*%t8 = %l4
+    if (lhs[0] == '*') {
+        Value * dst = parseOperand(lhs.substr(1));
+        Value * src = parseOperand(rhs);
+        if (!dst || !src) {
+            return false;
+        }
+
+        MoveInstruction * moveInst = new MoveInstruction(func, dst, src);
+        moveInst->setIsPointerStore(true);
+        irCode.addInst(moveInst);
+        return true;
+    }
+
+    if (startsWith(rhs, "call ")) {
+        return readCall(func, lhs, rhs.substr(5));
+    }
+
+    // 二元运算、比较运算、求负运算以及int与float的转换，左侧为新定义的临时变量
+    IRInstOperator op = IRInstOperator::IRINST_OP_MAX;
+    std::string operands;
+    for (auto & item: binaryOpTable) {
+        size_t len = strlen(item.name);
+        if ((rhs.compare(0, len, item.name) == 0) && (rhs.size() > len) && (rhs[len] == ' ')) {
+            op = item.op;
+            operands = rhs.substr(len + 1);
+            break;
+        }
+    }
+
+    bool isUnary = BinaryInstruction::isUnaryOp(op);
+
+    if (op != IRInstOperator::IRINST_OP_MAX) {
+
+        auto pIter = tempTypes.find(lhs);
+        if (pIter == tempTypes.end()) {
+            return error("运算结果必须是声明过的临时变量：" + lhs);
+        }
+
+        if (locals.count(lhs)) {
+            return error("临时变量重复定义：" + lhs);
+        }
+
+        auto parts = split(operands, ',');
+        if (parts.size() != (isUnary ? 1u : 2u)) {
+            return error("运算指令的操作数个数错误");
+        }
+
+        Value * src1 = parseOperand(parts[0]);
+        Value * src2 = isUnary ? nullptr : parseOperand(parts[1]);
+        if (!src1 || (!isUnary && !src2)) {
+            return false;
+        }
+
+        BinaryInstruction * inst = new BinaryInstruction(func, op, src1, src2, pIter->second);
+        irCode.addInst(inst);
+        locals[lhs] = inst;
+        return true;
+    }
+
+    // 普通赋值与指针读取：%l0 = %t52，%l4 = *%t8
+    Value * dst = parseOperand(lhs);
+    if (!dst) {
+        return false;
+    }
+
+    bool isLoad = (rhs[0] == '*');
+    Value * src = parseOperand(isLoad ? rhs.substr(1) : rhs);
+    if (!src) {
+        return false;
+    }
+
+    MoveInstruction * moveInst = new MoveInstruction(func, dst, src);
+    moveInst->setIsPointerLoad(isLoad);
+    irCode.addInst(moveInst);
+
+    return true;
+}
+
+/// @brief 处理函数调用指令的剩余部分：类型 @函数名(实参列表)
+/// @param func 函数
+/// @param resultName 结果的名字，无返回值时为空
+/// @param text call后的文本
+/// @return true：成功，false：失败
+bool IRReader::readCall(Function * func, const std::string & resultName, const std::string & text)
+{
+    // void @putint(i32 %t6) 或 i32 @f(i32 %l1, i32 2)
+    size_t space = text.find(' ');
+    size_t lparen = text.find('(');
+    size_t rparen = text.rfind(')');
+    if ((space == std::string::npos) || (lparen == std::string::npos) || (rparen == std::string::npos) ||
+        (lparen < space) || (rparen < lparen)) {
+        return error("函数调用指令格式错误");
+    }
+
+    Type * type = parseType(text.substr(0, space));
+    if (!type) {
+        return error("不支持的返回类型：" + text.substr(0, space));
+    }
+
+    std::string name = trim(text.substr(space + 1, lparen - space - 1));
+    Function * calledFunc = startsWith(name, IR_GLOBAL_VARNAME_PREFIX) ? module->findFunction(name.substr(1)) : nullptr;
+    if (!calledFunc) {
+        return error("函数未定义：" + name);
+    }
+
+    // 实参为“类型 名字”的形式，只取名字
+    std::vector<Value *> args;
+    for (auto & argText: split(text.substr(lparen + 1, rparen - lparen - 1), ',')) {
+        size_t pos = argText.rfind(' ');
+        Value * arg = parseOperand(pos == std::string::npos ? argText : argText.substr(pos + 1));
+        if (!arg) {
+            return false;
+        }
+        args.push_back(arg);
+    }
+
+    if (!resultName.empty()) {
+        if (!tempTypes.count(resultName)) {
+            return error("函数调用结果必须是声明过的临时变量：" + resultName);
+        }
+        if (locals.count(resultName)) {
+            return error("临时变量重复定义：" + resultName);
+        }
+    }
+
+    func->setExistFuncCall(true);
+    if ((int) args.size() > func->getMaxFuncCallArgCnt()) {
+        func->setMaxFuncCallArgCnt((int) args.size());
+    }
+
+    FuncCallInstruction * inst = new FuncCallInstruction(func, calledFunc, args, type);
+    func->getInterCode().addInst(inst);
+
+    if (!resultName.empty()) {
+        locals[resultName] = inst;
+    }
+
+    return true;
+}
+
+/// @brief 文本类型转换成类型，支持i1、i32、float、void以及其指针
+/// @param text 类型文本
+/// @return 类型，不认识时为空
+Type * IRReader::parseType(const std::string & text)
+{
+    if (!text.empty() && text.back() == '*') {
+        Type * pointee = parseType(text.substr(0, text.size() - 1));
+        if (!pointee) {
+            return nullptr;
+        }
+        return const_cast<Type *>(static_cast<const Type *>(PointerType::get(pointee)));
+    }
+
+    if (text == "i32") {
+        return IntegerType::getTypeInt();
+    }
+
+    if (text == "i1") {
+        return IntegerType::getTypeBool();
+    }
+
+    if (text == "float") {
+        return FloatType::getTypeFloat();
+    }
+
+    if (text == "void") {
+        return VoidType::getType();
+    }
+
+    return nullptr;
+}
+
+/// @brief 根据名字、整数常量或float常量查找操作数
+/// @param text 操作数文本
+/// @return 操作数，找不到时为空，并设置错误信息
+Value * IRReader::parseOperand(const std::string & text)
+{
+    std::string name = trim(text);
+
+    if (name.empty()) {
+        error("缺少操作数");
+        return nullptr;
+    }
+
+    if (isFloatText(name)) {
+        int32_t bits;
+        if (!parseFloatBits(name, bits)) {
+            error("float常量格式错误：" + name);
+            return nullptr;
+        }
+        return module->newConstFloatBits(bits);
+    }
+
+    if (isdigit((unsigned char) name[0]) || ((name[0] == '-') && (name.size() > 1))) {
+        char * end;
+        long val = strtol(name.c_str(), &end, 10);
+        if (*end != '\0') {
+            error("整数常量格式错误：" + name);
+            return nullptr;
+        }
+        return module->newConstInt((int32_t) val);
+    }
+
+    auto & table = startsWith(name, IR_GLOBAL_VARNAME_PREFIX) ? globals : locals;
+
+    auto pIter = table.find(name);
+    if (pIter == table.end()) {
+        error("变量未定义：" + name);
+        return nullptr;
+    }
+
+    return pIter->second;
+}
+
+/// @brief 根据名字获取Label指令，不存在时创建，用于前向跳转
+/// @param func 函数
+/// @param name Label名字
+/// @return Label指令
+LabelInstruction * IRReader::getLabel(Function * func, const std::string & name)
+{
+    auto pIter = labels.find(name);
+    if (pIter != labels.end()) {
+        return pIter->second;
+    }
+
+    LabelInstruction * label = new LabelInstruction(func);
+    labels[name] = label;
+
+    return label;
+}
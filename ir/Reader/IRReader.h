@@ -0,0 +1,140 @@
+///
+/// @file IRReader.h
+/// @brief 读取文本形式的线性IR(DragonIR)，重建Module、Function以及IR指令
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Module.h"
+#include "LabelInstruction.h"
+
+///
+/// @brief 线性IR读取器，读取Module::outputIR输出的文本，重建的Module可直接进行优化与后端代码生成。
+/// 读取分两遍：第一遍处理全局变量的declare与所有函数的define，使得函数可以调用后面定义的函数；
+/// 第二遍逐个函数处理局部变量、临时变量的declare以及指令
+///
+class IRReader {
+
+public:
+    /// @brief 构造函数
+    /// @param _fileName IR文件名
+    /// @param _module 要填充的模块
+    IRReader(const std::string & _fileName, Module * _module);
+
+    /// @brief 析构函数
+    ~IRReader() = default;
+
+    /// @brief 读取IR文件并重建模块
+    /// @return true：成功，false：失败
+    bool run();
+
+    void setLastError(const std::string & error)
+    {
+        lastError = error;
+    }
+    std::string getLastError() const
+    {
+        return lastError;
+    }
+
+protected:
+    /// @brief 处理全局变量的declare
+    /// @param line 行文本
+    /// @return true：成功，false：失败
+    bool readGlobalDeclare(const std::string & line);
+
+    /// @brief 处理函数头define，创建函数以及形参
+    /// @param line 行文本
+    /// @return 函数，失败时为空
+    Function * readFunctionHeader(const std::string & line);
+
+    /// @brief 处理函数体，从函数头的下一行开始到}为止
+    /// @param func 函数
+    /// @param lineNo 函数头的行号，从0开始
+    /// @return true：成功，false：失败
+    bool readFunctionBody(Function * func, size_t lineNo);
+
+    /// @brief 处理函数内的declare
+    /// @param func 函数
+    /// @param text 去掉declare后的文本
+    /// @return true：成功，false：失败
+    bool readLocalDeclare(Function * func, const std::string & text);
+
+    /// @brief 处理一条指令
+    /// @param func 函数
+    /// @param text 指令文本
+    /// @return true：成功，false：失败
+    bool readInstruction(Function * func, const std::string & text);
+
+    /// @brief 处理函数调用指令的剩余部分：类型 @函数名(实参列表)
+    /// @param func 函数
+    /// @param resultName 结果的名字，无返回值时为空
+    /// @param text call后的文本
+    /// @return true：成功，false：失败
+    bool readCall(Function * func, const std::string & resultName, const std::string & text);
+
+    /// @brief 文本类型转换成类型，支持i1、i32、void以及其指针
+    /// @param text 类型文本
+    /// @return 类型，不认识时为空
+    Type * parseType(const std::string & text);
+
+    /// @brief 根据名字或整数常量查找操作数
+    /// @param text 操作数文本
+    /// @return 操作数，找不到时为空，并设置错误信息
+    Value * parseOperand(const std::string & text);
+
+    /// @brief 根据名字获取Label指令，不存在时创建，用于前向跳转
+    /// @param func 函数
+    /// @param name Label名字
+    /// @return Label指令
+    LabelInstruction * getLabel(Function * func, const std::string & name);
+
+    /// @brief 设置带行号的错误信息
+    /// @param error 错误信息
+    /// @return 恒为false，便于直接返回
+    bool error(const std::string & error);
+
+private:
+    /// @brief IR文件名
+    std::string fileName;
+
+    /// @brief 要填充的模块
+    Module * module;
+
+    /// @brief IR文件的所有行
+    std::vector<std::string> lines;
+
+    /// @brief 当前处理的行号，从0开始
+    size_t curLine = 0;
+
+    /// @brief 全局变量，名字含@
+    std::unordered_map<std::string, Value *> globals;
+
+    /// @brief 当前函数内的形参、局部变量与临时变量，名字含%
+    std::unordered_map<std::string, Value *> locals;
+
+    /// @brief 当前函数内临时变量declare的类型，在定义临时变量的指令中使用
+    std::unordered_map<std::string, Type *> tempTypes;
+
+    /// @brief 当前函数内的Label指令
+    std::unordered_map<std::string, LabelInstruction *> labels;
+
+    /// @brief 已经加入到指令序列中的Label指令，用于检查重复定义与未定义的Label
+    std::unordered_map<LabelInstruction *, bool> placedLabels;
+
+    /// @brief 错误信息
+    std::string lastError;
+};
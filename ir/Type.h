@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 #define Instanceof(res, type, var) auto res = dynamic_cast<type>(var)
@@ -44,8 +45,11 @@ public:
     ///
     /// @brief 构造函数
     /// @param _ID 类型ID
+    /// @param _size 所占内存空间大小，-1表示没有大小
+    /// @param _alignment 对齐字节数，0表示没有对齐要求
     ///
-    Type(TypeID _ID = VoidTyID) : ID(_ID)
+    Type(TypeID _ID = VoidTyID, int32_t _size = -1, int32_t _alignment = 0)
+        : ID(_ID), size(_size), alignment(_alignment)
     {}
 
     ///
@@ -116,9 +120,9 @@ public:
     /// @return true
     /// @return false
     ///
-    [[nodiscard]] virtual bool isInt1Byte() const
+    [[nodiscard]] bool isInt1Byte() const
     {
-        return false;
+        return (ID == IntegerTyID) && (intBitWidth == 1);
     }
 
     ///
@@ -126,9 +130,9 @@ public:
     /// @return true
     /// @return false
     ///
-    [[nodiscard]] virtual bool isInt32Type() const
+    [[nodiscard]] bool isInt32Type() const
     {
-        return false;
+        return (ID == IntegerTyID) && (intBitWidth == 32);
     }
 
     ///
@@ -161,12 +165,21 @@ public:
     }
 
     ///
-    /// @brief 获得类型所占内存空间大小
+    /// @brief 获得类型所占内存空间大小，创建类型时已算好
     /// @return int32_t
     ///
-    [[nodiscard]] virtual int32_t getSize() const
+    [[nodiscard]] int32_t getSize() const
     {
-        return -1;
+        return size;
+    }
+
+    ///
+    /// @brief 获得类型的对齐字节数，数组为元素的对齐字节数
+    /// @return int32_t
+    ///
+    [[nodiscard]] int32_t getAlignment() const
+    {
+        return alignment;
     }
 
     /// @brief 转换字符串
@@ -178,4 +191,19 @@ protected:
     /// @brief 标识类型的ID
     ///
     TypeID ID;
+
+    ///
+    /// @brief 所占内存空间大小，-1表示没有大小
+    ///
+    int32_t size;
+
+    ///
+    /// @brief 对齐字节数
+    ///
+    int32_t alignment;
+
+    ///
+    /// @brief 整数类型的位宽，其它类型为0，整数类型的判断不需要虚函数调用
+    ///
+    int32_t intBitWidth = 0;
 };
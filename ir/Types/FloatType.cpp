@@ -0,0 +1,35 @@
+///
+/// @file FloatType.cpp
+/// @brief 32位单精度浮点类型类
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+
+#include "FloatType.h"
+
+///
+/// @brief 唯一的float类型实例
+///
+FloatType * FloatType::oneInstance;
+
+///
+/// @brief 获取类型float
+/// @return FloatType*
+///
+FloatType * FloatType::getTypeFloat()
+{
+    // 只维持一份
+    if (!oneInstance) {
+        oneInstance = new FloatType();
+    }
+
+    return oneInstance;
+}
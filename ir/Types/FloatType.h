@@ -0,0 +1,49 @@
+///
+/// @file FloatType.h
+/// @brief 32位单精度浮点类型类
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+
+#pragma once
+
+#include "Type.h"
+
+class FloatType final : public Type {
+
+public:
+    ///
+    /// @brief 获取类型，全局只有一份
+    /// @return FloatType*
+    ///
+    static FloatType * getTypeFloat();
+
+    ///
+    /// @brief 获取类型的IR标识符
+    /// @return std::string IR标识符float
+    ///
+    [[nodiscard]] std::string toString() const override
+    {
+        return "float";
+    }
+
+private:
+    ///
+    /// @brief 构造函数
+    ///
+    explicit FloatType() : Type(Type::FloatTyID, 4, 4)
+    {}
+
+    ///
+    /// @brief 唯一的float类型实例
+    ///
+    static FloatType * oneInstance;
+};
@@ -17,21 +17,69 @@
 
 #pragma once
 
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include "Type.h"
+#include "StorageSet.h"
 
+///
+/// @brief 函数类型，相同返回类型和形参类型的函数类型只有一个实例
+///
 class FunctionType final : public Type {
+
+    ///
+    /// @brief Hash用结构体，按返回类型和形参类型计算
+    ///
+    struct FunctionTypeHasher final {
+        size_t operator()(const FunctionType & type) const noexcept
+        {
+            size_t hash = std::hash<const Type *>{}(type.getReturnType());
+            for (Type * argType: type.getArgTypes()) {
+                hash = hash * 31 + std::hash<const Type *>{}(argType);
+            }
+            return hash;
+        }
+    };
+
+    ///
+    /// @brief 判断两者相等的结构体，返回类型和形参类型都相同
+    ///
+    struct FunctionTypeEqual final {
+        bool operator()(const FunctionType & lhs, const FunctionType & rhs) const noexcept
+        {
+            return (lhs.getReturnType() == rhs.getReturnType()) && (lhs.getArgTypes() == rhs.getArgTypes());
+        }
+    };
+
 public:
     ///
     /// @brief 函数类型
     /// @param retType 函数返回值类型
     /// @param argTypes 函数形参类型
     ///
-    FunctionType(Type * _retType, std::vector<Type *> _argTypes) : retType{_retType}, argTypes{std::move(_argTypes)}
+    FunctionType(Type * _retType, std::vector<Type *> _argTypes)
+        : Type(FunctionTyID), retType{_retType}, argTypes{std::move(_argTypes)}
     {}
 
+    ///
+    /// @brief 获取函数类型，相同的返回类型和形参类型返回同一个实例
+    /// @param retType 函数返回值类型
+    /// @param argTypes 函数形参类型
+    /// @return FunctionType*
+    ///
+    static FunctionType * get(Type * retType, const std::vector<Type *> & argTypes)
+    {
+        static StorageSet<FunctionType, FunctionTypeHasher, FunctionTypeEqual> storageSet;
+
+        static std::mutex storageMutex;
+        std::lock_guard<std::mutex> lock(storageMutex);
+
+        // 实例创建后不再修改，可以去掉集合元素的const
+        return const_cast<FunctionType *>(storageSet.get(retType, argTypes));
+    }
+
     ///
     /// @brief 函数类型的IR字符串
     /// @return std::string
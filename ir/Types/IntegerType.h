@@ -54,41 +54,14 @@ public:
         return this->bitWidth;
     }
 
-    ///
-    /// @brief 是否是布尔类型，也就是1位整数类型
-    /// @return true
-    /// @return false
-    ///
-    [[nodiscard]] bool isInt1Byte() const override
-    {
-        return bitWidth == 1;
-    }
-
-    ///
-    /// @brief 是否是int类型，也就是32位整数类型
-    /// @return true
-    /// @return false
-    ///
-    [[nodiscard]] bool isInt32Type() const override
-    {
-        return bitWidth == 32;
-    }
-
-    ///
-    /// @brief 获得类型所占内存空间大小
-    /// @return int32_t
-    ///
-    [[nodiscard]] int32_t getSize() const override
-    {
-        return 4;
-    }
-
 private:
     ///
     /// @brief 构造函数
     ///
-    explicit IntegerType(int32_t _bitWidth) : Type(Type::IntegerTyID), bitWidth(_bitWidth)
-    {}
+    explicit IntegerType(int32_t _bitWidth) : Type(Type::IntegerTyID, 4, 4), bitWidth(_bitWidth)
+    {
+        intBitWidth = _bitWidth;
+    }
 
     ///
     /// @brief 唯一的VOID类型实例
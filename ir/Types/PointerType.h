@@ -17,6 +17,7 @@
 
 #include "Type.h"
 #include "StorageSet.h"
+#include <mutex>
 #include <vector>
 
 ///
@@ -64,7 +65,7 @@ public:
     ///
     /// 该构造函数将Type的ID设置为PointerTypeID，并且
     /// 保存pointeeType的指针到pointeeType成员变量
-    explicit PointerType(const Type * pointeeType) : Type(PointerTyID)
+    explicit PointerType(const Type * pointeeType) : Type(PointerTyID, 4, 4)
     {
         this->pointeeType = pointeeType;
 
@@ -114,6 +115,11 @@ public:
     static const PointerType * get(Type * pointee)
     {
         static StorageSet<PointerType, PointerTypeHasher, PointerTypeEqual> storageSet;
+
+        // 后端按函数并行生成代码时也会获取指针类型，这里需互斥访问
+        static std::mutex storageMutex;
+        std::lock_guard<std::mutex> lock(storageMutex);
+
         return storageSet.get(pointee);
     }
 
@@ -148,9 +154,34 @@ private:
 
 //添加 ArrayType 类的定义和实现-lxg
 ///
-/// @brief 数组类型
+/// @brief 数组类型，相同元素类型和维度的数组类型只有一个实例，可直接比较指针
 ///
 class ArrayType : public Type {
+
+    ///
+    /// @brief Hash用结构体，按元素类型和各维度大小计算
+    ///
+    struct ArrayTypeHasher final {
+        size_t operator()(const ArrayType & type) const noexcept
+        {
+            size_t hash = std::hash<const Type *>{}(type.getElementType());
+            for (int dim: type.getDimensions()) {
+                hash = hash * 31 + std::hash<int>{}(dim);
+            }
+            return hash;
+        }
+    };
+
+    ///
+    /// @brief 判断两者相等的结构体，元素类型和各维度大小都相同
+    ///
+    struct ArrayTypeEqual final {
+        bool operator()(const ArrayType & lhs, const ArrayType & rhs) const noexcept
+        {
+            return (lhs.getElementType() == rhs.getElementType()) && (lhs.getDimensions() == rhs.getDimensions());
+        }
+    };
+
 private:
     /// @brief 元素类型
     Type* elementType;
@@ -162,13 +193,18 @@ private:
     std::vector<int> dimensions;
     
 public:
-    /// @brief 构造函数
+    /// @brief 构造函数，应通过get获取数组类型
     /// @param elemType 元素类型
     /// @param dims 各维度大小
     ArrayType(Type* elemType, const std::vector<int>& dims)
-        : Type(ArrayTyID), elementType(elemType), dimensions(dims)
+        : Type(ArrayTyID, elemType->getSize(), elemType->getAlignment()), elementType(elemType), dimensions(dims)
     {
         dimension = dimensions.size();
+
+        // 数组大小在创建时算好，后续查询不需要遍历维度
+        for (int dim : dimensions) {
+            size *= dim;
+        }
     }
     
     /// @brief 获取元素类型
@@ -189,17 +225,7 @@ public:
     
     /// @brief 获取整个数组占用空间大小（字节）
     /// @return 整个数组大小
-    int getTotalSize() const {
-        int total = getElementSize();
-        for (int dim : dimensions) {
-            total *= dim;
-        }
-        return total;
-    }
-    
-    /// @brief 获取类型大小
-    /// @return 整个数组大小
-    int32_t getSize() const override { return getTotalSize(); }
+    int getTotalSize() const { return size; }
     
     /// @brief 获取类型字符串表示
     /// @return 类型字符串
@@ -215,11 +241,25 @@ public:
         return result;
     }
     
-    /// @brief 创建数组类型的静态方法
+    /// @brief 获取数组类型，相同的元素类型和维度返回同一个实例
     /// @param elemType 元素类型
     /// @param dims 维度大小列表
     /// @return 数组类型指针
     static ArrayType* get(Type* elemType, const std::vector<int>& dims) {
-        return new ArrayType(elemType, dims);
+        static StorageSet<ArrayType, ArrayTypeHasher, ArrayTypeEqual> storageSet;
+
+        // 与指针类型一样，后端并行生成代码时可能获取，需互斥访问
+        static std::mutex storageMutex;
+        std::lock_guard<std::mutex> lock(storageMutex);
+
+        // 实例创建后不再修改，可以去掉集合元素的const
+        return const_cast<ArrayType *>(storageSet.get(elemType, dims));
+    }
+
+    /// @brief 类型是数组类型时转换为数组类型，按类型ID判断，不需要dynamic_cast
+    /// @param type 类型
+    /// @return 数组类型指针，不是数组类型时为空指针
+    static ArrayType* cast(Type* type) {
+        return (type && type->isArrayType()) ? static_cast<ArrayType *>(type) : nullptr;
     }
 };
\ No newline at end of file
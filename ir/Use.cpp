@@ -24,17 +24,50 @@
 ///
 void Use::setUsee(Value * newVal)
 {
-    this->usee->removeUse(this);
+    if (this->usee) {
+        this->usee->removeUse(this);
+    }
     this->usee = newVal;
-    this->usee->addUse(this);
+    if (this->usee) {
+        this->usee->addUse(this);
+    }
 }
 
 ///
 /// @brief 移除def-use边，需要两头分别清理
-/// ! 请注意该函数并没有删除Use，需要自行清理资源
+/// ! User的操作数数组中后面的边会前移，该Use对象不再代表原来的边
 ///
 void Use::remove()
 {
-    usee->removeUse(this);
+    if (usee) {
+        usee->removeUse(this);
+        usee = nullptr;
+    }
     user->removeOperandRaw(this);
+}
+
+///
+/// @brief 把边移动到另一个位置，use链中由新位置替代原来的位置，原来的边变为空边
+/// @param dst 新的位置，必须是空边
+///
+void Use::moveTo(Use & dst)
+{
+    dst.usee = usee;
+    dst.user = user;
+    dst.prevUse = prevUse;
+    dst.nextUse = nextUse;
+
+    if (prevUse) {
+        prevUse->nextUse = &dst;
+    } else if (usee) {
+        usee->firstUse = &dst;
+    }
+
+    if (nextUse) {
+        nextUse->prevUse = &dst;
+    }
+
+    usee = nullptr;
+    prevUse = nullptr;
+    nextUse = nullptr;
 }
\ No newline at end of file
@@ -29,11 +29,15 @@ class Value;
 /// Use可以跟踪每个Value的所有使用情况，并且当Value被修改或删除时，可以更新所有引用它的地方
 ///
 /// User和Use之间存在一个双向关系：
-/// User持有一个Use链表(成员uses)，每个Use指向一个Value
-/// Value持有一个User链表(成员uses)，每个User指向一个使用该Value的User对象
+/// User持有一个Use数组(成员operands)，Use对象就存放在User的操作数数组中，每个Use指向一个Value
+/// Value持有一个Use的侵入式双向链表(成员firstUse)，链表通过Use自身的prevUse/nextUse串起来，
+/// 因此增加、删除和更换边都是O(1)，不需要额外分配内存
 ///
 class Use {
 
+    friend class Value;
+    friend class User;
+
 protected:
     ///
     /// @brief 指向要使用的value
@@ -45,7 +49,22 @@ protected:
     ///
     User * user = nullptr;
 
+    ///
+    /// @brief usee的use链中的前一条边
+    ///
+    Use * prevUse = nullptr;
+
+    ///
+    /// @brief usee的use链中的后一条边
+    ///
+    Use * nextUse = nullptr;
+
 public:
+    ///
+    /// @brief 构造函数，构建一条空的边，用于User的操作数数组
+    ///
+    Use() = default;
+
     /**
      * 构建函数，构建一条define-use的边
      * <br>
@@ -57,6 +76,12 @@ public:
     Use(Value * _value, User * _user) : usee(_value), user(_user)
     {}
 
+    ///
+    /// @brief 边在链表中，不能拷贝，只能由User在操作数数组内移动
+    ///
+    Use(const Use &) = delete;
+    Use & operator=(const Use &) = delete;
+
     ///
     /// @brief 获取值
     /// @return Value *
@@ -84,6 +109,15 @@ public:
         return usee;
     }
 
+    ///
+    /// @brief 获取usee的use链中的下一条边，用于遍历Value的所有使用
+    /// @return Use* 下一条边，没有时为空指针
+    ///
+    [[nodiscard]] Use * getNextUse() const
+    {
+        return nextUse;
+    }
+
     ///
     /// @brief 不再使用Use原来的Value，更新为新的Value
     /// @param newVal 新的Value
@@ -91,7 +125,14 @@ public:
     void setUsee(Value * newVal);
 
     ///
-    /// @brief def-use边取消，但不会删除该Use
+    /// @brief def-use边取消，边从User的操作数中移除
     ///
     void remove();
+
+protected:
+    ///
+    /// @brief 把边移动到另一个位置，use链中由新位置替代原来的位置，原来的边变为空边
+    /// @param dst 新的位置，必须是空边
+    ///
+    void moveTo(Use & dst);
 };
\ No newline at end of file
@@ -15,8 +15,6 @@
 /// </table>
 ///
 
-#include <algorithm>
-
 #include "User.h"
 
 ///
@@ -26,6 +24,56 @@
 User::User(Type * _type) : Value(_type)
 {}
 
+///
+/// @brief 析构函数，清除所有的操作数
+///
+User::~User()
+{
+    // 操作数的边从被使用Value的use链中摘除后才能释放
+    clearOperands();
+
+    if (operandsOnHeap) {
+        delete[] operands;
+    }
+}
+
+///
+/// @brief 设置派生类内嵌的操作数数组，只能在增加操作数之前调用
+/// @param storage 数组
+/// @param capacity 数组的长度
+///
+void User::setInlineOperands(Use * storage, int32_t capacity)
+{
+    operands = storage;
+    operandsCapacity = capacity;
+    operandsOnHeap = false;
+}
+
+///
+/// @brief 预留操作数数组的空间，避免逐个增加操作数时多次扩大数组
+/// @param capacity 容量
+///
+void User::reserveOperands(int32_t capacity)
+{
+    if (capacity <= operandsCapacity) {
+        return;
+    }
+
+    // 边移动到新的数组中，use链中的位置随之更新
+    Use * newOperands = new Use[capacity];
+    for (int32_t pos = 0; pos < operandsNum; ++pos) {
+        operands[pos].moveTo(newOperands[pos]);
+    }
+
+    if (operandsOnHeap) {
+        delete[] operands;
+    }
+
+    operands = newOperands;
+    operandsCapacity = capacity;
+    operandsOnHeap = true;
+}
+
 ///
 /// @brief 更新指定Pos的Value
 /// @param pos 位置
@@ -33,8 +81,8 @@ User::User(Type * _type) : Value(_type)
 ///
 void User::setOperand(int32_t pos, Value * val)
 {
-    if (pos < (int32_t) operands.size()) {
-        operands[pos]->setUsee(val);
+    if (pos < operandsNum) {
+        operands[pos].setUsee(val);
     }
 }
 
@@ -50,14 +98,17 @@ void User::addOperand(Value * val)
         return;  // 或者抛出异常、记录错误
     }
 
-    // If not, add the given Value as a new use.
-    auto use = new Use(val, this);
+    if (operandsNum == operandsCapacity) {
+        reserveOperands(operandsCapacity ? operandsCapacity * 2 : 2);
+    }
 
-    // 增加到操作数中
-    operands.push_back(use);
+    // 边直接构造在操作数数组中
+    Use & use = operands[operandsNum++];
+    use.user = this;
+    use.usee = val;
 
     // 该val被使用
-    val->addUse(use);
+    val->addUse(&use);
 }
 
 ///
@@ -66,11 +117,10 @@ void User::addOperand(Value * val)
 ///
 void User::removeOperand(Value * val)
 {
-    for (auto & use: operands) {
-        if (use->getUsee() == val) {
+    for (int32_t pos = 0; pos < operandsNum; ++pos) {
+        if (operands[pos].getUsee() == val) {
             // 找到了就删除这个Use
-            use->remove();
-            delete use;
+            operands[pos].remove();
             break;
         }
     }
@@ -83,13 +133,8 @@ void User::removeOperand(Value * val)
 void User::removeOperand(int pos)
 {
     // 检索并清除边，使得边的两头都会自动减少
-    if (pos < (int32_t) operands.size()) {
-
-        // 必须先暂存后释放，不能直接delete uses[pos]
-        // 这是因为use->remove会删除operands的元素，使得operands[pos]的对象不再是原来的对象
-        Use * use = operands[pos];
-        use->remove();
-        delete use;
+    if (pos < operandsNum) {
+        operands[pos].remove();
     }
 }
 
@@ -99,10 +144,21 @@ void User::removeOperand(int pos)
 ///
 void User::removeOperandRaw(Use * use)
 {
-    auto pIter = std::find(operands.begin(), operands.end(), use);
-    if (pIter != operands.end()) {
-        operands.erase(pIter);
+    int32_t pos = (int32_t) (use - operands);
+    if ((pos < 0) || (pos >= operandsNum)) {
+        return;
+    }
+
+    // 后面的边依次前移
+    if (use->usee) {
+        use->usee->removeUse(use);
+        use->usee = nullptr;
     }
+    for (; pos + 1 < operandsNum; ++pos) {
+        operands[pos + 1].moveTo(operands[pos]);
+    }
+
+    operandsNum--;
 }
 
 ///
@@ -111,8 +167,8 @@ void User::removeOperandRaw(Use * use)
 ///
 void User::removeUse(Use * use)
 {
-    auto pIter = std::find(operands.begin(), operands.end(), use);
-    if (pIter != operands.end()) {
+    int32_t pos = (int32_t) (use - operands);
+    if ((pos >= 0) && (pos < operandsNum)) {
         use->remove();
     }
 }
@@ -122,23 +178,29 @@ void User::removeUse(Use * use)
 ///
 void User::clearOperands()
 {
-    for (int32_t pos = 0; pos < (int32_t) operands.size();) {
-
-        // 必须先暂存后释放，不能直接delete uses[pos]
-        // 这是因为use->remove会删除operands的元素，使得operands[pos]的对象不再是原来的对象
-
-        Use * use = operands[pos];
-        use->remove();
-        delete use;
+    for (int32_t pos = 0; pos < operandsNum; ++pos) {
+        Use & use = operands[pos];
+        if (use.usee) {
+            use.usee->removeUse(&use);
+            use.usee = nullptr;
+        }
     }
+
+    operandsNum = 0;
 }
+
 ///
-/// @brief Get the Operands object
-/// @return std::vector<Use *>&
+/// @brief 获取指定位置的操作数的边
+/// @param pos 位置
+/// @return Use* 边，位置无效时为空指针
 ///
-std::vector<Use *> & User::getOperands()
+Use * User::getOperandUse(int32_t pos)
 {
-    return operands;
+    if ((pos >= 0) && (pos < operandsNum)) {
+        return &operands[pos];
+    }
+
+    return nullptr;
 }
 
 ///
@@ -148,8 +210,8 @@ std::vector<Use *> & User::getOperands()
 std::vector<Value *> User::getOperandsValue()
 {
     std::vector<Value *> operandsVec;
-    for (auto & use: operands) {
-        operandsVec.emplace_back(use->getUsee());
+    for (int32_t pos = 0; pos < operandsNum; ++pos) {
+        operandsVec.emplace_back(operands[pos].getUsee());
     }
     return operandsVec;
 }
@@ -160,7 +222,7 @@ std::vector<Value *> User::getOperandsValue()
 ///
 int32_t User::getOperandsNum()
 {
-    return (int32_t) operands.size();
+    return operandsNum;
 }
 
 ///
@@ -170,8 +232,8 @@ int32_t User::getOperandsNum()
 ///
 Value * User::getOperand(int32_t pos)
 {
-    if (pos < (int32_t) operands.size()) {
-        return operands[pos]->getUsee();
+    if (pos < operandsNum) {
+        return operands[pos].getUsee();
     }
 
     return nullptr;
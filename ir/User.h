@@ -29,12 +29,30 @@
 /// User可以是指令(Instruction)、常量表达式(ConstantExpr)、全局变量(GlobalVariable)等。
 /// User持有对Value的引用，并且可以有多个Value作为其操作数(Operands)
 ///
+/// 操作数数组中直接存放Use对象。派生类可提供内嵌的定长数组，操作数不超过其长度时不需要另外分配内存，
+/// 超过时改为在堆上分配，数组扩大时边会移动到新的数组中
+///
 class User : public Value {
 
     ///
-    /// @brief 操作数列表，指向当前Value的所有操作数
+    /// @brief 操作数数组，每个元素是一条指向操作数的边
+    ///
+    Use * operands = nullptr;
+
+    ///
+    /// @brief 操作数的个数
+    ///
+    int32_t operandsNum = 0;
+
+    ///
+    /// @brief 操作数数组的容量
+    ///
+    int32_t operandsCapacity = 0;
+
+    ///
+    /// @brief 操作数数组是否在堆上分配，否则是派生类提供的内嵌数组
     ///
-    std::vector<Use *> operands;
+    bool operandsOnHeap = false;
 
 public:
     ///
@@ -45,10 +63,16 @@ public:
     User(Type * _type);
 
     ///
-    /// @brief Get the Operands object
-    /// @return std::vector<Use *>&
+    /// @brief 析构函数，清除所有的操作数
     ///
-    std::vector<Use *> & getOperands();
+    ~User() override;
+
+    ///
+    /// @brief 获取指定位置的操作数的边
+    /// @param pos 位置
+    /// @return Use* 边，位置无效时为空指针
+    ///
+    Use * getOperandUse(int32_t pos);
 
     ///
     /// @brief 取得操作数
@@ -83,6 +107,12 @@ public:
     ///
     void addOperand(Value * val);
 
+    ///
+    /// @brief 预留操作数数组的空间，避免逐个增加操作数时多次扩大数组
+    /// @param capacity 容量
+    ///
+    void reserveOperands(int32_t capacity);
+
     ///
     /// @brief 清除指定的操作数
     /// @param pos 操作数的索引
@@ -111,4 +141,12 @@ public:
     /// @brief 清除所有的操作数
     ///
     void clearOperands();
+
+protected:
+    ///
+    /// @brief 设置派生类内嵌的操作数数组，只能在增加操作数之前调用
+    /// @param storage 数组
+    /// @param capacity 数组的长度
+    ///
+    void setInlineOperands(Use * storage, int32_t capacity);
 };
\ No newline at end of file
@@ -15,7 +15,7 @@
 /// </table>
 ///
 
-#include <algorithm>
+#include <utility>
 
 #include "Value.h"
 #include "Use.h"
@@ -30,7 +30,14 @@ Value::Value(Type * _type) : type(_type)
 /// @brief 析构函数
 Value::~Value()
 {
-    // 如有资源清理，请这里追加代码
+    // 还在使用该Value的边置空，避免User释放时访问已释放的Value
+    while (firstUse) {
+        Use * use = firstUse;
+        firstUse = use->nextUse;
+        use->usee = nullptr;
+        use->prevUse = nullptr;
+        use->nextUse = nullptr;
+    }
 }
 
 /// @brief 获取名字
@@ -53,7 +60,16 @@ void Value::setName(std::string _name)
 /// @return 变量名
 std::string Value::getIRName() const
 {
-    return IRName;
+    if (IRName) {
+        return *IRName;
+    }
+
+    // 重命名时只记录了编号，需要输出时才生成名字
+    if (irPrefix) {
+        return irPrefix + std::to_string(irSlot);
+    }
+
+    return "";
 }
 
 ///
@@ -62,7 +78,23 @@ std::string Value::getIRName() const
 ///
 void Value::setIRName(std::string _name)
 {
-    this->IRName = _name;
+    if (_name.empty()) {
+        this->IRName.reset();
+    } else {
+        this->IRName = std::make_unique<std::string>(std::move(_name));
+    }
+}
+
+///
+/// @brief 设置IR名字的前缀和编号，只记录编号，获取IR名字时才生成字符串
+/// @param prefix 前缀，必须是常量字符串
+/// @param slot 编号
+///
+void Value::setIRSlot(const char * prefix, int32_t slot)
+{
+    this->IRName.reset();
+    this->irPrefix = prefix;
+    this->irSlot = slot;
 }
 
 /// @brief 获取类型
@@ -78,7 +110,13 @@ Type * Value::getType()
 ///
 void Value::addUse(Use * use)
 {
-    uses.push_back(use);
+    // 插入到链表头部
+    use->prevUse = nullptr;
+    use->nextUse = firstUse;
+    if (firstUse) {
+        firstUse->prevUse = use;
+    }
+    firstUse = use;
 }
 
 ///
@@ -87,9 +125,37 @@ void Value::addUse(Use * use)
 ///
 void Value::removeUse(Use * use)
 {
-    auto pIter = std::find(uses.begin(), uses.end(), use);
-    if (pIter != uses.end()) {
-        uses.erase(pIter);
+    // 不在链表中的边忽略
+    if ((use->prevUse == nullptr) && (firstUse != use)) {
+        return;
+    }
+
+    if (use->prevUse) {
+        use->prevUse->nextUse = use->nextUse;
+    } else {
+        firstUse = use->nextUse;
+    }
+
+    if (use->nextUse) {
+        use->nextUse->prevUse = use->prevUse;
+    }
+
+    use->prevUse = nullptr;
+    use->nextUse = nullptr;
+}
+
+///
+/// @brief 所有使用该Value的地方改为使用新的Value
+/// @param newVal 新的Value
+///
+void Value::replaceAllUseWith(Value * newVal)
+{
+    if (newVal == this) {
+        return;
+    }
+
+    while (firstUse) {
+        firstUse->setUsee(newVal);
     }
 }
 
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 
 #include "Use.h"
@@ -31,22 +32,35 @@
 ///
 class Value {
 
+    friend class Use;
+
 protected:
     /// @brief 变量名，函数名等原始的名字，可能为空串
     std::string name;
 
     ///
-    /// @brief IR名字，用于文本IR的输出
+    /// @brief 显式设置的IR名字，用于文本IR的输出。多数Value没有，单独存放以减小Value的大小；
+    /// 为空时由irPrefix和irSlot在输出时生成
+    ///
+    std::unique_ptr<std::string> IRName;
+
+    ///
+    /// @brief 重命名时分配的IR名字前缀，为空表示没有分配编号
+    ///
+    const char * irPrefix = nullptr;
+
+    ///
+    /// @brief 重命名时分配的IR名字编号
     ///
-    std::string IRName;
+    int32_t irSlot = -1;
 
     /// @brief 类型
     Type * type;
 
     ///
-    /// @brief define-use链，这个定值被使用的所有边，即所有的User
+    /// @brief define-use链的第一条边，这个定值被使用的所有边通过Use自身链接起来
     ///
-    std::vector<Use *> uses;
+    Use * firstUse = nullptr;
 
 public:
     /// @brief 构造函数
@@ -76,6 +90,13 @@ public:
     ///
     void setIRName(std::string _name);
 
+    ///
+    /// @brief 设置IR名字的前缀和编号，只记录编号，获取IR名字时才生成字符串
+    /// @param prefix 前缀，必须是常量字符串
+    /// @param slot 编号
+    ///
+    void setIRSlot(const char * prefix, int32_t slot);
+
     /// @brief 获取类型
     /// @return 变量名
     virtual Type * getType();
@@ -92,6 +113,30 @@ public:
     ///
     void removeUse(Use * use);
 
+    ///
+    /// @brief 获取define-use链的第一条边，通过Use::getNextUse遍历使用该Value的所有边
+    /// @return Use* 第一条边，没有使用时为空指针
+    ///
+    [[nodiscard]] Use * getFirstUse() const
+    {
+        return firstUse;
+    }
+
+    ///
+    /// @brief 是否被使用
+    /// @return true 有使用
+    ///
+    [[nodiscard]] bool hasUses() const
+    {
+        return firstUse != nullptr;
+    }
+
+    ///
+    /// @brief 所有使用该Value的地方改为使用新的Value
+    /// @param newVal 新的Value
+    ///
+    void replaceAllUseWith(Value * newVal);
+
     ///
     /// @brief 取得变量所在的作用域层级
     /// @return int32_t 层级
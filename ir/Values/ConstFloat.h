@@ -0,0 +1,122 @@
+///
+/// @file ConstFloat.h
+/// @brief float类型的常量
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "Constant.h"
+#include "FloatType.h"
+
+///
+/// @brief 单精度浮点常量类。IR文本中有限值为带小数点或指数的十进制形式，9位有效数字保证可精确还原；
+/// 无穷与NaN为0x开头的8位十六进制位模式
+///
+class ConstFloat : public Constant {
+
+public:
+    ///
+    /// @brief 指定位模式的常量，位模式相同的常量才是同一个常量，可区分0.0与-0.0
+    /// @param _bits IEEE 754单精度位模式
+    ///
+    explicit ConstFloat(int32_t _bits) : Constant(FloatType::getTypeFloat()), bits(_bits)
+    {
+        name = toIRString(getVal());
+    }
+
+    /// @brief 获取名字
+    /// @return 常量的文本形式
+    [[nodiscard]] std::string getIRName() const override
+    {
+        return name;
+    }
+
+    ///
+    /// @brief 获取值
+    /// @return float
+    ///
+    float getVal() const
+    {
+        return bitsToFloat(bits);
+    }
+
+    ///
+    /// @brief 获取位模式，用于按整数加载到寄存器或放到数据段中
+    /// @return int32_t
+    ///
+    int32_t getBits() const
+    {
+        return bits;
+    }
+
+    ///
+    /// @brief float的位模式
+    /// @param val 值
+    /// @return 位模式
+    ///
+    static int32_t floatToBits(float val)
+    {
+        int32_t result;
+        memcpy(&result, &val, sizeof(result));
+        return result;
+    }
+
+    ///
+    /// @brief 位模式对应的float
+    /// @param bits 位模式
+    /// @return 值
+    ///
+    static float bitsToFloat(int32_t bits)
+    {
+        float result;
+        memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+
+    ///
+    /// @brief float值的IR文本形式
+    /// @param val 值
+    /// @return 文本
+    ///
+    static std::string toIRString(float val)
+    {
+        char buf[32];
+
+        if (!std::isfinite(val)) {
+            snprintf(buf, sizeof(buf), "0x%08X", (uint32_t) floatToBits(val));
+            return buf;
+        }
+
+        snprintf(buf, sizeof(buf), "%.9g", (double) val);
+        std::string str = buf;
+
+        // 与整数常量区分，必须有小数点或指数
+        if (str.find_first_of(".e") == std::string::npos) {
+            str += ".0";
+        }
+
+        return str;
+    }
+
+private:
+    ///
+    /// @brief 位模式
+    ///
+    int32_t bits;
+};
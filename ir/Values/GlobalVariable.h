@@ -16,6 +16,11 @@
 ///
 #pragma once
 
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "ConstFloat.h"
 #include "GlobalValue.h"
 #include "IRConstant.h"
 #include "../Types/PointerType.h" // 添加此行以引入 ArrayType 类的定义-lxg
@@ -57,6 +62,57 @@ public:
         return this->inBSSSection;
     }
 
+    ///
+    /// @brief 设置初值，数组按行优先展开，末尾为0的元素不必给出
+    /// @param values 各元素的初值，float为IEEE 754位模式
+    ///
+    void setInitValues(std::vector<int32_t> values)
+    {
+        while (!values.empty() && (values.back() == 0)) {
+            values.pop_back();
+        }
+
+        this->initValues = std::move(values);
+        this->inBSSSection = this->initValues.empty();
+    }
+
+    ///
+    /// @brief 获取初值，末尾为0的元素已去掉
+    /// @return 各元素的初值
+    ///
+    [[nodiscard]] const std::vector<int32_t> & getInitValues() const
+    {
+        return this->initValues;
+    }
+
+    ///
+    /// @brief 获取某个元素的初值
+    /// @param index 按行优先展开后的元素下标
+    /// @return 初值
+    ///
+    [[nodiscard]] int32_t getInitValue(size_t index) const
+    {
+        return index < this->initValues.size() ? this->initValues[index] : 0;
+    }
+
+    ///
+    /// @brief 是否只读，即程序中没有对其写入，可放在.rodata段中
+    /// @return true：只读，false：可写
+    ///
+    [[nodiscard]] bool isReadOnly() const
+    {
+        return this->readOnly;
+    }
+
+    ///
+    /// @brief 设置是否只读
+    /// @param _readOnly true：只读，false：可写
+    ///
+    void setReadOnly(bool _readOnly)
+    {
+        this->readOnly = _readOnly;
+    }
+
     ///
     /// @brief 取得变量所在的作用域层级
     /// @return int32_t 层级
@@ -119,6 +175,15 @@ public:
 					str += "[" + std::to_string(dim) + "]";
 				}
 				
+				// 添加初值：= {1, 2, 3}
+				if (!initValues.empty()) {
+					str += " = {";
+					for (size_t k = 0; k < initValues.size(); ++k) {
+						str += (k ? ", " : "") + initValueString(elemType, k);
+					}
+					str += "}";
+				}
+
 				// 添加注释：;全局数组a
 				std::string realName = getName();
 				if (!realName.empty()) {
@@ -129,12 +194,30 @@ public:
 				str = "declare " + getType()->toString() + " " + getIRName();
 			}
 		} else {
-			// 非数组类型使用原有格式
+			// 非数组类型使用原有格式，有初值时为declare i32 @a = 5
 			str = "declare " + getType()->toString() + " " + getIRName();
+			if (!initValues.empty()) {
+				str += " = " + initValueString(getType(), 0);
+			}
 		}
 	}
 
 private:
+    ///
+    /// @brief 初值的文本形式，float的初值保存的是位模式
+    /// @param elemType 元素类型
+    /// @param index 下标
+    /// @return 文本
+    ///
+    std::string initValueString(Type * elemType, size_t index)
+    {
+        if (elemType->isFloatType()) {
+            return ConstFloat::toIRString(ConstFloat::bitsToFloat(initValues[index]));
+        }
+
+        return std::to_string(initValues[index]);
+    }
+
     ///
     /// @brief 变量加载到寄存器中时对应的寄存器编号
     ///
@@ -144,4 +227,14 @@ private:
     /// @brief 默认全局变量在BSS段，没有初始化，或者即使初始化过，但都值都为0
     ///
     bool inBSSSection = true;
+
+    ///
+    /// @brief 初值，数组按行优先展开，末尾为0的元素已去掉
+    ///
+    std::vector<int32_t> initValues;
+
+    ///
+    /// @brief 是否只读
+    ///
+    bool readOnly = false;
 };
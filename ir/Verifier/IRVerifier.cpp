@@ -0,0 +1,590 @@
+///
+/// @file IRVerifier.cpp
+/// @brief 线性IR(DragonIR)的一致性校验
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <unordered_map>
+
+#include "IRVerifier.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "MoveInstruction.h"
+
+/// @brief 最多记录的错误个数，后续的错误只计数
+#define VERIFIER_MAX_REPORTS 10
+
+/// @brief 构造函数
+/// @param _module 要校验的模块
+IRVerifier::IRVerifier(Module * _module) : module(_module)
+{}
+
+/// @brief 记录错误
+/// @param func 出错的函数
+/// @param index 出错指令的下标，-1表示与具体指令无关
+/// @param message 错误信息
+void IRVerifier::report(Function * func, int32_t index, const std::string & message)
+{
+    if (errorCount++ >= VERIFIER_MAX_REPORTS) {
+        return;
+    }
+
+    if (!lastError.empty()) {
+        lastError += "\n";
+    }
+
+    lastError += "@" + func->getName();
+
+    auto & insts = func->getInterCode().getInsts();
+    if ((index >= 0) && (index < (int32_t) insts.size()) && insts[index]) {
+
+        std::string str;
+        (void) valueName(func, nullptr);
+        insts[index]->toString(str);
+        lastError += " 第" + std::to_string(index) + "条指令(" + str + ")";
+    }
+
+    lastError += "：" + message;
+}
+
+/// @brief 获取出错信息中Value的名字
+/// @param func Value所在的函数
+/// @param val Value，可为空
+/// @return 名字
+std::string IRVerifier::valueName(Function * func, Value * val)
+{
+    // 校验在重命名之前进行，临时变量等需要命名后才能显示
+    if (renamed.insert(func).second) {
+        func->renameIR();
+    }
+
+    return val ? val->getIRName() : std::string();
+}
+
+/// @brief 快速校验一个函数
+/// @param func 函数
+void IRVerifier::verifyStructure(Function * func)
+{
+    auto & insts = func->getInterCode().getInsts();
+    if (insts.empty()) {
+        report(func, -1, "函数没有指令");
+        return;
+    }
+
+    labels.clear();
+    for (int32_t k = 0; k < (int32_t) insts.size(); ++k) {
+        Instruction * inst = insts[k];
+        if (inst && (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) && !labels.insert(inst).second) {
+            report(func, k, "Label重复出现");
+        }
+    }
+
+    int32_t exitCount = 0;
+    for (int32_t k = 0; k < (int32_t) insts.size(); ++k) {
+
+        Instruction * inst = insts[k];
+        if (!inst) {
+            report(func, k, "指令为空");
+            continue;
+        }
+
+        if (inst->getFunction() != func) {
+            report(func, k, "指令不属于本函数");
+        }
+
+        IRInstOperator op = inst->getOp();
+        if ((k == 0) && (op != IRInstOperator::IRINST_OP_ENTRY)) {
+            report(func, k, "函数的第一条指令不是entry");
+        } else if ((k != 0) && (op == IRInstOperator::IRINST_OP_ENTRY)) {
+            report(func, k, "entry只能是函数的第一条指令");
+        }
+
+        if (op == IRInstOperator::IRINST_OP_EXIT) {
+            exitCount++;
+        }
+
+        if (op == IRInstOperator::IRINST_OP_GOTO) {
+            auto * gotoInst = static_cast<GotoInstruction *>(inst);
+            if (!labels.count(gotoInst->getTarget())) {
+                report(func, k, "跳转目标不是本函数内的Label");
+            }
+
+            bool conditional = gotoInst->getFalseTarget() != nullptr;
+            if (conditional && !labels.count(gotoInst->getFalseTarget())) {
+                report(func, k, "假出口不是本函数内的Label");
+            }
+
+            if (inst->getOperandsNum() != (conditional ? 1 : 0)) {
+                report(func, k, "跳转指令的操作数个数错误");
+            }
+        }
+
+        for (int32_t pos = 0; pos < inst->getOperandsNum(); ++pos) {
+
+            Use * use = inst->getOperandUse(pos);
+            if (!use->getUsee()) {
+                report(func, k, "操作数为空");
+                continue;
+            }
+
+            if (use->getUser() != inst) {
+                report(func, k, "操作数的User不是本指令");
+            }
+
+            // 临时变量只能是本函数内有值的指令
+            auto * def = dynamic_cast<Instruction *>(use->getUsee());
+            if (def) {
+                if (!def->hasResultValue()) {
+                    report(func, k, "操作数是没有值的指令");
+                } else if (def->getFunction() != func) {
+                    report(func, k, "操作数是其它函数的临时变量");
+                }
+            }
+        }
+    }
+
+    if (exitCount != 1) {
+        report(func, -1, "exit指令有" + std::to_string(exitCount) + "条");
+    }
+}
+
+/// @brief 校验模块内所有指令的use链
+void IRVerifier::verifyUses()
+{
+    // 指令数目较多，用排序后的数组做查找，比哈希表快
+    std::vector<Use *> operandUses;
+    std::vector<Value *> usees;
+    for (auto func: module->getFunctionList()) {
+        for (auto inst: func->getInterCode().getInsts()) {
+            for (int32_t pos = 0; pos < inst->getOperandsNum(); ++pos) {
+                Use * use = inst->getOperandUse(pos);
+                operandUses.push_back(use);
+                usees.push_back(use->getUsee());
+            }
+        }
+    }
+
+    std::sort(operandUses.begin(), operandUses.end());
+    std::sort(usees.begin(), usees.end());
+    usees.erase(std::unique(usees.begin(), usees.end()), usees.end());
+
+    // 所有被使用的Value的use链中的边
+    std::vector<Use *> listed;
+
+    // Value的use链中的边必须指向该Value，不是IR中指令的操作数时，其User必须已不在IR中或者不是指令
+    for (auto usee: usees) {
+        for (Use * edge = usee->getFirstUse(); edge; edge = edge->getNextUse()) {
+
+            listed.push_back(edge);
+
+            if (std::binary_search(operandUses.begin(), operandUses.end(), edge)) {
+                if (edge->getUsee() != usee) {
+                    Function * func = static_cast<Instruction *>(edge->getUser())->getFunction();
+                    report(func, -1, valueName(func, usee) + "的use链中的边指向其它Value");
+                }
+                continue;
+            }
+
+            // 全局变量等其它User不检查
+            auto * user = dynamic_cast<Instruction *>(edge->getUser());
+            if (!user) {
+                continue;
+            }
+
+            if (!std::binary_search(moduleInsts.begin(), moduleInsts.end(), user)) {
+                report(user->getFunction(),
+                       -1,
+                       "已不在IR中的指令仍然在" + valueName(user->getFunction(), usee) + "的use链中，删除指令时需清除其操作数");
+            } else {
+                report(user->getFunction(), -1, valueName(user->getFunction(), usee) + "的use链中的边不在User的操作数中");
+            }
+        }
+    }
+
+    // 指令的操作数必须在被使用Value的use链中
+    std::sort(listed.begin(), listed.end());
+    for (auto func: module->getFunctionList()) {
+        auto & insts = func->getInterCode().getInsts();
+        for (int32_t k = 0; k < (int32_t) insts.size(); ++k) {
+            for (int32_t pos = 0; pos < insts[k]->getOperandsNum(); ++pos) {
+                Use * use = insts[k]->getOperandUse(pos);
+                if (!std::binary_search(listed.begin(), listed.end(), use)) {
+                    report(func, k, "操作数不在" + valueName(func, use->getUsee()) + "的use链中");
+                }
+            }
+        }
+    }
+}
+
+/// @brief 校验一个函数内临时变量的定义支配其使用
+/// @param func 函数
+void IRVerifier::verifyDominance(Function * func)
+{
+    auto & insts = func->getInterCode().getInsts();
+    int32_t instCount = (int32_t) insts.size();
+
+    // 划分基本块，块从函数入口或Label指令开始
+    std::vector<int32_t> blockOf(instCount);
+    std::vector<int32_t> blockBegin;
+    std::unordered_map<Instruction *, int32_t> labelBlock;
+    for (int32_t k = 0; k < instCount; ++k) {
+        if ((k == 0) || (insts[k]->getOp() == IRInstOperator::IRINST_OP_LABEL)) {
+            blockBegin.push_back(k);
+            labelBlock[insts[k]] = (int32_t) blockBegin.size() - 1;
+        }
+        blockOf[k] = (int32_t) blockBegin.size() - 1;
+    }
+
+    int32_t blockCount = (int32_t) blockBegin.size();
+    blockBegin.push_back(instCount);
+
+    // 块内第一条跳转或出口指令决定后继，没有时顺序执行到下一个块
+    std::vector<std::vector<int32_t>> succs(blockCount);
+    for (int32_t b = 0; b < blockCount; ++b) {
+        bool fallThrough = true;
+        for (int32_t k = blockBegin[b]; k < blockBegin[b + 1]; ++k) {
+            IRInstOperator op = insts[k]->getOp();
+            if (op == IRInstOperator::IRINST_OP_EXIT) {
+                fallThrough = false;
+                break;
+            }
+            if (op == IRInstOperator::IRINST_OP_GOTO) {
+                auto * gotoInst = static_cast<GotoInstruction *>(insts[k]);
+                succs[b].push_back(labelBlock[gotoInst->getTarget()]);
+                if (gotoInst->getFalseTarget()) {
+                    succs[b].push_back(labelBlock[gotoInst->getFalseTarget()]);
+                }
+                fallThrough = false;
+                break;
+            }
+        }
+        if (fallThrough && (b + 1 < blockCount)) {
+            succs[b].push_back(b + 1);
+        }
+    }
+
+    // 深度优先的后序，入口块的后序序号最大
+    std::vector<int32_t> postOrder(blockCount, -1);
+    std::vector<int32_t> order;
+    std::vector<std::pair<int32_t, size_t>> stack = {{0, 0}};
+    std::vector<bool> visited(blockCount, false);
+    visited[0] = true;
+    while (!stack.empty()) {
+        auto & top = stack.back();
+        if (top.second < succs[top.first].size()) {
+            int32_t succ = succs[top.first][top.second++];
+            if (!visited[succ]) {
+                visited[succ] = true;
+                stack.emplace_back(succ, 0);
+            }
+        } else {
+            postOrder[top.first] = (int32_t) order.size();
+            order.push_back(top.first);
+            stack.pop_back();
+        }
+    }
+
+    std::vector<std::vector<int32_t>> preds(blockCount);
+    for (int32_t b = 0; b < blockCount; ++b) {
+        if (visited[b]) {
+            for (auto succ: succs[b]) {
+                preds[succ].push_back(b);
+            }
+        }
+    }
+
+    // Cooper-Harvey-Kennedy迭代计算直接支配者
+    std::vector<int32_t> idom(blockCount, -1);
+    idom[0] = 0;
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (auto pIter = order.rbegin(); pIter != order.rend(); ++pIter) {
+            int32_t b = *pIter;
+            if (b == 0) {
+                continue;
+            }
+
+            int32_t newIdom = -1;
+            for (auto pred: preds[b]) {
+                if (idom[pred] == -1) {
+                    continue;
+                }
+                if (newIdom == -1) {
+                    newIdom = pred;
+                    continue;
+                }
+                int32_t x = pred;
+                int32_t y = newIdom;
+                while (x != y) {
+                    while (postOrder[x] < postOrder[y]) {
+                        x = idom[x];
+                    }
+                    while (postOrder[y] < postOrder[x]) {
+                        y = idom[y];
+                    }
+                }
+                newIdom = x;
+            }
+
+            if (idom[b] != newIdom) {
+                idom[b] = newIdom;
+                changed = true;
+            }
+        }
+    }
+
+    std::unordered_map<Instruction *, int32_t> defIndex;
+    for (int32_t k = 0; k < instCount; ++k) {
+        if (insts[k]->hasResultValue()) {
+            defIndex[insts[k]] = k;
+        }
+    }
+
+    for (int32_t k = 0; k < instCount; ++k) {
+
+        int32_t useBlock = blockOf[k];
+        if (!visited[useBlock]) {
+            // 不可达的指令不检查
+            continue;
+        }
+
+        for (int32_t pos = 0; pos < insts[k]->getOperandsNum(); ++pos) {
+
+            auto * def = dynamic_cast<Instruction *>(insts[k]->getOperand(pos));
+            if ((!def) || (def->getFunction() != func)) {
+                continue;
+            }
+
+            auto pIter = defIndex.find(def);
+            if (pIter == defIndex.end()) {
+                report(func, k, "使用的临时变量不在函数的指令中");
+                continue;
+            }
+
+            int32_t defBlock = blockOf[pIter->second];
+            bool dominated;
+            if (defBlock == useBlock) {
+                dominated = pIter->second < k;
+            } else {
+                int32_t b = useBlock;
+                while ((b != defBlock) && (b != 0)) {
+                    b = idom[b];
+                }
+                dominated = (b == defBlock);
+            }
+
+            if (!dominated) {
+                report(func, k, "临时变量" + valueName(func, def) + "的定义不支配该使用");
+            }
+        }
+    }
+}
+
+/// @brief 校验一条指令的类型
+/// @param func 函数
+/// @param index 指令的下标
+void IRVerifier::verifyTypes(Function * func, int32_t index)
+{
+    Instruction * inst = func->getInterCode().getInsts()[index];
+
+    int32_t num = inst->getOperandsNum();
+    auto isInt = [](Value * val) { return val->getType()->isIntegerType(); };
+    auto isAddr = [](Value * val) { return val->getType()->isPointerType() || val->getType()->isArrayType(); };
+    auto isFloat = [](Value * val) { return val->getType()->isFloatType(); };
+
+    switch (inst->getOp()) {
+        case IRInstOperator::IRINST_OP_ADD_I:
+        case IRInstOperator::IRINST_OP_SUB_I:
+            // 结果为指针时是地址计算，否则为整数运算
+            if (num != 2) {
+                report(func, index, "运算指令的操作数个数错误");
+            } else if (isInt(inst) && !(isInt(inst->getOperand(0)) && isInt(inst->getOperand(1)))) {
+                report(func, index, "整数运算的操作数不是整数");
+            } else if (isAddr(inst) && !(isAddr(inst->getOperand(0)) || isAddr(inst->getOperand(1)))) {
+                report(func, index, "地址计算的操作数中没有地址");
+            } else if (!isInt(inst) && !isAddr(inst)) {
+                report(func, index, "运算结果的类型错误");
+            }
+            break;
+
+        case IRInstOperator::IRINST_OP_MUL_I:
+        case IRInstOperator::IRINST_OP_DIV_I:
+        case IRInstOperator::IRINST_OP_MOD_I:
+            if ((num != 2) || !isInt(inst) || !isInt(inst->getOperand(0)) || !isInt(inst->getOperand(1))) {
+                report(func, index, "整数运算的操作数或结果不是整数");
+            }
+            break;
+
+        case IRInstOperator::IRINST_OP_NEG_I:
+            if ((num != 1) || !isInt(inst) || !isInt(inst->getOperand(0))) {
+                report(func, index, "求负运算的操作数或结果不是整数");
+            }
+            break;
+
+        case IRInstOperator::IRINST_OP_LT_I:
+        case IRInstOperator::IRINST_OP_GT_I:
+        case IRInstOperator::IRINST_OP_LE_I:
+        case IRInstOperator::IRINST_OP_GE_I:
+        case IRInstOperator::IRINST_OP_EQ_I:
+        case IRInstOperator::IRINST_OP_NE_I:
+            if ((num != 2) || !inst->getType()->isInt1Byte()) {
+                report(func, index, "比较运算的操作数个数错误或者结果不是i1");
+            } else if (inst->getOperand(0)->getType()->isVoidType() || inst->getOperand(1)->getType()->isVoidType()) {
+                report(func, index, "比较运算的操作数没有值");
+            }
+            break;
+
+        case IRInstOperator::IRINST_OP_ADD_F:
+        case IRInstOperator::IRINST_OP_SUB_F:
+        case IRInstOperator::IRINST_OP_MUL_F:
+        case IRInstOperator::IRINST_OP_DIV_F:
+            if ((num != 2) || !isFloat(inst) || !isFloat(inst->getOperand(0)) || !isFloat(inst->getOperand(1))) {
+                report(func, index, "浮点运算的操作数或结果不是float");
+            }
+            break;
+
+        case IRInstOperator::IRINST_OP_NEG_F:
+            if ((num != 1) || !isFloat(inst) || !isFloat(inst->getOperand(0))) {
+                report(func, index, "浮点求负运算的操作数或结果不是float");
+            }
+            break;
+
+        case IRInstOperator::IRINST_OP_LT_F:
+        case IRInstOperator::IRINST_OP_GT_F:
+        case IRInstOperator::IRINST_OP_LE_F:
+        case IRInstOperator::IRINST_OP_GE_F:
+        case IRInstOperator::IRINST_OP_EQ_F:
+        case IRInstOperator::IRINST_OP_NE_F:
+            if ((num != 2) || !inst->getType()->isInt1Byte()) {
+                report(func, index, "浮点比较运算的操作数个数错误或者结果不是i1");
+            } else if (!isFloat(inst->getOperand(0)) || !isFloat(inst->getOperand(1))) {
+                report(func, index, "浮点比较运算的操作数不是float");
+            }
+            break;
+
+        case IRInstOperator::IRINST_OP_ITOF:
+            if ((num != 1) || !isFloat(inst) || !isInt(inst->getOperand(0))) {
+                report(func, index, "sitofp的操作数不是整数或者结果不是float");
+            }
+            break;
+
+        case IRInstOperator::IRINST_OP_FTOI:
+            if ((num != 1) || !isInt(inst) || !isFloat(inst->getOperand(0))) {
+                report(func, index, "fptosi的操作数不是float或者结果不是整数");
+            }
+            break;
+
+        case IRInstOperator::IRINST_OP_GOTO:
+            if ((num == 1) && !isInt(inst->getOperand(0))) {
+                report(func, index, "条件跳转的条件不是整数");
+            }
+            break;
+
+        case IRInstOperator::IRINST_OP_ASSIGN: {
+            auto * moveInst = static_cast<MoveInstruction *>(inst);
+            if (num != 2) {
+                report(func, index, "赋值指令的操作数个数错误");
+            } else if (moveInst->getIsPointerStore() && !isAddr(inst->getOperand(0))) {
+                report(func, index, "指针存储的目标不是指针");
+            } else if (moveInst->getIsPointerLoad() && !isAddr(inst->getOperand(1))) {
+                report(func, index, "指针读取的源不是指针");
+            } else if (!moveInst->getIsPointerStore() && inst->getOperand(0)->getType()->isArrayType()) {
+                report(func, index, "数组变量不能作为赋值的目标");
+            } else if (!moveInst->getIsPointerStore() && !moveInst->getIsPointerLoad() &&
+                       (isAddr(inst->getOperand(0)) != isAddr(inst->getOperand(1)))) {
+                report(func, index, "指针与非指针之间的赋值");
+            } else if (!moveInst->getIsPointerStore() && !moveInst->getIsPointerLoad() && isInt(inst->getOperand(0)) &&
+                       !isInt(inst->getOperand(1))) {
+                report(func, index, "整型变量的赋值源不是整数");
+            } else if (!moveInst->getIsPointerStore() && !moveInst->getIsPointerLoad() &&
+                       (isFloat(inst->getOperand(0)) != isFloat(inst->getOperand(1)))) {
+                report(func, index, "float变量与整数之间的赋值没有进行类型转换");
+            }
+            break;
+        }
+
+        case IRInstOperator::IRINST_OP_FUNC_CALL: {
+            Function * callee = static_cast<FuncCallInstruction *>(inst)->calledFunction;
+            if (!callee) {
+                report(func, index, "函数调用没有被调用函数");
+                break;
+            }
+
+            // putf为可变参数
+            size_t params = callee->getParams().size();
+            bool variadic = callee->isBuiltin() && (callee->getName() == "putf");
+            if ((variadic && ((size_t) num < params)) || (!variadic && ((size_t) num != params))) {
+                report(func, index, "实参个数与" + callee->getName() + "的形参个数不一致");
+            }
+
+            if (inst->getType()->isVoidType() != callee->getReturnType()->isVoidType()) {
+                report(func, index, "函数调用的结果类型与" + callee->getName() + "的返回类型不一致");
+            }
+            break;
+        }
+
+        case IRInstOperator::IRINST_OP_EXIT:
+            if ((num != 0) == func->getReturnType()->isVoidType()) {
+                report(func, index, "exit指令的返回值与函数的返回类型不一致");
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+/// @brief 校验模块内的所有函数
+/// @param full true：完整校验，false：快速校验
+/// @return true：通过，false：发现错误，详细信息见getLastError
+bool IRVerifier::run(bool full)
+{
+    errorCount = 0;
+    lastError.clear();
+
+    for (auto func: module->getFunctionList()) {
+        if (!func->isBuiltin()) {
+            verifyStructure(func);
+        }
+    }
+
+    // 结构错误时后续的校验没有意义
+    if (full && (errorCount == 0)) {
+
+        moduleInsts.clear();
+        for (auto func: module->getFunctionList()) {
+            auto & insts = func->getInterCode().getInsts();
+            moduleInsts.insert(moduleInsts.end(), insts.begin(), insts.end());
+        }
+        std::sort(moduleInsts.begin(), moduleInsts.end());
+
+        verifyUses();
+
+        for (auto func: module->getFunctionList()) {
+            if (func->isBuiltin()) {
+                continue;
+            }
+
+            verifyDominance(func);
+
+            for (int32_t k = 0; k < (int32_t) func->getInterCode().getInsts().size(); ++k) {
+                verifyTypes(func, k);
+            }
+        }
+    }
+
+    if (errorCount > VERIFIER_MAX_REPORTS) {
+        lastError += "\n...共" + std::to_string(errorCount) + "个错误";
+    }
+
+    return errorCount == 0;
+}
@@ -0,0 +1,102 @@
+///
+/// @file IRVerifier.h
+/// @brief 线性IR(DragonIR)的一致性校验
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "Module.h"
+
+///
+/// @brief IR校验器，检查IR变换可能破坏的不变式。
+///
+/// 快速校验只做一遍线性扫描：函数以entry开始且只有一条exit，Label在本函数内且只出现一次，
+/// 跳转目标是本函数内的Label，操作数有效，临时变量属于本函数。
+/// 完整校验另外检查Value的uses与User的operands是否一致，
+/// 临时变量的定义是否支配其使用，以及各指令的操作数与结果的类型
+///
+class IRVerifier {
+
+public:
+    /// @brief 构造函数
+    /// @param _module 要校验的模块
+    explicit IRVerifier(Module * _module);
+
+    /// @brief 析构函数
+    ~IRVerifier() = default;
+
+    /// @brief 校验模块内的所有函数
+    /// @param full true：完整校验，false：快速校验
+    /// @return true：通过，false：发现错误，详细信息见getLastError
+    bool run(bool full = false);
+
+    void setLastError(const std::string & error)
+    {
+        lastError = error;
+    }
+    std::string getLastError() const
+    {
+        return lastError;
+    }
+
+protected:
+    /// @brief 快速校验一个函数
+    /// @param func 函数
+    void verifyStructure(Function * func);
+
+    /// @brief 校验模块内所有指令的use链
+    void verifyUses();
+
+    /// @brief 校验一个函数内临时变量的定义支配其使用
+    /// @param func 函数
+    void verifyDominance(Function * func);
+
+    /// @brief 校验一条指令的类型
+    /// @param func 函数
+    /// @param index 指令的下标
+    void verifyTypes(Function * func, int32_t index);
+
+    /// @brief 获取出错信息中Value的名字，第一次获取时对函数重命名
+    /// @param func Value所在的函数
+    /// @param val Value，可为空
+    /// @return 名字
+    std::string valueName(Function * func, Value * val);
+
+    /// @brief 记录错误
+    /// @param func 出错的函数
+    /// @param index 出错指令的下标，-1表示与具体指令无关
+    /// @param message 错误信息
+    void report(Function * func, int32_t index, const std::string & message);
+
+private:
+    /// @brief 要校验的模块
+    Module * module;
+
+    /// @brief 模块内所有函数的指令，已排序，用于检查use链中的User是否仍在IR中
+    std::vector<Instruction *> moduleInsts;
+
+    /// @brief 已经重命名的函数，出错时重命名后输出的指令才有名字
+    std::unordered_set<Function *> renamed;
+
+    /// @brief 当前函数的Label指令
+    std::unordered_set<Instruction *> labels;
+
+    /// @brief 发现的错误个数
+    int errorCount = 0;
+
+    /// @brief 错误信息
+    std::string lastError;
+};
@@ -22,12 +22,31 @@
 #include "Antlr4Executor.h"
 #include "CodeGenerator.h"
 #include "CodeGeneratorArm32.h"
+#include "CodeGeneratorArm64.h"
+#include "CodeGeneratorRiscv64.h"
+#include "CodeGeneratorX86_64.h"
 #include "FlexBisonExecutor.h"
 #include "FrontEndExecutor.h"
 #include "Graph.h"
 #include "IRGenerator.h"
+#include "IRReader.h"
+#include "IRBinaryReader.h"
+#include "IRBinaryWriter.h"
+#include "IRInterpreter.h"
+#include "ProfileInstrumenter.h"
+#include "ProfileReader.h"
+#include "BlockPlacement.h"
+#include "IRVerifier.h"
+#include "GlobalConstFolding.h"
 #include "RecursiveDescentExecutor.h"
 #include "Module.h"
+#include "TimeReport.h"
+#include "Debug.h"
+#include "CompileCache.h"
+
+#ifndef MINIC_VERSION
+#define MINIC_VERSION "unknown"
+#endif
 
 ///
 /// @brief 是否显示帮助信息
@@ -86,6 +105,45 @@ static std::string gInputFile;
 /// @brief 输出文件，不同的选项输出的内容不同
 static std::string gOutputFile;
 
+/// @brief 是否输出编译各阶段的耗时与内存统计
+static bool gTimeReport = false;
+
+/// @brief 编译统计的Chrome trace-event格式JSON输出文件，可为空
+static std::string gTimeTraceFile;
+
+/// @brief 输入文件是否是线性IR，文本或二进制格式
+static bool gFromIR = false;
+
+/// @brief 输出的线性IR是否采用二进制格式
+static bool gIRBinary = false;
+
+/// @brief 是否解释执行线性IR，代替汇编输出
+static bool gInterpret = false;
+
+/// @brief 解释执行时输出指令执行次数的文件，可为空
+static std::string gProfileFile;
+
+/// @brief 是否插入块计数器，生成输出profile的程序
+static bool gProfileGenerate = false;
+
+/// @brief 指导优化的profile文件，为空时不使用profile
+static std::string gProfileUse;
+
+/// @brief 是否在IR生成以及每个IR变换之后进行完整的IR校验
+static bool gVerifyEach = false;
+
+/// @brief 是否直接输出ELF可重定位目标文件，代替汇编输出，目前只支持ARM32
+static bool gEmitObject = false;
+
+/// @brief 是否产生Thumb-2指令，目前只支持ARM32的汇编输出
+static bool gThumb = false;
+
+/// @brief 编译缓存目录，为空时不使用缓存
+static std::string gCacheDir;
+
+/// @brief 编译缓存
+static CompileCache gCompileCache;
+
 static struct option long_options[] = {
     {"help", no_argument, 0, 'h'},
     {"output", required_argument, 0, 'o'},
@@ -97,6 +155,17 @@ static struct option long_options[] = {
     {"optimize", required_argument, 0, 'O'},
     {"target", required_argument, 0, 't'},
     {"asmir", no_argument, 0, 'c'},
+    {"time-report", optional_argument, 0, 'R'},
+    {"debug", required_argument, 0, 'G'},
+    {"cache-dir", required_argument, 0, 'K'},
+    {"from-ir", required_argument, 0, 'F'},
+    {"ir-binary", no_argument, 0, 'B'},
+    {"interpret", optional_argument, 0, 'X'},
+    {"profile-generate", no_argument, 0, 'P'},
+    {"profile-use", required_argument, 0, 'U'},
+    {"verify-each", no_argument, 0, 'V'},
+    {"obj", no_argument, 0, 'E'},
+    {"thumb", no_argument, 0, 'M'},
     {0, 0, 0, 0}
 };
 
@@ -114,8 +183,27 @@ static void showHelp(const std::string & exeName)
     std::cout << "  -A, --antlr4               Use Antlr4 for lexical and syntax analysis\n";
     std::cout << "  -D, --recursive-descent    Use recursive descent parsing\n";
     std::cout << "  -O, --optimize=LEVEL       Set optimization level\n";
-    std::cout << "  -t, --target=CPU           Specify target CPU architecture\n";
+    std::cout << "  -t, --target=CPU           Specify target CPU architecture: ARM32 (default),\n";
+    std::cout << "                             ARM64, RISCV64 or X86_64\n";
     std::cout << "  -c, --asmir                Show IR instructions as comments in assembly output\n";
+    std::cout << "      --obj                  Output an ELF relocatable object instead of assembly\n";
+    std::cout << "                             (ARM32 only)\n";
+    std::cout << "      --thumb                Generate Thumb-2 code instead of A32 (ARM32 only)\n";
+    std::cout << "      --time-report[=FILE]   Report time and memory per phase and per function,\n";
+    std::cout << "                             optionally write a Chrome trace-event JSON to FILE\n";
+    std::cout << "      --debug=CATEGORIES     Print diagnostics to stderr for the comma separated\n";
+    std::cout << "                             categories: " + debugCategoryNames() + "\n";
+    std::cout << "      --from-ir=FILE         Read linear IR (text or binary) from FILE instead of\n";
+    std::cout << "                             a MiniC source\n";
+    std::cout << "      --ir-binary            Output intermediate representation in binary format\n";
+    std::cout << "      --interpret[=FILE]     Execute the IR from main instead of generating assembly,\n";
+    std::cout << "                             optionally write per-instruction execution counts to FILE\n";
+    std::cout << "      --profile-generate     Count block executions, the program writes the counts\n";
+    std::cout << "                             to $MINIC_PROFILE (default minic.profdata) on exit\n";
+    std::cout << "      --profile-use=FILE     Use block execution counts in FILE to lay out code\n";
+    std::cout << "      --verify-each          Fully verify the IR after generation and after every pass\n";
+    std::cout << "      --cache-dir=DIR        Reuse outputs of unchanged sources and functions\n";
+    std::cout << "                             cached in DIR\n";
 }
 
 /// @brief 参数解析与有效性检查
@@ -134,6 +222,16 @@ static int ArgsAnalysis(int argc, char * argv[])
     // -O要求必须带有附加整数，指明优化的级别
     // -t要求必须带有目标CPU，指明目标CPU的汇编
     // -c选项在输出汇编时有效，附带输出IR指令内容
+    // --time-report只有长选项，输出编译统计，可选附带trace文件名
+    // --debug只有长选项，按类别开启调试诊断输出，如--debug=stack-layout
+    // --cache-dir只有长选项，指定编译缓存的目录
+    // --from-ir只有长选项，指定输入的线性IR文件，代替源文件，文本与二进制格式根据文件头自动识别
+    // --ir-binary只有长选项，与-I一起使用，输出二进制格式的线性IR
+    // --interpret只有长选项，解释执行线性IR，可选附带指令执行次数的输出文件名
+    // --profile-generate只有长选项，插入块计数器，程序退出时输出profile
+    // --profile-use只有长选项，指定profile文件，按块的执行次数优化
+    // --verify-each只有长选项，IR生成以及每个IR变换之后进行完整的IR校验
+    // --thumb只有长选项，ARM32产生Thumb-2指令
     const char options[] = "ho:STIADO:t:c";
     int option_index = 0;
 
@@ -172,7 +270,7 @@ lb_check:
                 gFrontEndRecursiveDescentParsing = true;
                 break;
             case 'O':
-                // 优化级别分析，暂时没有用，如开启优化时请使用
+                // 优化级别分析，ARM32在级别不小于1时进行if转换
                 gOptLevel = std::stoi(optarg);
                 break;
             case 't':
@@ -181,6 +279,53 @@ lb_check:
             case 'c':
                 gAsmAlsoShowIR = true;
                 break;
+            case 'G':
+                if (!debugEnable(optarg)) {
+                    minic_log(LOG_ERROR, "不支持的调试类别：%s", optarg);
+                    return -1;
+                }
+                break;
+            case 'F':
+                // 输入为线性IR文件，不能再指定源文件
+                if (!gInputFile.empty()) {
+                    return -1;
+                }
+                gInputFile = optarg;
+                gFromIR = true;
+                break;
+            case 'B':
+                gIRBinary = true;
+                break;
+            case 'X':
+                gInterpret = true;
+                if (optarg) {
+                    gProfileFile = optarg;
+                }
+                break;
+            case 'P':
+                gProfileGenerate = true;
+                break;
+            case 'U':
+                gProfileUse = optarg;
+                break;
+            case 'V':
+                gVerifyEach = true;
+                break;
+            case 'E':
+                gEmitObject = true;
+                break;
+            case 'M':
+                gThumb = true;
+                break;
+            case 'K':
+                gCacheDir = optarg;
+                break;
+            case 'R':
+                gTimeReport = true;
+                if (optarg) {
+                    gTimeTraceFile = optarg;
+                }
+                break;
             default:
                 return -1;
                 break; /* no break */
@@ -218,13 +363,38 @@ lb_check:
         return -1;
     }
 
-    int flag = (int) gShowLineIR + (int) gShowAST;
+    // 线性IR作为输入时没有抽象语法树
+    if (gFromIR && gShowAST) {
+        return -1;
+    }
+
+    // 二进制格式只用于线性IR的输出
+    if (gIRBinary && !gShowLineIR) {
+        return -1;
+    }
+
+    // 插桩后的程序产生profile，不能同时使用profile
+    if (gProfileGenerate && !gProfileUse.empty()) {
+        return -1;
+    }
+
+    int flag = (int) gShowLineIR + (int) gShowAST + (int) gInterpret;
 
     if (0 == flag) {
         // 没有指定，则输出汇编指令
         gShowASM = true;
     } else if (flag != 1) {
-        // 线性中间IR、抽象语法树只能同时选择一个
+        // 线性中间IR、抽象语法树、解释执行只能同时选择一个
+        return -1;
+    }
+
+    // 目标文件代替汇编输出，不能与其它输出同时选择
+    if (gEmitObject && !gShowASM) {
+        return -1;
+    }
+
+    // 目标文件的编码器只支持A32指令
+    if (gThumb && gEmitObject) {
         return -1;
     }
 
@@ -236,6 +406,8 @@ lb_check:
             gOutputFile = "output.png";
         } else if (gShowLineIR) {
             gOutputFile = "output.ir";
+        } else if (gEmitObject) {
+            gOutputFile = "output.o";
         } else {
             gOutputFile = "output.s";
         }
@@ -244,6 +416,31 @@ lb_check:
     return 0;
 }
 
+///
+/// @brief IR校验，发现错误时输出详细信息
+/// @param module 模块
+/// @param full true：完整校验，false：快速校验
+/// @param after 刚执行完的阶段，用于定位引入错误的变换
+/// @return true 通过
+/// @return false 发现错误
+///
+static bool verifyIR(Module * module, bool full, const char * after)
+{
+    IRVerifier verifier(module);
+
+    bool ok;
+    {
+        TimeScope scope(full ? "IRVerifier(full)" : "IRVerifier");
+        ok = verifier.run(full);
+    }
+
+    if (!ok) {
+        minic_log(LOG_ERROR, "IR校验错误(%s之后) - 详细信息：\n%s", after, verifier.getLastError().c_str());
+    }
+
+    return ok;
+}
+
 ///
 /// @brief 对源文件进行编译处理生成汇编
 /// @return true 成功
@@ -259,6 +456,28 @@ static int compile(std::string inputFile, std::string outputFile)
 
     Module * module = nullptr;
 
+    // 源文件级缓存：源文件内容与选项都没有变化时直接复制缓存的输出，不再执行前端与IR生成
+    // 抽象语法树的图片输出不缓存
+    std::string cacheKey;
+    if (gCompileCache.isEnabled() && !gShowAST && !gInterpret) {
+
+        std::string source;
+        if (CompileCache::readFile(inputFile, source)) {
+
+            cacheKey = gCompileCache.makeKey(gShowLineIR ? "ir" : (gEmitObject ? "obj" : "asm"), source);
+
+            std::string output;
+            if (gCompileCache.load(cacheKey, output)) {
+                if (CompileCache::writeFile(outputFile, output)) {
+                    minic_debug(DEBUG_CACHE, "%s: hit %s\n", inputFile.c_str(), cacheKey.c_str());
+                    return 0;
+                }
+            }
+
+            minic_debug(DEBUG_CACHE, "%s: miss %s\n", inputFile.c_str(), cacheKey.c_str());
+        }
+    }
+
     // 这里采用do {} while(0)架构的目的是如果处理出错可通过break退出循环，出口唯一
     // 在编译器编译优化时会自动去除，因为while恒假的缘故
     do {
@@ -266,79 +485,227 @@ static int compile(std::string inputFile, std::string outputFile)
         // 编译过程主要包括：
         // 1）词法语法分析生成AST
         // 2) 遍历AST生成线性IR
-        // 3) 对线性IR进行优化：目前不支持
+        // 3) 对线性IR进行优化：目前只有profile指导的基本块排列
         // 4) 把线性IR转换成汇编
 
-        // 创建词法语法分析器
-        FrontEndExecutor * frontEndExecutor;
-        if (gFrontEndAntlr4) {
-            // Antlr4
-            frontEndExecutor = new Antlr4Executor(inputFile);
-        } else if (gFrontEndRecursiveDescentParsing) {
-            // 递归下降分析法
-            frontEndExecutor = new RecursiveDescentExecutor(inputFile);
+        if (gFromIR) {
+
+            // 读取线性IR重建符号表，不需要前端以及IR生成
+            module = new Module(inputFile);
+
+            std::string irError;
+            if (IRBinaryReader::isBinaryFile(inputFile)) {
+                IRBinaryReader irReader(inputFile, module);
+                TimeScope scope("IRBinaryReader::run");
+                subResult = irReader.run();
+                irError = irReader.getLastError();
+            } else {
+                IRReader irReader(inputFile, module);
+                TimeScope scope("IRReader::run");
+                subResult = irReader.run();
+                irError = irReader.getLastError();
+            }
+            if (!subResult) {
+                minic_log(LOG_ERROR, "IR读取错误 - 详细信息：%s", irError.c_str());
+                break;
+            }
+
+            if (gVerifyEach && !verifyIR(module, true, "IRReader")) {
+                break;
+            }
         } else {
-            // 默认为Flex+Bison
-            frontEndExecutor = new FlexBisonExecutor(inputFile);
-        }
 
-        // 前端执行：词法分析、语法分析后产生抽象语法树，其root为全局变量ast_root
-        subResult = frontEndExecutor->run();
-        if (!subResult) {
+            // 创建词法语法分析器
+            FrontEndExecutor * frontEndExecutor;
+            if (gFrontEndAntlr4) {
+                // Antlr4
+                frontEndExecutor = new Antlr4Executor(inputFile);
+            } else if (gFrontEndRecursiveDescentParsing) {
+                // 递归下降分析法
+                frontEndExecutor = new RecursiveDescentExecutor(inputFile);
+            } else {
+                // 默认为Flex+Bison
+                frontEndExecutor = new FlexBisonExecutor(inputFile);
+            }
 
-            minic_log(LOG_ERROR, "前端分析错误");
-            // 退出循环
-            break;
-        }
+            // 前端执行：词法分析、语法分析后产生抽象语法树，其root为全局变量ast_root
+            {
+                TimeScope scope("frontend");
+                subResult = frontEndExecutor->run();
+            }
+            if (!subResult) {
 
-        // 获取抽象语法树的根节点
-        ast_node * astRoot = frontEndExecutor->getASTRoot();
+                minic_log(LOG_ERROR, "前端分析错误");
+                // 退出循环
+                break;
+            }
 
-        // 清理前端资源
-        delete frontEndExecutor;
+            // 获取抽象语法树的根节点
+            ast_node * astRoot = frontEndExecutor->getASTRoot();
 
-        // 这里可进行非线性AST的优化
+            // 清理前端资源
+            delete frontEndExecutor;
 
-        if (gShowAST) {
+            // 这里可进行非线性AST的优化
+
+            if (gShowAST) {
+
+                // 遍历抽象语法树，生成抽象语法树图片
+                OutputAST(astRoot, outputFile);
+
+                // 清理抽象语法树
+                free_ast(astRoot);
+
+                // 设置返回结果：正常
+                result = 0;
+
+                break;
+            }
+
+            // 输出线性中间IR、计算器模拟解释执行、输出汇编指令
+            // 都需要遍历AST转换成线性IR指令
+
+            // 符号表，保存所有的变量以及函数等信息
+            module = new Module(inputFile);
+
+            // 遍历抽象语法树产生线性IR，相关信息保存到符号表中
+            IRGenerator ast2IR(astRoot, module);
+            {
+                TimeScope scope("IRGenerator::run");
+                subResult = ast2IR.run();
+            }
+            if (!subResult) {
 
-            // 遍历抽象语法树，生成抽象语法树图片
-            OutputAST(astRoot, outputFile);
+				// 输出错误信息
+				minic_log(LOG_ERROR, "中间IR生成错误 - 详细信息：%s", ast2IR.getLastError().c_str());
+
+                break;
+            }
 
             // 清理抽象语法树
-            free_ast(astRoot);
+            {
+                TimeScope scope("free_ast");
+                free_ast(astRoot);
+            }
 
-            // 设置返回结果：正常
-            result = 0;
+            if (gVerifyEach && !verifyIR(module, true, "IRGenerator")) {
+                break;
+            }
+        }
 
-            break;
+        // 对线性IR进行优化
+
+        if (gProfileGenerate) {
+
+            // 插入块计数器
+            ProfileInstrumenter instrumenter(module);
+            {
+                TimeScope scope("ProfileInstrumenter");
+                subResult = instrumenter.run();
+            }
+            if (!subResult) {
+                minic_log(LOG_ERROR, "profile插桩错误 - 详细信息：%s", instrumenter.getLastError().c_str());
+                break;
+            }
+
+            if (gVerifyEach && !verifyIR(module, true, "ProfileInstrumenter")) {
+                break;
+            }
+        }
+
+        if (!gProfileUse.empty()) {
+
+            // 读取块的执行次数，按执行次数调整块的次序
+            ProfileReader profileReader(gProfileUse, module);
+            {
+                TimeScope scope("ProfileReader");
+                subResult = profileReader.run();
+            }
+            if (!subResult) {
+                minic_log(LOG_ERROR, "profile读取错误 - 详细信息：%s", profileReader.getLastError().c_str());
+                break;
+            }
+
+            {
+                TimeScope scope("BlockPlacement");
+                for (auto func: module->getFunctionList()) {
+                    BlockPlacement placement(func);
+                    (void) placement.run();
+                }
+            }
+
+            if (gVerifyEach && !verifyIR(module, true, "BlockPlacement")) {
+                break;
+            }
         }
 
-        // 输出线性中间IR、计算器模拟解释执行、输出汇编指令
-        // 都需要遍历AST转换成线性IR指令
+        if (gInterpret) {
+
+            // 解释执行，程序的返回值作为编译器的返回值
+            IRInterpreter interpreter(module);
+            int32_t exitCode = 0;
+            {
+                TimeScope scope("IRInterpreter::run");
+                subResult = interpreter.run(exitCode);
+            }
+            if (!subResult) {
+                minic_log(LOG_ERROR, "解释执行错误 - 详细信息：%s", interpreter.getLastError().c_str());
+                break;
+            }
+
+            if (!gProfileFile.empty()) {
+
+                // 执行次数按IR指令输出，需要对IR的名字重命名
+                module->renameIR();
+
+                FILE * fp = fopen(gProfileFile.c_str(), "w");
+                if (!fp) {
+                    minic_log(LOG_ERROR, "文件(%s)无法写入", gProfileFile.c_str());
+                    break;
+                }
 
-        // 符号表，保存所有的变量以及函数等信息
-        Module * module = new Module(inputFile);
+                {
+                    OutputStream os(fp);
+                    interpreter.printProfile(os);
+                }
 
-        // 遍历抽象语法树产生线性IR，相关信息保存到符号表中
-        IRGenerator ast2IR(astRoot, module);
-        subResult = ast2IR.run();
-        if (!subResult) {
+                fclose(fp);
+            }
 
-			// 输出错误信息
-			minic_log(LOG_ERROR, "中间IR生成错误 - 详细信息：%s", ast2IR.getLastError().c_str());
+            result = exitCode;
 
             break;
         }
 
-        // 清理抽象语法树
-        free_ast(astRoot);
+        if (gShowLineIR && gIRBinary) {
+
+            // 二进制格式的IR按编号引用，不需要重命名
+            IRBinaryWriter irWriter(module);
+            {
+                TimeScope scope("IRBinaryWriter");
+                subResult = irWriter.writeFile(outputFile);
+            }
+            if (!subResult) {
+                minic_log(LOG_ERROR, "IR输出错误 - 详细信息：%s", irWriter.getLastError().c_str());
+                break;
+            }
+
+            // 设置返回结果：正常
+            result = 0;
+
+            break;
+        }
 
         if (gShowLineIR) {
 
             // 对IR的名字重命名
-            module->renameIR();
+            {
+                TimeScope scope("renameIR");
+                module->renameIR();
+            }
 
             // 输出IR
+            TimeScope scope("outputIR");
             module->outputIR(outputFile);
 
             // 设置返回结果：正常
@@ -350,11 +717,35 @@ static int compile(std::string inputFile, std::string outputFile)
         // 要使得汇编能输出IR指令作为注释，必须对IR的名字进行命名，否则为空值
         if (gAsmAlsoShowIR) {
             // 对IR的名字重命名
+            TimeScope scope("renameIR");
             module->renameIR();
         }
 
         // 这里可追加中间代码优化，体系结果无关的优化等
 
+        // 没有写入的全局变量放到只读段，对其的读取折叠为常量
+        {
+            TimeScope scope("GlobalConstFolding");
+            GlobalConstFolding globalConstFolding(module);
+            (void) globalConstFolding.run();
+        }
+
+        if (gVerifyEach && !verifyIR(module, true, "GlobalConstFolding")) {
+            break;
+        }
+
+        // 后端之前总是进行一次快速校验，Debug版本进行完整校验；--verify-each时每步都已完整校验过
+        if (gShowASM && !gVerifyEach) {
+#ifdef NDEBUG
+            bool fullVerify = false;
+#else
+            bool fullVerify = true;
+#endif
+            if (!verifyIR(module, fullVerify, "IR变换")) {
+                break;
+            }
+        }
+
         // 后端处理，体系结果相关的操作
         // 这里提供一种面向ARM32的汇编产生器CodeGeneratorArm32作为参考
         // 需要时可根据需要修改或追加新的目标体系架构
@@ -362,10 +753,57 @@ static int compile(std::string inputFile, std::string outputFile)
 
             CodeGenerator * generator = nullptr;
 
+            if (gEmitObject && (gCPUTarget != "ARM32")) {
+                // 目标文件的直接输出目前只支持ARM32
+                minic_log(LOG_ERROR, "指定的目标CPU架构(%s)不支持目标文件的输出", gCPUTarget.c_str());
+                break;
+            }
+
+            if (gThumb && (gCPUTarget != "ARM32")) {
+                // Thumb-2只用于ARM32
+                minic_log(LOG_ERROR, "指定的目标CPU架构(%s)不支持Thumb-2", gCPUTarget.c_str());
+                break;
+            }
+
             if (gCPUTarget == "ARM32") {
-                // 输出面向ARM32的汇编指令
-                generator = new CodeGeneratorArm32(module);
+                // 输出面向ARM32的汇编指令，或者直接输出目标文件
+                CodeGeneratorArm32 * arm32Generator = new CodeGeneratorArm32(module);
+                arm32Generator->setEmitObject(gEmitObject);
+                arm32Generator->setThumb(gThumb);
+                arm32Generator->setIfConversion(gOptLevel >= 1);
+                arm32Generator->setLoopVectorize(gOptLevel >= 1);
+                generator = arm32Generator;
+                generator->setShowLinearIR(gAsmAlsoShowIR);
+                generator->setCompileCache(&gCompileCache);
+
+                TimeScope scope("codegen");
+                if (!generator->run(outputFile)) {
+                    delete generator;
+                    break;
+                }
+            } else if (gCPUTarget == "ARM64") {
+                // 输出面向ARM64(AArch64)的汇编指令
+                generator = new CodeGeneratorArm64(module);
                 generator->setShowLinearIR(gAsmAlsoShowIR);
+                generator->setCompileCache(&gCompileCache);
+
+                TimeScope scope("codegen");
+                generator->run(outputFile);
+            } else if (gCPUTarget == "RISCV64") {
+                // 输出面向RISC-V64(RV64GC)的汇编指令
+                generator = new CodeGeneratorRiscv64(module);
+                generator->setShowLinearIR(gAsmAlsoShowIR);
+                generator->setCompileCache(&gCompileCache);
+
+                TimeScope scope("codegen");
+                generator->run(outputFile);
+            } else if (gCPUTarget == "X86_64") {
+                // 输出面向x86-64的汇编指令，可在本机直接汇编运行
+                generator = new CodeGeneratorX86_64(module);
+                generator->setShowLinearIR(gAsmAlsoShowIR);
+                generator->setCompileCache(&gCompileCache);
+
+                TimeScope scope("codegen");
                 generator->run(outputFile);
             } else {
                 // 不支持指定的CPU架构
@@ -386,6 +824,14 @@ static int compile(std::string inputFile, std::string outputFile)
 
     delete module;
 
+    // 编译成功后保存输出到缓存
+    if ((result == 0) && !cacheKey.empty()) {
+        std::string output;
+        if (CompileCache::readFile(outputFile, output)) {
+            gCompileCache.save(cacheKey, output);
+        }
+    }
+
     return result;
 }
 
@@ -421,8 +867,51 @@ int main(int argc, char * argv[])
         return 0;
     }
 
+    if (gTimeReport) {
+        TimeReport::enable(gTimeTraceFile);
+    }
+
+    if (!gCacheDir.empty()) {
+
+        // 编译器版本、可执行文件以及影响输出的选项都作为缓存的键的一部分
+        std::string compilerId = std::string(MINIC_VERSION) + "|" + CompileCache::executableHash();
+        compilerId += "|frontend=" + std::string(gFrontEndAntlr4 ? "antlr4" : (gFrontEndRecursiveDescentParsing ? "rd" : "flexbison"));
+        compilerId += "|target=" + gCPUTarget;
+        compilerId += "|O" + std::to_string(gOptLevel);
+        compilerId += "|asmir=" + std::to_string((int) gAsmAlsoShowIR);
+        compilerId += "|fromir=" + std::to_string((int) gFromIR);
+        compilerId += "|irbinary=" + std::to_string((int) gIRBinary);
+        compilerId += "|profgen=" + std::to_string((int) gProfileGenerate);
+        compilerId += "|verify=" + std::to_string((int) gVerifyEach);
+        compilerId += "|thumb=" + std::to_string((int) gThumb);
+
+        // profile的内容影响输出，内容作为键的一部分
+        if (!gProfileUse.empty()) {
+            std::string profile;
+            (void) CompileCache::readFile(gProfileUse, profile);
+            compilerId += "|profuse=" + std::to_string(CompileCache::hash(profile.data(), profile.size()));
+        }
+
+        if (!gCompileCache.enable(gCacheDir, compilerId)) {
+            // 缓存不可用不影响编译
+            minic_log(LOG_ERROR, "缓存目录(%s)无法创建，不使用编译缓存", gCacheDir.c_str());
+        }
+    }
+
     // 参数解析正确，进行编译处理，目前只支持一个文件的编译。
-    result = compile(gInputFile, gOutputFile);
+    {
+        TimeScope scope("total");
+        result = compile(gInputFile, gOutputFile);
+    }
+
+    if (gTimeReport) {
+        // 统计结果输出到标准错误，不影响编译结果的输出
+        TimeReport::print(stderr);
+
+        if (!TimeReport::writeTrace()) {
+            minic_log(LOG_ERROR, "trace文件(%s)无法写入", gTimeTraceFile.c_str());
+        }
+    }
 
     return result;
 }
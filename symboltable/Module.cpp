@@ -17,7 +17,9 @@
 
 #include "ScopeStack.h"
 #include "Common.h"
+#include "FloatType.h"
 #include "VoidType.h"
+#include "OutputStream.h"
 
 Module::Module(std::string _name) : name(_name)
 {
@@ -47,20 +49,52 @@ Module::Module(std::string _name) : name(_name)
                          "a"}},
         true);
     (void) newFunction("putstr", VoidType::getType(), {new FormalParam{IntegerType::getTypeInt(), "str"}}, true);
-    (void) newFunction("getfloat", IntegerType::getTypeInt(), {}, true);
+    // 浮点数的输入输出，按硬浮点调用约定通过s0传递
+    (void) newFunction("getfloat", FloatType::getTypeFloat(), {}, true);
     (void) newFunction(
         "getfarray",
         IntegerType::getTypeInt(),
-        {new FormalParam{const_cast<Type *>(static_cast<const Type *>(PointerType::get(IntegerType::getTypeInt()))),
+        {new FormalParam{const_cast<Type *>(static_cast<const Type *>(PointerType::get(FloatType::getTypeFloat()))),
                          "a"}},
         true);
-    (void) newFunction("putfloat", VoidType::getType(), {new FormalParam{IntegerType::getTypeInt(), "a"}}, true);
+    (void) newFunction("putfloat", VoidType::getType(), {new FormalParam{FloatType::getTypeFloat(), "a"}}, true);
     (void) newFunction(
         "putfarray",
         VoidType::getType(),
-        {new FormalParam{IntegerType::getTypeInt(), "n"}, new FormalParam{IntegerType::getTypeInt(), "a"}},
+        {new FormalParam{IntegerType::getTypeInt(), "n"},
+         new FormalParam{const_cast<Type *>(static_cast<const Type *>(PointerType::get(FloatType::getTypeFloat()))),
+                         "a"}},
         true);
     (void) newFunction("putf", VoidType::getType(), {new FormalParam{IntegerType::getTypeInt(), "a"}}, true);
+
+    // 局部数组初始化时整体清零以及从只读段的模板复制，由C库实现
+    (void) newFunction(
+        "memset",
+        VoidType::getType(),
+        {new FormalParam{const_cast<Type *>(static_cast<const Type *>(PointerType::get(IntegerType::getTypeInt()))),
+                         "dst"},
+         new FormalParam{IntegerType::getTypeInt(), "c"},
+         new FormalParam{IntegerType::getTypeInt(), "n"}},
+        true);
+    (void) newFunction(
+        "memcpy",
+        VoidType::getType(),
+        {new FormalParam{const_cast<Type *>(static_cast<const Type *>(PointerType::get(IntegerType::getTypeInt()))),
+                         "dst"},
+         new FormalParam{const_cast<Type *>(static_cast<const Type *>(PointerType::get(IntegerType::getTypeInt()))),
+                         "src"},
+         new FormalParam{IntegerType::getTypeInt(), "n"}},
+        true);
+
+    // --profile-generate插桩后main函数退出前调用，输出块计数器，由tests/std.c实现
+    (void) newFunction(
+        "__minic_prof_dump",
+        VoidType::getType(),
+        {new FormalParam{IntegerType::getTypeInt(), "hash"},
+         new FormalParam{IntegerType::getTypeInt(), "n"},
+         new FormalParam{const_cast<Type *>(static_cast<const Type *>(PointerType::get(IntegerType::getTypeInt()))),
+                         "counts"}},
+        true);
 }
 
 /// @brief 进入作用域，如进入函数体块、语句块等
@@ -148,14 +182,15 @@ Function * Module::newFunction(std::string name, Type * returnType, std::vector<
     }
 
     // 以下是原代码，创建新函数...
-    std::vector<Type *> paramsType(params.size());
+    std::vector<Type *> paramsType;
+    paramsType.reserve(params.size());
 
     for (auto & param: params) {
         paramsType.push_back(param->getType());
     }
 
-    /// 函数类型参数
-    FunctionType * type = new FunctionType(returnType, paramsType);
+    /// 函数类型参数，相同的函数类型共用一个实例
+    FunctionType * type = FunctionType::get(returnType, paramsType);
 
     // 新建函数对象
     tempFunc = new Function(name, type, builtin);
@@ -182,7 +217,7 @@ Function * Module::newFunction(std::string name, Type * returnType, std::vector<
 
 //     return nullptr;
 // }
-Function * Module::findFunction(std::string name)
+Function * Module::findFunction(const std::string & name)
 {
     // 根据名字查找
     auto pIter = funcMap.find(name);
@@ -240,6 +275,30 @@ ConstInt * Module::newConstInt(int32_t intVal)
     return val;
 }
 
+/// @brief 新建一个float常量的Value，位模式相同的常量只有一份
+/// @param val 值
+/// @return 常量Value
+ConstFloat * Module::newConstFloat(float val)
+{
+    return newConstFloatBits(ConstFloat::floatToBits(val));
+}
+
+/// @brief 按位模式新建一个float常量的Value，用于IR读取与全局变量初值
+/// @param bits IEEE 754单精度位模式
+/// @return 常量Value
+ConstFloat * Module::newConstFloatBits(int32_t bits)
+{
+    auto pIter = constFloatMap.find(bits);
+    if (pIter != constFloatMap.end()) {
+        return pIter->second;
+    }
+
+    ConstFloat * val = new ConstFloat(bits);
+    constFloatMap.emplace(bits, val);
+
+    return val;
+}
+
 /// @brief 根据整数值获取当前符号
 /// \param name 变量名
 /// \return 变量对应的值
@@ -308,7 +367,7 @@ Value * Module::newVarValue(Type * type, std::string name)
 ///
 /// @param name 变量ID
 /// @return 指针有效则找到，空指针未找到
-Value * Module::findVarValue(std::string name)
+Value * Module::findVarValue(const std::string & name)
 {
     // 逐层级作用域查找
     Value * tempValue = scopeStack->findAllScope(name);
@@ -367,6 +426,18 @@ GlobalVariable * Module::newGlobalVariable(Type * type, std::string name)
     return val;
 }
 
+/// @brief 新建只读的全局变量，不加入作用域，用于局部数组初始化的模板
+/// @param type 类型
+/// @param name 名字，要求不与其它全局变量重名
+/// @return 全局变量
+GlobalVariable * Module::newReadOnlyGlobal(Type * type, const std::string & name)
+{
+    GlobalVariable * val = newGlobalVariable(type, name);
+    val->setReadOnly(true);
+
+    return val;
+}
+
 /// @brief 根据变量名获取当前符号(只管理全局变量和常量)
 /// @param name 变量名或者常量名
 /// @param create 变量查找不到时若为true则自动创建变量型Value，否则不创建
@@ -431,20 +502,23 @@ void Module::outputIR(const std::string & filePath)
         return;
     }
 
-    // 全局变量遍历输出对应的declare指令
-    for (auto var: globalVariableVector) {
+    // 经缓冲的输出流输出，函数的IR文本不再整体生成后输出
+    {
+        OutputStream os(fp);
 
+        // 全局变量遍历输出对应的declare指令
         std::string str;
-        var->toDeclareString(str);
-        fprintf(fp, "%s\n", str.c_str());
-    }
+        for (auto var: globalVariableVector) {
 
-    // 遍历所有的线性IR指令，文本输出
-    for (auto func: funcVector) {
+            str.clear();
+            var->toDeclareString(str);
+            os << str << '\n';
+        }
 
-        std::string instStr;
-        func->toString(instStr);
-        fprintf(fp, "%s", instStr.c_str());
+        // 遍历所有的线性IR指令，文本输出
+        for (auto func: funcVector) {
+            func->print(os);
+        }
     }
 
     fclose(fp);
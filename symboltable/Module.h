@@ -20,6 +20,7 @@
 #include <unordered_map>
 
 #include "ConstInt.h"
+#include "ConstFloat.h"
 #include "Type.h"
 #include "GlobalVariable.h"
 #include "Function.h"
@@ -88,7 +89,7 @@ public:
     /// @brief 根据函数名查找函数信息
     /// @param name 函数名
     /// @return 函数信息
-    Function * findFunction(std::string name);
+    Function * findFunction(const std::string & name);
 
     ///
     /// @brief 获取全局变量列表，用于外部遍历全局变量
@@ -110,6 +111,16 @@ public:
     /// \return 临时Value
     ConstInt * newConstInt(int32_t intVal);
 
+    /// @brief 新建一个float常量的Value，位模式相同的常量只有一份
+    /// @param val 值
+    /// @return 常量Value
+    ConstFloat * newConstFloat(float val);
+
+    /// @brief 按位模式新建一个float常量的Value，用于IR读取与全局变量初值
+    /// @param bits IEEE 754单精度位模式
+    /// @return 常量Value
+    ConstFloat * newConstFloatBits(int32_t bits);
+
     /// @brief 新建变量型Value，会根据currentFunc的值进行判断创建全局或者局部变量
     /// ! 该函数只有在AST遍历生成线性IR中使用，其它地方不能使用
     /// @param name 变量ID
@@ -120,7 +131,7 @@ public:
     /// ! 该函数只有在AST遍历生成线性IR中使用，其它地方不能使用
     /// @param name 变量ID
     /// @return 指针有效则找到，空指针未找到
-    Value * findVarValue(std::string name);
+    Value * findVarValue(const std::string & name);
 
     /// @brief 使用指定的Value创建变量符号表项（用于数组参数）-lxg
     /// ! 该函数只有在AST遍历生成线性IR中使用，其它地方不能使用
@@ -130,6 +141,12 @@ public:
     /// @return 成功返回该Value，失败返回nullptr
     Value * newVarValueWithValue(Type * type, const std::string & name, Value * value);
 
+    /// @brief 新建只读的全局变量，不加入作用域，用于局部数组初始化的模板
+    /// @param type 类型
+    /// @param name 名字，要求不与其它全局变量重名
+    /// @return 全局变量
+    GlobalVariable * newReadOnlyGlobal(Type * type, const std::string & name);
+
     /// @brief 清理Module中管理的所有信息资源
     void Delete();
 
@@ -204,4 +221,7 @@ private:
 
     /// @brief 常量表
     std::unordered_map<int32_t, ConstInt *> constIntMap;
+
+    /// @brief float常量表，按位模式索引
+    std::unordered_map<int32_t, ConstFloat *> constFloatMap;
 };
\ No newline at end of file
@@ -20,9 +20,8 @@
 ///
 void ScopeStack::enterScope()
 {
-    // 在栈顶新加入一层，没有变量
-    std::unordered_map<std::string, Value *> valueMap;
-    valueStack.emplace_back(valueMap);
+    // 记录本层的起点，本层还没有变量
+    scopeStarts.push_back((int32_t) bindings.size());
 }
 
 ///
@@ -30,7 +29,15 @@ void ScopeStack::enterScope()
 ///
 void ScopeStack::leaveScope()
 {
-    valueStack.pop_back();
+    // 逆序撤销本层的变量，恢复被遮蔽的外层同名变量
+    int32_t start = scopeStarts.back();
+    while ((int32_t) bindings.size() > start) {
+        Binding & binding = bindings.back();
+        innermost[binding.symbol] = binding.shadowed;
+        bindings.pop_back();
+    }
+
+    scopeStarts.pop_back();
 }
 
 ///
@@ -39,7 +46,34 @@ void ScopeStack::leaveScope()
 ///
 void ScopeStack::insertValue(Value * value)
 {
-    valueStack.back().insert(make_pair(value->getName(), value));
+    int32_t symbol = interner.intern(value->getName());
+    if (symbol >= (int32_t) innermost.size()) {
+        innermost.resize(interner.size(), -1);
+    }
+
+    // 当前作用域中已有同名变量时保留原来的变量
+    int32_t level = getCurrentScopeLevel();
+    int32_t shadowed = innermost[symbol];
+    if ((shadowed >= 0) && (bindings[shadowed].level == level)) {
+        return;
+    }
+
+    innermost[symbol] = (int32_t) bindings.size();
+    bindings.push_back(Binding{value, symbol, level, shadowed});
+}
+
+///
+/// @brief 查找最内层的同名变量
+/// @param name 变量名
+/// @return int32_t 变量在bindings中的下标，-1表示没有
+///
+int32_t ScopeStack::findInnermost(const std::string & name)
+{
+    int32_t symbol = interner.find(name);
+    if ((symbol < 0) || (symbol >= (int32_t) innermost.size())) {
+        return -1;
+    }
+    return innermost[symbol];
 }
 
 ///
@@ -47,12 +81,12 @@ void ScopeStack::insertValue(Value * value)
 /// @param  name 变量名
 /// @return Value* 变量对象，若没有，则返回空指针
 ///
-Value * ScopeStack::findCurrentScope(std::string name)
+Value * ScopeStack::findCurrentScope(const std::string & name)
 {
-    // 在栈顶的作用域中查找，即当前作用域
-    auto it = valueStack.back().find(name);
-    if (it != valueStack.back().end()) {
-        return it->second;
+    // 最内层的同名变量在当前作用域中才算找到
+    int32_t index = findInnermost(name);
+    if ((index >= 0) && (bindings[index].level == getCurrentScopeLevel())) {
+        return bindings[index].value;
     }
     return nullptr;
 }
@@ -62,16 +96,11 @@ Value * ScopeStack::findCurrentScope(std::string name)
 /// @param  name 变量名
 /// @return Value* 变量对象。若没有，则返回空指针
 ///
-Value * ScopeStack::findAllScope(std::string name)
+Value * ScopeStack::findAllScope(const std::string & name)
 {
-    // 模拟栈操作，从栈顶开始查找
-    for (auto it = valueStack.rbegin(); it != valueStack.rend(); ++it) {
-        auto p = it->find(name);
-        if (p != it->end()) {
-            return p->second;
-        }
-    }
-    return nullptr;
+    // 遮蔽链的头就是最内层的同名变量，不需要逐层查找
+    int32_t index = findInnermost(name);
+    return (index >= 0) ? bindings[index].value : nullptr;
 }
 
 ///
@@ -80,5 +109,5 @@ Value * ScopeStack::findAllScope(std::string name)
 ///
 int ScopeStack::getCurrentScopeLevel()
 {
-    return valueStack.size() - 1;
+    return (int) scopeStarts.size() - 1;
 }
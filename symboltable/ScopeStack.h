@@ -15,13 +15,14 @@
 ///
 #pragma once
 
-#include <unordered_map>
 #include <vector>
 
+#include "SymbolInterner.h"
 #include "Value.h"
 
 ///
-/// @brief 变量作用域管理类，内部通过栈来实现
+/// @brief 变量作用域管理类。变量名驻留为编号，每个编号对应一条由内层指向外层的遮蔽链，
+/// 所有作用域共用一张表；离开作用域时按加入的逆序撤销本层的变量，进入作用域不分配内存
 ///
 class ScopeStack {
     // 作用域栈
@@ -38,7 +39,7 @@ public:
     /// @param  name 变量名
     /// @return Value* 变量对象，若没有，则返回空指针
     ///
-    Value * findCurrentScope(std::string name);
+    Value * findCurrentScope(const std::string & name);
 
     ///
     /// @brief 获取当前的作用域栈的层号
@@ -51,7 +52,7 @@ public:
     /// @param  name 变量名
     /// @return Value* 变量对象。若没有，则返回空指针
     ///
-    Value * findAllScope(std::string name);
+    Value * findAllScope(const std::string & name);
 
     ///
     /// @brief 进入作用域
@@ -64,8 +65,45 @@ public:
     void leaveScope();
 
 protected:
+    /// @brief 作用域中的一个变量
+    struct Binding {
+        /// @brief 变量
+        Value * value;
+
+        /// @brief 变量名的编号
+        int32_t symbol;
+
+        /// @brief 所在作用域的层号
+        int32_t level;
+
+        /// @brief 被遮蔽的同名变量在bindings中的下标，-1表示没有
+        int32_t shadowed;
+    };
+
+    ///
+    /// @brief 查找最内层的同名变量
+    /// @param name 变量名
+    /// @return int32_t 变量在bindings中的下标，-1表示没有
+    ///
+    int32_t findInnermost(const std::string & name);
+
+    ///
+    /// @brief 变量名的编号
+    ///
+    SymbolInterner interner;
+
+    ///
+    /// @brief 按加入次序排列的所有可见变量，相当于作用域栈展开后的内容
+    ///
+    std::vector<Binding> bindings;
+
+    ///
+    /// @brief 以变量名的编号为下标，保存最内层同名变量在bindings中的下标，-1表示没有
+    ///
+    std::vector<int32_t> innermost;
+
     ///
-    /// @brief 变量作用域栈，最外层用vector来模拟栈，每一层用unordered_map来实现，变量名为key，变量为value
+    /// @brief 每一层作用域的第一个变量在bindings中的下标，最外层在前
     ///
-    std::vector<std::unordered_map<std::string, Value *>> valueStack;
+    std::vector<int32_t> scopeStarts;
 };
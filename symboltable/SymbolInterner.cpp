@@ -0,0 +1,99 @@
+///
+/// @file SymbolInterner.cpp
+/// @brief 标识符驻留，把标识符映射为连续的整数编号
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include "SymbolInterner.h"
+
+/// @brief 初始的槽位数，必须是2的幂
+#define INTERNER_INITIAL_SLOTS 256
+
+/// @brief FNV-1a哈希
+/// @param name 标识符
+/// @return uint32_t 哈希值
+static uint32_t hashName(const std::string & name)
+{
+    uint32_t hash = 2166136261u;
+    for (unsigned char ch: name) {
+        hash = (hash ^ ch) * 16777619u;
+    }
+    return hash;
+}
+
+/// @brief 构造函数
+SymbolInterner::SymbolInterner() : slots(INTERNER_INITIAL_SLOTS, -1)
+{}
+
+/// @brief 查找标识符所在的槽位
+/// @param name 标识符
+/// @param hash 标识符的哈希值
+/// @return size_t 槽位，槽位为空时表示标识符不存在
+size_t SymbolInterner::probe(const std::string & name, uint32_t hash) const
+{
+    size_t mask = slots.size() - 1;
+
+    // 线性探测，装填因子不超过1/2，总能遇到空槽位
+    for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+        int32_t symbol = slots[slot];
+        if ((symbol < 0) || ((hashes[symbol] == hash) && (names[symbol] == name))) {
+            return slot;
+        }
+    }
+}
+
+/// @brief 槽位数翻倍并重新放置所有编号
+void SymbolInterner::grow()
+{
+    slots.assign(slots.size() * 2, -1);
+
+    size_t mask = slots.size() - 1;
+    for (int32_t symbol = 0; symbol < (int32_t) names.size(); ++symbol) {
+        size_t slot = hashes[symbol] & mask;
+        while (slots[slot] >= 0) {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = symbol;
+    }
+}
+
+/// @brief 获取标识符的编号，没有时分配新的编号
+/// @param name 标识符
+/// @return int32_t 编号
+int32_t SymbolInterner::intern(const std::string & name)
+{
+    uint32_t hash = hashName(name);
+
+    size_t slot = probe(name, hash);
+    if (slots[slot] >= 0) {
+        return slots[slot];
+    }
+
+    int32_t symbol = (int32_t) names.size();
+    names.push_back(name);
+    hashes.push_back(hash);
+
+    if (names.size() * 2 > slots.size()) {
+        grow();
+    } else {
+        slots[slot] = symbol;
+    }
+
+    return symbol;
+}
+
+/// @brief 查找标识符的编号，不分配新的编号
+/// @param name 标识符
+/// @return int32_t 编号，没有时返回-1
+int32_t SymbolInterner::find(const std::string & name) const
+{
+    return slots[probe(name, hashName(name))];
+}
@@ -0,0 +1,85 @@
+///
+/// @file SymbolInterner.h
+/// @brief 标识符驻留，把标识符映射为连续的整数编号
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///
+/// @brief 标识符驻留表。相同的标识符得到相同的编号，编号从0开始连续分配，
+/// 可直接作为数组下标。内部用开放寻址的哈希表，只增不删
+///
+class SymbolInterner {
+
+public:
+    /// @brief 构造函数
+    SymbolInterner();
+
+    ///
+    /// @brief 获取标识符的编号，没有时分配新的编号
+    /// @param name 标识符
+    /// @return int32_t 编号
+    ///
+    int32_t intern(const std::string & name);
+
+    ///
+    /// @brief 查找标识符的编号，不分配新的编号
+    /// @param name 标识符
+    /// @return int32_t 编号，没有时返回-1
+    ///
+    int32_t find(const std::string & name) const;
+
+    ///
+    /// @brief 获取编号对应的标识符
+    /// @param symbol 编号
+    /// @return const std::string& 标识符
+    ///
+    const std::string & getName(int32_t symbol) const
+    {
+        return names[symbol];
+    }
+
+    ///
+    /// @brief 获取已分配的编号个数
+    /// @return int32_t 个数
+    ///
+    int32_t size() const
+    {
+        return (int32_t) names.size();
+    }
+
+protected:
+    ///
+    /// @brief 查找标识符所在的槽位
+    /// @param name 标识符
+    /// @param hash 标识符的哈希值
+    /// @return size_t 槽位，槽位为空时表示标识符不存在
+    ///
+    size_t probe(const std::string & name, uint32_t hash) const;
+
+    /// @brief 槽位数翻倍并重新放置所有编号
+    void grow();
+
+private:
+    /// @brief 开放寻址的槽位，保存编号，-1为空槽位，槽位数为2的幂
+    std::vector<int32_t> slots;
+
+    /// @brief 编号对应的标识符
+    std::vector<std::string> names;
+
+    /// @brief 编号对应的哈希值，扩容时不必重新计算
+    std::vector<uint32_t> hashes;
+};
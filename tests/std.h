@@ -34,4 +34,7 @@ void putfloat(float a);
 void putfarray(int n, float a[]);
 void putf(char a[], ...);
 
+/* Profile counters written by --profile-generate builds */
+void __minic_prof_dump(int hash, int n, int counts[]);
+
 #endif // MINIC_STD_H
@@ -6,7 +6,7 @@ if [ $# -ne 2 ]; then
 fi
 
 # 生成ARM64汇编语言
-"$1/build/minic" -S -A -o "$1/tests/$2.s" "$1/tests/$2.c"
+"$1/build/minic" -S -t ARM64 -A -o "$1/tests/$2.s" "$1/tests/$2.c"
 
 # 交叉编译程序成ARM64程序
 aarch64-linux-gnu-gcc -march=armv8-a -g -static --include "$1/tests/std.h" -o "$1/tests/$2" "tests/$2.s" "$1/tests/std.c"
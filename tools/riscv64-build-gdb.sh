@@ -6,7 +6,7 @@ if [ $# -ne 2 ]; then
 fi
 
 # 交叉编译程序成RISCV64程序
-"$1/build/minic" -S -A -o "$1/tests/$2.s" "$1/tests/$2.c"
+"$1/build/minic" -S -t RISCV64 -A -o "$1/tests/$2.s" "$1/tests/$2.c"
 
 # 交叉编译程序成ARM32程序
 riscv64-linux-gnu-gcc -g -static --include "$1/tests/std.h" -o "$1/tests/$2" "tests/$2.s" "$1/tests/std.c"
@@ -0,0 +1,40 @@
+#!/bin/bash
+
+rundir="."
+casename="test1-1"
+
+if [ $# -gt 1 ]; then
+	rundir=$1
+	casename=$2
+elif [ $# -gt 0 ]; then
+	casename=$1
+fi
+
+echo "run host"
+
+# 使用gcc进行编译直接运行，作为参考结果
+if ! gcc -g --include "${rundir}/tests/std.h" -o "${rundir}/tests/${casename}-0" "${rundir}/tests/${casename}.c" "${rundir}/tests/std.c"
+then
+	exit 1
+fi
+
+"${rundir}/tests/${casename}-0"
+printf "\n%d\n" $?
+
+echo "native x86_64"
+
+# 生成x86-64汇编语言
+if ! "${rundir}/build/minic" -S -t X86_64 -c -o "${rundir}/tests/${casename}-x86_64.s" "${rundir}/tests/${casename}.c"
+then
+	exit 1
+fi
+
+# 本机编译成x86-64程序，不需要交叉编译器与qemu
+if ! gcc -g --include "${rundir}/tests/std.h" -o "${rundir}/tests/${casename}-x86_64" "${rundir}/tests/${casename}-x86_64.s" "${rundir}/tests/std.c"
+then
+	exit 1
+fi
+
+"${rundir}/tests/${casename}-x86_64"
+
+printf "\n%d\n" $?
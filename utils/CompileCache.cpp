@@ -0,0 +1,220 @@
+///
+/// @file CompileCache.cpp
+/// @brief 磁盘上的编译缓存的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <cinttypes>
+#include <cstdio>
+#include <filesystem>
+#include <system_error>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+#include "CompileCache.h"
+
+/// @brief 缓存格式的版本，缓存项的格式变化时修改，使旧的缓存项失效
+#define COMPILE_CACHE_FORMAT "1"
+
+///
+/// @brief 开启缓存
+/// @param dir 缓存目录，不存在时创建
+/// @param _compilerId 编译器标识，包括编译器版本以及影响输出的选项
+/// @return true：成功，false：目录创建失败
+///
+bool CompileCache::enable(const std::string & dir, const std::string & _compilerId)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    if (ec || !std::filesystem::is_directory(dir, ec)) {
+        return false;
+    }
+
+    cacheDir = dir;
+    compilerId = COMPILE_CACHE_FORMAT "|" + _compilerId;
+
+    return true;
+}
+
+///
+/// @brief 64位FNV-1a哈希
+/// @param data 数据
+/// @param size 字节数
+/// @param seed 初始值，用于连续计算多段数据的哈希
+/// @return 哈希值
+///
+uint64_t CompileCache::hash(const void * data, size_t size, uint64_t seed)
+{
+    const unsigned char * bytes = static_cast<const unsigned char *>(data);
+
+    uint64_t value = seed;
+    for (size_t k = 0; k < size; ++k) {
+        value ^= bytes[k];
+        value *= 0x100000001b3ULL;
+    }
+
+    return value;
+}
+
+///
+/// @brief 计算缓存项的键
+/// @param kind 缓存项的种类，如asm、ir、func
+/// @param content 确定缓存项内容的文本
+/// @return 键，十六进制的哈希值
+///
+std::string CompileCache::makeKey(const std::string & kind, const std::string & content) const
+{
+    // 两个不同的种子计算得到128位，降低不同内容碰撞的概率
+    uint64_t value[2];
+    for (int k = 0; k < 2; ++k) {
+        uint64_t seed = hash(&k, sizeof(k));
+        seed = hash(compilerId.data(), compilerId.size(), seed);
+        seed = hash(kind.data(), kind.size() + 1, seed);
+        value[k] = hash(content.data(), content.size(), seed);
+    }
+
+    char buf[40];
+    snprintf(buf, sizeof(buf), "%016" PRIx64 "%016" PRIx64, value[0], value[1]);
+
+    return kind + "-" + buf;
+}
+
+///
+/// @brief 缓存项对应的文件路径
+/// @param key 键
+///
+std::string CompileCache::entryPath(const std::string & key) const
+{
+    return (std::filesystem::path(cacheDir) / key).string();
+}
+
+///
+/// @brief 读取缓存项
+/// @param key 键
+/// @param data 缓存的内容
+/// @return true：命中，false：未命中
+///
+bool CompileCache::load(const std::string & key, std::string & data)
+{
+    if (isEnabled() && readFile(entryPath(key), data)) {
+        hits++;
+        return true;
+    }
+
+    misses++;
+    return false;
+}
+
+///
+/// @brief 保存缓存项，先写临时文件再改名，多个编译器进程同时写同一项时不会得到不完整的内容
+/// @param key 键
+/// @param data 要缓存的内容
+/// @return true：成功，false：失败
+///
+bool CompileCache::save(const std::string & key, const std::string & data)
+{
+    if (!isEnabled()) {
+        return false;
+    }
+
+    static std::atomic<uint32_t> tmpIndex{0};
+
+    std::string path = entryPath(key);
+    std::string tmpPath = path + ".tmp." + std::to_string(getpid()) + "." + std::to_string(tmpIndex++);
+
+    if (!writeFile(tmpPath, data)) {
+        return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, path, ec);
+    if (ec) {
+        std::filesystem::remove(tmpPath, ec);
+        return false;
+    }
+
+    return true;
+}
+
+///
+/// @brief 读取整个文件
+/// @param path 文件路径
+/// @param data 文件内容
+/// @return true：成功，false：失败
+///
+bool CompileCache::readFile(const std::string & path, std::string & data)
+{
+    FILE * fp = fopen(path.c_str(), "rb");
+    if (!fp) {
+        return false;
+    }
+
+    data.clear();
+
+    char buf[8192];
+    size_t len;
+    while ((len = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        data.append(buf, len);
+    }
+
+    bool ok = !ferror(fp);
+    fclose(fp);
+
+    return ok;
+}
+
+///
+/// @brief 写入整个文件
+/// @param path 文件路径
+/// @param data 文件内容
+/// @return true：成功，false：失败
+///
+bool CompileCache::writeFile(const std::string & path, const std::string & data)
+{
+    FILE * fp = fopen(path.c_str(), "wb");
+    if (!fp) {
+        return false;
+    }
+
+    bool ok = fwrite(data.data(), 1, data.size(), fp) == data.size();
+
+    if (fclose(fp) != 0) {
+        ok = false;
+    }
+
+    return ok;
+}
+
+///
+/// @brief 当前运行的编译器可执行文件的哈希值，编译器重新构建后缓存自动失效
+/// @return 哈希值的十六进制文本，获取不到可执行文件时为空
+///
+std::string CompileCache::executableHash()
+{
+#ifdef _WIN32
+    return "";
+#else
+    std::string data;
+    if (!readFile("/proc/self/exe", data)) {
+        return "";
+    }
+
+    char buf[20];
+    snprintf(buf, sizeof(buf), "%016" PRIx64, hash(data.data(), data.size()));
+
+    return buf;
+#endif
+}
@@ -0,0 +1,136 @@
+///
+/// @file CompileCache.h
+/// @brief 磁盘上的编译缓存，对应--cache-dir选项
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+///
+/// @brief 编译缓存。缓存项以内容的哈希值为键保存在缓存目录下，分两级：
+/// (1) 源文件级：键由源文件内容、编译器版本与影响输出的选项确定，命中时直接复制输出文件，
+///     不再执行前端与IR生成；
+/// (2) 函数级：键由函数的线性IR文本、全局变量声明及编译器版本与选项确定，命中时复用函数的汇编代码。
+///
+class CompileCache {
+
+public:
+    ///
+    /// @brief 开启缓存
+    /// @param dir 缓存目录，不存在时创建
+    /// @param compilerId 编译器标识，包括编译器版本以及影响输出的选项
+    /// @return true：成功，false：目录创建失败
+    ///
+    bool enable(const std::string & dir, const std::string & compilerId);
+
+    ///
+    /// @brief 是否开启了缓存
+    /// @return true：开启，false：未开启
+    ///
+    bool isEnabled() const
+    {
+        return !cacheDir.empty();
+    }
+
+    ///
+    /// @brief 计算缓存项的键
+    /// @param kind 缓存项的种类，如asm、ir、func
+    /// @param content 确定缓存项内容的文本
+    /// @return 键，十六进制的哈希值
+    ///
+    std::string makeKey(const std::string & kind, const std::string & content) const;
+
+    ///
+    /// @brief 读取缓存项
+    /// @param key 键
+    /// @param data 缓存的内容
+    /// @return true：命中，false：未命中
+    ///
+    bool load(const std::string & key, std::string & data);
+
+    ///
+    /// @brief 保存缓存项，先写临时文件再改名，多个编译器进程同时写同一项时不会得到不完整的内容
+    /// @param key 键
+    /// @param data 要缓存的内容
+    /// @return true：成功，false：失败
+    ///
+    bool save(const std::string & key, const std::string & data);
+
+    ///
+    /// @brief 获取命中次数
+    ///
+    uint32_t getHits() const
+    {
+        return hits;
+    }
+
+    ///
+    /// @brief 获取未命中次数
+    ///
+    uint32_t getMisses() const
+    {
+        return misses;
+    }
+
+    ///
+    /// @brief 64位FNV-1a哈希
+    /// @param data 数据
+    /// @param size 字节数
+    /// @param seed 初始值，用于连续计算多段数据的哈希
+    /// @return 哈希值
+    ///
+    static uint64_t hash(const void * data, size_t size, uint64_t seed = 0xcbf29ce484222325ULL);
+
+    ///
+    /// @brief 读取整个文件
+    /// @param path 文件路径
+    /// @param data 文件内容
+    /// @return true：成功，false：失败
+    ///
+    static bool readFile(const std::string & path, std::string & data);
+
+    ///
+    /// @brief 写入整个文件
+    /// @param path 文件路径
+    /// @param data 文件内容
+    /// @return true：成功，false：失败
+    ///
+    static bool writeFile(const std::string & path, const std::string & data);
+
+    ///
+    /// @brief 当前运行的编译器可执行文件的哈希值，编译器重新构建后缓存自动失效
+    /// @return 哈希值的十六进制文本，获取不到可执行文件时为空
+    ///
+    static std::string executableHash();
+
+private:
+    ///
+    /// @brief 缓存项对应的文件路径
+    /// @param key 键
+    ///
+    std::string entryPath(const std::string & key) const;
+
+    /// @brief 缓存目录，为空表示未开启
+    std::string cacheDir;
+
+    /// @brief 编译器标识
+    std::string compilerId;
+
+    /// @brief 命中次数，函数级缓存可能在多线程中访问
+    std::atomic<uint32_t> hits{0};
+
+    /// @brief 未命中次数
+    std::atomic<uint32_t> misses{0};
+};
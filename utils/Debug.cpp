@@ -0,0 +1,175 @@
+///
+/// @file Debug.cpp
+/// @brief 按类别开启的调试诊断输出的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <cstdarg>
+#include <cstdio>
+#include <mutex>
+
+#include "Debug.h"
+
+uint32_t gDebugCategories = 0;
+
+namespace {
+
+/// @brief 类别名与类别的对应关系
+struct DebugCategoryName {
+    const char * name;
+    uint32_t category;
+};
+
+const DebugCategoryName debugCategoryTable[] = {
+    {"stack-layout", DEBUG_STACK_LAYOUT},
+    {"isel", DEBUG_ISEL},
+    {"cache", DEBUG_CACHE},
+    {"code-size", DEBUG_CODE_SIZE},
+};
+
+/// @brief 保证多线程输出时各段不交错
+std::mutex debugOutputMutex;
+
+} // namespace
+
+///
+/// @brief 开启调试类别
+/// @param categories 逗号分隔的类别名，如stack-layout,isel，all代表全部
+/// @return true：成功，false：存在不认识的类别
+///
+bool debugEnable(const std::string & categories)
+{
+    size_t start = 0;
+
+    while (start <= categories.size()) {
+
+        size_t end = categories.find(',', start);
+        if (end == std::string::npos) {
+            end = categories.size();
+        }
+
+        std::string name = categories.substr(start, end - start);
+        start = end + 1;
+
+        if (name.empty()) {
+            continue;
+        }
+
+        if (name == "all") {
+            gDebugCategories = DEBUG_ALL;
+            continue;
+        }
+
+        bool found = false;
+        for (auto & item: debugCategoryTable) {
+            if (name == item.name) {
+                gDebugCategories |= item.category;
+                found = true;
+                break;
+            }
+        }
+
+        if (!found) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// @brief 所有类别名，逗号分隔，用于帮助信息
+/// @return 类别名
+///
+std::string debugCategoryNames()
+{
+    std::string names;
+    for (auto & item: debugCategoryTable) {
+        names += item.name;
+        names += ",";
+    }
+
+    return names + "all";
+}
+
+///
+/// @brief 按printf格式追加到字符串中
+/// @param str 追加的字符串
+/// @param fmt 格式
+///
+void debugAppend(std::string & str, const char * fmt, ...)
+{
+    char buf[1024];
+
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    if (len < 0) {
+        return;
+    }
+
+    if ((size_t) len < sizeof(buf)) {
+        str.append(buf, len);
+        return;
+    }
+
+    // 超长时按实际长度重新格式化
+    std::string longBuf(len + 1, '\0');
+    va_start(args, fmt);
+    vsnprintf(&longBuf[0], longBuf.size(), fmt, args);
+    va_end(args);
+
+    str.append(longBuf.c_str(), len);
+}
+
+///
+/// @brief 一次性输出一段调试信息到标准错误，每行前加类别名。多线程时各段之间不会交错
+/// @param category 调试类别
+/// @param text 调试信息
+///
+void debugOutput(uint32_t category, const std::string & text)
+{
+    if (text.empty()) {
+        return;
+    }
+
+    const char * prefix = "debug";
+    for (auto & item: debugCategoryTable) {
+        if (item.category & category) {
+            prefix = item.name;
+            break;
+        }
+    }
+
+    std::string out;
+    size_t start = 0;
+    while (start < text.size()) {
+        size_t end = text.find('\n', start);
+        if (end == std::string::npos) {
+            end = text.size() - 1;
+        }
+
+        out += "[";
+        out += prefix;
+        out += "] ";
+        out.append(text, start, end - start + 1);
+        if (text[end] != '\n') {
+            out += "\n";
+        }
+
+        start = end + 1;
+    }
+
+    std::lock_guard<std::mutex> lock(debugOutputMutex);
+    fwrite(out.data(), 1, out.size(), stderr);
+}
@@ -0,0 +1,105 @@
+///
+/// @file Debug.h
+/// @brief 按类别开启的调试诊断输出，对应--debug=类别选项
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/// @brief 栈帧布局：局部变量、数组、内存变量的栈内分配与冲突检查
+#define DEBUG_STACK_LAYOUT (1u << 0)
+
+/// @brief 指令选择：逐条IR指令的翻译过程
+#define DEBUG_ISEL (1u << 1)
+
+/// @brief 编译缓存：源文件与函数级缓存的命中情况
+#define DEBUG_CACHE (1u << 2)
+
+/// @brief 代码大小：Thumb-2模式下各函数代码大小的变化
+#define DEBUG_CODE_SIZE (1u << 3)
+
+/// @brief 全部类别
+#define DEBUG_ALL (~0u)
+
+/// @brief printf风格的格式串检查，仅GCC/Clang支持
+#if defined(__GNUC__)
+#define MINIC_PRINTF_FORMAT(fmtIndex, argIndex) __attribute__((format(printf, fmtIndex, argIndex)))
+#else
+#define MINIC_PRINTF_FORMAT(fmtIndex, argIndex)
+#endif
+
+///
+/// @brief 已开启的调试类别位图
+///
+extern uint32_t gDebugCategories;
+
+///
+/// @brief 调试类别是否开启。定义MINIC_DISABLE_DEBUG时恒为假，调试输出的代码在编译期即被删除
+/// @param category 调试类别
+/// @return true：开启，false：未开启
+///
+inline bool debugEnabled(uint32_t category)
+{
+#ifdef MINIC_DISABLE_DEBUG
+    (void) category;
+    return false;
+#else
+    return (gDebugCategories & category) != 0;
+#endif
+}
+
+///
+/// @brief 开启调试类别
+/// @param categories 逗号分隔的类别名，如stack-layout,isel，all代表全部
+/// @return true：成功，false：存在不认识的类别
+///
+bool debugEnable(const std::string & categories);
+
+///
+/// @brief 所有类别名，逗号分隔，用于帮助信息
+/// @return 类别名
+///
+std::string debugCategoryNames();
+
+///
+/// @brief 按printf格式追加到字符串中
+/// @param str 追加的字符串
+/// @param fmt 格式
+///
+void debugAppend(std::string & str, const char * fmt, ...) MINIC_PRINTF_FORMAT(2, 3);
+
+///
+/// @brief 一次性输出一段调试信息到标准错误，每行前加类别名。多线程时各段之间不会交错
+/// @param category 调试类别
+/// @param text 调试信息
+///
+void debugOutput(uint32_t category, const std::string & text);
+
+/// @brief 类别开启时立即输出一条调试信息，未开启时不会对参数求值
+#define minic_debug(category, fmt, args...)                                                                            \
+    do {                                                                                                               \
+        if (debugEnabled(category)) {                                                                                  \
+            std::string debug_buf;                                                                                     \
+            debugAppend(debug_buf, fmt, ##args);                                                                       \
+            debugOutput(category, debug_buf);                                                                          \
+        }                                                                                                              \
+    } while (0)
+
+/// @brief 类别开启时追加调试信息到buf中，之后通过debugOutput整段输出，未开启时不会对参数求值
+#define minic_debug_buf(category, buf, fmt, args...)                                                                   \
+    do {                                                                                                               \
+        if (debugEnabled(category)) {                                                                                  \
+            debugAppend(buf, fmt, ##args);                                                                             \
+        }                                                                                                              \
+    } while (0)
@@ -0,0 +1,167 @@
+///
+/// @file OutputStream.cpp
+/// @brief 带缓冲的文本输出流的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <cstdarg>
+#include <vector>
+
+#include "OutputStream.h"
+
+///
+/// @brief 输出到文件的构造函数
+/// @param _fp 文件指针，由调用者打开与关闭
+///
+OutputStream::OutputStream(FILE * _fp) : fp(_fp)
+{
+    buffer = new char[BUFFER_SIZE];
+}
+
+///
+/// @brief 输出到字符串的构造函数，内容追加到字符串的尾部
+/// @param _str 字符串
+///
+OutputStream::OutputStream(std::string & _str) : str(&_str)
+{}
+
+///
+/// @brief 析构函数，缓冲区的内容写入文件
+///
+OutputStream::~OutputStream()
+{
+    flush();
+
+    delete[] buffer;
+}
+
+///
+/// @brief 缓冲区的内容写入文件
+///
+void OutputStream::flush()
+{
+    if (fp && (used > 0)) {
+        fwrite(buffer, 1, used, fp);
+    }
+
+    used = 0;
+}
+
+///
+/// @brief 缓冲区放不下时的写入
+///
+void OutputStream::writeSlow(const char * data, size_t size)
+{
+    flush();
+
+    if (size >= (size_t) BUFFER_SIZE) {
+        // 比缓冲区还大的内容直接写入文件
+        fwrite(data, 1, size, fp);
+    } else {
+        memcpy(buffer, data, size);
+        used = (int32_t) size;
+    }
+}
+
+///
+/// @brief 格式化写入，格式同printf
+/// @param fmt 格式
+///
+void OutputStream::printf(const char * fmt, ...)
+{
+    va_list args;
+
+    if (str) {
+        // 先尝试格式化到栈上的小缓冲区，放不下时再按实际长度格式化
+        char small[256];
+
+        va_start(args, fmt);
+        int len = vsnprintf(small, sizeof(small), fmt, args);
+        va_end(args);
+
+        if (len < 0) {
+            return;
+        }
+
+        if (len < (int) sizeof(small)) {
+            str->append(small, len);
+        } else {
+            size_t oldSize = str->size();
+            str->resize(oldSize + len + 1);
+
+            va_start(args, fmt);
+            vsnprintf(&(*str)[oldSize], len + 1, fmt, args);
+            va_end(args);
+
+            str->resize(oldSize + len);
+        }
+
+        return;
+    }
+
+    // 直接格式化到缓冲区的剩余空间
+    va_start(args, fmt);
+    int len = vsnprintf(buffer + used, BUFFER_SIZE - used, fmt, args);
+    va_end(args);
+
+    if (len < 0) {
+        return;
+    }
+
+    if (len < BUFFER_SIZE - used) {
+        used += len;
+        return;
+    }
+
+    // 剩余空间放不下，清空缓冲区后重新格式化
+    flush();
+
+    if (len < BUFFER_SIZE) {
+        va_start(args, fmt);
+        vsnprintf(buffer, BUFFER_SIZE, fmt, args);
+        va_end(args);
+
+        used = len;
+    } else {
+        std::vector<char> big(len + 1);
+
+        va_start(args, fmt);
+        vsnprintf(big.data(), big.size(), fmt, args);
+        va_end(args);
+
+        fwrite(big.data(), 1, len, fp);
+    }
+}
+
+///
+/// @brief 输出整数
+/// @param value 整数值
+///
+OutputStream & OutputStream::operator<<(int64_t value)
+{
+    char buf[24];
+    char * end = buf + sizeof(buf);
+    char * p = end;
+
+    uint64_t uvalue = value < 0 ? 0 - (uint64_t) value : (uint64_t) value;
+    do {
+        *--p = (char) ('0' + uvalue % 10);
+        uvalue /= 10;
+    } while (uvalue != 0);
+
+    if (value < 0) {
+        *--p = '-';
+    }
+
+    write(p, end - p);
+
+    return *this;
+}
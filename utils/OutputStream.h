@@ -0,0 +1,122 @@
+///
+/// @file OutputStream.h
+/// @brief 带缓冲的文本输出流，IR与汇编的文本输出都经过它写入
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+///
+/// @brief 文本输出流。输出到文件时先写入固定大小的缓冲区，满了才调用fwrite；
+/// 输出到字符串时直接追加到字符串尾部。各种写入操作都直接写到缓冲区，不产生临时字符串
+///
+class OutputStream {
+
+public:
+    ///
+    /// @brief 输出到文件的构造函数
+    /// @param fp 文件指针，由调用者打开与关闭
+    ///
+    explicit OutputStream(FILE * fp);
+
+    ///
+    /// @brief 输出到字符串的构造函数，内容追加到字符串的尾部
+    /// @param str 字符串
+    ///
+    explicit OutputStream(std::string & str);
+
+    ///
+    /// @brief 析构函数，缓冲区的内容写入文件
+    ///
+    ~OutputStream();
+
+    OutputStream(const OutputStream &) = delete;
+    OutputStream & operator=(const OutputStream &) = delete;
+
+    ///
+    /// @brief 写入指定长度的内容
+    /// @param data 内容
+    /// @param size 字节数
+    ///
+    void write(const char * data, size_t size)
+    {
+        if (str) {
+            str->append(data, size);
+        } else if (size <= (size_t) (BUFFER_SIZE - used)) {
+            memcpy(buffer + used, data, size);
+            used += (int32_t) size;
+        } else {
+            writeSlow(data, size);
+        }
+    }
+
+    ///
+    /// @brief 格式化写入，格式同printf
+    /// @param fmt 格式
+    ///
+    void printf(const char * fmt, ...);
+
+    ///
+    /// @brief 缓冲区的内容写入文件
+    ///
+    void flush();
+
+    OutputStream & operator<<(char ch)
+    {
+        write(&ch, 1);
+        return *this;
+    }
+
+    OutputStream & operator<<(const char * s)
+    {
+        write(s, strlen(s));
+        return *this;
+    }
+
+    OutputStream & operator<<(const std::string & s)
+    {
+        write(s.data(), s.size());
+        return *this;
+    }
+
+    OutputStream & operator<<(int64_t value);
+
+    OutputStream & operator<<(int32_t value)
+    {
+        return *this << (int64_t) value;
+    }
+
+private:
+    ///
+    /// @brief 缓冲区放不下时的写入
+    ///
+    void writeSlow(const char * data, size_t size);
+
+    /// @brief 缓冲区大小
+    static const int32_t BUFFER_SIZE = 64 * 1024;
+
+    /// @brief 输出的文件，输出到字符串时为空
+    FILE * fp = nullptr;
+
+    /// @brief 输出的字符串，输出到文件时为空
+    std::string * str = nullptr;
+
+    /// @brief 缓冲区，输出到字符串时不使用
+    char * buffer = nullptr;
+
+    /// @brief 缓冲区已使用的字节数
+    int32_t used = 0;
+};
@@ -0,0 +1,145 @@
+///
+/// @file SlabAllocator.cpp
+/// @brief 小对象的分块内存分配，用于大量创建和释放的IR对象
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "SlabAllocator.h"
+
+/// @brief 大小档次的粒度，也是对齐字节数
+#define SLAB_GRANULE 16
+
+/// @brief 最大档次的字节数
+#define SLAB_MAX_SIZE 512
+
+/// @brief 大小档次的个数
+#define SLAB_CLASSES (SLAB_MAX_SIZE / SLAB_GRANULE)
+
+/// @brief 每次向系统申请的内存块大小
+#define SLAB_CHUNK_SIZE (64 * 1024)
+
+namespace {
+
+/// @brief 空闲链表的节点，借用已释放对象的内存
+struct FreeNode {
+    FreeNode * next;
+};
+
+///
+/// @brief 所有线程申请的内存块，程序退出时统一释放
+///
+class ChunkList {
+
+public:
+    ~ChunkList()
+    {
+        for (auto chunk: chunks) {
+            ::operator delete(chunk, std::align_val_t(SLAB_GRANULE));
+        }
+    }
+
+    /// @brief 申请一个内存块，按档次粒度对齐。MSVC没有std::aligned_alloc，采用对齐的operator new，失败时抛出异常
+    char * newChunk()
+    {
+        void * chunk = ::operator new(SLAB_CHUNK_SIZE, std::align_val_t(SLAB_GRANULE));
+
+        std::lock_guard<std::mutex> lock(mutex);
+        chunks.push_back(chunk);
+
+        return static_cast<char *>(chunk);
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<void *> chunks;
+};
+
+ChunkList & chunkList()
+{
+    static ChunkList list;
+    return list;
+}
+
+///
+/// @brief 每个线程的分配状态，不需要加锁
+///
+struct ThreadCache {
+    /// @brief 各档次的空闲链表
+    FreeNode * freeLists[SLAB_CLASSES] = {};
+
+    /// @brief 当前内存块中未切分部分的起始位置
+    char * cursor = nullptr;
+
+    /// @brief 当前内存块的结束位置
+    char * limit = nullptr;
+};
+
+thread_local ThreadCache threadCache;
+
+} // namespace
+
+/// @brief 分配内存
+/// @param size 字节数
+/// @return void* 内存，16字节对齐
+void * SlabAllocator::allocate(std::size_t size)
+{
+    if ((size == 0) || (size > SLAB_MAX_SIZE)) {
+        return ::operator new(size);
+    }
+
+    std::size_t index = (size - 1) / SLAB_GRANULE;
+    ThreadCache & cache = threadCache;
+
+    FreeNode * node = cache.freeLists[index];
+    if (node) {
+        cache.freeLists[index] = node->next;
+        return node;
+    }
+
+    std::size_t rounded = (index + 1) * SLAB_GRANULE;
+    if (cache.cursor + rounded > cache.limit) {
+        // 当前内存块剩余部分不足一个对象时丢弃，换一个新块
+        cache.cursor = chunkList().newChunk();
+        cache.limit = cache.cursor + SLAB_CHUNK_SIZE;
+    }
+
+    void * p = cache.cursor;
+    cache.cursor += rounded;
+
+    return p;
+}
+
+/// @brief 释放内存
+/// @param p allocate返回的内存
+/// @param size 分配时的字节数
+void SlabAllocator::deallocate(void * p, std::size_t size) noexcept
+{
+    if (!p) {
+        return;
+    }
+
+    if ((size == 0) || (size > SLAB_MAX_SIZE)) {
+        ::operator delete(p);
+        return;
+    }
+
+    // 其它线程分配的对象同样挂到本线程的空闲链表中
+    std::size_t index = (size - 1) / SLAB_GRANULE;
+    ThreadCache & cache = threadCache;
+
+    auto * node = static_cast<FreeNode *>(p);
+    node->next = cache.freeLists[index];
+    cache.freeLists[index] = node;
+}
@@ -0,0 +1,41 @@
+///
+/// @file SlabAllocator.h
+/// @brief 小对象的分块内存分配，用于大量创建和释放的IR对象
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstddef>
+
+///
+/// @brief 分块分配器。按16字节对齐划分大小档次，每个档次从64KB的内存块中连续切分，
+/// 释放的内存挂到本线程该档次的空闲链表中复用，内存块直到程序退出才归还。
+/// 与逐个malloc相比没有每个对象的分配头部，连续创建的对象在内存中也相邻。
+/// 超过最大档次的请求直接使用operator new
+///
+class SlabAllocator {
+
+public:
+    ///
+    /// @brief 分配内存
+    /// @param size 字节数
+    /// @return void* 内存，16字节对齐
+    ///
+    static void * allocate(std::size_t size);
+
+    ///
+    /// @brief 释放内存
+    /// @param p allocate返回的内存
+    /// @param size 分配时的字节数
+    ///
+    static void deallocate(void * p, std::size_t size) noexcept;
+};
@@ -0,0 +1,344 @@
+///
+/// @file TimeReport.cpp
+/// @brief 编译各阶段的耗时与内存统计的实现
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include "TimeReport.h"
+
+namespace {
+
+///
+/// @brief 一条统计记录
+///
+struct TimeRecord {
+    std::string name;
+    std::string funcName;
+    int32_t tid;
+    int64_t startUs;
+    int64_t wallUs;
+    int64_t cpuUs;
+    int64_t peakRssKB;
+    uint64_t allocs;
+};
+
+/// @brief 所有的统计记录，函数级的记录可能来自多个线程
+std::vector<TimeRecord> gRecords;
+std::mutex gRecordsMutex;
+
+/// @brief Chrome trace-event输出文件
+std::string gTraceFile;
+
+/// @brief 统计的时间起点
+std::chrono::steady_clock::time_point gStartTime;
+
+/// @brief 整个进程的内存分配次数
+std::atomic<uint64_t> gAllocCount{0};
+
+/// @brief 当前线程的内存分配次数
+thread_local uint64_t tAllocCount = 0;
+
+/// @brief 线程编号，用于trace输出
+std::atomic<int32_t> gNextTid{0};
+thread_local int32_t tTid = -1;
+
+int32_t currentTid()
+{
+    if (tTid < 0) {
+        tTid = gNextTid++;
+    }
+    return tTid;
+}
+
+/// @brief JSON字符串转义
+std::string jsonEscape(const std::string & str)
+{
+    std::string ret;
+    for (char ch: str) {
+        if (ch == '"' || ch == '\\') {
+            ret += '\\';
+        }
+        ret += ch;
+    }
+    return ret;
+}
+
+/// @brief 微秒转成毫秒
+double toMs(int64_t us)
+{
+    return (double) us / 1000.0;
+}
+
+} // namespace
+
+bool TimeReport::enabled = false;
+
+///
+/// @brief 开启统计
+/// @param traceFile Chrome trace-event格式的JSON输出文件，为空则不输出
+///
+void TimeReport::enable(const std::string & traceFile)
+{
+    gTraceFile = traceFile;
+    gStartTime = std::chrono::steady_clock::now();
+    enabled = true;
+}
+
+///
+/// @brief 当前的墙钟时间，单位微秒，以开启统计的时刻为起点
+///
+int64_t TimeReport::nowUs()
+{
+    auto elapsed = std::chrono::steady_clock::now() - gStartTime;
+    return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+///
+/// @brief 进程或当前线程已消耗的CPU时间，单位微秒
+/// @param thread true：当前线程，false：整个进程
+///
+int64_t TimeReport::cpuUs(bool thread)
+{
+#ifndef _WIN32
+    struct timespec ts;
+    if (clock_gettime(thread ? CLOCK_THREAD_CPUTIME_ID : CLOCK_PROCESS_CPUTIME_ID, &ts) == 0) {
+        return (int64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+    }
+#endif
+    (void) thread;
+    return (int64_t) std::clock() * 1000000 / CLOCKS_PER_SEC;
+}
+
+///
+/// @brief 进程的峰值常驻内存，单位KB
+///
+int64_t TimeReport::peakRssKB()
+{
+#ifndef _WIN32
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        // Linux下ru_maxrss的单位为KB
+        return usage.ru_maxrss;
+    }
+#endif
+    return 0;
+}
+
+///
+/// @brief 内存分配次数
+/// @param thread true：当前线程，false：整个进程
+///
+uint64_t TimeReport::allocCount(bool thread)
+{
+    return thread ? tAllocCount : gAllocCount.load(std::memory_order_relaxed);
+}
+
+///
+/// @brief 累计一次内存分配，由替换的operator new在开启统计时调用
+///
+void TimeReport::countAlloc()
+{
+    tAllocCount++;
+    gAllocCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+///
+/// @brief 记录一个已完成的统计区间，由TimeScope调用
+///
+void TimeReport::record(const std::string & name,
+                        const std::string & funcName,
+                        int64_t startUs,
+                        int64_t wallUs,
+                        int64_t cpuUs,
+                        int64_t peakRssKB,
+                        uint64_t allocs)
+{
+    int32_t tid = currentTid();
+
+    std::lock_guard<std::mutex> lock(gRecordsMutex);
+    gRecords.push_back({name, funcName, tid, startUs, wallUs, cpuUs, peakRssKB, allocs});
+}
+
+///
+/// @brief 以表格形式输出统计结果
+/// @param fp 输出的文件
+///
+void TimeReport::print(FILE * fp)
+{
+    if (!enabled) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(gRecordsMutex);
+
+    fprintf(fp, "===-------------------------------------------------------------------------===\n");
+    fprintf(fp, "                          MiniC time report\n");
+    fprintf(fp, "===-------------------------------------------------------------------------===\n");
+
+    // 编译阶段，按发生的次序输出
+    fprintf(fp, "%-32s %12s %12s %14s %12s\n", "phase", "wall(ms)", "cpu(ms)", "peak rss(KB)", "allocs");
+    for (auto & rec: gRecords) {
+        if (rec.funcName.empty()) {
+            fprintf(fp,
+                    "%-32s %12.3f %12.3f %14lld %12llu\n",
+                    rec.name.c_str(),
+                    toMs(rec.wallUs),
+                    toMs(rec.cpuUs),
+                    (long long) rec.peakRssKB,
+                    (unsigned long long) rec.allocs);
+        }
+    }
+
+    // 函数级的处理，按函数汇总后按墙钟时间从大到小输出
+    std::map<std::string, std::vector<const TimeRecord *>> funcRecords;
+    for (auto & rec: gRecords) {
+        if (!rec.funcName.empty()) {
+            funcRecords[rec.funcName].push_back(&rec);
+        }
+    }
+
+    if (funcRecords.empty()) {
+        return;
+    }
+
+    std::vector<std::pair<int64_t, std::string>> funcOrder;
+    for (auto & item: funcRecords) {
+        int64_t total = 0;
+        for (auto rec: item.second) {
+            total += rec->wallUs;
+        }
+        funcOrder.emplace_back(total, item.first);
+    }
+    std::sort(funcOrder.begin(), funcOrder.end(), [](auto & a, auto & b) {
+        return a.first != b.first ? a.first > b.first : a.second < b.second;
+    });
+
+    fprintf(fp, "\n%-24s %-24s %12s %12s %12s\n", "function", "phase", "wall(ms)", "cpu(ms)", "allocs");
+    for (auto & item: funcOrder) {
+        int64_t cpuTotal = 0;
+        uint64_t allocTotal = 0;
+        for (auto rec: funcRecords[item.second]) {
+            fprintf(fp,
+                    "%-24s %-24s %12.3f %12.3f %12llu\n",
+                    item.second.c_str(),
+                    rec->name.c_str(),
+                    toMs(rec->wallUs),
+                    toMs(rec->cpuUs),
+                    (unsigned long long) rec->allocs);
+            cpuTotal += rec->cpuUs;
+            allocTotal += rec->allocs;
+        }
+        fprintf(fp,
+                "%-24s %-24s %12.3f %12.3f %12llu\n",
+                item.second.c_str(),
+                "<total>",
+                toMs(item.first),
+                toMs(cpuTotal),
+                (unsigned long long) allocTotal);
+    }
+}
+
+///
+/// @brief 输出Chrome trace-event格式的JSON文件，可在chrome://tracing或Perfetto中查看
+/// @return true：成功或不需要输出，false：文件打开失败
+///
+bool TimeReport::writeTrace()
+{
+    if (!enabled || gTraceFile.empty()) {
+        return true;
+    }
+
+    FILE * fp = fopen(gTraceFile.c_str(), "w");
+    if (!fp) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(gRecordsMutex);
+
+    fprintf(fp, "{\"traceEvents\":[\n");
+
+    bool first = true;
+    for (auto & rec: gRecords) {
+        fprintf(fp,
+                "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%lld,\"dur\":%lld,"
+                "\"args\":{\"function\":\"%s\",\"cpu_us\":%lld,\"peak_rss_kb\":%lld,\"allocs\":%llu}}",
+                first ? "" : ",\n",
+                jsonEscape(rec.name).c_str(),
+                rec.funcName.empty() ? "phase" : "function",
+                rec.tid,
+                (long long) rec.startUs,
+                (long long) rec.wallUs,
+                jsonEscape(rec.funcName).c_str(),
+                (long long) rec.cpuUs,
+                (long long) rec.peakRssKB,
+                (unsigned long long) rec.allocs);
+        first = false;
+    }
+
+    fprintf(fp, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    fclose(fp);
+
+    return true;
+}
+
+///
+/// @brief 开始一个统计区间
+/// @param name 阶段名
+/// @param funcName 函数名，可为空
+///
+TimeScope::TimeScope(const char * _name, const std::string & _funcName)
+    : active(TimeReport::isEnabled()), name(_name)
+{
+    if (!active) {
+        return;
+    }
+
+    funcName = _funcName;
+
+    bool thread = !funcName.empty();
+    startAllocs = TimeReport::allocCount(thread);
+    startCpuUs = TimeReport::cpuUs(thread);
+    startUs = TimeReport::nowUs();
+}
+
+///
+/// @brief 结束统计区间并记录
+///
+TimeScope::~TimeScope()
+{
+    if (!active) {
+        return;
+    }
+
+    int64_t endUs = TimeReport::nowUs();
+    bool thread = !funcName.empty();
+
+    TimeReport::record(name,
+                       funcName,
+                       startUs,
+                       endUs - startUs,
+                       TimeReport::cpuUs(thread) - startCpuUs,
+                       TimeReport::peakRssKB(),
+                       TimeReport::allocCount(thread) - startAllocs);
+}
@@ -0,0 +1,141 @@
+///
+/// @file TimeReport.h
+/// @brief 编译各阶段的耗时与内存统计，对应--time-report选项
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+///
+/// @brief 编译统计报告，记录各阶段及各函数的墙钟时间、CPU时间、峰值内存以及内存分配次数
+/// 没有开启时所有的记录操作只做一次布尔判断，不产生额外开销
+///
+class TimeReport {
+
+public:
+    ///
+    /// @brief 开启统计
+    /// @param traceFile Chrome trace-event格式的JSON输出文件，为空则不输出
+    ///
+    static void enable(const std::string & traceFile = "");
+
+    ///
+    /// @brief 是否开启了统计
+    /// @return true：开启，false：未开启
+    ///
+    static bool isEnabled()
+    {
+        return enabled;
+    }
+
+    ///
+    /// @brief 以表格形式输出统计结果
+    /// @param fp 输出的文件
+    ///
+    static void print(FILE * fp);
+
+    ///
+    /// @brief 输出Chrome trace-event格式的JSON文件，可在chrome://tracing或Perfetto中查看
+    /// @return true：成功或不需要输出，false：文件打开失败
+    ///
+    static bool writeTrace();
+
+    ///
+    /// @brief 记录一个已完成的统计区间，由TimeScope调用
+    ///
+    static void record(const std::string & name,
+                       const std::string & funcName,
+                       int64_t startUs,
+                       int64_t wallUs,
+                       int64_t cpuUs,
+                       int64_t peakRssKB,
+                       uint64_t allocs);
+
+    ///
+    /// @brief 当前的墙钟时间，单位微秒，以开启统计的时刻为起点
+    ///
+    static int64_t nowUs();
+
+    ///
+    /// @brief 进程或当前线程已消耗的CPU时间，单位微秒
+    /// @param thread true：当前线程，false：整个进程
+    ///
+    static int64_t cpuUs(bool thread);
+
+    ///
+    /// @brief 进程的峰值常驻内存，单位KB
+    ///
+    static int64_t peakRssKB();
+
+    ///
+    /// @brief 内存分配次数
+    /// @param thread true：当前线程，false：整个进程
+    ///
+    static uint64_t allocCount(bool thread);
+
+    ///
+    /// @brief 累计一次内存分配，由替换的operator new在开启统计时调用
+    ///
+    static void countAlloc();
+
+private:
+    ///
+    /// @brief 是否开启统计
+    ///
+    static bool enabled;
+};
+
+///
+/// @brief 统计区间，构造时开始计时，析构时记录。
+/// 不指定函数名时为编译阶段，统计整个进程的CPU时间与分配次数；
+/// 指定函数名时为函数内的处理，函数可能在工作线程中处理，因此统计当前线程的CPU时间与分配次数
+///
+class TimeScope {
+
+public:
+    ///
+    /// @brief 开始一个统计区间
+    /// @param name 阶段名
+    /// @param funcName 函数名，可为空
+    ///
+    explicit TimeScope(const char * name, const std::string & funcName = "");
+
+    ///
+    /// @brief 结束统计区间并记录
+    ///
+    ~TimeScope();
+
+    TimeScope(const TimeScope &) = delete;
+    TimeScope & operator=(const TimeScope &) = delete;
+
+private:
+    /// @brief 是否记录，构造时确定
+    bool active;
+
+    /// @brief 阶段名
+    const char * name;
+
+    /// @brief 函数名
+    std::string funcName;
+
+    /// @brief 开始时的墙钟时间
+    int64_t startUs = 0;
+
+    /// @brief 开始时的CPU时间
+    int64_t startCpuUs = 0;
+
+    /// @brief 开始时的分配次数
+    uint64_t startAllocs = 0;
+};
@@ -0,0 +1,61 @@
+///
+/// @file TimeReportAlloc.cpp
+/// @brief 替换全局的operator new/delete，为--time-report统计内存分配次数
+/// @version 1.0
+/// @date 2026-10-16
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-16 <td>1.0     <td>        <td>新建
+/// </table>
+///
+#include <cstdlib>
+#include <new>
+
+#include "TimeReport.h"
+
+// 没有开启统计时只多一次布尔判断
+// 对应的operator delete同样需要替换，保证与malloc/free配对
+// 单独放在一个文件中，避免与使用容器的代码内联后产生new/delete不匹配的误报
+
+void * operator new(std::size_t size)
+{
+    if (TimeReport::isEnabled()) {
+        TimeReport::countAlloc();
+    }
+
+    void * p = std::malloc(size ? size : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+
+    return p;
+}
+
+void * operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void * p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void * p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void * p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void * p, std::size_t) noexcept
+{
+    std::free(p);
+}